@@ -38,6 +38,9 @@ DSL_1K_HD_HEIGHT  = 1080
 DSL_PIPELINE_LINK_METHOD_BY_POSITION = 0
 DSL_PIPELINE_LINK_METHOD_BY_ADD_ORDER = 1
 
+DSL_PIPELINE_SCHEDULE_PRIORITY_HIGHEST = 0
+DSL_PIPELINE_SCHEDULER_DEFAULT_PERIOD = 1000
+
 DSL_PAD_SINK = 0
 DSL_PAD_SRC = 1
 
@@ -70,6 +73,24 @@ DSL_NVBUF_MEM_TYPE_CUDA_DEVICE   = 2
 DSL_NVBUF_MEM_TYPE_CUDA_UNIFIED  = 3
 DSL_NVBUF_MEM_TYPE_SURFACE_ARRAY = 4
 
+DSL_MEMORY_TAG_TRACKED_OBJECTS = 0
+DSL_MEMORY_TAG_TRACE_HISTORY = 1
+DSL_MEMORY_TAG_DISPLAY_TEXT = 2
+DSL_MEMORY_TAG_FILE_ACTIONS = 3
+DSL_MEMORY_TAG_MAILER = 4
+DSL_MEMORY_TAG_MESSAGE_META = 5
+DSL_MEMORY_TAG_FRAME_SCRATCH = 6
+
+DSL_ODE_COUNTER_TYPE_GLOBAL = 0
+DSL_ODE_COUNTER_TYPE_TRIGGER = 1
+DSL_ODE_COUNTER_TYPE_ACTION = 2
+DSL_ODE_COUNTER_TYPE_ACCUMULATOR = 3
+
+DSL_ODE_STATS_METRIC_COUNT = 0
+DSL_ODE_STATS_METRIC_CONFIDENCE = 1
+DSL_ODE_STATS_METRIC_WIDTH = 2
+DSL_ODE_STATS_METRIC_HEIGHT = 3
+
 # DSL Stream Format Types
 DSL_STREAM_FORMAT_BYTE = 2
 DSL_STREAM_FORMAT_TIME = 3
@@ -224,6 +245,19 @@ DSL_HEAT_MAP_LEGEND_LOCATION_LEFT = 3
 DSL_CAPTURE_TYPE_OBJECT = 0
 DSL_CAPTURE_TYPE_FRAME = 1
 
+DSL_FRAME_CAPTURE_NEXT_FRAME = 0xFFFFFFFFFFFFFFFF
+
+DSL_FRAME_CAPTURE_OUTPUT_FILE = 0
+DSL_FRAME_CAPTURE_OUTPUT_BUFFER = 1
+
+DSL_FRAME_CAPTURE_STATUS_COMPLETE = 0
+DSL_FRAME_CAPTURE_STATUS_EXPIRED = 1
+DSL_FRAME_CAPTURE_STATUS_MISSED = 2
+DSL_FRAME_CAPTURE_STATUS_FAILED = 3
+DSL_FRAME_CAPTURE_STATUS_CANCELED = 4
+
+DSL_FRAME_CAPTURE_DEFAULT_WORKERS = 1
+
 DSL_ODE_TRIGGER_LIMIT_NONE = 0
 DSL_ODE_TRIGGER_LIMIT_ONE = 1
 
@@ -337,6 +371,58 @@ class dsl_capture_info(Structure):
         ('width', c_uint),
         ('height', c_uint)]
 
+class dsl_media_info(Structure):
+    _fields_ = [
+        ('width', c_uint),
+        ('height', c_uint),
+        ('fps_n', c_uint),
+        ('fps_d', c_uint)]
+
+class dsl_memory_stats(Structure):
+    _fields_ = [
+        ('live_bytes', c_uint64),
+        ('peak_bytes', c_uint64),
+        ('allocations', c_uint64),
+        ('frees', c_uint64),
+        ('allocated_bytes', c_uint64),
+        ('allocation_rate', c_double)]
+
+class dsl_ode_counter_info(Structure):
+    _fields_ = [
+        ('name', c_wchar_p),
+        ('type', c_uint),
+        ('events', c_uint64),
+        ('frames', c_uint64),
+        ('occurrences', c_uint64)]
+
+class dsl_ode_stats(Structure):
+    _fields_ = [
+        ('source_id', c_uint),
+        ('class_id', c_uint),
+        ('metric', c_uint),
+        ('window_end_frame', c_uint64),
+        ('count', c_uint64),
+        ('mean', c_double),
+        ('variance', c_double),
+        ('min', c_double),
+        ('max', c_double),
+        ('p50', c_double),
+        ('p90', c_double),
+        ('p99', c_double)]
+
+class dsl_frame_capture_result(Structure):
+    _fields_ = [
+        ('request_id', c_uint64),
+        ('status', c_uint),
+        ('frame_number', c_uint64),
+        ('source_id', c_uint),
+        ('filename', c_wchar_p),
+        ('dirpath', c_wchar_p),
+        ('data', POINTER(c_uint8)),
+        ('size', c_uint64),
+        ('width', c_uint),
+        ('height', c_uint)]
+
 class dsl_rtsp_connection_data(Structure):
     _fields_ = [
         ('is_connected', c_bool),
@@ -478,6 +564,10 @@ DSL_STATE_CHANGE_LISTENER = \
 DSL_EOS_LISTENER = \
     CFUNCTYPE(None, c_void_p)
 
+# dsl_file_complete_listener_cb
+DSL_FILE_COMPLETE_LISTENER = \
+    CFUNCTYPE(None, c_wchar_p, c_wchar_p, c_uint64, c_void_p)
+
 # dsl_error_message_handler_cb
 DSL_ERROR_MESSAGE_HANDLER = \
     CFUNCTYPE(None, c_wchar_p, c_wchar_p, c_void_p)
@@ -506,6 +596,14 @@ DSL_RECORD_CLIENT_LISTNER = \
 DSL_CAPTURE_COMPLETE_LISTENER = \
     CFUNCTYPE(None, POINTER(dsl_capture_info), c_void_p)
 
+# dsl_info_media_probe_handler_cb
+DSL_INFO_MEDIA_PROBE_HANDLER = \
+    CFUNCTYPE(None, c_wchar_p, c_uint, POINTER(dsl_media_info), c_void_p)
+
+# dsl_sink_frame_capture_complete_cb
+DSL_SINK_FRAME_CAPTURE_COMPLETE_HANDLER = \
+    CFUNCTYPE(None, POINTER(dsl_frame_capture_result), c_void_p)
+
 # dsl_player_termination_event_listener_cb
 DSL_PLAYER_TERMINATION_EVENT_LISTENER = \
     CFUNCTYPE(None, c_void_p)
@@ -1574,6 +1672,55 @@ def dsl_ode_action_enabled_set(name, enabled):
     result =_dsl.dsl_ode_action_enabled_set(name, enabled)
     return int(result)
 
+##
+## dsl_ode_action_dedup_get()
+##
+_dsl.dsl_ode_action_dedup_get.argtypes = [c_wchar_p, 
+    POINTER(c_bool), POINTER(c_uint), POINTER(c_bool)]
+_dsl.dsl_ode_action_dedup_get.restype = c_uint
+def dsl_ode_action_dedup_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    window = c_uint(0)
+    fan_in = c_bool(0)
+    result =_dsl.dsl_ode_action_dedup_get(name, 
+        DSL_BOOL_P(enabled), DSL_UINT_P(window), DSL_BOOL_P(fan_in))
+    return int(result), enabled.value, window.value, fan_in.value
+
+##
+## dsl_ode_action_dedup_set()
+##
+_dsl.dsl_ode_action_dedup_set.argtypes = [c_wchar_p, c_bool, c_uint, c_bool]
+_dsl.dsl_ode_action_dedup_set.restype = c_uint
+def dsl_ode_action_dedup_set(name, enabled, window, fan_in):
+    global _dsl
+    result =_dsl.dsl_ode_action_dedup_set(name, enabled, window, fan_in)
+    return int(result)
+
+##
+## dsl_ode_action_summary_get()
+##
+_dsl.dsl_ode_action_summary_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_ode_action_summary_get.restype = c_uint
+def dsl_ode_action_summary_get(name):
+    global _dsl
+    interval = c_uint(0)
+    samples = c_uint(0)
+    result =_dsl.dsl_ode_action_summary_get(name, 
+        DSL_UINT_P(interval), DSL_UINT_P(samples))
+    return int(result), interval.value, samples.value
+
+##
+## dsl_ode_action_summary_set()
+##
+_dsl.dsl_ode_action_summary_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_ode_action_summary_set.restype = c_uint
+def dsl_ode_action_summary_set(name, interval, samples):
+    global _dsl
+    result =_dsl.dsl_ode_action_summary_set(name, interval, samples)
+    return int(result)
+
 ##
 ## dsl_ode_action_enabled_state_change_listener_add()
 ##
@@ -1912,6 +2059,32 @@ def dsl_ode_trigger_cross_view_settings_set(name, enabled, color, line_width):
         enabled, color, line_width)
     return int(result) 
 
+##
+## dsl_ode_trigger_cross_view_lod_settings_get()
+##
+_dsl.dsl_ode_trigger_cross_view_lod_settings_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_ode_trigger_cross_view_lod_settings_get.restype = c_uint
+def dsl_ode_trigger_cross_view_lod_settings_get(name):
+    global _dsl
+    tolerance = c_uint(0)
+    max_traces = c_uint(0)
+    result =_dsl.dsl_ode_trigger_cross_view_lod_settings_get(name, 
+        DSL_UINT_P(tolerance), DSL_UINT_P(max_traces))
+    return int(result), tolerance.value, max_traces.value
+
+##
+## dsl_ode_trigger_cross_view_lod_settings_set()
+##
+_dsl.dsl_ode_trigger_cross_view_lod_settings_set.argtypes = [c_wchar_p, 
+    c_uint, c_uint]
+_dsl.dsl_ode_trigger_cross_view_lod_settings_set.restype = c_uint
+def dsl_ode_trigger_cross_view_lod_settings_set(name, tolerance, max_traces):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_cross_view_lod_settings_set(name, 
+        tolerance, max_traces)
+    return int(result) 
+
 ##
 ## dsl_ode_trigger_persistence_new()
 ##
@@ -1950,6 +2123,31 @@ def dsl_ode_trigger_persistence_range_set(name, minimum, maximum):
         minimum, maximum)
     return int(result)
 
+##
+## dsl_ode_trigger_speed_range_get()
+##
+_dsl.dsl_ode_trigger_speed_range_get.argtypes = [c_wchar_p, 
+    POINTER(c_float), POINTER(c_float)]
+_dsl.dsl_ode_trigger_speed_range_get.restype = c_uint
+def dsl_ode_trigger_speed_range_get(name):
+    global _dsl
+    minimum = c_float(0)
+    maximum = c_float(0)
+    result =_dsl.dsl_ode_trigger_speed_range_get(name, 
+        DSL_FLOAT_P(minimum), DSL_FLOAT_P(maximum))
+    return int(result), minimum.value, maximum.value
+
+##
+## dsl_ode_trigger_speed_range_set()
+##
+_dsl.dsl_ode_trigger_speed_range_set.argtypes = [c_wchar_p, c_float, c_float]
+_dsl.dsl_ode_trigger_speed_range_set.restype = c_uint
+def dsl_ode_trigger_speed_range_set(name, minimum, maximum):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_speed_range_set(name, 
+        minimum, maximum)
+    return int(result)
+
 ##
 ## dsl_ode_trigger_summation_new()
 ##
@@ -2227,6 +2425,26 @@ def dsl_ode_trigger_source_set(name, source):
     result =_dsl.dsl_ode_trigger_source_set(name, source)
     return int(result)
 
+##
+## dsl_ode_trigger_source_add()
+##
+_dsl.dsl_ode_trigger_source_add.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_ode_trigger_source_add.restype = c_uint
+def dsl_ode_trigger_source_add(name, source):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_source_add(name, source)
+    return int(result)
+
+##
+## dsl_ode_trigger_source_remove()
+##
+_dsl.dsl_ode_trigger_source_remove.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_ode_trigger_source_remove.restype = c_uint
+def dsl_ode_trigger_source_remove(name, source):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_source_remove(name, source)
+    return int(result)
+
 ##
 ## dsl_ode_trigger_infer_get()
 ##
@@ -2269,6 +2487,28 @@ def dsl_ode_trigger_class_id_set(name, class_id):
     result =_dsl.dsl_ode_trigger_class_id_set(name, class_id)
     return int(result)
 
+##
+## dsl_ode_trigger_class_id_mask_get()
+##
+_dsl.dsl_ode_trigger_class_id_mask_get.argtypes = [c_wchar_p, POINTER(c_uint64)]
+_dsl.dsl_ode_trigger_class_id_mask_get.restype = c_uint
+def dsl_ode_trigger_class_id_mask_get(name):
+    global _dsl
+    class_id_mask = c_uint64(0)
+    result =_dsl.dsl_ode_trigger_class_id_mask_get(name, 
+        DSL_UINT64_P(class_id_mask))
+    return int(result), class_id_mask.value
+
+##
+## dsl_ode_trigger_class_id_mask_set()
+##
+_dsl.dsl_ode_trigger_class_id_mask_set.argtypes = [c_wchar_p, c_uint64]
+_dsl.dsl_ode_trigger_class_id_mask_set.restype = c_uint
+def dsl_ode_trigger_class_id_mask_set(name, class_id_mask):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_class_id_mask_set(name, class_id_mask)
+    return int(result)
+
 ##
 ## dsl_ode_trigger_class_id_ab_get()
 ##
@@ -2657,6 +2897,63 @@ def dsl_ode_accumulator_new(name):
     result =_dsl.dsl_ode_accumulator_new(name)
     return int(result)
 
+##
+## dsl_ode_accumulator_stats_new()
+##
+_dsl.dsl_ode_accumulator_stats_new.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_ode_accumulator_stats_new.restype = c_uint
+def dsl_ode_accumulator_stats_new(name, window, slide):
+    global _dsl
+    result =_dsl.dsl_ode_accumulator_stats_new(name, window, slide)
+    return int(result)
+
+##
+## dsl_ode_accumulator_stats_window_get()
+##
+_dsl.dsl_ode_accumulator_stats_window_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_ode_accumulator_stats_window_get.restype = c_uint
+def dsl_ode_accumulator_stats_window_get(name):
+    global _dsl
+    window = c_uint(0)
+    slide = c_uint(0)
+    result =_dsl.dsl_ode_accumulator_stats_window_get(name, 
+        DSL_UINT_P(window), DSL_UINT_P(slide))
+    return int(result), window.value, slide.value
+
+##
+## dsl_ode_accumulator_stats_window_set()
+##
+_dsl.dsl_ode_accumulator_stats_window_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_ode_accumulator_stats_window_set.restype = c_uint
+def dsl_ode_accumulator_stats_window_set(name, window, slide):
+    global _dsl
+    result =_dsl.dsl_ode_accumulator_stats_window_set(name, window, slide)
+    return int(result)
+
+##
+## dsl_ode_accumulator_stats_get()
+##
+_dsl.dsl_ode_accumulator_stats_get.argtypes = [c_wchar_p, c_uint, c_uint, 
+    c_uint, POINTER(dsl_ode_stats)]
+_dsl.dsl_ode_accumulator_stats_get.restype = c_uint
+def dsl_ode_accumulator_stats_get(name, source_id, class_id, metric):
+    global _dsl
+    stats = dsl_ode_stats()
+    result =_dsl.dsl_ode_accumulator_stats_get(name, 
+        source_id, class_id, metric, byref(stats))
+    return int(result), stats
+
+##
+## dsl_ode_accumulator_stats_clear()
+##
+_dsl.dsl_ode_accumulator_stats_clear.argtypes = [c_wchar_p]
+_dsl.dsl_ode_accumulator_stats_clear.restype = c_uint
+def dsl_ode_accumulator_stats_clear(name):
+    global _dsl
+    result =_dsl.dsl_ode_accumulator_stats_clear(name)
+    return int(result)
+
 ##
 ## dsl_ode_accumulator_action_add()
 ##
@@ -2976,6 +3273,19 @@ def dsl_pph_ode_trigger_remove_all(name):
     result =_dsl.dsl_pph_ode_trigger_remove_all(name)
     return int(result)
 
+##
+## dsl_pph_ode_trigger_swap()
+##
+#_dsl.dsl_pph_ode_trigger_swap.argtypes = [??]
+_dsl.dsl_pph_ode_trigger_swap.restype = c_uint
+def dsl_pph_ode_trigger_swap(name, triggers):
+    global _dsl
+    arr = (c_wchar_p * (len(triggers)+1))()
+    arr[:-1] = triggers
+    arr[-1] = None
+    result =_dsl.dsl_pph_ode_trigger_swap(name, arr)
+    return int(result)
+
 ##
 ## dsl_pph_ode_display_meta_alloc_size_get()
 ##
@@ -2997,6 +3307,27 @@ def dsl_pph_ode_display_meta_alloc_size_set(name, size):
     result =_dsl.dsl_pph_ode_display_meta_alloc_size_set(name, size)
     return int(result)
 
+##
+## dsl_pph_ode_pre_filter_enabled_get()
+##
+_dsl.dsl_pph_ode_pre_filter_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_pph_ode_pre_filter_enabled_get.restype = c_uint
+def dsl_pph_ode_pre_filter_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result =_dsl.dsl_pph_ode_pre_filter_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_pph_ode_pre_filter_enabled_set()
+##
+_dsl.dsl_pph_ode_pre_filter_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_pph_ode_pre_filter_enabled_set.restype = c_uint
+def dsl_pph_ode_pre_filter_enabled_set(name, enabled):
+    global _dsl
+    result =_dsl.dsl_pph_ode_pre_filter_enabled_set(name, enabled)
+    return int(result)
+
 ##
 ## dsl_pph_custom_new()
 ##
@@ -3093,6 +3424,74 @@ def dsl_pph_eos_new(name, handler, client_data):
         handler_cb, c_client_data)
     return int(result)
 
+##
+## dsl_pph_meta_stream_new()
+##
+_dsl.dsl_pph_meta_stream_new.argtypes = [c_wchar_p, c_wchar_p, c_uint, c_uint]
+_dsl.dsl_pph_meta_stream_new.restype = c_uint
+def dsl_pph_meta_stream_new(name, path, key_frame_interval, max_rate):
+    global _dsl
+    result =_dsl.dsl_pph_meta_stream_new(name, path, key_frame_interval, max_rate)
+    return int(result)
+
+##
+## dsl_pph_meta_stream_key_frame_interval_get()
+##
+_dsl.dsl_pph_meta_stream_key_frame_interval_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_pph_meta_stream_key_frame_interval_get.restype = c_uint
+def dsl_pph_meta_stream_key_frame_interval_get(name):
+    global _dsl
+    key_frame_interval = c_uint(0)
+    result =_dsl.dsl_pph_meta_stream_key_frame_interval_get(name, 
+        DSL_UINT_P(key_frame_interval))
+    return int(result), key_frame_interval.value
+
+##
+## dsl_pph_meta_stream_key_frame_interval_set()
+##
+_dsl.dsl_pph_meta_stream_key_frame_interval_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_pph_meta_stream_key_frame_interval_set.restype = c_uint
+def dsl_pph_meta_stream_key_frame_interval_set(name, key_frame_interval):
+    global _dsl
+    result =_dsl.dsl_pph_meta_stream_key_frame_interval_set(name, key_frame_interval)
+    return int(result)
+
+##
+## dsl_pph_meta_stream_max_rate_get()
+##
+_dsl.dsl_pph_meta_stream_max_rate_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_pph_meta_stream_max_rate_get.restype = c_uint
+def dsl_pph_meta_stream_max_rate_get(name):
+    global _dsl
+    max_rate = c_uint(0)
+    result =_dsl.dsl_pph_meta_stream_max_rate_get(name, DSL_UINT_P(max_rate))
+    return int(result), max_rate.value
+
+##
+## dsl_pph_meta_stream_max_rate_set()
+##
+_dsl.dsl_pph_meta_stream_max_rate_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_pph_meta_stream_max_rate_set.restype = c_uint
+def dsl_pph_meta_stream_max_rate_set(name, max_rate):
+    global _dsl
+    result =_dsl.dsl_pph_meta_stream_max_rate_set(name, max_rate)
+    return int(result)
+
+##
+## dsl_pph_meta_stream_stats_get()
+##
+_dsl.dsl_pph_meta_stream_stats_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint64), POINTER(c_uint64)]
+_dsl.dsl_pph_meta_stream_stats_get.restype = c_uint
+def dsl_pph_meta_stream_stats_get(name):
+    global _dsl
+    clients = c_uint(0)
+    sent = c_uint64(0)
+    dropped = c_uint64(0)
+    result =_dsl.dsl_pph_meta_stream_stats_get(name, DSL_UINT_P(clients),
+        DSL_UINT64_P(sent), DSL_UINT64_P(dropped))
+    return int(result), clients.value, sent.value, dropped.value
+
 ##
 ## dsl_pph_enabled_get()
 ##
@@ -4036,6 +4435,66 @@ def dsl_source_interpipe_accept_settings_set(name, accept_eos, accept_events):
         accept_eos, accept_events)
     return int(result)
 
+##
+## dsl_source_shared_new()
+##
+_dsl.dsl_source_shared_new.argtypes = [c_wchar_p, c_wchar_p, c_bool]
+_dsl.dsl_source_shared_new.restype = c_uint
+def dsl_source_shared_new(name, uri, is_live):
+    global _dsl
+    result = _dsl.dsl_source_shared_new(name, uri, is_live)
+    return int(result)
+
+##
+## dsl_source_shared_settings_get()
+##
+_dsl.dsl_source_shared_settings_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_source_shared_settings_get.restype = c_uint
+def dsl_source_shared_settings_get(name):
+    global _dsl
+    queue_size = c_uint(0)
+    max_rate = c_uint(0)
+    result = _dsl.dsl_source_shared_settings_get(name, 
+        DSL_UINT_P(queue_size), DSL_UINT_P(max_rate))
+    return int(result), queue_size.value, max_rate.value 
+
+##
+## dsl_source_shared_settings_set()
+##
+_dsl.dsl_source_shared_settings_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_source_shared_settings_set.restype = c_uint
+def dsl_source_shared_settings_set(name, queue_size, max_rate):
+    global _dsl
+    result = _dsl.dsl_source_shared_settings_set(name, queue_size, max_rate)
+    return int(result)
+
+##
+## dsl_source_shared_stats_get()
+##
+_dsl.dsl_source_shared_stats_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint64), POINTER(c_uint64), POINTER(c_uint64)]
+_dsl.dsl_source_shared_stats_get.restype = c_uint
+def dsl_source_shared_stats_get(name):
+    global _dsl
+    received = c_uint64(0)
+    dropped = c_uint64(0)
+    delivered = c_uint64(0)
+    result = _dsl.dsl_source_shared_stats_get(name, 
+        byref(received), byref(dropped), byref(delivered))
+    return int(result), received.value, dropped.value, delivered.value 
+
+##
+## dsl_source_shared_decoder_count_get()
+##
+_dsl.dsl_source_shared_decoder_count_get.argtypes = [POINTER(c_uint)]
+_dsl.dsl_source_shared_decoder_count_get.restype = c_uint
+def dsl_source_shared_decoder_count_get():
+    global _dsl
+    count = c_uint(0)
+    result = _dsl.dsl_source_shared_decoder_count_get(DSL_UINT_P(count))
+    return int(result), count.value 
+
 ##
 ## dsl_source_rtsp_new()
 ##
@@ -4261,6 +4720,21 @@ def dsl_source_video_buffer_out_frame_rate_set(name, fps_n, fps_d):
         fps_n, fps_d)
     return int(result)
 
+##
+## dsl_source_video_buffer_out_stats_get()
+##
+_dsl.dsl_source_video_buffer_out_stats_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint64), POINTER(c_uint64), POINTER(c_uint64)]
+_dsl.dsl_source_video_buffer_out_stats_get.restype = c_uint
+def dsl_source_video_buffer_out_stats_get(name):
+    global _dsl
+    received = c_uint64(0)
+    dropped = c_uint64(0)
+    converted = c_uint64(0)
+    result = _dsl.dsl_source_video_buffer_out_stats_get(name, 
+        byref(received), byref(dropped), byref(converted))
+    return int(result), received.value, dropped.value, converted.value 
+
 ##
 ## dsl_source_video_buffer_out_crop_rectangle_get()
 ##
@@ -4335,6 +4809,27 @@ def dsl_source_uri_uri_set(name, uir):
     result = _dsl.dsl_source_uri_uri_set(name, uir)
     return int(result)
 
+##
+## dsl_source_uri_keyframe_scan_get()
+##
+_dsl.dsl_source_uri_keyframe_scan_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_source_uri_keyframe_scan_get.restype = c_uint
+def dsl_source_uri_keyframe_scan_get(name):
+    global _dsl
+    interval = c_uint(0)
+    result = _dsl.dsl_source_uri_keyframe_scan_get(name, DSL_UINT_P(interval))
+    return int(result), interval.value
+
+##
+## dsl_source_uri_keyframe_scan_set()
+##
+_dsl.dsl_source_uri_keyframe_scan_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_source_uri_keyframe_scan_set.restype = c_uint
+def dsl_source_uri_keyframe_scan_set(name, interval):
+    global _dsl
+    result = _dsl.dsl_source_uri_keyframe_scan_set(name, interval)
+    return int(result)
+
 ##
 ## dsl_source_video_dewarper()
 ##
@@ -4567,6 +5062,44 @@ def dsl_source_rtsp_tap_remove(name):
     result = _dsl.dsl_source_rtsp_tap_remove(name)
     return int(result)
 
+##
+## dsl_source_rtsp_encoded_cache_settings_get()
+##
+_dsl.dsl_source_rtsp_encoded_cache_settings_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint64)]
+_dsl.dsl_source_rtsp_encoded_cache_settings_get.restype = c_uint
+def dsl_source_rtsp_encoded_cache_settings_get(name):
+    global _dsl
+    duration = c_uint(0)
+    max_size = c_uint64(0)
+    result = _dsl.dsl_source_rtsp_encoded_cache_settings_get(name, 
+        DSL_UINT_P(duration), DSL_UINT64_P(max_size))
+    return int(result), duration.value, max_size.value
+
+##
+## dsl_source_rtsp_encoded_cache_settings_set()
+##
+_dsl.dsl_source_rtsp_encoded_cache_settings_set.argtypes = [c_wchar_p, 
+    c_uint, c_uint64]
+_dsl.dsl_source_rtsp_encoded_cache_settings_set.restype = c_uint
+def dsl_source_rtsp_encoded_cache_settings_set(name, duration, max_size):
+    global _dsl
+    result = _dsl.dsl_source_rtsp_encoded_cache_settings_set(name, 
+        duration, max_size)
+    return int(result)
+
+##
+## dsl_source_rtsp_encoded_cache_export()
+##
+_dsl.dsl_source_rtsp_encoded_cache_export.argtypes = [c_wchar_p, 
+    c_uint, c_wchar_p]
+_dsl.dsl_source_rtsp_encoded_cache_export.restype = c_uint
+def dsl_source_rtsp_encoded_cache_export(name, duration, file_path):
+    global _dsl
+    result = _dsl.dsl_source_rtsp_encoded_cache_export(name, 
+        duration, file_path)
+    return int(result)
+
 ##
 ## dsl_source_is_live()
 ##
@@ -7231,6 +7764,47 @@ def dsl_sink_frame_capture_schedule(name, frame_number):
     result =_dsl.dsl_sink_frame_capture_schedule(name, frame_number)
     return int(result)
     
+##
+## dsl_sink_frame_capture_request()
+##
+_dsl.dsl_sink_frame_capture_request.argtypes = [c_wchar_p, c_uint64, 
+    c_uint, c_uint, DSL_SINK_FRAME_CAPTURE_COMPLETE_HANDLER, c_void_p, 
+    POINTER(c_uint64)]
+_dsl.dsl_sink_frame_capture_request.restype = c_uint
+def dsl_sink_frame_capture_request(name, frame_number, output_type, timeout,
+    client_handler, client_data):
+    global _dsl
+    c_client_handler = DSL_SINK_FRAME_CAPTURE_COMPLETE_HANDLER(client_handler)
+    callbacks.append(c_client_handler)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    clientdata.append(c_client_data)
+    request_id = c_uint64(0)
+    result =_dsl.dsl_sink_frame_capture_request(name, frame_number, 
+        output_type, timeout, c_client_handler, c_client_data, 
+        DSL_UINT64_P(request_id))
+    return int(result), request_id.value
+    
+##
+## dsl_sink_frame_capture_workers_get()
+##
+_dsl.dsl_sink_frame_capture_workers_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_sink_frame_capture_workers_get.restype = c_uint
+def dsl_sink_frame_capture_workers_get(name):
+    global _dsl
+    workers = c_uint(0)
+    result = _dsl.dsl_sink_frame_capture_workers_get(name, DSL_UINT_P(workers))
+    return int(result), workers.value
+    
+##
+## dsl_sink_frame_capture_workers_set()
+##
+_dsl.dsl_sink_frame_capture_workers_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_sink_frame_capture_workers_set.restype = c_uint
+def dsl_sink_frame_capture_workers_set(name, workers):
+    global _dsl
+    result = _dsl.dsl_sink_frame_capture_workers_set(name, workers)
+    return int(result)
+    
 ##
 ## dsl_sink_sync_enabled_get()
 ##
@@ -8384,6 +8958,182 @@ def dsl_pipeline_link_method_set(name, link_method):
     result =_dsl.dsl_pipeline_link_method_set(name, link_method)
     return int(result)
 
+##
+## dsl_pipeline_offline_enabled_get()
+##
+_dsl.dsl_pipeline_offline_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_pipeline_offline_enabled_get.restype = c_uint
+def dsl_pipeline_offline_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_pipeline_offline_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_pipeline_offline_enabled_set()
+##
+_dsl.dsl_pipeline_offline_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_pipeline_offline_enabled_set.restype = c_uint
+def dsl_pipeline_offline_enabled_set(name, enabled):
+    global _dsl
+    result = _dsl.dsl_pipeline_offline_enabled_set(name, enabled)
+    return int(result)
+
+##
+## dsl_pipeline_offline_file_queue_add()
+##
+#_dsl.dsl_pipeline_offline_file_queue_add.argtypes = [??]
+_dsl.dsl_pipeline_offline_file_queue_add.restype = c_uint
+def dsl_pipeline_offline_file_queue_add(name, file_paths):
+    global _dsl
+    arr = (c_wchar_p * (len(file_paths)+1))()
+    arr[:-1] = file_paths
+    arr[-1] = None
+    result = _dsl.dsl_pipeline_offline_file_queue_add(name, arr)
+    return int(result)
+
+##
+## dsl_pipeline_offline_file_queue_size_get()
+##
+_dsl.dsl_pipeline_offline_file_queue_size_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint)]
+_dsl.dsl_pipeline_offline_file_queue_size_get.restype = c_uint
+def dsl_pipeline_offline_file_queue_size_get(name):
+    global _dsl
+    size = c_uint(0)
+    result = _dsl.dsl_pipeline_offline_file_queue_size_get(name, 
+        DSL_UINT_P(size))
+    return int(result), size.value
+
+##
+## dsl_pipeline_offline_file_queue_clear()
+##
+_dsl.dsl_pipeline_offline_file_queue_clear.argtypes = [c_wchar_p]
+_dsl.dsl_pipeline_offline_file_queue_clear.restype = c_uint
+def dsl_pipeline_offline_file_queue_clear(name):
+    global _dsl
+    result = _dsl.dsl_pipeline_offline_file_queue_clear(name)
+    return int(result)
+
+##
+## dsl_pipeline_offline_stats_get()
+##
+_dsl.dsl_pipeline_offline_stats_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint64), POINTER(c_double)]
+_dsl.dsl_pipeline_offline_stats_get.restype = c_uint
+def dsl_pipeline_offline_stats_get(name):
+    global _dsl
+    files_completed = c_uint(0)
+    frames_processed = c_uint64(0)
+    frames_per_second = c_double(0)
+    result = _dsl.dsl_pipeline_offline_stats_get(name, 
+        DSL_UINT_P(files_completed), DSL_UINT64_P(frames_processed), 
+        DSL_DOUBLE_P(frames_per_second))
+    return (int(result), files_completed.value, frames_processed.value,
+        frames_per_second.value)
+
+##
+## dsl_pipeline_offline_file_complete_listener_add()
+##
+_dsl.dsl_pipeline_offline_file_complete_listener_add.argtypes = [c_wchar_p, 
+    DSL_FILE_COMPLETE_LISTENER, c_void_p]
+_dsl.dsl_pipeline_offline_file_complete_listener_add.restype = c_uint
+def dsl_pipeline_offline_file_complete_listener_add(name, 
+    client_listener, client_data):
+    global _dsl
+    c_client_listener = DSL_FILE_COMPLETE_LISTENER(client_listener)
+    callbacks.append(c_client_listener)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    clientdata.append(c_client_data)
+    result = _dsl.dsl_pipeline_offline_file_complete_listener_add(name, 
+        c_client_listener, c_client_data)
+    return int(result)
+    
+##
+## dsl_pipeline_offline_file_complete_listener_remove()
+##
+_dsl.dsl_pipeline_offline_file_complete_listener_remove.argtypes = [c_wchar_p, 
+    DSL_FILE_COMPLETE_LISTENER]
+_dsl.dsl_pipeline_offline_file_complete_listener_remove.restype = c_uint
+def dsl_pipeline_offline_file_complete_listener_remove(name, client_listener):
+    global _dsl
+    c_client_listener = DSL_FILE_COMPLETE_LISTENER(client_listener)
+    result = _dsl.dsl_pipeline_offline_file_complete_listener_remove(name, 
+        c_client_listener)
+    return int(result)
+
+##
+## dsl_pipeline_schedule_set()
+##
+_dsl.dsl_pipeline_schedule_set.argtypes = [c_wchar_p, c_uint, c_double]
+_dsl.dsl_pipeline_schedule_set.restype = c_uint
+def dsl_pipeline_schedule_set(name, priority, target_fps):
+    global _dsl
+    result = _dsl.dsl_pipeline_schedule_set(name, priority, target_fps)
+    return int(result)
+
+##
+## dsl_pipeline_schedule_get()
+##
+_dsl.dsl_pipeline_schedule_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_double)]
+_dsl.dsl_pipeline_schedule_get.restype = c_uint
+def dsl_pipeline_schedule_get(name):
+    global _dsl
+    priority = c_uint(0)
+    target_fps = c_double(0)
+    result = _dsl.dsl_pipeline_schedule_get(name, 
+        DSL_UINT_P(priority), DSL_DOUBLE_P(target_fps))
+    return int(result), priority.value, target_fps.value
+
+##
+## dsl_pipeline_schedule_remove()
+##
+_dsl.dsl_pipeline_schedule_remove.argtypes = [c_wchar_p]
+_dsl.dsl_pipeline_schedule_remove.restype = c_uint
+def dsl_pipeline_schedule_remove(name):
+    global _dsl
+    result = _dsl.dsl_pipeline_schedule_remove(name)
+    return int(result)
+
+##
+## dsl_pipeline_schedule_stats_get()
+##
+_dsl.dsl_pipeline_schedule_stats_get.argtypes = [c_wchar_p, 
+    POINTER(c_double), POINTER(c_double), POINTER(c_uint)]
+_dsl.dsl_pipeline_schedule_stats_get.restype = c_uint
+def dsl_pipeline_schedule_stats_get(name):
+    global _dsl
+    achieved_fps = c_double(0)
+    target_fps = c_double(0)
+    throttle_factor = c_uint(0)
+    result = _dsl.dsl_pipeline_schedule_stats_get(name, 
+        DSL_DOUBLE_P(achieved_fps), DSL_DOUBLE_P(target_fps), 
+        DSL_UINT_P(throttle_factor))
+    return (int(result), achieved_fps.value, target_fps.value,
+        throttle_factor.value)
+
+##
+## dsl_pipeline_scheduler_period_get()
+##
+_dsl.dsl_pipeline_scheduler_period_get.argtypes = [POINTER(c_uint)]
+_dsl.dsl_pipeline_scheduler_period_get.restype = c_uint
+def dsl_pipeline_scheduler_period_get():
+    global _dsl
+    period = c_uint(0)
+    result = _dsl.dsl_pipeline_scheduler_period_get(DSL_UINT_P(period))
+    return int(result), period.value
+
+##
+## dsl_pipeline_scheduler_period_set()
+##
+_dsl.dsl_pipeline_scheduler_period_set.argtypes = [c_uint]
+_dsl.dsl_pipeline_scheduler_period_set.restype = c_uint
+def dsl_pipeline_scheduler_period_set(period):
+    global _dsl
+    result = _dsl.dsl_pipeline_scheduler_period_set(period)
+    return int(result)
+
 ##
 ## dsl_pipeline_pause()
 ##
@@ -9327,3 +10077,124 @@ def dsl_info_log_function_restore():
     global _dsl
     result = _dsl.dsl_info_log_function_restore()
     return int(result)
+
+##
+## dsl_info_element_pool_max_size_get()
+##
+_dsl.dsl_info_element_pool_max_size_get.argtypes = [POINTER(c_uint)]
+_dsl.dsl_info_element_pool_max_size_get.restype = c_uint
+def dsl_info_element_pool_max_size_get():
+    global _dsl
+    max_size = c_uint(0)
+    result = _dsl.dsl_info_element_pool_max_size_get(DSL_UINT_P(max_size))
+    return int(result), max_size.value
+
+##
+## dsl_info_element_pool_max_size_set()
+##
+_dsl.dsl_info_element_pool_max_size_set.argtypes = [c_uint]
+_dsl.dsl_info_element_pool_max_size_set.restype = c_uint
+def dsl_info_element_pool_max_size_set(max_size):
+    global _dsl
+    result = _dsl.dsl_info_element_pool_max_size_set(max_size)
+    return int(result)
+
+##
+## dsl_info_media_info_get()
+##
+_dsl.dsl_info_media_info_get.argtypes = [c_wchar_p, POINTER(dsl_media_info)]
+_dsl.dsl_info_media_info_get.restype = c_uint
+def dsl_info_media_info_get(file_path):
+    global _dsl
+    info = dsl_media_info()
+    result = _dsl.dsl_info_media_info_get(file_path, byref(info))
+    return int(result), info
+
+##
+## dsl_info_media_probe_async()
+##
+#_dsl.dsl_info_media_probe_async.argtypes = [??]
+_dsl.dsl_info_media_probe_async.restype = c_uint
+def dsl_info_media_probe_async(file_paths, client_handler, client_data):
+    global _dsl
+    arr = (c_wchar_p * (len(file_paths)+1))()
+    arr[:-1] = file_paths
+    arr[-1] = None
+    if client_handler:
+        c_client_handler = DSL_INFO_MEDIA_PROBE_HANDLER(client_handler)
+    else:
+        c_client_handler = DSL_INFO_MEDIA_PROBE_HANDLER()
+    callbacks.append(c_client_handler)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    clientdata.append(c_client_data)
+    result = _dsl.dsl_info_media_probe_async(arr, 
+        c_client_handler, c_client_data)
+    return int(result)
+
+##
+## dsl_info_media_probe_workers_get()
+##
+_dsl.dsl_info_media_probe_workers_get.argtypes = [POINTER(c_uint)]
+_dsl.dsl_info_media_probe_workers_get.restype = c_uint
+def dsl_info_media_probe_workers_get():
+    global _dsl
+    workers = c_uint(0)
+    result = _dsl.dsl_info_media_probe_workers_get(DSL_UINT_P(workers))
+    return int(result), workers.value
+
+##
+## dsl_info_media_probe_workers_set()
+##
+_dsl.dsl_info_media_probe_workers_set.argtypes = [c_uint]
+_dsl.dsl_info_media_probe_workers_set.restype = c_uint
+def dsl_info_media_probe_workers_set(workers):
+    global _dsl
+    result = _dsl.dsl_info_media_probe_workers_set(workers)
+    return int(result)
+
+##
+## dsl_info_media_info_cache_clear()
+##
+_dsl.dsl_info_media_info_cache_clear.argtypes = []
+_dsl.dsl_info_media_info_cache_clear.restype = c_uint
+def dsl_info_media_info_cache_clear():
+    global _dsl
+    result = _dsl.dsl_info_media_info_cache_clear()
+    return int(result)
+
+##
+## dsl_info_memory_stats_get()
+##
+_dsl.dsl_info_memory_stats_get.argtypes = [c_uint, POINTER(dsl_memory_stats)]
+_dsl.dsl_info_memory_stats_get.restype = c_uint
+def dsl_info_memory_stats_get(tag):
+    global _dsl
+    stats = dsl_memory_stats()
+    result = _dsl.dsl_info_memory_stats_get(tag, byref(stats))
+    return int(result), stats
+
+##
+## dsl_info_memory_stats_reset()
+##
+_dsl.dsl_info_memory_stats_reset.argtypes = [c_uint]
+_dsl.dsl_info_memory_stats_reset.restype = c_uint
+def dsl_info_memory_stats_reset(tag):
+    global _dsl
+    result = _dsl.dsl_info_memory_stats_reset(tag)
+    return int(result)
+
+##
+## dsl_info_ode_counters_get()
+##
+_dsl.dsl_info_ode_counters_get.argtypes = [
+    POINTER(POINTER(dsl_ode_counter_info)), POINTER(c_uint)]
+_dsl.dsl_info_ode_counters_get.restype = c_uint
+def dsl_info_ode_counters_get():
+    global _dsl
+    counters = POINTER(dsl_ode_counter_info)()
+    size = c_uint(0)
+    result = _dsl.dsl_info_ode_counters_get(byref(counters), DSL_UINT_P(size))
+    # copy the snapshot, it's only valid until the next call
+    return int(result), [dsl_ode_counter_info(counters[i].name, 
+        counters[i].type, counters[i].events, counters[i].frames, 
+        counters[i].occurrences) for i in range(size.value)]
@@ -0,0 +1,161 @@
+################################################################################
+# The MIT License
+#
+# Copyright (c) 2024, Prominence AI, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+################################################################################
+
+################################################################################
+#
+# This example demonstrates how to process (infer-on) all .mp4 files in a 
+# given folder as fast as possible using the Pipeline's offline mode.
+#
+# The inference Pipeline is built with the following components:
+#   - NUM_SLOTS File Sources
+#   - Primary GST Inference Engine (PGIE)
+#   - IOU Tracker
+#   - Fake Sink
+# 
+# In offline mode the Pipeline plays without a clock. Each File Source
+# that reaches the end of its file is rebound to the next file in the 
+# Pipeline's file queue without stopping the Pipeline. The Pipeline EOS
+# occurs once all files have been processed.
+#  
+################################################################################
+
+#!/usr/bin/env python
+
+import sys
+from dsl import *
+import os
+
+# path to the directory that hold the mp4 files to process.
+dir_path = "/opt/nvidia/deepstream/deepstream/samples/streams"
+
+# Filespecs (Jetson and dGPU) for the Primary GIE
+primary_infer_config_file = \
+    '/opt/nvidia/deepstream/deepstream/samples/configs/deepstream-app/config_infer_primary.txt'
+primary_model_engine_file = \
+    '/opt/nvidia/deepstream/deepstream/samples/models/Primary_Detector/resnet18_trafficcamnet.etlt_b8_gpu0_int8.engine'
+
+# Filespec for the IOU Tracker config file
+iou_tracker_config_file = \
+    '/opt/nvidia/deepstream/deepstream/samples/configs/deepstream-app/config_tracker_IOU.yml'
+
+# Number of Streammuxer slots to keep busy
+NUM_SLOTS = 4
+
+## 
+# Function to be called each time a File Source completes a file
+## 
+def file_complete_listener(source, file_path, frames, client_data):
+    print(source, 'completed', file_path, 'with', frames, 'frames')
+
+## 
+# Function to be called on End-of-Stream (EOS) event
+## 
+def eos_event_listener(client_data):
+    print('Pipeline EOS event - all files processed')
+    retval, files_completed, frames_processed, frames_per_second = \
+        dsl_pipeline_offline_stats_get('pipeline')
+    print('files completed   = ', files_completed)
+    print('frames processed  = ', frames_processed)
+    print('frames per second = ', frames_per_second)
+    dsl_pipeline_stop('pipeline')
+    dsl_main_loop_quit()
+
+def main(args):
+
+    # Since we're not using args, we can Let DSL initialize GST on first call
+    while True:
+    
+        file_list = []
+        for file in os.listdir(dir_path):
+            if file.endswith(".mp4"):
+                file_list.append(os.path.join(dir_path, file),)
+
+        # New File Source for each slot, each with the next file in the list
+        source_names = []
+        for slot in range(min(NUM_SLOTS, len(file_list))):
+            source_name = 'file-source-' + str(slot)
+            retval = dsl_source_file_new(source_name, file_list.pop(0), False)
+            if retval != DSL_RETURN_SUCCESS:
+                break
+            source_names.append(source_name)
+        if retval != DSL_RETURN_SUCCESS:
+            break
+
+        # New Primary GIE using the filespecs above with interval = 0
+        retval = dsl_infer_gie_primary_new('primary-gie', 
+            primary_infer_config_file, primary_model_engine_file, 0)
+        if retval != DSL_RETURN_SUCCESS:
+            break
+
+        # New IOU Tracker, setting operational width and hieght
+        retval = dsl_tracker_new('iou-tracker', iou_tracker_config_file, 480, 272)
+        if retval != DSL_RETURN_SUCCESS:
+            break
+
+        # New Fake Sink - no rendering required
+        retval = dsl_sink_fake_new('fake-sink')
+        if retval != DSL_RETURN_SUCCESS:
+            break
+
+        # Add all the components to our pipeline
+        retval = dsl_pipeline_new_component_add_many('pipeline', 
+            source_names + ['primary-gie', 'iou-tracker', 'fake-sink', None])
+        if retval != DSL_RETURN_SUCCESS:
+            break
+
+        # Enable offline mode and add the remaining files to the queue
+        retval = dsl_pipeline_offline_enabled_set('pipeline', True)
+        if retval != DSL_RETURN_SUCCESS:
+            break
+        if len(file_list):
+            retval = dsl_pipeline_offline_file_queue_add('pipeline', file_list)
+            if retval != DSL_RETURN_SUCCESS:
+                break
+
+        ## Add the listener callback functions defined above
+        retval = dsl_pipeline_offline_file_complete_listener_add('pipeline', 
+            file_complete_listener, None)
+        if retval != DSL_RETURN_SUCCESS:
+            break
+        retval = dsl_pipeline_eos_listener_add('pipeline', eos_event_listener, None)
+        if retval != DSL_RETURN_SUCCESS:
+            break
+
+        # Play the pipeline
+        retval = dsl_pipeline_play('pipeline')
+        if retval != DSL_RETURN_SUCCESS:
+            break
+
+        dsl_main_loop_run()
+        retval = DSL_RETURN_SUCCESS
+        break
+
+    # Print out the final result
+    print(dsl_return_value_to_string(retval))
+
+    dsl_pipeline_delete_all()
+    dsl_component_delete_all()
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
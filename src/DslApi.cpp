@@ -1591,6 +1591,59 @@ DslReturnType dsl_ode_action_enabled_set(const wchar_t* name, boolean enabled)
     return DSL::Services::GetServices()->OdeActionEnabledSet(cstrName.c_str(), enabled);
 }
 
+DslReturnType dsl_ode_action_dedup_get(const wchar_t* name, 
+    boolean* enabled, uint* window, boolean* fan_in)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+    RETURN_IF_PARAM_IS_NULL(window);
+    RETURN_IF_PARAM_IS_NULL(fan_in);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionDedupGet(cstrName.c_str(), 
+        enabled, window, fan_in);
+}
+
+DslReturnType dsl_ode_action_dedup_set(const wchar_t* name, 
+    boolean enabled, uint window, boolean fan_in)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionDedupSet(cstrName.c_str(), 
+        enabled, window, fan_in);
+}
+
+DslReturnType dsl_ode_action_summary_get(const wchar_t* name, 
+    uint* interval, uint* samples)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(interval);
+    RETURN_IF_PARAM_IS_NULL(samples);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionSummaryGet(cstrName.c_str(), 
+        interval, samples);
+}
+
+DslReturnType dsl_ode_action_summary_set(const wchar_t* name, 
+    uint interval, uint samples)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionSummarySet(cstrName.c_str(), 
+        interval, samples);
+}
+
 DslReturnType dsl_ode_action_enabled_state_change_listener_add(const wchar_t* name,
     dsl_ode_enabled_state_change_listener_cb listener, void* client_data)
 {
@@ -2155,6 +2208,32 @@ DslReturnType dsl_ode_trigger_persistence_range_set(const wchar_t* name,
     return DSL::Services::GetServices()->OdeTriggerPersistenceRangeSet(
         cstrName.c_str(), minimum, maximum);
 }
+
+DslReturnType dsl_ode_trigger_speed_range_get(const wchar_t* name, 
+    float* minimum, float* maximum)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(minimum);
+    RETURN_IF_PARAM_IS_NULL(maximum);
+    
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerSpeedRangeGet(
+        cstrName.c_str(), minimum, maximum);
+}
+
+DslReturnType dsl_ode_trigger_speed_range_set(const wchar_t* name, 
+    float minimum, float maximum)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerSpeedRangeSet(
+        cstrName.c_str(), minimum, maximum);
+}
     
 DslReturnType dsl_ode_trigger_latest_new(const wchar_t* name, 
     const wchar_t* source, uint class_id, uint limit)
@@ -2259,6 +2338,32 @@ DslReturnType dsl_ode_trigger_cross_view_settings_set(const wchar_t* name,
         enabled, cstrColor.c_str(), line_width);
 }
     
+DslReturnType dsl_ode_trigger_cross_view_lod_settings_get(const wchar_t* name, 
+    uint* tolerance, uint* max_traces)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(tolerance);
+    RETURN_IF_PARAM_IS_NULL(max_traces);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->OdeTriggerCrossViewLodSettingsGet(
+        cstrName.c_str(), tolerance, max_traces);
+}
+
+DslReturnType dsl_ode_trigger_cross_view_lod_settings_set(const wchar_t* name, 
+    uint tolerance, uint max_traces)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerCrossViewLodSettingsSet(
+        cstrName.c_str(), tolerance, max_traces);
+}
+    
 DslReturnType dsl_ode_trigger_reset(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -2381,6 +2486,31 @@ DslReturnType dsl_ode_trigger_class_id_set(const wchar_t* name, uint class_id)
     return DSL::Services::GetServices()->OdeTriggerClassIdSet(cstrName.c_str(), class_id);
 }
 
+DslReturnType dsl_ode_trigger_class_id_mask_get(const wchar_t* name, 
+    uint64_t* class_id_mask)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(class_id_mask);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerClassIdMaskGet(cstrName.c_str(), 
+        class_id_mask);
+}
+
+DslReturnType dsl_ode_trigger_class_id_mask_set(const wchar_t* name, 
+    uint64_t class_id_mask)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerClassIdMaskSet(cstrName.c_str(), 
+        class_id_mask);
+}
+
 DslReturnType dsl_ode_trigger_class_id_ab_get(const wchar_t* name, 
     uint* class_id_a, uint* class_id_b)
 {
@@ -2494,6 +2624,34 @@ DslReturnType dsl_ode_trigger_source_set(const wchar_t* name, const wchar_t* sou
     return DSL::Services::GetServices()->OdeTriggerSourceSet(cstrName.c_str(), cstrSource.c_str());
 }
 
+DslReturnType dsl_ode_trigger_source_add(const wchar_t* name, const wchar_t* source)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(source);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrSource(source);
+    std::string cstrSource(wstrSource.begin(), wstrSource.end());
+
+    return DSL::Services::GetServices()->OdeTriggerSourceAdd(cstrName.c_str(), 
+        cstrSource.c_str());
+}
+
+DslReturnType dsl_ode_trigger_source_remove(const wchar_t* name, const wchar_t* source)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(source);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrSource(source);
+    std::string cstrSource(wstrSource.begin(), wstrSource.end());
+
+    return DSL::Services::GetServices()->OdeTriggerSourceRemove(cstrName.c_str(), 
+        cstrSource.c_str());
+}
+
 DslReturnType dsl_ode_trigger_infer_get(const wchar_t* name, const wchar_t** infer)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -3015,6 +3173,68 @@ DslReturnType dsl_ode_accumulator_new(const wchar_t* name)
     return DSL::Services::GetServices()->OdeAccumulatorNew(cstrName.c_str());
 }
 
+DslReturnType dsl_ode_accumulator_stats_new(const wchar_t* name, 
+    uint window, uint slide)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeAccumulatorStatsNew(cstrName.c_str(),
+        window, slide);
+}
+
+DslReturnType dsl_ode_accumulator_stats_window_get(const wchar_t* name, 
+    uint* window, uint* slide)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(window);
+    RETURN_IF_PARAM_IS_NULL(slide);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeAccumulatorStatsWindowGet(
+        cstrName.c_str(), window, slide);
+}
+
+DslReturnType dsl_ode_accumulator_stats_window_set(const wchar_t* name, 
+    uint window, uint slide)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeAccumulatorStatsWindowSet(
+        cstrName.c_str(), window, slide);
+}
+
+DslReturnType dsl_ode_accumulator_stats_get(const wchar_t* name, 
+    uint source_id, uint class_id, uint metric, dsl_ode_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeAccumulatorStatsGet(
+        cstrName.c_str(), source_id, class_id, metric, stats);
+}
+
+DslReturnType dsl_ode_accumulator_stats_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeAccumulatorStatsClear(
+        cstrName.c_str());
+}
+
 DslReturnType dsl_ode_accumulator_action_add(const wchar_t* name, const wchar_t* action)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -3447,6 +3667,26 @@ DslReturnType dsl_pph_ode_trigger_remove_all(const wchar_t* name)
     return DSL::Services::GetServices()->PphOdeTriggerRemoveAll(cstrName.c_str());
 }
 
+DslReturnType dsl_pph_ode_trigger_swap(const wchar_t* name, 
+    const wchar_t** triggers)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(triggers);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    std::vector<std::string> cstrOdeTriggers;
+    for (const wchar_t** trigger = triggers; *trigger; trigger++)
+    {
+        std::wstring wstrOdeTrigger(*trigger);
+        cstrOdeTriggers.push_back(
+            std::string(wstrOdeTrigger.begin(), wstrOdeTrigger.end()));
+    }
+    return DSL::Services::GetServices()->PphOdeTriggerSwap(cstrName.c_str(),
+        cstrOdeTriggers);
+}
+
 DslReturnType dsl_pph_ode_display_meta_alloc_size_get(const wchar_t* name, uint* size)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -3469,6 +3709,31 @@ DslReturnType dsl_pph_ode_display_meta_alloc_size_set(const wchar_t* name, uint
         cstrName.c_str(), size);
 }
 
+DslReturnType dsl_pph_ode_pre_filter_enabled_get(const wchar_t* name, 
+    boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdePreFilterEnabledGet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_pph_ode_pre_filter_enabled_set(const wchar_t* name, 
+    boolean enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdePreFilterEnabledSet(
+        cstrName.c_str(), enabled);
+}
+
 DslReturnType dsl_pph_buffer_timeout_new(const wchar_t* name,
     uint timeout, dsl_pph_buffer_timeout_handler_cb handler, void* client_data)
 {
@@ -3507,6 +3772,134 @@ DslReturnType dsl_pph_stream_event_new(const wchar_t* name,
     return DSL::Services::GetServices()->PphStreamEventNew(cstrName.c_str(), 
         handler, client_data);
 }
+
+DslReturnType dsl_pph_meta_stream_new(const wchar_t* name, const wchar_t* path,
+    uint key_frame_interval, uint max_rate)
+{
+#if !defined(BUILD_WEBRTC)
+    #error "BUILD_WEBRTC must be defined"
+#elif BUILD_WEBRTC != true
+    LOG_ERROR("WebRTC & WebSocket services require BUILD_WEBRTC to be set to true \
+        in the Makefile");
+    return DSL_RESULT_API_NOT_SUPPORTED;
+#else
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(path);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrPath(path);
+    std::string cstrPath(wstrPath.begin(), wstrPath.end());
+
+    return DSL::Services::GetServices()->PphMetaStreamNew(cstrName.c_str(), 
+        cstrPath.c_str(), key_frame_interval, max_rate);
+#endif    
+}
+
+DslReturnType dsl_pph_meta_stream_key_frame_interval_get(const wchar_t* name, 
+    uint* key_frame_interval)
+{
+#if !defined(BUILD_WEBRTC)
+    #error "BUILD_WEBRTC must be defined"
+#elif BUILD_WEBRTC != true
+    LOG_ERROR("WebRTC & WebSocket services require BUILD_WEBRTC to be set to true \
+        in the Makefile");
+    return DSL_RESULT_API_NOT_SUPPORTED;
+#else
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(key_frame_interval);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphMetaStreamKeyFrameIntervalGet(cstrName.c_str(), 
+        key_frame_interval);
+#endif    
+}
+
+DslReturnType dsl_pph_meta_stream_key_frame_interval_set(const wchar_t* name, 
+    uint key_frame_interval)
+{
+#if !defined(BUILD_WEBRTC)
+    #error "BUILD_WEBRTC must be defined"
+#elif BUILD_WEBRTC != true
+    LOG_ERROR("WebRTC & WebSocket services require BUILD_WEBRTC to be set to true \
+        in the Makefile");
+    return DSL_RESULT_API_NOT_SUPPORTED;
+#else
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphMetaStreamKeyFrameIntervalSet(cstrName.c_str(), 
+        key_frame_interval);
+#endif    
+}
+
+DslReturnType dsl_pph_meta_stream_max_rate_get(const wchar_t* name, 
+    uint* max_rate)
+{
+#if !defined(BUILD_WEBRTC)
+    #error "BUILD_WEBRTC must be defined"
+#elif BUILD_WEBRTC != true
+    LOG_ERROR("WebRTC & WebSocket services require BUILD_WEBRTC to be set to true \
+        in the Makefile");
+    return DSL_RESULT_API_NOT_SUPPORTED;
+#else
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(max_rate);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphMetaStreamMaxRateGet(cstrName.c_str(), 
+        max_rate);
+#endif    
+}
+
+DslReturnType dsl_pph_meta_stream_max_rate_set(const wchar_t* name, 
+    uint max_rate)
+{
+#if !defined(BUILD_WEBRTC)
+    #error "BUILD_WEBRTC must be defined"
+#elif BUILD_WEBRTC != true
+    LOG_ERROR("WebRTC & WebSocket services require BUILD_WEBRTC to be set to true \
+        in the Makefile");
+    return DSL_RESULT_API_NOT_SUPPORTED;
+#else
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphMetaStreamMaxRateSet(cstrName.c_str(), 
+        max_rate);
+#endif    
+}
+
+DslReturnType dsl_pph_meta_stream_stats_get(const wchar_t* name, 
+    uint* clients, uint64_t* sent, uint64_t* dropped)
+{
+#if !defined(BUILD_WEBRTC)
+    #error "BUILD_WEBRTC must be defined"
+#elif BUILD_WEBRTC != true
+    LOG_ERROR("WebRTC & WebSocket services require BUILD_WEBRTC to be set to true \
+        in the Makefile");
+    return DSL_RESULT_API_NOT_SUPPORTED;
+#else
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(clients);
+    RETURN_IF_PARAM_IS_NULL(sent);
+    RETURN_IF_PARAM_IS_NULL(dropped);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphMetaStreamStatsGet(cstrName.c_str(), 
+        clients, sent, dropped);
+#endif    
+}
      
 DslReturnType dsl_pph_enabled_get(const wchar_t* name, boolean* enabled)
 {
@@ -4933,6 +5326,69 @@ DslReturnType dsl_source_interpipe_accept_settings_set(const wchar_t* name,
 #endif
 }
     
+DslReturnType dsl_source_shared_new(const wchar_t* name, const wchar_t* uri,
+    boolean is_live)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(uri);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrUri(uri);
+    std::string cstrUri(wstrUri.begin(), wstrUri.end());
+
+    return DSL::Services::GetServices()->SourceSharedNew(cstrName.c_str(), 
+        cstrUri.c_str(), is_live);
+}
+
+DslReturnType dsl_source_shared_settings_get(const wchar_t* name,
+    uint* queue_size, uint* max_rate)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(queue_size);
+    RETURN_IF_PARAM_IS_NULL(max_rate);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceSharedSettingsGet(
+        cstrName.c_str(), queue_size, max_rate);
+}
+
+DslReturnType dsl_source_shared_settings_set(const wchar_t* name,
+    uint queue_size, uint max_rate)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceSharedSettingsSet(
+        cstrName.c_str(), queue_size, max_rate);
+}
+
+DslReturnType dsl_source_shared_stats_get(const wchar_t* name,
+    uint64_t* received, uint64_t* dropped, uint64_t* delivered)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(received);
+    RETURN_IF_PARAM_IS_NULL(dropped);
+    RETURN_IF_PARAM_IS_NULL(delivered);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceSharedStatsGet(
+        cstrName.c_str(), received, dropped, delivered);
+}
+
+DslReturnType dsl_source_shared_decoder_count_get(uint* count)
+{
+    RETURN_IF_PARAM_IS_NULL(count);
+
+    return DSL::Services::GetServices()->SourceSharedDecoderCountGet(count);
+}
+
 DslReturnType dsl_source_rtsp_new(const wchar_t* name, const wchar_t* uri, uint protocol, 
     uint skip_frames, uint dropFrameInterval, uint latency, uint timeout)
 {
@@ -5145,6 +5601,21 @@ DslReturnType dsl_source_video_buffer_out_frame_rate_set(const wchar_t* name,
         cstrName.c_str(), fps_n, fps_d);
 }
 
+DslReturnType dsl_source_video_buffer_out_stats_get(const wchar_t* name, 
+    uint64_t* received, uint64_t* dropped, uint64_t* converted)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(received);
+    RETURN_IF_PARAM_IS_NULL(dropped);
+    RETURN_IF_PARAM_IS_NULL(converted);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceVideoBufferOutStatsGet(
+        cstrName.c_str(), received, dropped, converted);
+}
+
 DslReturnType dsl_source_video_buffer_out_crop_rectangle_get(const wchar_t* name,
     uint crop_at, uint* left, uint* top, uint* width, uint* height)
 {
@@ -5300,18 +5771,43 @@ DslReturnType dsl_source_uri_uri_get(const wchar_t* name, const wchar_t** uri)
     return retval;
 }
 
-DslReturnType dsl_source_uri_uri_set(const wchar_t* name, const wchar_t* uri)
+DslReturnType dsl_source_uri_uri_set(const wchar_t* name, const wchar_t* uri)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(uri);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrUri(uri);
+    std::string cstrUri(wstrUri.begin(), wstrUri.end());
+
+    return DSL::Services::GetServices()->SourceUriUriSet(cstrName.c_str(), 
+        cstrUri.c_str());
+}
+
+DslReturnType dsl_source_uri_keyframe_scan_get(const wchar_t* name, 
+    uint* interval)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(interval);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceUriKeyFrameScanGet(
+        cstrName.c_str(), interval);
+}
+
+DslReturnType dsl_source_uri_keyframe_scan_set(const wchar_t* name, 
+    uint interval)
 {
     RETURN_IF_PARAM_IS_NULL(name);
-    RETURN_IF_PARAM_IS_NULL(uri);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
-    std::wstring wstrUri(uri);
-    std::string cstrUri(wstrUri.begin(), wstrUri.end());
 
-    return DSL::Services::GetServices()->SourceUriUriSet(cstrName.c_str(), 
-        cstrUri.c_str());
+    return DSL::Services::GetServices()->SourceUriKeyFrameScanSet(
+        cstrName.c_str(), interval);
 }
 
 DslReturnType dsl_source_rtsp_uri_get(const wchar_t* name, const wchar_t** uri)
@@ -5564,6 +6060,47 @@ DslReturnType dsl_source_rtsp_tap_remove(const wchar_t* name)
     return DSL::Services::GetServices()->SourceRtspTapRemove(cstrName.c_str());
 }
 
+DslReturnType dsl_source_rtsp_encoded_cache_settings_get(const wchar_t* name,
+    uint* duration, uint64_t* max_size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(duration);
+    RETURN_IF_PARAM_IS_NULL(max_size);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceRtspEncodedCacheSettingsGet(
+        cstrName.c_str(), duration, max_size);
+}
+
+DslReturnType dsl_source_rtsp_encoded_cache_settings_set(const wchar_t* name,
+    uint duration, uint64_t max_size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceRtspEncodedCacheSettingsSet(
+        cstrName.c_str(), duration, max_size);
+}
+
+DslReturnType dsl_source_rtsp_encoded_cache_export(const wchar_t* name,
+    uint duration, const wchar_t* file_path)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(file_path);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrFilePath(file_path);
+    std::string cstrFilePath(wstrFilePath.begin(), wstrFilePath.end());
+
+    return DSL::Services::GetServices()->SourceRtspEncodedCacheExport(
+        cstrName.c_str(), duration, cstrFilePath.c_str());
+}
+
 DslReturnType dsl_source_unique_id_get(const wchar_t* name, int* unique_id)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -8958,6 +9495,71 @@ DslReturnType dsl_sink_frame_capture_schedule(const wchar_t* name,
         cstrName.c_str(), frame_number);
 #endif        
 }
+    
+DslReturnType dsl_sink_frame_capture_request(const wchar_t* name,
+    uint64_t frame_number, uint output_type, uint timeout,
+    dsl_sink_frame_capture_complete_cb client_handler, void* client_data,
+    uint64_t* request_id)
+{
+#if !defined(BUILD_WITH_FFMPEG) || !defined(BUILD_WITH_OPENCV)
+    #error "BUILD_WITH_FFMPEG and BUILD_WITH_OPENCV must be defined"
+#elif (BUILD_WITH_FFMPEG != true) && (BUILD_WITH_OPENCV != true)
+    LOG_ERROR("dsl_sink_frame_capture_request requires one of BUILD_WITH_FFMPEG \
+       or BUILD_WITH_OPENCV to be set true in the Makefile");
+    return DSL_RESULT_API_NOT_SUPPORTED;
+#else    
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(request_id);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkFrameCaptureRequest(
+        cstrName.c_str(), frame_number, output_type, timeout,
+        client_handler, client_data, request_id);
+#endif        
+}
+    
+DslReturnType dsl_sink_frame_capture_workers_get(const wchar_t* name,
+    uint* workers)
+{
+#if !defined(BUILD_WITH_FFMPEG) || !defined(BUILD_WITH_OPENCV)
+    #error "BUILD_WITH_FFMPEG and BUILD_WITH_OPENCV must be defined"
+#elif (BUILD_WITH_FFMPEG != true) && (BUILD_WITH_OPENCV != true)
+    LOG_ERROR("dsl_sink_frame_capture_workers_get requires one of BUILD_WITH_FFMPEG \
+       or BUILD_WITH_OPENCV to be set true in the Makefile");
+    return DSL_RESULT_API_NOT_SUPPORTED;
+#else    
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(workers);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkFrameCaptureWorkersGet(
+        cstrName.c_str(), workers);
+#endif        
+}
+    
+DslReturnType dsl_sink_frame_capture_workers_set(const wchar_t* name,
+    uint workers)
+{
+#if !defined(BUILD_WITH_FFMPEG) || !defined(BUILD_WITH_OPENCV)
+    #error "BUILD_WITH_FFMPEG and BUILD_WITH_OPENCV must be defined"
+#elif (BUILD_WITH_FFMPEG != true) && (BUILD_WITH_OPENCV != true)
+    LOG_ERROR("dsl_sink_frame_capture_workers_set requires one of BUILD_WITH_FFMPEG \
+       or BUILD_WITH_OPENCV to be set true in the Makefile");
+    return DSL_RESULT_API_NOT_SUPPORTED;
+#else    
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkFrameCaptureWorkersSet(
+        cstrName.c_str(), workers);
+#endif        
+}
  
     
 // NOTE: the WebRTC Sink implementation requires DS 1.18.0 or later
@@ -11068,6 +11670,179 @@ DslReturnType dsl_pipeline_link_method_set(const wchar_t* name, uint link_method
         link_method);
 }
 
+DslReturnType dsl_pipeline_offline_enabled_get(const wchar_t* name, 
+    boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineOfflineEnabledGet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_pipeline_offline_enabled_set(const wchar_t* name, 
+    boolean enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineOfflineEnabledSet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_pipeline_offline_file_queue_add(const wchar_t* name, 
+    const wchar_t** file_paths)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(file_paths);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    std::vector<std::string> filePaths;
+    for (const wchar_t** file_path = file_paths; *file_path; file_path++)
+    {
+        std::wstring wstrFilePath(*file_path);
+        filePaths.push_back(std::string(wstrFilePath.begin(), wstrFilePath.end()));
+    }
+    return DSL::Services::GetServices()->PipelineOfflineFileQueueAdd(
+        cstrName.c_str(), filePaths);
+}
+
+DslReturnType dsl_pipeline_offline_file_queue_size_get(const wchar_t* name, 
+    uint* size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(size);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineOfflineFileQueueSizeGet(
+        cstrName.c_str(), size);
+}
+
+DslReturnType dsl_pipeline_offline_file_queue_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineOfflineFileQueueClear(
+        cstrName.c_str());
+}
+
+DslReturnType dsl_pipeline_offline_stats_get(const wchar_t* name, 
+    uint* files_completed, uint64_t* frames_processed, double* frames_per_second)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(files_completed);
+    RETURN_IF_PARAM_IS_NULL(frames_processed);
+    RETURN_IF_PARAM_IS_NULL(frames_per_second);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineOfflineStatsGet(
+        cstrName.c_str(), files_completed, frames_processed, frames_per_second);
+}
+
+DslReturnType dsl_pipeline_offline_file_complete_listener_add(const wchar_t* name, 
+    dsl_file_complete_listener_cb listener, void* client_data)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(listener);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->
+        PipelineOfflineFileCompleteListenerAdd(cstrName.c_str(), 
+            listener, client_data);
+}
+
+DslReturnType dsl_pipeline_offline_file_complete_listener_remove(const wchar_t* name, 
+    dsl_file_complete_listener_cb listener)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(listener);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->
+        PipelineOfflineFileCompleteListenerRemove(cstrName.c_str(), listener);
+}
+
+DslReturnType dsl_pipeline_schedule_set(const wchar_t* name, 
+    uint priority, double target_fps)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineScheduleSet(cstrName.c_str(), 
+        priority, target_fps);
+}
+
+DslReturnType dsl_pipeline_schedule_get(const wchar_t* name, 
+    uint* priority, double* target_fps)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(priority);
+    RETURN_IF_PARAM_IS_NULL(target_fps);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineScheduleGet(cstrName.c_str(), 
+        priority, target_fps);
+}
+
+DslReturnType dsl_pipeline_schedule_remove(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineScheduleRemove(cstrName.c_str());
+}
+
+DslReturnType dsl_pipeline_schedule_stats_get(const wchar_t* name, 
+    double* achieved_fps, double* target_fps, uint* throttle_factor)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(achieved_fps);
+    RETURN_IF_PARAM_IS_NULL(target_fps);
+    RETURN_IF_PARAM_IS_NULL(throttle_factor);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineScheduleStatsGet(
+        cstrName.c_str(), achieved_fps, target_fps, throttle_factor);
+}
+
+DslReturnType dsl_pipeline_scheduler_period_get(uint* period)
+{
+    RETURN_IF_PARAM_IS_NULL(period);
+
+    return DSL::Services::GetServices()->PipelineSchedulerPeriodGet(period);
+}
+
+DslReturnType dsl_pipeline_scheduler_period_set(uint period)
+{
+    return DSL::Services::GetServices()->PipelineSchedulerPeriodSet(period);
+}
+
 DslReturnType dsl_pipeline_pause(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -12273,3 +13048,97 @@ DslReturnType dsl_info_log_function_restore()
     return DSL::Services::GetServices()->InfoLogFunctionRestore();
 }
 
+DslReturnType dsl_info_element_pool_max_size_get(uint* max_size)
+{
+    RETURN_IF_PARAM_IS_NULL(max_size);
+
+    return DSL::Services::GetServices()->InfoElementPoolMaxSizeGet(max_size);
+}
+
+DslReturnType dsl_info_element_pool_max_size_set(uint max_size)
+{
+    return DSL::Services::GetServices()->InfoElementPoolMaxSizeSet(max_size);
+}
+
+DslReturnType dsl_info_media_info_get(const wchar_t* file_path, 
+    dsl_media_info* info)
+{
+#if !defined(BUILD_WITH_FFMPEG) || !defined(BUILD_WITH_OPENCV)
+    #error "BUILD_WITH_FFMPEG and BUILD_WITH_OPENCV must be defined"
+#elif (BUILD_WITH_FFMPEG != true) && (BUILD_WITH_OPENCV != true)
+    LOG_ERROR("dsl_info_media_info_get requires one of BUILD_WITH_FFMPEG \
+       or BUILD_WITH_OPENCV to be set true in the Makefile");
+    return DSL_RESULT_API_NOT_SUPPORTED;
+#else    
+    RETURN_IF_PARAM_IS_NULL(file_path);
+    RETURN_IF_PARAM_IS_NULL(info);
+
+    std::wstring wstrFilePath(file_path);
+    std::string cstrFilePath(wstrFilePath.begin(), wstrFilePath.end());
+
+    return DSL::Services::GetServices()->InfoMediaInfoGet(
+        cstrFilePath.c_str(), info);
+#endif        
+}
+
+DslReturnType dsl_info_media_probe_async(const wchar_t** file_paths,
+    dsl_info_media_probe_handler_cb client_handler, void* client_data)
+{
+#if !defined(BUILD_WITH_FFMPEG) || !defined(BUILD_WITH_OPENCV)
+    #error "BUILD_WITH_FFMPEG and BUILD_WITH_OPENCV must be defined"
+#elif (BUILD_WITH_FFMPEG != true) && (BUILD_WITH_OPENCV != true)
+    LOG_ERROR("dsl_info_media_probe_async requires one of BUILD_WITH_FFMPEG \
+       or BUILD_WITH_OPENCV to be set true in the Makefile");
+    return DSL_RESULT_API_NOT_SUPPORTED;
+#else    
+    RETURN_IF_PARAM_IS_NULL(file_paths);
+
+    std::vector<std::string> filePaths;
+    for (const wchar_t** file_path = file_paths; *file_path; file_path++)
+    {
+        std::wstring wstrFilePath(*file_path);
+        filePaths.push_back(std::string(wstrFilePath.begin(), wstrFilePath.end()));
+    }
+    return DSL::Services::GetServices()->InfoMediaProbeAsync(
+        filePaths, client_handler, client_data);
+#endif        
+}
+
+DslReturnType dsl_info_media_probe_workers_get(uint* workers)
+{
+    RETURN_IF_PARAM_IS_NULL(workers);
+
+    return DSL::Services::GetServices()->InfoMediaProbeWorkersGet(workers);
+}
+
+DslReturnType dsl_info_media_probe_workers_set(uint workers)
+{
+    return DSL::Services::GetServices()->InfoMediaProbeWorkersSet(workers);
+}
+
+DslReturnType dsl_info_media_info_cache_clear()
+{
+    return DSL::Services::GetServices()->InfoMediaInfoCacheClear();
+}
+
+DslReturnType dsl_info_memory_stats_get(uint tag, dsl_memory_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    return DSL::Services::GetServices()->InfoMemoryStatsGet(tag, stats);
+}
+
+DslReturnType dsl_info_memory_stats_reset(uint tag)
+{
+    return DSL::Services::GetServices()->InfoMemoryStatsReset(tag);
+}
+
+DslReturnType dsl_info_ode_counters_get(dsl_ode_counter_info** counters, 
+    uint* size)
+{
+    RETURN_IF_PARAM_IS_NULL(counters);
+    RETURN_IF_PARAM_IS_NULL(size);
+
+    return DSL::Services::GetServices()->InfoOdeCountersGet(counters, size);
+}
+
@@ -99,6 +99,7 @@ THE SOFTWARE.
 #define DSL_RESULT_SOURCE_ELEMENT_ADD_FAILED                        0x00020019
 #define DSL_RESULT_SOURCE_ELEMENT_REMOVE_FAILED                     0x0002001A
 #define DSL_RESULT_SOURCE_ELEMENT_NOT_IN_USE                        0x0002001B
+#define DSL_RESULT_SOURCE_EXPORT_FAILED                             0x0002001C
 
 /**
  * Dewarper API Return Values
@@ -469,6 +470,8 @@ THE SOFTWARE.
 #define DSL_RESULT_ODE_ACCUMULATOR_ACTION_ADD_FAILED                0x00900007
 #define DSL_RESULT_ODE_ACCUMULATOR_ACTION_REMOVE_FAILED             0x00900008
 #define DSL_RESULT_ODE_ACCUMULATOR_ACTION_NOT_IN_USE                0x00900009
+#define DSL_RESULT_ODE_ACCUMULATOR_NOT_THE_CORRECT_TYPE             0x0090000A
+#define DSL_RESULT_ODE_ACCUMULATOR_STATS_NOT_AVAILABLE              0x0090000B
 
 /**
  * ODE Heat-Mapper API Return Values
@@ -553,6 +556,50 @@ THE SOFTWARE.
 #define DSL_NVBUF_MEM_TYPE_CUDA_UNIFIED                             3
 #define DSL_NVBUF_MEM_TYPE_SURFACE_ARRAY                            4
 
+/**
+ * Memory Tags - DSL owned allocations are accounted per tag
+ */
+#define DSL_MEMORY_TAG_TRACKED_OBJECTS                              0
+#define DSL_MEMORY_TAG_TRACE_HISTORY                                1
+#define DSL_MEMORY_TAG_DISPLAY_TEXT                                 2
+#define DSL_MEMORY_TAG_FILE_ACTIONS                                 3
+#define DSL_MEMORY_TAG_MAILER                                       4
+#define DSL_MEMORY_TAG_MESSAGE_META                                 5
+#define DSL_MEMORY_TAG_FRAME_SCRATCH                                6
+
+/**
+ * ODE Counter Types - identifies the owner of each set of ODE counters
+ */
+#define DSL_ODE_COUNTER_TYPE_GLOBAL                                 0
+#define DSL_ODE_COUNTER_TYPE_TRIGGER                                1
+#define DSL_ODE_COUNTER_TYPE_ACTION                                 2
+#define DSL_ODE_COUNTER_TYPE_ACCUMULATOR                            3
+
+/**
+ * Tracked Object Kinematics - Tracking Triggers encode each tracked object's
+ * kinematics in pObjectMeta->misc_obj_info[3], 16 bits each, decoded with:
+ * speed - in pixels per second.
+ * heading - in degrees [0, 360), clockwise from the positive x-axis.
+ * path length - in pixels.
+ * time in view - in seconds.
+ */
+#define DSL_OBJECT_KINEMATICS_SPEED(info) \
+    ((uint)(((uint64_t)(info) >> 48) & 0xFFFF))
+#define DSL_OBJECT_KINEMATICS_HEADING(info) \
+    ((double)(((uint64_t)(info) >> 32) & 0xFFFF)/100.0)
+#define DSL_OBJECT_KINEMATICS_PATH_LENGTH(info) \
+    ((uint)(((uint64_t)(info) >> 16) & 0xFFFF))
+#define DSL_OBJECT_KINEMATICS_TIME_IN_VIEW(info) \
+    ((uint)((uint64_t)(info) & 0xFFFF))
+
+/**
+ * ODE Stats Accumulator Metrics - statistics are maintained for each metric
+ */
+#define DSL_ODE_STATS_METRIC_COUNT                                  0
+#define DSL_ODE_STATS_METRIC_CONFIDENCE                             1
+#define DSL_ODE_STATS_METRIC_WIDTH                                  2
+#define DSL_ODE_STATS_METRIC_HEIGHT                                 3
+
 /**
  * @brief DSL Pad Probe Handler - Stream Event Types
  */
@@ -856,6 +903,28 @@ THE SOFTWARE.
 #define DSL_CAPTURE_TYPE_OBJECT                                     0
 #define DSL_CAPTURE_TYPE_FRAME                                      1
 
+/**
+ * @brief Frame-Capture Sink request constants.
+ */
+#define DSL_FRAME_CAPTURE_NEXT_FRAME                                UINT64_MAX
+
+#define DSL_FRAME_CAPTURE_OUTPUT_FILE                               0
+#define DSL_FRAME_CAPTURE_OUTPUT_BUFFER                             1
+
+#define DSL_FRAME_CAPTURE_STATUS_COMPLETE                           0
+#define DSL_FRAME_CAPTURE_STATUS_EXPIRED                            1
+#define DSL_FRAME_CAPTURE_STATUS_MISSED                             2
+#define DSL_FRAME_CAPTURE_STATUS_FAILED                             3
+#define DSL_FRAME_CAPTURE_STATUS_CANCELED                           4
+
+#define DSL_FRAME_CAPTURE_DEFAULT_WORKERS                           1
+
+/**
+ * @brief period for checking Frame-Capture requests for expiry, 
+ * independent of frames arriving. In units of milliseconds.
+ */
+#define DSL_FRAME_CAPTURE_EXPIRY_PERIOD_MS                          100
+
 // Trigger-Always 'when' constants, pre/post check-for-occurrence
 #define DSL_ODE_PRE_OCCURRENCE_CHECK                                0
 #define DSL_ODE_POST_OCCURRENCE_CHECK                               1
@@ -953,6 +1022,12 @@ THE SOFTWARE.
 #define DSL_PIPELINE_SOURCE_UNIQUE_ID_OFFSET_IN_BITS                16
 #define DSL_PIPELINE_SOURCE_STREAM_ID_MASK                          0x0000FFFF
 
+/**
+ * @brief Pipeline Scheduler constants
+ */
+#define DSL_PIPELINE_SCHEDULE_PRIORITY_HIGHEST                      0
+#define DSL_PIPELINE_SCHEDULER_DEFAULT_PERIOD                       1000
+
 #define DSL_DEFAULT_STATE_CHANGE_TIMEOUT_IN_SEC                     10
 #define DSL_DEFAULT_WAIT_FOR_EOS_TIMEOUT_IN_SEC                     2
 
@@ -1280,6 +1355,228 @@ typedef struct dsl_capture_info
 
 } dsl_capture_info;
 
+/**
+ * @struct dsl_media_info
+ * @brief Media information for a video or image file.
+ */
+typedef struct _dsl_media_info
+{
+    /**
+     * @brief width of the video stream in pixels.
+     */
+    uint width;
+
+    /**
+     * @brief height of the video stream in pixels.
+     */
+    uint height;
+
+    /**
+     * @brief frames-per-second fractional numerator.
+     */
+    uint fps_n;
+
+    /**
+     * @brief frames-per-second fractional denominator.
+     */
+    uint fps_d;
+
+} dsl_media_info;
+
+/**
+ * @struct dsl_memory_stats
+ * @brief Allocation statistics for a single DSL_MEMORY_TAG.
+ */
+typedef struct _dsl_memory_stats
+{
+    /**
+     * @brief number of bytes currently allocated and owned by DSL.
+     */
+    uint64_t live_bytes;
+
+    /**
+     * @brief peak live_bytes since start-up or the last reset.
+     */
+    uint64_t peak_bytes;
+
+    /**
+     * @brief total number of allocations since start-up or the last reset.
+     */
+    uint64_t allocations;
+
+    /**
+     * @brief total number of frees since start-up or the last reset. Includes
+     * allocations transferred to, and freed by, DeepStream.
+     */
+    uint64_t frees;
+
+    /**
+     * @brief total number of bytes allocated since start-up or the last reset.
+     */
+    uint64_t allocated_bytes;
+
+    /**
+     * @brief allocations per second since the previous query, 0 on first query.
+     */
+    double allocation_rate;
+
+} dsl_memory_stats;
+
+/**
+ * @struct dsl_ode_counter_info
+ * @brief Snapshot of the counters for the global ODE event count, or for a
+ * single ODE Trigger, Action or Accumulator.
+ */
+typedef struct _dsl_ode_counter_info
+{
+    /**
+     * @brief unique name of the Trigger, Action or Accumulator, 
+     * "global" for the global event count.
+     */
+    const wchar_t* name;
+
+    /**
+     * @brief one of the DSL_ODE_COUNTER_TYPE_* constants.
+     */
+    uint type;
+
+    /**
+     * @brief Global: total ODE events over all Triggers. 
+     * Trigger: events since the last reset. 
+     * Action: number of times invoked by its Triggers. 
+     * Accumulator: number of frames accumulated.
+     */
+    uint64_t events;
+
+    /**
+     * @brief Trigger: frames processed since the first event after the last
+     * reset. 0 for all other types.
+     */
+    uint64_t frames;
+
+    /**
+     * @brief Trigger: total occurrences over all frames, never reset. 
+     * Action: number of occurrences dropped as duplicates. 
+     * 0 for all other types.
+     */
+    uint64_t occurrences;
+
+} dsl_ode_counter_info;
+
+/**
+ * @struct dsl_ode_stats
+ * @brief Statistics for a single source, class and metric over the last
+ * closed window of an ODE Stats Accumulator.
+ */
+typedef struct _dsl_ode_stats
+{
+    /**
+     * @brief unique id of the source the statistics are for.
+     */
+    uint source_id;
+
+    /**
+     * @brief class id the statistics are for.
+     */
+    uint class_id;
+
+    /**
+     * @brief one of the DSL_ODE_STATS_METRIC_* constants.
+     */
+    uint metric;
+
+    /**
+     * @brief frame number of the frame that closed the window.
+     */
+    uint64_t window_end_frame;
+
+    /**
+     * @brief number of values in the window. For DSL_ODE_STATS_METRIC_COUNT
+     * the number of frames, for all other metrics the number of occurrences.
+     */
+    uint64_t count;
+
+    /**
+     * @brief mean and sample variance of all values in the window.
+     */
+    double mean;
+    double variance;
+
+    /**
+     * @brief minimum and maximum values in the window.
+     */
+    double min;
+    double max;
+
+    /**
+     * @brief approximate 50th, 90th and 99th percentiles of all values 
+     * in the window, within 6.25% of the true value.
+     */
+    double p50;
+    double p90;
+    double p99;
+
+} dsl_ode_stats;
+
+/**
+ * @struct dsl_frame_capture_result
+ * @brief Frame-Capture request result provided to the client on completion.
+ */
+typedef struct _dsl_frame_capture_result
+{
+    /**
+     * @brief the unique request id returned by dsl_sink_frame_capture_request.
+     */
+    uint64_t request_id;
+    
+    /**
+     * @brief one of the DSL_FRAME_CAPTURE_STATUS constants.
+     */
+    uint status;
+    
+    /**
+     * @brief frame-number of the captured frame, valid on complete only.
+     */
+    uint64_t frame_number;
+
+    /**
+     * @brief unique source-id of the captured frame, valid on complete only.
+     */
+    uint source_id;
+
+    /**
+     * @brief filename of the saved image, NULL for buffer output.
+     */
+    const wchar_t* filename;
+    
+    /** 
+     * @brief directory path of the saved image, NULL for buffer output.
+     */
+    const wchar_t* dirpath;
+    
+    /**
+     * @brief encoded JPEG image data, NULL for file output. The data is
+     * only valid for the duration of the callback.
+     */
+    const uint8_t* data;
+
+    /**
+     * @brief size of the encoded JPEG image data in bytes.
+     */
+    uint64_t size;
+
+    /**
+     * @brief width of the image in pixels
+     */
+    uint width;
+
+    /**
+     * @brief height of the image in pixels
+     */
+    uint height;
+
+} dsl_frame_capture_result;
+
 /**
  * @struct dsl_webrtc_connection_data
  * @brief a structure of Connection date for a given WebRTC Sink
@@ -1737,6 +2034,19 @@ typedef void (*dsl_state_change_listener_cb)(uint prev_state,
  */
 typedef void (*dsl_eos_listener_cb)(void* client_data);
 
+/**
+ * @brief callback typedef for a client listener function. Once added to a Pipeline, 
+ * the function will be called each time a File Source completes a file while 
+ * the Pipeline is playing in offline mode. The function is called from the 
+ * File Source's streaming thread.
+ * @param[in] source unique name of the File Source that processed the file.
+ * @param[in] file_path absolute path of the completed file.
+ * @param[in] frames number of frames processed from the file.
+ * @param[in] client_data opaque pointer to client's data
+ */
+typedef void (*dsl_file_complete_listener_cb)(const wchar_t* source, 
+    const wchar_t* file_path, uint64_t frames, void* client_data);
+
 /**
  * @brief callback typedef for a client listener function. Once added to a Pipeline, 
  * the function will be called on receipt of Error messages from the Pipeline bus.
@@ -1806,6 +2116,29 @@ typedef void* (*dsl_record_client_listener_cb)(dsl_recording_info* info,
 typedef void (*dsl_capture_complete_listener_cb)(dsl_capture_info* info, 
     void* client_data);
 
+/**
+ * @brief callback typedef for a client to be notified with the result of
+ * each file probed by dsl_info_media_probe_async. The callback is called
+ * from one of the probe worker threads.
+ * @param[in] file_path path of the media file probed.
+ * @param[in] result DSL_RESULT_SUCCESS on successful probe, 
+ * DSL_RESULT_FAILURE otherwise.
+ * @param[in] info media info for the file, valid on success only.
+ * @param[in] client_data opaque pointer to client's user data.
+ */
+typedef void (*dsl_info_media_probe_handler_cb)(const wchar_t* file_path,
+    uint result, dsl_media_info* info, void* client_data);
+
+/**
+ * @brief callback typedef for a client to be notified on completion of a
+ * Frame-Capture Sink request. The callback is called from one of the Sink's
+ * worker threads.
+ * @param[in] result pointer to the request result, see dsl_frame_capture_result.
+ * @param[in] client_data opaque pointer to client's user data.
+ */
+typedef void (*dsl_sink_frame_capture_complete_cb)(
+    dsl_frame_capture_result* result, void* client_data);
+
 /**
  * @brief callback typedef for a client to listen for Player termination events.
  * @param[in] client_data opaque pointer to client's user data
@@ -2991,6 +3324,56 @@ DslReturnType dsl_ode_action_enabled_get(const wchar_t* name, boolean* enabled);
  */
 DslReturnType dsl_ode_action_enabled_set(const wchar_t* name, boolean enabled);
 
+/**
+ * @brief Gets the current occurrence de-duplication settings for the ODE Action
+ * @param[in] name unique name of the ODE Action to query
+ * @param[out] enabled true if de-duplication is enabled, false otherwise.
+ * @param[out] window de-duplication window in milliseconds, 0 = same frame only.
+ * @param[out] fan_in true if fan-in of the fired Triggers is enabled.
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_ACTION otherwise.
+ */
+DslReturnType dsl_ode_action_dedup_get(const wchar_t* name, 
+    boolean* enabled, uint* window, boolean* fan_in);
+
+/**
+ * @brief Sets the occurrence de-duplication settings for the ODE Action. When
+ * enabled, repeat occurrences for the same source and object (tracking-id), 
+ * from any of the Action's Triggers, are dropped within the window.
+ * @param[in] name unique name of the ODE Action to update
+ * @param[in] enabled set to true to enable de-duplication, false to disable.
+ * @param[in] window de-duplication window in milliseconds, 0 = same frame only.
+ * @param[in] fan_in set to true to defer the Action to the end of the frame
+ * so that it's invoked once with the names of all Triggers that fired.
+ * @return DSL_RESULT_SUCCESS on successful set, DSL_RESULT_ODE_ACTION otherwise.
+ */
+DslReturnType dsl_ode_action_dedup_set(const wchar_t* name, 
+    boolean enabled, uint window, boolean fan_in);
+
+/**
+ * @brief Gets the current summary settings for the named Print or Log 
+ * ODE Action.
+ * @param[in] name unique name of the ODE Action to query
+ * @param[out] interval summary interval in milliseconds, 0 = disabled.
+ * @param[out] samples number of full records written per key, per interval.
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_ACTION otherwise.
+ */
+DslReturnType dsl_ode_action_summary_get(const wchar_t* name, 
+    uint* interval, uint* samples);
+
+/**
+ * @brief Sets the summary settings for the named Print or Log ODE Action. 
+ * When enabled, occurrences are aggregated by Trigger, source, and class, 
+ * and one line per key is written from the main-loop at the end of each 
+ * interval. Only the first samples occurrences per key, per interval, are 
+ * written in full.
+ * @param[in] name unique name of the ODE Action to update
+ * @param[in] interval summary interval in milliseconds, 0 = disabled.
+ * @param[in] samples number of full records to write per key, per interval.
+ * @return DSL_RESULT_SUCCESS on successful set, DSL_RESULT_ODE_ACTION otherwise.
+ */
+DslReturnType dsl_ode_action_summary_set(const wchar_t* name, 
+    uint interval, uint samples);
+
 /**
  * @brief Adds a callback to be notified on change of enabled state for a named
  * ODE Action. 
@@ -3462,6 +3845,31 @@ DslReturnType dsl_ode_trigger_persistence_range_get(const wchar_t* name,
  */
 DslReturnType dsl_ode_trigger_persistence_range_set(const wchar_t* name, 
     uint minimum, uint maximum);
+
+/**
+ * @brief Gets the current speed range for a named Tracking Trigger - 
+ * Cross, Instance, Persistence, Latest or Earliest.
+ * @param[in] name unique name of the Tracking Trigger to query
+ * @param[out] minimum minimum speed of a tracked object's bbox center, in 
+ * pixels per second, to trigger an ODE occurrence. 0 = no minimum
+ * @param[out] maximum maximum speed of a tracked object's bbox center, in
+ * pixels per second, to trigger an ODE occurrence. 0 = no maximum
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_speed_range_get(const wchar_t* name, 
+    float* minimum, float* maximum);
+
+/**
+ * @brief Sets the speed range for a named Tracking Trigger - Cross, Instance,
+ * Persistence, Latest or Earliest. Speed is the smoothed speed of the tracked 
+ * object's bbox center, calculated from the frame NTP timestamps.
+ * @param[in] name unique name of the Tracking Trigger to update
+ * @param[in] minimum minimum speed in pixels per second. 0 = no minimum
+ * @param[in] maximum maximum speed in pixels per second. 0 = no maximum
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_speed_range_set(const wchar_t* name, 
+    float minimum, float maximum);
     
 /**
  * @brief Latest Trigger that checks for the persistence of Objects tracked 
@@ -3537,6 +3945,34 @@ DslReturnType dsl_ode_trigger_cross_view_settings_get(const wchar_t* name,
 DslReturnType dsl_ode_trigger_cross_view_settings_set(const wchar_t* name, 
     boolean enabled, const wchar_t* color, uint line_width);
     
+/**
+ * @brief Gets the current level-of-detail settings for the object trace
+ * display of the named cross trigger.
+ * @param[in] name unique name for the ODE Trigger to query
+ * @param[out] tolerance maximum distance in pixels between an object's full 
+ * and displayed trace. 0 = full trace displayed, default.
+ * @param[out] max_traces maximum number of object traces to display per frame,
+ * 0 = no limit, default.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_cross_view_lod_settings_get(const wchar_t* name, 
+    uint* tolerance, uint* max_traces);
+    
+/**
+ * @brief Sets the level-of-detail settings for the object trace display 
+ * of the named cross trigger. Displayed traces are simplified to within the
+ * tolerance and re-simplified only on material change. Line-cross testing
+ * always uses the full traces.
+ * @param[in] name unique name for the ODE Trigger to update
+ * @param[in] tolerance maximum distance in pixels between an object's full 
+ * and displayed trace. Set to 0 to display the full trace.
+ * @param[in] max_traces maximum number of object traces to display per frame.
+ * Set to 0 for no limit.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_cross_view_lod_settings_set(const wchar_t* name, 
+    uint tolerance, uint max_traces);
+    
 
 /**
  * @brief Resets the a named ODE Trigger, setting it's triggered count to 0
@@ -3639,6 +4075,25 @@ DslReturnType dsl_ode_trigger_source_get(const wchar_t* name, const wchar_t** so
  */
 DslReturnType dsl_ode_trigger_source_set(const wchar_t* name, const wchar_t* source);
 
+/**
+ * @brief Adds an additional source name for the ODE Trigger to filter on. Objects
+ * from the source set with dsl_ode_trigger_source_set, or from any additional 
+ * source, meet the Trigger's criteria. Frame-level state is kept for each source.
+ * @param[in] name unique name of the ODE Trigger to update
+ * @param[in] source unique source name to add to the filter.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_source_add(const wchar_t* name, const wchar_t* source);
+
+/**
+ * @brief Removes an additional source name previously added to the ODE Trigger
+ * with dsl_ode_trigger_source_add.
+ * @param[in] name unique name of the ODE Trigger to update
+ * @param[in] source unique source name to remove from the filter.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_source_remove(const wchar_t* name, const wchar_t* source);
+
 /**
  * @brief Gets the current infer component name filter for the ODE Trigger
  * A value of NULL indicates filter disabled (default)
@@ -3672,6 +4127,28 @@ DslReturnType dsl_ode_trigger_class_id_get(const wchar_t* name, uint* class_id);
  */
 DslReturnType dsl_ode_trigger_class_id_set(const wchar_t* name, uint class_id);
 
+/**
+ * @brief Gets the current class_id mask filter for the ODE Trigger
+ * @param[in] name unique name of the ODE Trigger to query
+ * @param[out] class_id_mask returns the current mask in use, 0 = disabled.
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_class_id_mask_get(const wchar_t* name, 
+    uint64_t* class_id_mask);
+
+/**
+ * @brief Sets a class_id mask for the ODE Trigger to filter on. Bit n of the 
+ * mask enables class_id n, for class_ids 0..63. When set, the mask is used in 
+ * place of the single class_id filter, and frame-level state - counts, 
+ * summations, absence, new high and low - is kept and evaluated for each
+ * (source, class_id) key. 
+ * @param[in] name unique name of the ODE Trigger to update
+ * @param[in] class_id_mask new mask to use, 0 to disable.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_class_id_mask_set(const wchar_t* name, 
+    uint64_t class_id_mask);
+
 /**
  * @brief Gets the current class_id_a and class_id_b filters for the ODE Trigger
  * @param[in] name unique name of the Intersection ODE Trigger to query
@@ -4069,6 +4546,65 @@ uint dsl_ode_trigger_list_size();
  */
 DslReturnType dsl_ode_accumulator_new(const wchar_t* name);
 
+/**
+ * @brief Creates a new ODE Stats Accumulator that when added to an ODE Trigger,
+ * maintains streaming statistics -- count, mean, variance, min, max and 
+ * percentiles -- per source and class for each DSL_ODE_STATS_METRIC_* over
+ * tumbling or sliding windows. All ODE Actions are called on window close.
+ * @param[in] name unique name for the ODE Stats Accumulator
+ * @param[in] window window size in frames.
+ * @param[in] slide frames between window closes. Set to 0 or window for
+ * tumbling windows. window must be a multiple of slide, with at most 16
+ * slides per window.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACCUMULATOR_RESULT otherwise.
+ */
+DslReturnType dsl_ode_accumulator_stats_new(const wchar_t* name, 
+    uint window, uint slide);
+
+/**
+ * @brief Gets the current window settings for a named ODE Stats Accumulator.
+ * @param[in] name unique name of the ODE Stats Accumulator to query.
+ * @param[out] window window size in frames.
+ * @param[out] slide frames between window closes.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACCUMULATOR_RESULT otherwise.
+ */
+DslReturnType dsl_ode_accumulator_stats_window_get(const wchar_t* name, 
+    uint* window, uint* slide);
+
+/**
+ * @brief Sets the window settings for a named ODE Stats Accumulator. 
+ * All current statistics are cleared.
+ * @param[in] name unique name of the ODE Stats Accumulator to update.
+ * @param[in] window window size in frames.
+ * @param[in] slide frames between window closes, 0 for tumbling windows.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACCUMULATOR_RESULT otherwise.
+ */
+DslReturnType dsl_ode_accumulator_stats_window_set(const wchar_t* name, 
+    uint window, uint slide);
+
+/**
+ * @brief Gets the statistics for the last closed window of a named ODE Stats
+ * Accumulator for a given source, class and metric.
+ * @param[in] name unique name of the ODE Stats Accumulator to query.
+ * @param[in] source_id unique id of the source to query.
+ * @param[in] class_id class id to query.
+ * @param[in] metric one of the DSL_ODE_STATS_METRIC_* constants.
+ * @param[out] stats statistics for the last closed window.
+ * @return DSL_RESULT_SUCCESS on success, 
+ * DSL_RESULT_ODE_ACCUMULATOR_STATS_NOT_AVAILABLE if no window has closed
+ * for the source and class, DSL_RESULT_ODE_ACCUMULATOR_RESULT otherwise.
+ */
+DslReturnType dsl_ode_accumulator_stats_get(const wchar_t* name, 
+    uint source_id, uint class_id, uint metric, dsl_ode_stats* stats);
+
+/**
+ * @brief Clears all current and closed window statistics for a named 
+ * ODE Stats Accumulator.
+ * @param[in] name unique name of the ODE Stats Accumulator to update.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACCUMULATOR_RESULT otherwise.
+ */
+DslReturnType dsl_ode_accumulator_stats_clear(const wchar_t* name);
+
 /**
  * @brief Adds a named ODE Action to a named ODE Accumulator
  * @param[in] name unique name of the ODE Accumulator to update
@@ -4344,6 +4880,21 @@ DslReturnType dsl_pph_ode_trigger_remove_many(const wchar_t* name, const wchar_t
  */
 DslReturnType dsl_pph_ode_trigger_remove_all(const wchar_t* name);
 
+/**
+ * @brief Replaces the complete set of ODE Triggers for a named ODE Handler with
+ * a new set. The new Triggers, with their Areas and Actions, are built off to
+ * the side and swapped in atomically between batches, without stalling the
+ * stream. Triggers in both sets are unaffected. New Triggers take over the 
+ * tracked-object state of removed Triggers with the same identity - i.e. the
+ * same type, source and class filters.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @param[in] triggers NULL terminated array of the new set of ODE Triggers, 
+ * in execution order. An empty array removes all Triggers.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_trigger_swap(const wchar_t* name, 
+    const wchar_t** triggers);
+
 /**
  * @brief Gets the current setting for the number of Display Meta structures that
  * are allocated for each frame. Each structure can hold up to 16 display elements
@@ -4366,6 +4917,28 @@ DslReturnType dsl_pph_ode_display_meta_alloc_size_get(const wchar_t* name, uint*
  */
 DslReturnType dsl_pph_ode_display_meta_alloc_size_set(const wchar_t* name, uint size);
 
+/**
+ * @brief Gets the current pre-filter enabled setting for the named ODE Handler.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[out] enabled true if the pre-filter is enabled, default = false.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_pre_filter_enabled_get(const wchar_t* name, 
+    boolean* enabled);
+
+/**
+ * @brief Sets the pre-filter enabled setting for the named ODE Handler. When
+ * enabled, the class, confidence, dimension and infer-done criteria of all 
+ * Triggers are tested once for each object, ahead of the Triggers, and each
+ * Trigger only checks the objects that pass its criteria. 
+ * Note: criteria are tested before any ODE Actions are invoked for the frame.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @param[in] enabled set to true to enable the pre-filter, false to disable.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_pre_filter_enabled_set(const wchar_t* name, 
+    boolean enabled);
+
 /**
  * @brief creates a new, uniquely named Custom pad-probe-handler to process a buffer
  * @param[in] name unique component name for the new Custom Handler
@@ -4444,6 +5017,71 @@ DslReturnType dsl_pph_eos_new(const wchar_t* name,
  */
 DslReturnType dsl_pph_stream_event_new(const wchar_t* name,
     dsl_pph_stream_event_handler_cb handler, void* client_data);
+
+/**
+ * @brief Creates a new, uniquely named Meta-Stream Pad Probe Handler (PPH).
+ * Once added to a Component's Pad, the PPH publishes the object metadata and
+ * ODE occurrences for each frame to all Websocket clients connected on the
+ * given path, using a compact binary encoding. Requires BUILD_WEBRTC=true.
+ * @param[in] name unique name for the new Pad Probe Handler.
+ * @param[in] path Websocket path for clients to connect on. The path is
+ * added to the Websocket Server if not already handled.
+ * @param[in] key_frame_interval number of frames between key-frames. 
+ * Bounding boxes in all other frames are delta encoded.
+ * @param[in] max_rate default maximum number of messages per second, per
+ * source, for clients that don't request a rate. 0 = no limit.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_meta_stream_new(const wchar_t* name, const wchar_t* path,
+    uint key_frame_interval, uint max_rate);
+
+/**
+ * @brief Gets the current key-frame interval for the named Meta-Stream PPH.
+ * @param[in] name unique name of the Meta-Stream PPH to query.
+ * @param[out] key_frame_interval current number of frames between key-frames.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_meta_stream_key_frame_interval_get(const wchar_t* name, 
+    uint* key_frame_interval);
+
+/**
+ * @brief Sets the key-frame interval for the named Meta-Stream PPH.
+ * @param[in] name unique name of the Meta-Stream PPH to update.
+ * @param[in] key_frame_interval new number of frames between key-frames.
+ * Must be greater than 0.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_meta_stream_key_frame_interval_set(const wchar_t* name, 
+    uint key_frame_interval);
+
+/**
+ * @brief Gets the default max-rate for new clients of the named Meta-Stream PPH.
+ * @param[in] name unique name of the Meta-Stream PPH to query.
+ * @param[out] max_rate current max messages per second, per source. 0 = no limit.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_meta_stream_max_rate_get(const wchar_t* name, 
+    uint* max_rate);
+
+/**
+ * @brief Sets the default max-rate for new clients of the named Meta-Stream PPH.
+ * @param[in] name unique name of the Meta-Stream PPH to update.
+ * @param[in] max_rate new max messages per second, per source. 0 = no limit.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_meta_stream_max_rate_set(const wchar_t* name, 
+    uint max_rate);
+
+/**
+ * @brief Gets the current publishing statistics for the named Meta-Stream PPH.
+ * @param[in] name unique name of the Meta-Stream PPH to query.
+ * @param[out] clients number of currently connected clients.
+ * @param[out] sent total number of messages sent to all clients.
+ * @param[out] dropped total number of messages dropped for slow clients.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_meta_stream_stats_get(const wchar_t* name, 
+    uint* clients, uint64_t* sent, uint64_t* dropped);
     
 /**
  * @brief gets the current enabled setting for the named Pad Probe Handler
@@ -5386,6 +6024,64 @@ DslReturnType dsl_source_interpipe_accept_settings_get(const wchar_t* name,
 DslReturnType dsl_source_interpipe_accept_settings_set(const wchar_t* name,
     boolean accept_eos, boolean accept_events);
     
+/**
+ * @brief Creates a new, uniquely named Shared Source that consumes the decoded
+ * stream of a URI through the process-wide Source Registry. All Shared Sources
+ * for the same URI, in any number of Pipelines, share a single connection and
+ * decoder. The decoder is started when the first Shared Source for the URI is 
+ * linked (on Pipeline play) and stopped when the last is unlinked.
+ * @param[in] name unique name for the new Shared Source
+ * @param[in] uri URI to consume, e.g. an RTSP camera's URI.
+ * @param[in] is_live set to true if the URI is a live source, false otherwise.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_shared_new(const wchar_t* name, const wchar_t* uri,
+    boolean is_live);
+
+/**
+ * @brief Gets the current queue and rate settings for the named Shared Source.
+ * @param[in] name unique name of the Shared Source to query.
+ * @param[out] queue_size max number of decoded buffers queued for the Source
+ * before the oldest is dropped. Default = 4.
+ * @param[out] max_rate max frames per second accepted by the Source from the
+ * shared decoder. 0 = no limit (default).
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_shared_settings_get(const wchar_t* name,
+    uint* queue_size, uint* max_rate);
+
+/**
+ * @brief Sets the queue and rate settings for the named Shared Source. 
+ * The settings can be updated at any time.
+ * @param[in] name unique name of the Shared Source to update.
+ * @param[in] queue_size max number of decoded buffers to queue, must be > 0.
+ * @param[in] max_rate max frames per second to accept. 0 = no limit.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_shared_settings_set(const wchar_t* name,
+    uint queue_size, uint max_rate);
+
+/**
+ * @brief Gets the buffer counts for the named Shared Source since it was 
+ * last linked.
+ * @param[in] name unique name of the Shared Source to query.
+ * @param[out] received number of buffers received from the shared decoder.
+ * @param[out] dropped number of buffers dropped by the rate limit or on
+ * queue overflow.
+ * @param[out] delivered number of buffers delivered downstream.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_shared_stats_get(const wchar_t* name,
+    uint64_t* received, uint64_t* dropped, uint64_t* delivered);
+
+/**
+ * @brief Gets the number of shared decoders currently in use, one for each
+ * URI consumed by one or more linked Shared Sources.
+ * @param[out] count current number of shared decoders.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_shared_decoder_count_get(uint* count);
+
 /**
  * @brief Creates a new, uniquely name Duplicate Source used to duplicate the stream 
  * of another named Video Source. Both the Duplicate Source and the Original Source
@@ -5512,6 +6208,20 @@ DslReturnType dsl_source_video_buffer_out_frame_rate_get(const wchar_t* name,
 DslReturnType dsl_source_video_buffer_out_frame_rate_set(const wchar_t* name, 
     uint fps_n, uint fps_d);
 
+/**
+ * @brief Gets the buffer-out frame counters for the named Video Source. When
+ * the frame-rate is scaled down, frames are dropped prior to conversion so 
+ * that only the frames kept are converted, cropped, and scaled. The counters
+ * are reset each time the Source is linked.
+ * @param[in] name unique name of the source to query
+ * @param[out] received number of frames received for buffer-out.
+ * @param[out] dropped number of frames dropped prior to conversion.
+ * @param[out] converted number of frames passed on for conversion.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_video_buffer_out_stats_get(const wchar_t* name, 
+    uint64_t* received, uint64_t* dropped, uint64_t* converted);
+
 /**
  * @brief Gets one of the buffer-out crop-rectangle for the named Video Source
  * The buffer can be cropped pre-video-conversion and/or post-video-conversion.
@@ -5619,6 +6329,31 @@ DslReturnType dsl_source_uri_uri_get(const wchar_t* name, const wchar_t** uri);
  */
 DslReturnType dsl_source_uri_uri_set(const wchar_t* name, const wchar_t* uri);
 
+/**
+ * @brief Gets the current key-frame scan interval for the named URI or 
+ * File Source.
+ * @param[in] name name of the Source to query.
+ * @param[out] interval 0 if scanning is disabled, otherwise N to pass every
+ * Nth key-frame to the decoder.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_uri_keyframe_scan_get(const wchar_t* name, 
+    uint* interval);
+
+/**
+ * @brief Sets the key-frame scan interval for the named URI or File Source.
+ * When scanning, only key-frames are passed to the decoder and the demuxer 
+ * is seeked in key-unit trick-mode if supported by the container. Frame 
+ * timestamps are preserved. For non-live sources only, and only when the 
+ * Source is not linked.
+ * @param[in] name name of the Source to update.
+ * @param[in] interval 0 to disable scanning, 1 to pass every key-frame, 
+ * N to pass every Nth key-frame.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_uri_keyframe_scan_set(const wchar_t* name, 
+    uint interval);
+
 /**
  * @brief Gets the current URI in use by the named RTSP Source.
  * @param[in] name name of the Source to query.
@@ -5822,6 +6557,40 @@ DslReturnType dsl_source_rtsp_tap_add(const wchar_t* name, const wchar_t* tap);
  */
 DslReturnType dsl_source_rtsp_tap_remove(const wchar_t* name);
 
+/**
+ * @brief Gets the current settings for the named RTSP Source's shared encoded
+ * cache. The cache holds references to the last N seconds of parsed, encoded 
+ * access units received from the server, indexed by key-frame.
+ * @param[in] name unique name of the RTSP Source to query.
+ * @param[out] duration maximum duration to cache in seconds, 0 = disabled.
+ * @param[out] max_size memory budget for the cache in bytes, 0 = no limit.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_encoded_cache_settings_get(const wchar_t* name,
+    uint* duration, uint64_t* max_size);
+
+/**
+ * @brief Sets the settings for the named RTSP Source's shared encoded cache.
+ * The cache is disabled by default. 
+ * @param[in] name unique name of the RTSP Source to update.
+ * @param[in] duration maximum duration to cache in seconds, 0 = disabled.
+ * @param[in] max_size memory budget for the cache in bytes, 0 = no limit.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_encoded_cache_settings_set(const wchar_t* name,
+    uint duration, uint64_t max_size);
+
+/**
+ * @brief Exports the last N seconds of the named RTSP Source's shared encoded 
+ * cache, starting at the nearest key-frame, to an elementary stream file.
+ * @param[in] name unique name of the RTSP Source to export from.
+ * @param[in] duration duration of encoded data to export in seconds.
+ * @param[in] file_path absolute or relative path for the new file.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_encoded_cache_export(const wchar_t* name,
+    uint duration, const wchar_t* file_path);
+
 /**
  * @brief Gets the unique-id assigned to the Source component once added
  * to a Pipeline. The unique source-id will be derived from the 
@@ -8191,6 +8960,50 @@ DslReturnType dsl_sink_frame_capture_initiate(const wchar_t* name);
  */
 DslReturnType dsl_sink_frame_capture_schedule(const wchar_t* name,
     uint64_t frame_number);
+
+/**
+ * @brief Adds a Frame-Capture request to the named Frame-Capture Sink's queue.
+ * All pending requests for the same frame are served with a single capture
+ * and encode on one of the Sink's worker threads. 
+ * @param[in] name unique name of the Frame-Capture Sink to use.
+ * @param[in] frame_number unique frame-number of the frame to capture, or
+ * DSL_FRAME_CAPTURE_NEXT_FRAME to capture the next frame.
+ * @param[in] output_type one of the DSL_FRAME_CAPTURE_OUTPUT constants. 
+ * File output is saved to the output directory of the Sink's Capture Action.
+ * @param[in] timeout maximum time to wait for the frame in milliseconds, 
+ * the request expires on timeout. Set to 0 for no timeout.
+ * @param[in] client_handler callback to call on request completion. 
+ * Required for buffer output, may be NULL for file output.
+ * @param[in] client_data opaque pointer to client data passed into the
+ * client_handler function.
+ * @param[out] request_id unique id for the new request.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure.
+ */
+DslReturnType dsl_sink_frame_capture_request(const wchar_t* name,
+    uint64_t frame_number, uint output_type, uint timeout,
+    dsl_sink_frame_capture_complete_cb client_handler, void* client_data,
+    uint64_t* request_id);
+
+/**
+ * @brief Gets the current number of encoder worker threads for the named
+ * Frame-Capture Sink.
+ * @param[in] name unique name of the Frame-Capture Sink to query.
+ * @param[out] workers current number of worker threads. 
+ * Default = DSL_FRAME_CAPTURE_DEFAULT_WORKERS.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure.
+ */
+DslReturnType dsl_sink_frame_capture_workers_get(const wchar_t* name,
+    uint* workers);
+
+/**
+ * @brief Sets the number of encoder worker threads for the named
+ * Frame-Capture Sink.
+ * @param[in] name unique name of the Frame-Capture Sink to update.
+ * @param[in] workers new number of worker threads to use, must be > 0.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure.
+ */
+DslReturnType dsl_sink_frame_capture_workers_set(const wchar_t* name,
+    uint workers);
     
 /**
  * @brief creates a new, uniquely named WebRTC Sink component
@@ -9485,6 +10298,151 @@ DslReturnType dsl_pipeline_link_method_get(const wchar_t* name, uint* link_metho
  */
 DslReturnType dsl_pipeline_link_method_set(const wchar_t* name, uint link_method);
 
+/**
+ * @brief Gets the current offline mode enabled setting for the named Pipeline.
+ * @param[in] name unique name of the Pipeline to query.
+ * @param[out] enabled true if offline mode is enabled, false otherwise.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_offline_enabled_get(const wchar_t* name, 
+    boolean* enabled);
+
+/**
+ * @brief Sets the offline mode enabled setting for the named Pipeline. When
+ * enabled, the Pipeline plays as fast as possible without a clock, and each
+ * File Source that reaches the end of its file is rebound to the next file
+ * in the Pipeline's file queue without stopping the Pipeline. A File Source
+ * sends EOS downstream only when the queue is empty. Non-live Pipelines only.
+ * @param[in] name unique name of the Pipeline to update.
+ * @param[in] enabled set to true to enable offline mode, false to disable.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_offline_enabled_set(const wchar_t* name, 
+    boolean enabled);
+
+/**
+ * @brief Adds a list of files to the back of the named Pipeline's offline
+ * file queue. Files can be added at any time, including while playing.
+ * @param[in] name unique name of the Pipeline to update.
+ * @param[in] file_paths NULL terminated list of media files to add.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_offline_file_queue_add(const wchar_t* name, 
+    const wchar_t** file_paths);
+
+/**
+ * @brief Gets the number of files waiting in the named Pipeline's offline
+ * file queue.
+ * @param[in] name unique name of the Pipeline to query.
+ * @param[out] size current number of files in the queue.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_offline_file_queue_size_get(const wchar_t* name, 
+    uint* size);
+
+/**
+ * @brief Removes all files waiting in the named Pipeline's offline file queue.
+ * @param[in] name unique name of the Pipeline to update.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_offline_file_queue_clear(const wchar_t* name);
+
+/**
+ * @brief Gets the aggregate statistics for the named Pipeline's current, or
+ * last, offline run. Statistics are reset each time the Pipeline is played.
+ * @param[in] name unique name of the Pipeline to query.
+ * @param[out] files_completed number of files processed to completion.
+ * @param[out] frames_processed total number of frames from all completed files.
+ * @param[out] frames_per_second aggregate frames per second from the start
+ * of the run to the completion of the last file.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_offline_stats_get(const wchar_t* name, 
+    uint* files_completed, uint64_t* frames_processed, double* frames_per_second);
+
+/**
+ * @brief Adds a callback to be notified on the completion of each file
+ * while the Pipeline is playing in offline mode.
+ * @param[in] name name of the pipeline to update
+ * @param[in] listener pointer to the client's function to add
+ * @param[in] client_data opaque pointer to client data passed into the listener function.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_offline_file_complete_listener_add(const wchar_t* name, 
+    dsl_file_complete_listener_cb listener, void* client_data);
+
+/**
+ * @brief Removes a callback previously added with 
+ * dsl_pipeline_offline_file_complete_listener_add
+ * @param[in] name name of the pipeline to update
+ * @param[in] listener pointer to the client's function to remove
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_offline_file_complete_listener_remove(const wchar_t* name, 
+    dsl_file_complete_listener_cb listener);
+
+/**
+ * @brief Adds the named Pipeline to the process-wide Pipeline Scheduler, or
+ * updates its schedule if already scheduled. While a Pipeline plays below its
+ * target frame-rate, the Scheduler throttles the Primary Inference of all 
+ * lower priority Pipelines -- lowest priority first -- until the target is met.
+ * @param[in] name unique name of the Pipeline to schedule.
+ * @param[in] priority scheduling priority. 0 = DSL_PIPELINE_SCHEDULE_PRIORITY_HIGHEST.
+ * @param[in] target_fps target frame-rate for all sources combined, in frames
+ * per second. 0 = best effort, the Pipeline can be throttled but never throttles.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_schedule_set(const wchar_t* name, 
+    uint priority, double target_fps);
+
+/**
+ * @brief Gets the current schedule for the named Pipeline.
+ * @param[in] name unique name of the Pipeline to query.
+ * @param[out] priority current scheduling priority.
+ * @param[out] target_fps current target frame-rate in frames per second.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_schedule_get(const wchar_t* name, 
+    uint* priority, double* target_fps);
+
+/**
+ * @brief Removes the named Pipeline from the Pipeline Scheduler. Any throttling
+ * of the Pipeline's Primary Inference is removed.
+ * @param[in] name unique name of the Pipeline to remove.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_schedule_remove(const wchar_t* name);
+
+/**
+ * @brief Gets the current scheduling stats for the named Pipeline.
+ * @param[in] name unique name of the Pipeline to query.
+ * @param[out] achieved_fps frame-rate achieved over the last scheduling period
+ * for all sources combined. 0 if the Pipeline is not playing.
+ * @param[out] target_fps current target frame-rate in frames per second.
+ * @param[out] throttle_factor current throttle factor for the Pipeline's 
+ * Primary Inference. The effective interval is (interval+1)*throttle_factor-1.
+ * 1 = not throttled.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_schedule_stats_get(const wchar_t* name, 
+    double* achieved_fps, double* target_fps, uint* throttle_factor);
+
+/**
+ * @brief Gets the current period for the Pipeline Scheduler.
+ * @param[out] period current period in milliseconds. 
+ * Default = DSL_PIPELINE_SCHEDULER_DEFAULT_PERIOD.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_scheduler_period_get(uint* period);
+
+/**
+ * @brief Sets the period for the Pipeline Scheduler. Frame-rates are measured,
+ * and throttling adjusted, once per period.
+ * @param[in] period new period in milliseconds. Must be greater than 0.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_scheduler_period_set(uint period);
+
 /**
  * @brief pauses a Pipeline if in a state of playing
  * @param[in] name unique name of the Pipeline to pause.
@@ -10355,6 +11313,100 @@ DslReturnType dsl_info_log_file_set_with_ts(const wchar_t* file_path);
  */
 DslReturnType dsl_info_log_function_restore();
 
+/**
+ * @brief Gets the current maximum number of released GStreamer elements, per 
+ * element factory, that are kept for reuse by new components.
+ * @param[out] max_size current max size. 0 = element pooling disabled.
+ * @return true on successful query, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_element_pool_max_size_get(uint* max_size);
+
+/**
+ * @brief Sets the maximum number of released GStreamer elements, per element 
+ * factory, to keep for reuse by new components. Pooled elements in excess of
+ * the new size are freed.
+ * @param[in] max_size new max size to use. Set to 0 to disable element pooling.
+ * @return true on successful update, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_element_pool_max_size_set(uint max_size);
+
+/**
+ * @brief Gets the video dimensions and frame-rate for a media file. Results
+ * are cached, keyed by file path, size and modification time, and shared with 
+ * all File and Image Sources. Only the container headers are read when they
+ * provide all required information.
+ * @param[in] file_path relative or absolute path to the media file.
+ * @param[out] info media info for the file.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_media_info_get(const wchar_t* file_path, 
+    dsl_media_info* info);
+
+/**
+ * @brief Probes a list of media files in parallel, adding the results to 
+ * the media info cache. Use to probe a folder of files before processing.
+ * @param[in] file_paths NULL terminated list of media files to probe.
+ * @param[in] client_handler callback to call with the result of each file,
+ * may be NULL to only populate the cache.
+ * @param[in] client_data opaque pointer to client data passed into the
+ * client_handler function.
+ * @return DSL_RESULT_SUCCESS on successful queue, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_media_probe_async(const wchar_t** file_paths,
+    dsl_info_media_probe_handler_cb client_handler, void* client_data);
+
+/**
+ * @brief Gets the current number of worker threads used to probe media files
+ * asynchronously.
+ * @param[out] workers current number of workers. Default = 4.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_media_probe_workers_get(uint* workers);
+
+/**
+ * @brief Sets the number of worker threads used to probe media files
+ * asynchronously.
+ * @param[in] workers new number of workers, must be > 0.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_media_probe_workers_set(uint workers);
+
+/**
+ * @brief Clears all cached media info.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_media_info_cache_clear();
+
+/**
+ * @brief Gets the allocation statistics for one of the DSL_MEMORY_TAG_* 
+ * subsystems. Use to attribute memory growth in long running Pipelines.
+ * @param[in] tag one of the DSL_MEMORY_TAG_* constants.
+ * @param[out] stats current statistics for the tag.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_memory_stats_get(uint tag, dsl_memory_stats* stats);
+
+/**
+ * @brief Resets the allocation statistics for one of the DSL_MEMORY_TAG_*
+ * subsystems. The counts are cleared and the peak is reset to the current
+ * live bytes.
+ * @param[in] tag one of the DSL_MEMORY_TAG_* constants.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_memory_stats_reset(uint tag);
+
+/**
+ * @brief Gets a snapshot of all ODE counters - the global event count, and
+ * the counters for every ODE Trigger, Action and Accumulator - in a single 
+ * call. The counters are read without locking any ODE component so that
+ * monitoring never contends with ODE evaluation.
+ * @param[out] counters array of counter info, valid until the next call.
+ * @param[out] size number of entries in the counters array.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_ode_counters_get(dsl_ode_counter_info** counters, 
+    uint* size);
+
 
 EXTERN_C_END
 
@@ -24,6 +24,7 @@ THE SOFTWARE.
 
 #include "DslDisplayTypes.h"
 #include "DslServices.h"
+#include "DslMemoryTracker.h"
 
 namespace DSL
 {
@@ -365,6 +366,11 @@ namespace DSL
         m_pColor->Unlock();
     }
     
+    bool RgbaFont::IsStatic()
+    {
+        return m_pColor->IsStatic();
+    }
+    
     // ********************************************************************
 
     RgbaText::RgbaText(const char* name, 
@@ -420,6 +426,8 @@ namespace DSL
         m_pShadowFont = DSL_RGBA_FONT_NEW("", 
             m_pFont->m_fontName.c_str(), m_pFont->font_size, m_pShadowColor);
             
+        // the text may already be part of a prebuilt overlay layer
+        StaticOverlay::Invalidate();
         return true;
     }
     
@@ -457,12 +465,12 @@ namespace DSL
             pTextParams->text_bg_clr = *m_pShadowColor;
 
             // need to allocate storage for actual text, then copy.
-            pTextParams->display_text = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
+            pTextParams->display_text = DisplayTextAlloc(MAX_DISPLAY_LEN);
             m_text.copy(pTextParams->display_text, MAX_DISPLAY_LEN, 0);
 
             pTextParams->font_params = *m_pShadowFont;
             // Font, font-size, font-color
-            pTextParams->font_params.font_name = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
+            pTextParams->font_params.font_name = DisplayTextAlloc(MAX_DISPLAY_LEN);
             m_pShadowFont->m_fontName.copy(pTextParams->font_params.font_name, 
                 MAX_DISPLAY_LEN, 0);
                 
@@ -476,15 +484,21 @@ namespace DSL
         Unlock();
         
         // need to allocate storage for actual text, then copy.
-        pTextParams->display_text = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
+        pTextParams->display_text = DisplayTextAlloc(MAX_DISPLAY_LEN);
         m_text.copy(pTextParams->display_text, MAX_DISPLAY_LEN, 0);
         
         // Font, font-size, font-color
-        pTextParams->font_params.font_name = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
+        pTextParams->font_params.font_name = DisplayTextAlloc(MAX_DISPLAY_LEN);
         m_pFont->m_fontName.copy(pTextParams->font_params.font_name, 
             MAX_DISPLAY_LEN, 0);
     }
         
+    bool RgbaText::IsStatic()
+    {
+        return m_pFont->IsStatic() and m_pBgColor->IsStatic() and
+            (!m_shadowEnabled or m_pShadowColor->IsStatic());
+    }
+        
     // ********************************************************************
 
     RgbaLine::RgbaLine(const char* name, uint x1, uint y1, uint x2, uint y2, 
@@ -529,6 +543,11 @@ namespace DSL
         pDisplayMeta->line_params[pDisplayMeta->num_lines++] = *this;
     }
     
+    bool RgbaLine::IsStatic()
+    {
+        return m_pColor->IsStatic();
+    }
+    
     // ********************************************************************
 
     RgbaArrow::RgbaArrow(const char* name, uint x1, uint y1, uint x2, uint y2, 
@@ -573,6 +592,11 @@ namespace DSL
         pDisplayMeta->arrow_params[pDisplayMeta->num_arrows++] = *this;
     }
 
+    bool RgbaArrow::IsStatic()
+    {
+        return m_pColor->IsStatic();
+    }
+    
     // ********************************************************************
 
     RgbaRectangle::RgbaRectangle(const char* name, 
@@ -625,6 +649,11 @@ namespace DSL
         pDisplayMeta->rect_params[pDisplayMeta->num_rects++] = *this;
     }
     
+    bool RgbaRectangle::IsStatic()
+    {
+        return m_pColor->IsStatic() and m_pBgColor->IsStatic();
+    }
+    
     // ********************************************************************
 
     RgbaPolygon::RgbaPolygon(const char* name, const dsl_coordinate* coordinates, 
@@ -688,6 +717,11 @@ namespace DSL
         }
     }
 
+    bool RgbaPolygon::IsStatic()
+    {
+        return m_pColor->IsStatic();
+    }
+    
     // ********************************************************************
 
     RgbaMultiLine::RgbaMultiLine(const char* name, 
@@ -750,6 +784,11 @@ namespace DSL
             pDisplayMeta->line_params[pDisplayMeta->num_lines++] = line;
         }
     }
+    bool RgbaMultiLine::IsStatic()
+    {
+        return m_pColor->IsStatic();
+    }
+    
     // ********************************************************************
 
     RgbaCircle::RgbaCircle(const char* name, uint x_center, uint y_center, uint radius,
@@ -789,6 +828,11 @@ namespace DSL
             displayMetaData.at(0)->num_circles++] = *this;
     }
 
+    bool RgbaCircle::IsStatic()
+    {
+        return m_pColor->IsStatic() and m_pBgColor->IsStatic();
+    }
+    
     // ********************************************************************
 
     SourceDimensions::SourceDimensions(const char* name, 
@@ -921,5 +965,129 @@ namespace DSL
         }
         
     }
+
+    // ********************************************************************
+
+    // Initialize the process-wide overlay generation. Layers start at 0 so
+    // that each is built on first use.
+    gint StaticOverlay::s_generation = 1;
+
+    StaticOverlay::StaticOverlay()
+        : m_generation(0)
+    {
+        LOG_FUNC();
+    }
+
+    StaticOverlay::~StaticOverlay()
+    {
+        LOG_FUNC();
+
+        Clear();
+    }
+
+    void StaticOverlay::Invalidate()
+    {
+        g_atomic_int_inc(&s_generation);
+    }
+
+    uint StaticOverlay::GetCurrentGeneration()
+    {
+        return g_atomic_int_get(&s_generation);
+    }
+
+    uint StaticOverlay::GetGeneration()
+    {
+        return m_generation;
+    }
+
+    void StaticOverlay::Build(const std::vector<DSL_DISPLAY_TYPE_PTR>& displayTypes,
+        uint numBlocks, uint generation, NvDsFrameMeta* pFrameMeta)
+    {
+        LOG_FUNC();
+
+        Clear();
+
+        // Each Display Type adds its meta to the prebuilt blocks exactly as 
+        // it would to a frame's display meta, with the same overflow rules.
+        m_blocks.resize(numBlocks);
+        std::vector<NvDsDisplayMeta*> blocks;
+        for (auto& iblock: m_blocks)
+        {
+            blocks.push_back(&iblock);
+        }
+        for (const auto& ivec: displayTypes)
+        {
+            ivec->AddMeta(blocks, pFrameMeta);
+        }
+        m_generation = generation;
+    }
+
+    void StaticOverlay::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData)
+    {
+//        LOG_FUNC();
+
+        uint numBlocks = std::min(m_blocks.size(), displayMetaData.size());
+
+        for (uint i = 0; i < numBlocks; i++)
+        {
+            const NvDsDisplayMeta& block = m_blocks[i];
+            NvDsDisplayMeta* pDisplayMeta = displayMetaData[i];
+
+            // The layer is added first, so the copies below are normally 
+            // whole-array, but never overrun space already in use.
+            uint count = std::min(block.num_rects, 
+                MAX_ELEMENTS_IN_DISPLAY_META - pDisplayMeta->num_rects);
+            memcpy(&pDisplayMeta->rect_params[pDisplayMeta->num_rects],
+                block.rect_params, count*sizeof(NvOSD_RectParams));
+            pDisplayMeta->num_rects += count;
+
+            count = std::min(block.num_lines, 
+                MAX_ELEMENTS_IN_DISPLAY_META - pDisplayMeta->num_lines);
+            memcpy(&pDisplayMeta->line_params[pDisplayMeta->num_lines],
+                block.line_params, count*sizeof(NvOSD_LineParams));
+            pDisplayMeta->num_lines += count;
+
+            count = std::min(block.num_arrows, 
+                MAX_ELEMENTS_IN_DISPLAY_META - pDisplayMeta->num_arrows);
+            memcpy(&pDisplayMeta->arrow_params[pDisplayMeta->num_arrows],
+                block.arrow_params, count*sizeof(NvOSD_ArrowParams));
+            pDisplayMeta->num_arrows += count;
+
+            count = std::min(block.num_circles, 
+                MAX_ELEMENTS_IN_DISPLAY_META - pDisplayMeta->num_circles);
+            memcpy(&pDisplayMeta->circle_params[pDisplayMeta->num_circles],
+                block.circle_params, count*sizeof(NvOSD_CircleParams));
+            pDisplayMeta->num_circles += count;
+
+            // Text storage is freed by the display meta on release, so each
+            // frame needs its own copy of the display and font-name strings.
+            count = std::min(block.num_labels, 
+                MAX_ELEMENTS_IN_DISPLAY_META - pDisplayMeta->num_labels);
+            for (uint j = 0; j < count; j++)
+            {
+                NvOSD_TextParams* pTextParams = &pDisplayMeta->
+                    text_params[pDisplayMeta->num_labels++];
+                    
+                *pTextParams = block.text_params[j];
+                pTextParams->display_text = 
+                    DisplayTextDup(block.text_params[j].display_text);
+                pTextParams->font_params.font_name = 
+                    DisplayTextDup(block.text_params[j].font_params.font_name);
+            }
+        }
+    }
+
+    void StaticOverlay::Clear()
+    {
+        for (auto& iblock: m_blocks)
+        {
+            for (uint i = 0; i < iblock.num_labels; i++)
+            {
+                g_free(iblock.text_params[i].display_text);
+                g_free(iblock.text_params[i].font_params.font_name);
+            }
+        }
+        m_blocks.clear();
+        m_generation = 0;
+    }
 }
-    
@@ -171,6 +171,13 @@ namespace DSL
         virtual void AddMeta(std::vector<NvDsDisplayMeta*>& 
             displayMetaData, NvDsFrameMeta* pFrameMeta);
             
+        /**
+         * @brief Determines if the Display Type's meta is identical for every
+         * frame, and can therefore be prebuilt into a StaticOverlay.
+         * @return true if static, false otherwise (default).
+         */
+        virtual bool IsStatic(){return false;};
+            
     protected:
         
         /**
@@ -223,6 +230,12 @@ namespace DSL
          * @brief noop SetNext for static color.
          */
         virtual void SetNext(){};
+
+        /**
+         * @brief A fixed RGBA Color never changes value on SetNext.
+         * @return true always for the base RGBA Color.
+         */
+        virtual bool IsStatic(){return true;};
     };
 
     // ********************************************************************
@@ -288,6 +301,12 @@ namespace DSL
          * @brief Set the RGB values to the next color in the Palette.
          */
         void SetNext();
+
+        /**
+         * @brief Dynamic colors can change on every frame.
+         * @return false always.
+         */
+        bool IsStatic(){return false;};
         
         /**
          * @brief Gets the palette index.
@@ -348,6 +367,12 @@ namespace DSL
          * @brief Set the RGB values to the next random color.
          */
         void SetNext();
+
+        /**
+         * @brief Dynamic colors can change on every frame.
+         * @return false always.
+         */
+        bool IsStatic(){return false;};
         
     private:
     
@@ -391,6 +416,12 @@ namespace DSL
          * @brief Calls the client's call back to get the next RGB values.
          */
         void SetNext();
+
+        /**
+         * @brief Dynamic colors can change on every frame.
+         * @return false always.
+         */
+        bool IsStatic(){return false;};
         
     private:
     
@@ -437,6 +468,12 @@ namespace DSL
          */
         inline void Unlock();
         
+        /**
+         * @brief A font is static if its RGBA Color is static.
+         * @return true if static, false otherwise.
+         */
+        bool IsStatic();
+
         /**
          * @breif actual tty font name
          */
@@ -498,6 +535,13 @@ namespace DSL
          */
         void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Determines if the Text's meta is identical for every frame,
+         * i.e. its Font, background and shadow colors are all static.
+         * @return true if static, false otherwise.
+         */
+        bool IsStatic();
         
         std::string m_text;
         
@@ -569,6 +613,13 @@ namespace DSL
          */
         void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Determines if the Display Type's meta is identical for every
+         * frame, i.e. all of its RGBA Colors are static.
+         * @return true if static, false otherwise.
+         */
+        bool IsStatic();
             
     private:
     
@@ -609,6 +660,13 @@ namespace DSL
          */
         void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Determines if the Display Type's meta is identical for every
+         * frame, i.e. all of its RGBA Colors are static.
+         * @return true if static, false otherwise.
+         */
+        bool IsStatic();
             
     private:
     
@@ -652,6 +710,13 @@ namespace DSL
          */
         void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Determines if the Display Type's meta is identical for every
+         * frame, i.e. all of its RGBA Colors are static.
+         * @return true if static, false otherwise.
+         */
+        bool IsStatic();
             
     private:
     
@@ -726,6 +791,13 @@ namespace DSL
         void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
+        /**
+         * @brief Determines if the Display Type's meta is identical for every
+         * frame, i.e. all of its RGBA Colors are static.
+         * @return true if static, false otherwise.
+         */
+        bool IsStatic();
+
     private:
     
         /**
@@ -793,6 +865,13 @@ namespace DSL
         void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
+        /**
+         * @brief Determines if the Display Type's meta is identical for every
+         * frame, i.e. all of its RGBA Colors are static.
+         * @return true if static, false otherwise.
+         */
+        bool IsStatic();
+
     private:
     
         /**
@@ -833,6 +912,13 @@ namespace DSL
         void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
+        /**
+         * @brief Determines if the Display Type's meta is identical for every
+         * frame, i.e. all of its RGBA Colors are static.
+         * @return true if static, false otherwise.
+         */
+        bool IsStatic();
+
     private:
     
         /**
@@ -875,6 +961,12 @@ namespace DSL
          */
         void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Source display text is updated from the frame meta.
+         * @return false always.
+         */
+        bool IsStatic(){return false;};
         
     private:
     
@@ -918,6 +1010,12 @@ namespace DSL
          */
         void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Source display text is updated from the frame meta.
+         * @return false always.
+         */
+        bool IsStatic(){return false;};
         
     private:
     
@@ -961,6 +1059,12 @@ namespace DSL
          */
         void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Source display text is updated from the frame meta.
+         * @return false always.
+         */
+        bool IsStatic(){return false;};
         
     private:
     
@@ -1004,6 +1108,12 @@ namespace DSL
          */
         void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Source display text is updated from the frame meta.
+         * @return false always.
+         */
+        bool IsStatic(){return false;};
         
     private:
     
@@ -1047,6 +1157,12 @@ namespace DSL
          */
         void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Source display text is updated from the frame meta.
+         * @return false always.
+         */
+        bool IsStatic(){return false;};
         
     private:
     
@@ -1061,6 +1177,95 @@ namespace DSL
         DSL_RGBA_COLOR_PTR m_pBgColor;
     };
 
+    // ********************************************************************
+
+    #define DSL_STATIC_OVERLAY_PTR std::shared_ptr<StaticOverlay>
+    #define DSL_STATIC_OVERLAY_NEW() \
+        std::shared_ptr<StaticOverlay>(new StaticOverlay())
+
+    /**
+     * @class StaticOverlay
+     * @brief Prebuilt layer of display meta for all static Display Types
+     * drawn on the frames of a single source. The layer is built once, by 
+     * calling AddMeta on each Display Type, and then copied into each frame's
+     * display meta. All layers are invalidated together, by incrementing a
+     * process-wide generation count, whenever a static Display Type is added
+     * to or removed from the overlay path of an ODE Trigger or Action.
+     */
+    class StaticOverlay
+    {
+    public:
+
+        /**
+         * @brief ctor for the StaticOverlay class
+         */
+        StaticOverlay();
+
+        /**
+         * @brief dtor for the StaticOverlay class
+         */
+        ~StaticOverlay();
+
+        /**
+         * @brief Invalidates all StaticOverlay layers, forcing a rebuild of
+         * each on next use.
+         */
+        static void Invalidate();
+
+        /**
+         * @brief Gets the current process-wide overlay generation.
+         * @return current generation.
+         */
+        static uint GetCurrentGeneration();
+
+        /**
+         * @brief Gets the generation this layer was last built for.
+         * @return generation of the last build, 0 if never built.
+         */
+        uint GetGeneration();
+
+        /**
+         * @brief Builds the layer from a list of static Display Types.
+         * @param[in] displayTypes static Display Types to prebuild.
+         * @param[in] numBlocks number of display meta blocks available
+         * per frame, i.e. the ODE PPH display meta alloc size.
+         * @param[in] generation overlay generation the layer is built for.
+         * @param[in] pFrameMeta frame meta for the frame being processed.
+         */
+        void Build(const std::vector<DSL_DISPLAY_TYPE_PTR>& displayTypes,
+            uint numBlocks, uint generation, NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Copies the prebuilt layer into the provided displayMetaData.
+         * @param displayMetaData vector of allocated Display metadata to add 
+         * the layer to.
+         */
+        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData);
+
+    private:
+
+        /**
+         * @brief Frees the text storage owned by the prebuilt blocks and
+         * clears the layer.
+         */
+        void Clear();
+
+        /**
+         * @brief process-wide overlay generation, incremented on Invalidate.
+         */
+        static gint s_generation;
+
+        /**
+         * @brief overlay generation this layer was last built for.
+         */
+        uint m_generation;
+
+        /**
+         * @brief prebuilt display meta blocks for this layer.
+         */
+        std::vector<NvDsDisplayMeta> m_blocks;
+    };
+
 }
 #endif // _DSL_DISPLAY_TYPES_H
     
@@ -0,0 +1,297 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslElementPool.h"
+
+namespace DSL
+{
+    // Initialize the ElementPool single instance pointer
+    ElementPool* ElementPool::m_pInstance = NULL;
+
+    std::set<std::string> ElementPool::m_poolableFactories = {
+        "queue",
+        "capsfilter",
+        "nvvideoconvert",
+        "videorate",
+        "h264parse",
+        "h265parse",
+        "jpegparse",
+        "rtph264depay",
+        "rtph265depay"
+    };
+
+    ElementPool* ElementPool::GetPool()
+    {
+        // one time initialization of the single instance pointer
+        if (!m_pInstance)
+        {
+            LOG_INFO("ElementPool Initialization");
+
+            // Single instantiation for the lib's lifetime
+            m_pInstance = new ElementPool();
+        }
+        return m_pInstance;
+    }
+
+    ElementPool::ElementPool()
+        : m_maxSize(DSL_ELEMENT_POOL_DEFAULT_MAX_SIZE)
+    {
+        LOG_FUNC();
+    }
+
+    ElementPool::~ElementPool()
+    {
+        LOG_FUNC();
+
+        Clear();
+
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+        for (auto& imap: m_factories)
+        {
+            gst_object_unref(imap.second);
+        }
+    }
+
+    GstObject* ElementPool::Acquire(const char* factoryName, const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+
+        auto ipool = m_pools.find(factoryName);
+        if (ipool != m_pools.end() and ipool->second.size())
+        {
+            GstObject* pGstObj = ipool->second.back();
+            ipool->second.pop_back();
+
+            // The pool holds a full reference. Make it floating again so that
+            // the new owner can take it just as if it were newly created.
+            g_object_force_floating(G_OBJECT(pGstObj));
+            gst_object_set_name(pGstObj, name);
+
+            LOG_DEBUG("Reusing pooled '" << factoryName
+                << "' element for new Element '" << name << "'");
+            return pGstObj;
+        }
+
+        // Look the factory up in the registry once only
+        auto ifactory = m_factories.find(factoryName);
+        if (ifactory == m_factories.end())
+        {
+            GstElementFactory* pFactory = gst_element_factory_find(factoryName);
+            if (!pFactory)
+            {
+                LOG_ERROR("Failed to find Element factory '" << factoryName << "'");
+                return NULL;
+            }
+            ifactory = m_factories.insert(
+                std::make_pair(std::string(factoryName), pFactory)).first;
+        }
+        return GST_OBJECT(gst_element_factory_create(ifactory->second, name));
+    }
+
+    bool ElementPool::Release(const char* factoryName, GstObject* pGstObj)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+
+        if (!m_maxSize or
+            m_poolableFactories.find(factoryName) == m_poolableFactories.end())
+        {
+            return false;
+        }
+        std::vector<GstObject*>& pool = m_pools[factoryName];
+
+        if (pool.size() >= m_maxSize or !IsReusable(pGstObj))
+        {
+            return false;
+        }
+        Reset(pGstObj);
+        pool.push_back(pGstObj);
+
+        LOG_DEBUG("Element '" << GST_OBJECT_NAME(pGstObj)
+            << "' released to the '" << factoryName << "' pool");
+        return true;
+    }
+
+    uint ElementPool::GetMaxSize()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+
+        return m_maxSize;
+    }
+
+    void ElementPool::SetMaxSize(uint maxSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+
+        m_maxSize = maxSize;
+
+        for (auto& imap: m_pools)
+        {
+            while (imap.second.size() > m_maxSize)
+            {
+                gst_object_unref(imap.second.back());
+                imap.second.pop_back();
+            }
+        }
+    }
+
+    uint ElementPool::GetSize()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+
+        uint size(0);
+        for (auto& imap: m_pools)
+        {
+            size += imap.second.size();
+        }
+        return size;
+    }
+
+    void ElementPool::Clear()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+
+        for (auto& imap: m_pools)
+        {
+            for (auto& ielement: imap.second)
+            {
+                gst_object_unref(ielement);
+            }
+        }
+        m_pools.clear();
+    }
+
+    bool ElementPool::IsReusable(GstObject* pGstObj)
+    {
+        if (GST_OBJECT_PARENT(pGstObj) or
+            GST_STATE(GST_ELEMENT(pGstObj)) != GST_STATE_NULL)
+        {
+            return false;
+        }
+        bool isReusable(true);
+
+        GST_OBJECT_LOCK(pGstObj);
+        for (GList* ipad = GST_ELEMENT(pGstObj)->pads; ipad; ipad = ipad->next)
+        {
+            if (GST_PAD_PEER(GST_PAD(ipad->data)))
+            {
+                isReusable = false;
+                break;
+            }
+        }
+        GST_OBJECT_UNLOCK(pGstObj);
+
+        return isReusable;
+    }
+
+    void ElementPool::RemoveAllPadProbes(GstObject* pGstObj)
+    {
+        // Collect a reference to each pad first so that the element's object
+        // lock is not held while taking each pad's object lock.
+        std::vector<GstPad*> pads;
+
+        GST_OBJECT_LOCK(pGstObj);
+        for (GList* ipad = GST_ELEMENT(pGstObj)->pads; ipad; ipad = ipad->next)
+        {
+            pads.push_back(GST_PAD(gst_object_ref(ipad->data)));
+        }
+        GST_OBJECT_UNLOCK(pGstObj);
+
+        for (auto& ipad: pads)
+        {
+            std::vector<gulong> probeIds;
+
+            GST_OBJECT_LOCK(ipad);
+            for (GHook* hook = ipad->probes.hooks; hook; hook = hook->next)
+            {
+                if (G_HOOK_IS_VALID(hook))
+                {
+                    probeIds.push_back(hook->hook_id);
+                }
+            }
+            GST_OBJECT_UNLOCK(ipad);
+
+            // Removes probes added by any previous owner, including those
+            // added with gst_pad_add_probe outside of the Elementr's control.
+            for (auto& iprobeId: probeIds)
+            {
+                LOG_DEBUG("Removing probe with id = " << iprobeId 
+                    << " from pad '" << GST_OBJECT_NAME(ipad) << "'");
+                gst_pad_remove_probe(ipad, iprobeId);
+            }
+            gst_object_unref(ipad);
+        }
+    }
+
+    void ElementPool::Reset(GstObject* pGstObj)
+    {
+        GObject* pGObject = G_OBJECT(pGstObj);
+
+        // Remove every pad probe so none can fire for the next owner.
+        RemoveAllPadProbes(pGstObj);
+
+        // Disconnect all signal handlers connected by the previous owner.
+        // Signals are listed per type, so walk the full type hierarchy.
+        for (GType type = G_OBJECT_TYPE(pGObject); type;
+            type = g_type_parent(type))
+        {
+            guint numIds(0);
+            guint* signalIds = g_signal_list_ids(type, &numIds);
+            for (guint i = 0; i < numIds; i++)
+            {
+                g_signal_handlers_disconnect_matched(pGObject, G_SIGNAL_MATCH_ID,
+                    signalIds[i], 0, NULL, NULL, NULL);
+            }
+            g_free(signalIds);
+        }
+
+        // Restore all writable, non construct-only properties to their defaults
+        guint numProperties(0);
+        GParamSpec** paramSpecs = g_object_class_list_properties(
+            G_OBJECT_GET_CLASS(pGObject), &numProperties);
+
+        for (guint i = 0; i < numProperties; i++)
+        {
+            GParamSpec* pSpec = paramSpecs[i];
+
+            if (!(pSpec->flags & G_PARAM_WRITABLE) or
+                !(pSpec->flags & G_PARAM_READABLE) or
+                (pSpec->flags & G_PARAM_CONSTRUCT_ONLY) or
+                pSpec->owner_type == GST_TYPE_OBJECT)
+            {
+                // skip the GstObject "name" and "parent" properties
+                continue;
+            }
+            g_object_set_property(pGObject, pSpec->name,
+                g_param_spec_get_default_value(pSpec));
+        }
+        g_free(paramSpecs);
+    }
+}
@@ -0,0 +1,176 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_ELEMENT_POOL_H
+#define _DSL_ELEMENT_POOL_H
+
+#include "Dsl.h"
+
+#include <set>
+
+namespace DSL
+{
+    /**
+     * @brief Default maximum number of released elements kept per factory.
+     */
+    #define DSL_ELEMENT_POOL_DEFAULT_MAX_SIZE 16
+
+    /**
+     * @class ElementPool
+     * @brief Process-wide singleton that creates all GST Elements for the
+     * Elementr class. Element factories are looked up in the GST registry once
+     * and cached. Released elements of common, stateless factories (queue,
+     * capsfilter, nvvideoconvert, parsers, etc.) are reset to their property
+     * defaults and kept for reuse, up to a maximum number per factory.
+     *
+     * Note: Elementrs are created and deleted by the Services under the
+     * services mutex, so an element released by one component can't be
+     * reacquired by another until the releasing component is fully deleted.
+     * All pad-probes are removed from a released element's pads on reset,
+     * including those not added through the Elementr, so none can fire for 
+     * the next owner.
+     */
+    class ElementPool
+    {
+    public:
+
+        /**
+         * @brief Returns a pointer to this singleton Pool
+         * @return instance pointer to the ElementPool
+         */
+        static ElementPool* GetPool();
+
+        /**
+         * @brief Ctor for this singleton ElementPool class
+         */
+        ElementPool();
+
+        /**
+         * @brief Dtor for this singleton ElementPool class
+         */
+        ~ElementPool();
+
+        /**
+         * @brief Acquires a new GST Element, either from the pool of released
+         * elements for the factory, or by creating a new one.
+         * @param[in] factoryName name of the factory to create the element from.
+         * @param[in] name unique name to give the element.
+         * @return new floating GstObject on success, NULL on failure.
+         */
+        GstObject* Acquire(const char* factoryName, const char* name);
+
+        /**
+         * @brief Releases a GST Element that is no longer in use. If the factory
+         * is poolable, and the pool for the factory is not full, the element
+         * is reset and kept for reuse. The element must be in a NULL state and
+         * not have a parent.
+         * @param[in] factoryName name of the factory the element was created from.
+         * @param[in] pGstObj element to release.
+         * @return true if the element was taken by the pool, false if the
+         * caller remains responsible for unreferencing the element.
+         */
+        bool Release(const char* factoryName, GstObject* pGstObj);
+
+        /**
+         * @brief Gets the current maximum number of released elements to keep
+         * per factory.
+         * @return current max size, 0 = pooling disabled.
+         */
+        uint GetMaxSize();
+
+        /**
+         * @brief Sets the maximum number of released elements to keep per
+         * factory. Pools larger than the new size are trimmed.
+         * @param[in] maxSize new max size to use, 0 = disable pooling.
+         */
+        void SetMaxSize(uint maxSize);
+
+        /**
+         * @brief Gets the number of released elements currently kept for reuse.
+         * @return total size of all factory pools.
+         */
+        uint GetSize();
+
+        /**
+         * @brief Unreferences all released elements currently kept for reuse.
+         */
+        void Clear();
+
+    private:
+
+        /**
+         * @brief Determines if an element is in a state that can be reused.
+         * i.e. no linked pads.
+         * @param[in] pGstObj element to check.
+         * @return true if reusable, false otherwise.
+         */
+        bool IsReusable(GstObject* pGstObj);
+
+        /**
+         * @brief Removes all pad-probes from all pads of a released element.
+         * @param[in] pGstObj element to remove the pad-probes from.
+         */
+        void RemoveAllPadProbes(GstObject* pGstObj);
+
+        /**
+         * @brief Resets a released element by removing all pad-probes, 
+         * disconnecting all signal handlers, and restoring all writable 
+         * properties to their default values.
+         * @param[in] pGstObj element to reset.
+         */
+        void Reset(GstObject* pGstObj);
+
+        /**
+         * @brief instance pointer for this singleton class
+         */
+        static ElementPool* m_pInstance;
+
+        /**
+         * @brief set of factory names that are eligible for pooling.
+         */
+        static std::set<std::string> m_poolableFactories;
+
+        /**
+         * @brief mutex to protect mutual access to the pool
+         */
+        DslMutex m_poolMutex;
+
+        /**
+         * @brief maximum number of released elements to keep per factory.
+         */
+        uint m_maxSize;
+
+        /**
+         * @brief map of factory names to cached factories.
+         */
+        std::map<std::string, GstElementFactory*> m_factories;
+
+        /**
+         * @brief map of factory names to released elements kept for reuse.
+         */
+        std::map<std::string, std::vector<GstObject*>> m_pools;
+    };
+}
+
+#endif // _DSL_ELEMENT_POOL_H
@@ -28,6 +28,7 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslNodetr.h"
+#include "DslElementPool.h"
 
 namespace DSL
 {
@@ -64,8 +65,8 @@ namespace DSL
             // Create a unique name by appending the plugin name
             AppendSuffix(factoryName);
             
-            m_pGstObj = GST_OBJECT(gst_element_factory_make(factoryName, 
-                GetCStrName()));
+            m_pGstObj = ElementPool::GetPool()->Acquire(factoryName, 
+                GetCStrName());
             if (!m_pGstObj)
             {
                 LOG_ERROR("Failed to create new Element '" << name << "'");
@@ -88,8 +89,8 @@ namespace DSL
             AppendSuffix(factoryName);
             AppendSuffix(suffix);
             
-            m_pGstObj = GST_OBJECT(gst_element_factory_make(factoryName, 
-                GetCStrName()));
+            m_pGstObj = ElementPool::GetPool()->Acquire(factoryName, 
+                GetCStrName());
             if (!m_pGstObj)
             {
                 LOG_ERROR("Failed to create new Element '" << name << "'");
@@ -103,6 +104,21 @@ namespace DSL
         ~Elementr()
         {
             LOG_FUNC();
+            
+            // Return the GST Element to the ElementPool for reuse if no longer
+            // owned by a Parent and this Elementr did not add its own Pad Probes. 
+            // The base GstNodetr will not unref the Element if taken by the pool.
+            if (GetGstElement() and !m_pParentGstObj and !m_isProxy and 
+                !m_pSinkPadBufferProbe and !m_pSrcPadBufferProbe)
+            {
+                gst_element_set_state(GetGstElement(), GST_STATE_NULL);
+                
+                if (ElementPool::GetPool()->Release(m_factoryName.c_str(), 
+                    m_pGstObj))
+                {
+                    m_isProxy = true;
+                }
+            }
         };
 
         /**
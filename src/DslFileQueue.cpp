@@ -0,0 +1,179 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslFileQueue.h"
+
+namespace DSL
+{
+    FileQueue::FileQueue(const char* name)
+        : m_name(name)
+        , m_filesCompleted(0)
+        , m_framesProcessed(0)
+        , m_startTime(g_get_monotonic_time())
+        , m_lastCompleteTime(0)
+    {
+        LOG_FUNC();
+    }
+
+    FileQueue::~FileQueue()
+    {
+        LOG_FUNC();
+    }
+
+    void FileQueue::Push(const std::string& filePath)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
+
+        m_filePaths.push_back(filePath);
+    }
+
+    bool FileQueue::Pop(std::string& filePath)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
+
+        if (m_filePaths.empty())
+        {
+            return false;
+        }
+        filePath = m_filePaths.front();
+        m_filePaths.pop_front();
+        return true;
+    }
+
+    uint FileQueue::GetSize()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
+
+        return m_filePaths.size();
+    }
+
+    void FileQueue::Clear()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
+
+        m_filePaths.clear();
+    }
+
+    void FileQueue::ResetStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
+
+        m_filesCompleted = 0;
+        m_framesProcessed = 0;
+        m_startTime = g_get_monotonic_time();
+        m_lastCompleteTime = 0;
+    }
+
+    void FileQueue::GetStats(uint* filesCompleted, uint64_t* framesProcessed, 
+        double* framesPerSecond)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
+
+        *filesCompleted = m_filesCompleted;
+        *framesProcessed = m_framesProcessed;
+        *framesPerSecond = 0;
+
+        if (m_lastCompleteTime > m_startTime)
+        {
+            *framesPerSecond = (double)m_framesProcessed * G_USEC_PER_SEC /
+                (m_lastCompleteTime - m_startTime);
+        }
+    }
+
+    bool FileQueue::AddCompleteListener(dsl_file_complete_listener_cb listener, 
+        void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
+
+        if (m_completeListeners.find(listener) != m_completeListeners.end())
+        {   
+            LOG_ERROR("File complete listener is not unique for Pipeline '"
+                << m_name << "'");
+            return false;
+        }
+        m_completeListeners[listener] = clientData;
+
+        return true;
+    }
+
+    bool FileQueue::RemoveCompleteListener(dsl_file_complete_listener_cb listener)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
+
+        if (m_completeListeners.find(listener) == m_completeListeners.end())
+        {   
+            LOG_ERROR("File complete listener was not found for Pipeline '"
+                << m_name << "'");
+            return false;
+        }
+        m_completeListeners.erase(listener);
+
+        return true;
+    }
+
+    void FileQueue::NotifyComplete(const std::string& sourceName, 
+        const std::string& filePath, uint64_t frames)
+    {
+        LOG_FUNC();
+        
+        std::map<dsl_file_complete_listener_cb, void*> listeners;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
+
+            m_filesCompleted++;
+            m_framesProcessed += frames;
+            m_lastCompleteTime = g_get_monotonic_time();
+            
+            // copy so that listeners can call back into the queue services
+            listeners = m_completeListeners;
+        }
+        LOG_INFO("File Source '" << sourceName << "' completed file '" 
+            << filePath << "' with " << frames << " frames");
+
+        std::wstring wstrSourceName(sourceName.begin(), sourceName.end());
+        std::wstring wstrFilePath(filePath.begin(), filePath.end());
+
+        for (auto const& imap: listeners)
+        {
+            try
+            {
+                imap.first(wstrSourceName.c_str(), wstrFilePath.c_str(), 
+                    frames, imap.second);
+            }
+            catch(...)
+            {
+                LOG_ERROR("Exception calling Client File-Complete-Listener");
+            }
+        }
+    }
+}
@@ -0,0 +1,175 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_FILE_QUEUE_H
+#define _DSL_FILE_QUEUE_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+#include <deque>
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_FILE_QUEUE_PTR std::shared_ptr<FileQueue>
+    #define DSL_FILE_QUEUE_NEW(name) \
+        std::shared_ptr<FileQueue>(new FileQueue(name))
+
+    /**
+     * @class FileQueue
+     * @brief Work queue of media files shared by all File Sources of a Pipeline
+     * running in offline mode. A File Source that reaches the end of its current
+     * file pops the next file from the queue and is rebound to it without
+     * stopping the Pipeline. Completed files are reported to all client
+     * listeners, and aggregate throughput is tracked for the offline run.
+     */
+    class FileQueue
+    {
+    public:
+
+        /**
+         * @brief Ctor for the FileQueue class
+         * @param[in] name name of the owning Pipeline, for logging only.
+         */
+        FileQueue(const char* name);
+
+        /**
+         * @brief Dtor for the FileQueue class
+         */
+        ~FileQueue();
+
+        /**
+         * @brief Adds a file to the back of the queue.
+         * @param[in] filePath relative or absolute path to the file to add.
+         */
+        void Push(const std::string& filePath);
+
+        /**
+         * @brief Pops the next file from the front of the queue.
+         * @param[out] filePath path of the next file to process.
+         * @return true if a file was popped, false if the queue is empty.
+         */
+        bool Pop(std::string& filePath);
+
+        /**
+         * @brief Gets the number of files waiting in the queue.
+         * @return current queue size.
+         */
+        uint GetSize();
+
+        /**
+         * @brief Removes all files waiting in the queue.
+         */
+        void Clear();
+
+        /**
+         * @brief Resets the aggregate statistics. Called on the start of
+         * each offline run.
+         */
+        void ResetStats();
+
+        /**
+         * @brief Gets the aggregate statistics for the current offline run.
+         * @param[out] filesCompleted number of files processed to completion.
+         * @param[out] framesProcessed total frames from all completed files.
+         * @param[out] framesPerSecond aggregate throughput from the start of
+         * the run to the completion of the last file.
+         */
+        void GetStats(uint* filesCompleted, uint64_t* framesProcessed, 
+            double* framesPerSecond);
+
+        /**
+         * @brief Adds a listener to be notified on the completion of each file.
+         * @param[in] listener client callback function to add.
+         * @param[in] clientData opaque pointer to client data.
+         * @return true on successful add, false otherwise.
+         */
+        bool AddCompleteListener(dsl_file_complete_listener_cb listener, 
+            void* clientData);
+
+        /**
+         * @brief Removes a listener previously added with AddCompleteListener.
+         * @param[in] listener client callback function to remove.
+         * @return true on successful remove, false otherwise.
+         */
+        bool RemoveCompleteListener(dsl_file_complete_listener_cb listener);
+
+        /**
+         * @brief Called by a File Source on reaching the end of a file. Updates
+         * the aggregate statistics and notifies all client listeners.
+         * @param[in] sourceName name of the File Source that processed the file.
+         * @param[in] filePath absolute path of the completed file.
+         * @param[in] frames number of frames processed from the file.
+         */
+        void NotifyComplete(const std::string& sourceName, 
+            const std::string& filePath, uint64_t frames);
+
+    private:
+
+        /**
+         * @brief name of the owning Pipeline.
+         */
+        std::string m_name;
+
+        /**
+         * @brief mutex to protect mutual access to the queue and statistics.
+         */
+        DslMutex m_queueMutex;
+
+        /**
+         * @brief queue of files waiting to be processed.
+         */
+        std::deque<std::string> m_filePaths;
+
+        /**
+         * @brief map of client listeners to their client data.
+         */
+        std::map<dsl_file_complete_listener_cb, void*> m_completeListeners;
+
+        /**
+         * @brief number of files processed to completion in the current run.
+         */
+        uint m_filesCompleted;
+
+        /**
+         * @brief total frames from all completed files in the current run.
+         */
+        uint64_t m_framesProcessed;
+
+        /**
+         * @brief monotonic start time of the current run in microseconds.
+         */
+        gint64 m_startTime;
+
+        /**
+         * @brief monotonic time of the last file completion in microseconds.
+         */
+        gint64 m_lastCompleteTime;
+    };
+}
+
+#endif // _DSL_FILE_QUEUE_H
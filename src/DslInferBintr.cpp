@@ -39,6 +39,7 @@ namespace DSL
         , m_inferType(inferType)
         , m_processMode(processMode)
         , m_interval(interval)
+        , m_throttleFactor(1)
         , m_batchSizeSetByClient(false)
         , m_inferConfigFile(inferConfigFile)
         , m_modelEngineFile(modelEngineFile)
@@ -258,11 +259,38 @@ namespace DSL
             return false;
         }
         m_interval = interval;
-        m_pInferEngine->SetAttribute("interval", m_interval);
+        m_pInferEngine->SetAttribute("interval", 
+            (m_interval+1)*m_throttleFactor - 1);
         
         return true;
     }
     
+    void InferBintr::SetThrottleFactor(uint factor)
+    {
+        LOG_FUNC();
+        
+        if (factor == m_throttleFactor)
+        {
+            return;
+        }
+        m_throttleFactor = std::max(factor, (uint)1);
+        
+        // The "interval" property is mutable in the PLAYING state.
+        m_pInferEngine->SetAttribute("interval", 
+            (m_interval+1)*m_throttleFactor - 1);
+
+        LOG_INFO("InferBintr '" << GetName() << "' set throttle-factor = "
+            << m_throttleFactor << " for effective interval = " 
+            << (m_interval+1)*m_throttleFactor - 1);
+    }
+    
+    uint InferBintr::GetThrottleFactor()
+    {
+        LOG_FUNC();
+        
+        return m_throttleFactor;
+    }
+    
     uint InferBintr::GetInterval()
     {
         LOG_FUNC();
@@ -163,6 +163,21 @@ namespace DSL
          */
         uint GetInterval();
 
+        /**
+         * @brief sets the throttle factor for this InferBintr. Unlike the 
+         * interval, the throttle factor can be set while linked and playing.
+         * The effective interval is (interval+1)*factor - 1, i.e. inference
+         * runs on one of every factor batches that would otherwise be inferred.
+         * @param[in] factor new throttle factor, 1 = no throttling.
+         */
+        void SetThrottleFactor(uint factor);
+        
+        /**
+         * @brief gets the current throttle factor in use by this InferBintr
+         * @return the current throttle factor, 1 = no throttling.
+         */
+        uint GetThrottleFactor();
+
         /**
          * @brief gets the current unique Id in use by this InferBintr
          * @return the current unique Id
@@ -264,6 +279,12 @@ namespace DSL
          */
         uint m_interval;
 
+        /**
+         * @brief current throttle factor for the InferBintr, set by the
+         * Pipeline Scheduler. 1 = no throttling.
+         */
+        uint m_throttleFactor;
+
         /**
          @brief Current process mode in use by the Primary
          */
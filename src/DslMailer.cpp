@@ -24,6 +24,7 @@ THE SOFTWARE.
 
 #include "DslMailer.h"
 #include "DslApi.h"
+#include "DslMemoryTracker.h"
 
 #define DATE_BUFF_LENGTH 37
 
@@ -76,11 +77,24 @@ namespace DSL
         m_content.insert(m_content.end(), m_htmlBegin.begin(), m_htmlBegin.end() );
         m_content.insert(m_content.end(), body.begin(), body.end() );
         m_content.insert(m_content.end(), m_htmlEnd.begin(), m_htmlEnd.end() );
+        
+        // Account for the message while it's queued, sized once on creation.
+        m_accountedSize = sizeof(SmtpMessage) + m_attachment.capacity();
+        for (const auto& ivec: {&m_header, &m_content})
+        {
+            for (const auto& iline: *ivec)
+            {
+                m_accountedSize += sizeof(std::string) + iline.capacity();
+            }
+        }
+        MemoryTracker::OnAlloc(DSL_MEMORY_TAG_MAILER, m_accountedSize);
     };
 
     SmtpMessage::~SmtpMessage()
     {
         LOG_FUNC();
+        
+        MemoryTracker::OnFree(DSL_MEMORY_TAG_MAILER, m_accountedSize);
     }
     
     std::string SmtpMessage::DateTimeLine()
@@ -282,7 +282,13 @@ namespace DSL {
          * @brief static message counter for all messages, 
          * incremented on message creation
          */
-        uint m_messageId;        
+        uint m_messageId;
+        
+        /**
+         * @brief size of the message, accounted to the Mailer memory tag
+         * on creation and released on deletion.
+         */
+        size_t m_accountedSize;        
     };
 
     /**
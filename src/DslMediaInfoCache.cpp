@@ -0,0 +1,250 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslMediaInfoCache.h"
+
+#if (BUILD_WITH_FFMPEG == true) || (BUILD_WITH_OPENCV == true)
+#include "DslAvFile.h"
+#endif
+
+namespace DSL
+{
+    // Initialize the MediaInfoCache single instance pointer
+    MediaInfoCache* MediaInfoCache::m_pInstance = NULL;
+
+    MediaInfoCache* MediaInfoCache::GetCache()
+    {
+        // one time initialization of the single instance pointer
+        if (!m_pInstance)
+        {
+            LOG_INFO("MediaInfoCache Initialization");
+
+            // Single instantiation for the lib's lifetime
+            m_pInstance = new MediaInfoCache();
+        }
+        return m_pInstance;
+    }
+
+    MediaInfoCache::MediaInfoCache()
+        : m_workers(DSL_MEDIA_INFO_DEFAULT_WORKERS)
+        , m_pWorkerPool(NULL)
+    {
+        LOG_FUNC();
+    }
+
+    MediaInfoCache::~MediaInfoCache()
+    {
+        LOG_FUNC();
+
+        if (m_pWorkerPool)
+        {
+            // Wait for all queued jobs to complete before freeing the pool
+            g_thread_pool_free(m_pWorkerPool, FALSE, TRUE);
+        }
+    }
+
+    bool MediaInfoCache::Probe(const char* filePath, dsl_media_info& info)
+    {
+        LOG_FUNC();
+        
+        char absolutePath[PATH_MAX+1];
+        struct stat fileStat;
+        
+        if (!realpath(filePath, absolutePath) or 
+            stat(absolutePath, &fileStat) != 0)
+        {
+            LOG_ERROR("Media file '" << filePath << "' Not found");
+            return false;
+        }
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+            
+            // Cached info is valid only if the file is unchanged
+            auto imap = m_cache.find(absolutePath);
+            if (imap != m_cache.end() and 
+                imap->second.size == fileStat.st_size and
+                imap->second.mtime.tv_sec == fileStat.st_mtim.tv_sec and
+                imap->second.mtime.tv_nsec == fileStat.st_mtim.tv_nsec)
+            {
+                LOG_DEBUG("Using cached media info for file '" 
+                    << absolutePath << "'");
+                info = imap->second.info;
+                return true;
+            }
+        }
+        
+        // Probe outside of the lock so that files can be probed in parallel
+        if (!probeFile(absolutePath, info))
+        {
+            return false;
+        }
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        if (m_cache.find(absolutePath) == m_cache.end())
+        {
+            // Evict the oldest entry when full
+            if (m_cacheOrder.size() >= DSL_MEDIA_INFO_CACHE_MAX_SIZE)
+            {
+                m_cache.erase(m_cacheOrder.front());
+                m_cacheOrder.pop_front();
+            }
+            m_cacheOrder.push_back(absolutePath);
+        }
+        m_cache[absolutePath] = {fileStat.st_size, fileStat.st_mtim, info};
+        
+        return true;
+    }
+    
+    bool MediaInfoCache::ProbeAsync(const std::vector<std::string>& filePaths,
+        dsl_info_media_probe_handler_cb clientHandler, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        if (!m_pWorkerPool)
+        {
+            GError* pError(NULL);
+            m_pWorkerPool = g_thread_pool_new(media_probe_worker_cb, this,
+                m_workers, FALSE, &pError);
+            if (!m_pWorkerPool)
+            {
+                LOG_ERROR("MediaInfoCache failed to create worker pool with error: " 
+                    << pError->message);
+                g_error_free(pError);
+                return false;
+            }
+        }
+        for (auto& ipath: filePaths)
+        {
+            g_thread_pool_push(m_pWorkerPool, 
+                new MediaProbeJob{ipath, clientHandler, clientData}, NULL);
+        }
+        return true;
+    }
+    
+    uint MediaInfoCache::GetWorkers()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        return m_workers;
+    }
+    
+    bool MediaInfoCache::SetWorkers(uint workers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        if (!workers)
+        {
+            LOG_ERROR("Invalid number of workers = 0 for the MediaInfoCache");
+            return false;
+        }
+        if (m_pWorkerPool and 
+            !g_thread_pool_set_max_threads(m_pWorkerPool, workers, NULL))
+        {
+            LOG_ERROR("MediaInfoCache failed to set workers = " << workers);
+            return false;
+        }
+        m_workers = workers;
+        return true;
+    }
+    
+    uint MediaInfoCache::GetSize()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        return m_cache.size();
+    }
+    
+    void MediaInfoCache::Clear()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        m_cache.clear();
+        m_cacheOrder.clear();
+    }
+    
+    void MediaInfoCache::ProcessProbeJob(MediaProbeJob* pJob)
+    {
+        LOG_FUNC();
+        
+        std::unique_ptr<MediaProbeJob> pJobOwner(pJob);
+        
+        dsl_media_info info{0};
+        uint result = (Probe(pJob->filePath.c_str(), info))
+            ? DSL_RESULT_SUCCESS
+            : DSL_RESULT_FAILURE;
+            
+        if (pJob->clientHandler)
+        {
+            std::wstring wstrFilePath(pJob->filePath.begin(), 
+                pJob->filePath.end());
+            try
+            {
+                pJob->clientHandler(wstrFilePath.c_str(), result, 
+                    &info, pJob->clientData);
+            }
+            catch(...)
+            {
+                LOG_ERROR("MediaInfoCache threw exception calling Client Handler");
+            }
+        }
+    }
+    
+    bool MediaInfoCache::probeFile(const char* filePath, dsl_media_info& info)
+    {
+        LOG_FUNC();
+        
+#if (BUILD_WITH_FFMPEG == true) || (BUILD_WITH_OPENCV == true)
+        try
+        {
+            AvInputFile avFile(filePath);
+            info.width = avFile.videoWidth;
+            info.height = avFile.videoHeight;
+            info.fps_n = avFile.fpsN;
+            info.fps_d = avFile.fpsD;
+        }
+        catch(...)
+        {
+            return false;
+        }
+        return true;
+#else
+        LOG_WARN("Unable to probe media file '" << filePath 
+            << "' Extended AV File Services are disabled in the Makefile");
+        return false;
+#endif        
+    }
+    
+    static void media_probe_worker_cb(gpointer job, gpointer pMediaInfoCache)
+    {
+        static_cast<MediaInfoCache*>(pMediaInfoCache)->
+            ProcessProbeJob(static_cast<MediaProbeJob*>(job));
+    }
+}
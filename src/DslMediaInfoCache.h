@@ -0,0 +1,206 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_MEDIA_INFO_CACHE_H
+#define _DSL_MEDIA_INFO_CACHE_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+#include <deque>
+
+namespace DSL
+{
+    /**
+     * @brief Maximum number of media files kept in the MediaInfoCache.
+     */
+    #define DSL_MEDIA_INFO_CACHE_MAX_SIZE 4096
+
+    /**
+     * @brief Default number of worker threads for asynchronous probing.
+     */
+    #define DSL_MEDIA_INFO_DEFAULT_WORKERS 4
+
+    /**
+     * @struct MediaProbeJob
+     * @brief Unit of work for the MediaInfoCache's worker pool.
+     */
+    struct MediaProbeJob
+    {
+        /**
+         * @brief path of the media file to probe.
+         */
+        std::string filePath;
+        
+        /**
+         * @brief client callback to call with the probe result.
+         */
+        dsl_info_media_probe_handler_cb clientHandler;
+        
+        /**
+         * @brief opaque pointer to client data to return with the callback.
+         */
+        void* clientData;
+    };
+
+    /**
+     * @class MediaInfoCache
+     * @brief Process-wide singleton that probes media files for their video
+     * dimensions and frame-rate, caching the results keyed by file path, 
+     * size, and modification time. Files can be probed in parallel, ahead 
+     * of use, by a pool of worker threads.
+     */
+    class MediaInfoCache
+    {
+    public:
+
+        /**
+         * @brief Returns a pointer to this singleton Cache
+         * @return instance pointer to the MediaInfoCache
+         */
+        static MediaInfoCache* GetCache();
+
+        /**
+         * @brief Ctor for this singleton MediaInfoCache class
+         */
+        MediaInfoCache();
+
+        /**
+         * @brief Dtor for this singleton MediaInfoCache class
+         */
+        ~MediaInfoCache();
+
+        /**
+         * @brief Gets the media info for a file, from the cache if the file
+         * is unchanged since last probed, by probing the file otherwise.
+         * @param[in] filePath relative or absolute path to the media file.
+         * @param[out] info media info for the file on success.
+         * @return true on success, false if the file could not be probed.
+         */
+        bool Probe(const char* filePath, dsl_media_info& info);
+        
+        /**
+         * @brief Queues a list of files to be probed by the worker pool. 
+         * The client handler is called once for each file from a worker thread.
+         * @param[in] filePaths list of media files to probe.
+         * @param[in] clientHandler client callback to call with each result.
+         * @param[in] clientData opaque pointer to client data.
+         * @return true on successful queue, false otherwise.
+         */
+        bool ProbeAsync(const std::vector<std::string>& filePaths,
+            dsl_info_media_probe_handler_cb clientHandler, void* clientData);
+            
+        /**
+         * @brief Gets the current number of worker threads for async probing.
+         * @return current number of workers.
+         */
+        uint GetWorkers();
+        
+        /**
+         * @brief Sets the number of worker threads for async probing.
+         * @param[in] workers new number of workers, must be > 0.
+         * @return true on successful update, false otherwise.
+         */
+        bool SetWorkers(uint workers);
+        
+        /**
+         * @brief Gets the current number of files in the cache.
+         * @return current cache size.
+         */
+        uint GetSize();
+        
+        /**
+         * @brief Clears all cached media info.
+         */
+        void Clear();
+        
+        /**
+         * @brief Processes a MediaProbeJob on a worker thread.
+         * @param[in] pJob job to process, deleted on return.
+         */
+        void ProcessProbeJob(MediaProbeJob* pJob);
+
+    private:
+    
+        /**
+         * @struct CachedMediaInfo
+         * @brief media info for a file along with the file's size and mtime
+         * at the time of probing.
+         */
+        struct CachedMediaInfo
+        {
+            off_t size;
+            struct timespec mtime;
+            dsl_media_info info;
+        };
+        
+        /**
+         * @brief Probes a media file, reading the container headers only
+         * if they provide all required information.
+         * @param[in] filePath path to the media file.
+         * @param[out] info media info for the file on success.
+         * @return true on success, false otherwise.
+         */
+        bool probeFile(const char* filePath, dsl_media_info& info);
+
+        /**
+         * @brief instance pointer for this singleton class
+         */
+        static MediaInfoCache* m_pInstance;
+
+        /**
+         * @brief mutex to protect mutual access to the cache
+         */
+        DslMutex m_cacheMutex;
+        
+        /**
+         * @brief map of absolute file paths to cached media info.
+         */
+        std::map<std::string, CachedMediaInfo> m_cache;
+        
+        /**
+         * @brief file paths in the order added, for eviction when full.
+         */
+        std::deque<std::string> m_cacheOrder;
+        
+        /**
+         * @brief current number of worker threads.
+         */
+        uint m_workers;
+        
+        /**
+         * @brief pool of worker threads for async probing, created on first use.
+         */
+        GThreadPool* m_pWorkerPool;
+    };
+
+    /**
+     * @brief function for the MediaInfoCache's worker pool threads.
+     * @param[in] job pointer to the MediaProbeJob to process.
+     * @param[in] pMediaInfoCache pointer to the singleton MediaInfoCache.
+     */
+    static void media_probe_worker_cb(gpointer job, gpointer pMediaInfoCache);
+}
+
+#endif // _DSL_MEDIA_INFO_CACHE_H
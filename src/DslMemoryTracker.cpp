@@ -0,0 +1,166 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslMemoryTracker.h"
+
+namespace DSL
+{
+    MemoryTracker::Counters MemoryTracker::s_counters[DSL_MEMORY_TAG_COUNT];
+
+    uint64_t MemoryTracker::s_lastAllocations[DSL_MEMORY_TAG_COUNT] = {0};
+
+    int64_t MemoryTracker::s_lastQueryTimes[DSL_MEMORY_TAG_COUNT] = {0};
+
+    DslMutex MemoryTracker::s_queryMutex;
+
+    bool MemoryTracker::GetStats(uint tag, dsl_memory_stats* stats)
+    {
+        LOG_FUNC();
+
+        if (tag >= DSL_MEMORY_TAG_COUNT)
+        {
+            LOG_ERROR("Invalid memory tag = " << tag);
+            return false;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&s_queryMutex);
+
+        Counters& counters = s_counters[tag];
+
+        stats->live_bytes = counters.liveBytes.load(std::memory_order_relaxed);
+        stats->peak_bytes = counters.peakBytes.load(std::memory_order_relaxed);
+        stats->allocations = counters.allocations.load(std::memory_order_relaxed);
+        stats->frees = counters.frees.load(std::memory_order_relaxed);
+        stats->allocated_bytes =
+            counters.allocatedBytes.load(std::memory_order_relaxed);
+
+        // The first query has no previous interval to calculate the rate over.
+        int64_t currentTime = g_get_monotonic_time();
+        stats->allocation_rate = 0;
+        if (s_lastQueryTimes[tag] and currentTime > s_lastQueryTimes[tag] and
+            stats->allocations >= s_lastAllocations[tag])
+        {
+            stats->allocation_rate =
+                (double)(stats->allocations - s_lastAllocations[tag]) /
+                ((double)(currentTime - s_lastQueryTimes[tag]) / G_USEC_PER_SEC);
+        }
+        s_lastAllocations[tag] = stats->allocations;
+        s_lastQueryTimes[tag] = currentTime;
+
+        return true;
+    }
+
+    bool MemoryTracker::ResetStats(uint tag)
+    {
+        LOG_FUNC();
+
+        if (tag >= DSL_MEMORY_TAG_COUNT)
+        {
+            LOG_ERROR("Invalid memory tag = " << tag);
+            return false;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&s_queryMutex);
+
+        Counters& counters = s_counters[tag];
+
+        counters.allocations.store(0, std::memory_order_relaxed);
+        counters.frees.store(0, std::memory_order_relaxed);
+        counters.allocatedBytes.store(0, std::memory_order_relaxed);
+        counters.peakBytes.store(counters.liveBytes.load(std::memory_order_relaxed),
+            std::memory_order_relaxed);
+
+        s_lastAllocations[tag] = 0;
+        s_lastQueryTimes[tag] = 0;
+
+        return true;
+    }
+
+    // ********************************************************************
+
+    FrameArena* FrameArena::GetThreadArena()
+    {
+        static thread_local FrameArena arena;
+
+        return &arena;
+    }
+
+    FrameArena::FrameArena()
+        : m_offset(0)
+    {
+        // No function log - created on first use by each streaming thread.
+    }
+
+    FrameArena::~FrameArena()
+    {
+        for (auto& ichunk: m_chunks)
+        {
+            MemoryTracker::OnFree(DSL_MEMORY_TAG_FRAME_SCRATCH, ichunk.second);
+            g_free(ichunk.first);
+        }
+    }
+
+    void* FrameArena::Allocate(size_t size, size_t alignment)
+    {
+        // No function log - avoid overhead.
+
+        if (m_chunks.size())
+        {
+            size_t offset = (m_offset + alignment - 1) & ~(alignment - 1);
+            if (offset + size <= m_chunks.back().second)
+            {
+                m_offset = offset + size;
+                return m_chunks.back().first + offset;
+            }
+        }
+        // g_malloc is aligned for any fundamental type, so a new chunk
+        // always starts aligned.
+        AddChunk(size);
+        m_offset = size;
+
+        return m_chunks.back().first;
+    }
+
+    void FrameArena::Reset()
+    {
+        // No function log - avoid overhead.
+
+        while (m_chunks.size() > 1)
+        {
+            MemoryTracker::OnFree(DSL_MEMORY_TAG_FRAME_SCRATCH,
+                m_chunks.back().second);
+            g_free(m_chunks.back().first);
+            m_chunks.pop_back();
+        }
+        m_offset = 0;
+    }
+
+    void FrameArena::AddChunk(size_t size)
+    {
+        size_t chunkSize = std::max(size, (size_t)DSL_FRAME_ARENA_CHUNK_SIZE);
+
+        m_chunks.push_back(std::make_pair((char*)g_malloc(chunkSize), chunkSize));
+
+        MemoryTracker::OnAlloc(DSL_MEMORY_TAG_FRAME_SCRATCH, chunkSize);
+    }
+}
@@ -0,0 +1,329 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_MEMORY_TRACKER_H
+#define _DSL_MEMORY_TRACKER_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+#include <atomic>
+
+namespace DSL
+{
+    /**
+     * @brief Number of memory tags, one for each DSL_MEMORY_TAG_* constant.
+     */
+    #define DSL_MEMORY_TAG_COUNT                                        7
+
+    /**
+     * @brief Size of the first, and all subsequent, FrameArena chunks.
+     */
+    #define DSL_FRAME_ARENA_CHUNK_SIZE                                  (64*1024)
+
+    /**
+     * @class MemoryTracker
+     * @brief Process-wide, per-tag accounting of DSL owned allocations.
+     * Counters are updated with relaxed atomic operations only, so that
+     * accounting can remain enabled in release builds on the streaming threads.
+     */
+    class MemoryTracker
+    {
+    public:
+
+        /**
+         * @brief Accounts for a new allocation owned by DSL.
+         * @param[in] tag one of the DSL_MEMORY_TAG_* constants.
+         * @param[in] size size of the allocation in bytes.
+         */
+        static inline void OnAlloc(uint tag, size_t size)
+        {
+            Counters& counters = s_counters[tag];
+
+            counters.allocations.fetch_add(1, std::memory_order_relaxed);
+            counters.allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+            uint64_t liveBytes = counters.liveBytes.fetch_add(size,
+                std::memory_order_relaxed) + size;
+
+            uint64_t peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+            while (liveBytes > peakBytes and
+                !counters.peakBytes.compare_exchange_weak(peakBytes, liveBytes,
+                    std::memory_order_relaxed))
+            {
+            }
+        }
+
+        /**
+         * @brief Accounts for the free of an allocation previously accounted
+         * for with OnAlloc.
+         * @param[in] tag one of the DSL_MEMORY_TAG_* constants.
+         * @param[in] size size of the allocation in bytes.
+         */
+        static inline void OnFree(uint tag, size_t size)
+        {
+            Counters& counters = s_counters[tag];
+
+            counters.frees.fetch_add(1, std::memory_order_relaxed);
+            counters.liveBytes.fetch_sub(size, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Accounts for an allocation whose ownership is transferred to
+         * DeepStream, e.g. display text freed on release of the frame's meta.
+         * The allocation counts towards the allocation rate, but not the live
+         * bytes, as DSL is never notified of the free.
+         * @param[in] tag one of the DSL_MEMORY_TAG_* constants.
+         * @param[in] size size of the allocation in bytes.
+         */
+        static inline void OnTransfer(uint tag, size_t size)
+        {
+            Counters& counters = s_counters[tag];
+
+            counters.allocations.fetch_add(1, std::memory_order_relaxed);
+            counters.allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+            counters.frees.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Gets the current stats for a memory tag. The allocation
+         * rate is calculated over the time since the previous call.
+         * @param[in] tag one of the DSL_MEMORY_TAG_* constants.
+         * @param[out] stats current stats for the tag.
+         * @return true on successful query, false if tag is invalid.
+         */
+        static bool GetStats(uint tag, dsl_memory_stats* stats);
+
+        /**
+         * @brief Resets the stats for a memory tag. The allocation and free
+         * counts are cleared and the peak is reset to the current live bytes.
+         * @param[in] tag one of the DSL_MEMORY_TAG_* constants.
+         * @return true on successful reset, false if tag is invalid.
+         */
+        static bool ResetStats(uint tag);
+
+    private:
+
+        /**
+         * @brief live counters for a single memory tag.
+         */
+        struct Counters
+        {
+            std::atomic<uint64_t> liveBytes;
+            std::atomic<uint64_t> peakBytes;
+            std::atomic<uint64_t> allocations;
+            std::atomic<uint64_t> frees;
+            std::atomic<uint64_t> allocatedBytes;
+        };
+
+        /**
+         * @brief counters for each memory tag, zero initialized on load.
+         */
+        static Counters s_counters[DSL_MEMORY_TAG_COUNT];
+
+        /**
+         * @brief allocation count and monotonic time of the previous
+         * GetStats for each tag, used to calculate the allocation rate.
+         */
+        static uint64_t s_lastAllocations[DSL_MEMORY_TAG_COUNT];
+        static int64_t s_lastQueryTimes[DSL_MEMORY_TAG_COUNT];
+
+        /**
+         * @brief mutex to protect mutual access to the previous query values.
+         */
+        static DslMutex s_queryMutex;
+    };
+
+    /**
+     * @brief Allocates zeroed text storage for display meta. Ownership passes
+     * to the meta, which frees the text on release.
+     * @param[in] size size of the storage in bytes.
+     * @return new text storage.
+     */
+    inline gchar* DisplayTextAlloc(size_t size)
+    {
+        MemoryTracker::OnTransfer(DSL_MEMORY_TAG_DISPLAY_TEXT, size);
+        return (gchar*)g_malloc0(size);
+    }
+
+    /**
+     * @brief Duplicates a string for display meta. Ownership passes to the
+     * meta, which frees the text on release.
+     * @param[in] text string to duplicate, may be NULL.
+     * @return new copy of the string, NULL if text is NULL.
+     */
+    inline gchar* DisplayTextDup(const gchar* text)
+    {
+        if (text)
+        {
+            MemoryTracker::OnTransfer(DSL_MEMORY_TAG_DISPLAY_TEXT, strlen(text)+1);
+        }
+        return g_strdup(text);
+    }
+
+    /**
+     * @class TaggedAllocator
+     * @brief Standard Library allocator that accounts for all allocations
+     * with the MemoryTracker under a fixed tag. Use with containers and with
+     * std::allocate_shared for DSL owned objects.
+     */
+    template <typename T, uint Tag>
+    class TaggedAllocator
+    {
+    public:
+        typedef T value_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef TaggedAllocator<U, Tag> other;
+        };
+
+        TaggedAllocator() noexcept {};
+
+        template <typename U>
+        TaggedAllocator(const TaggedAllocator<U, Tag>&) noexcept {};
+
+        T* allocate(size_t n)
+        {
+            T* p = static_cast<T*>(::operator new(n*sizeof(T)));
+            MemoryTracker::OnAlloc(Tag, n*sizeof(T));
+            return p;
+        }
+
+        void deallocate(T* p, size_t n) noexcept
+        {
+            MemoryTracker::OnFree(Tag, n*sizeof(T));
+            ::operator delete(p);
+        }
+    };
+
+    template <typename T, typename U, uint Tag>
+    inline bool operator==(const TaggedAllocator<T, Tag>&,
+        const TaggedAllocator<U, Tag>&){return true;};
+
+    template <typename T, typename U, uint Tag>
+    inline bool operator!=(const TaggedAllocator<T, Tag>&,
+        const TaggedAllocator<U, Tag>&){return false;};
+
+    /**
+     * @class FrameArena
+     * @brief Resettable bump allocator for per-frame scratch memory. Each
+     * streaming thread owns one arena, reset by the ODE Pad Probe Handler at
+     * the end of each frame. Memory is never freed individually; the first
+     * chunk is kept across resets so that steady-state frames don't allocate.
+     * Chunks are accounted under DSL_MEMORY_TAG_FRAME_SCRATCH.
+     */
+    class FrameArena
+    {
+    public:
+
+        /**
+         * @brief Returns the arena for the calling thread.
+         * @return pointer to the calling thread's FrameArena.
+         */
+        static FrameArena* GetThreadArena();
+
+        /**
+         * @brief ctor for the FrameArena class
+         */
+        FrameArena();
+
+        /**
+         * @brief dtor for the FrameArena class
+         */
+        ~FrameArena();
+
+        /**
+         * @brief Allocates scratch memory valid until the next Reset.
+         * @param[in] size number of bytes to allocate.
+         * @param[in] alignment required alignment, a power of 2.
+         * @return pointer to the new memory.
+         */
+        void* Allocate(size_t size, size_t alignment);
+
+        /**
+         * @brief Releases all scratch memory allocated since the last Reset.
+         * All chunks other than the first are freed.
+         */
+        void Reset();
+
+    private:
+
+        /**
+         * @brief Allocates a new chunk large enough for size bytes.
+         * @param[in] size minimum size of the new chunk.
+         */
+        void AddChunk(size_t size);
+
+        /**
+         * @brief list of chunks, pointer and size, the current chunk last.
+         */
+        std::vector<std::pair<char*, size_t>> m_chunks;
+
+        /**
+         * @brief offset of the next free byte in the current chunk.
+         */
+        size_t m_offset;
+    };
+
+    /**
+     * @class ArenaAllocator
+     * @brief Standard Library allocator for containers of per-frame scratch
+     * that allocates from a FrameArena. deallocate is a no-op.
+     */
+    template <typename T>
+    class ArenaAllocator
+    {
+    public:
+        typedef T value_type;
+
+        ArenaAllocator(FrameArena* pArena) noexcept
+            : m_pArena(pArena){};
+
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+            : m_pArena(other.m_pArena){};
+
+        T* allocate(size_t n)
+        {
+            return static_cast<T*>(m_pArena->Allocate(n*sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* p, size_t n) noexcept
+        {
+        }
+
+        FrameArena* m_pArena;
+    };
+
+    template <typename T, typename U>
+    inline bool operator==(const ArenaAllocator<T>& a,
+        const ArenaAllocator<U>& b){return a.m_pArena == b.m_pArena;};
+
+    template <typename T, typename U>
+    inline bool operator!=(const ArenaAllocator<T>& a,
+        const ArenaAllocator<U>& b){return a.m_pArena != b.m_pArena;};
+}
+
+#endif // _DSL_MEMORY_TRACKER_H
@@ -239,16 +239,14 @@ namespace DSL
         }
         if (topic)
         {
-            std::shared_ptr<std::string> pTopic = std::shared_ptr<std::string>(
-                new std::string(topic));
-            
+            // Compare in place - no per-message copy of the topic is required.
             for(auto const& imap: m_messageTopics)
             {
-                if (*imap.first == *pTopic)
+                if (*imap.first == topic)
                 {
                     try
                     {
-                        std::wstring wstrTopic(pTopic->begin(), pTopic->end());
+                        std::wstring wstrTopic(imap.first->begin(), imap.first->end());
                         imap.second(NULL, status, message, length, wstrTopic.c_str());
                     }
                     catch(...)
@@ -507,12 +507,22 @@ namespace DSL
         if (ivec != m_usedRequestPadIds.end())
         {
             streamId = ivec - m_usedRequestPadIds.begin();
-            m_usedRequestPadIds[streamId] = true;
         }
         // Else we're adding to the end of th indexed map
         else
         {
             streamId = m_usedRequestPadIds.size();
+        }
+        if (!_isSrcPadProvisioned(pChildComponent, streamId))
+        {
+            return false;
+        }
+        if (streamId < m_usedRequestPadIds.size())
+        {
+            m_usedRequestPadIds[streamId] = true;
+        }
+        else
+        {
             m_usedRequestPadIds.push_back(true);
         }
         // Call the private helper to complete the common add functionality
@@ -539,6 +549,10 @@ namespace DSL
                 << "' as it would exceed max-branches = " << m_maxBranches);
             return false;
         }
+        if (!_isSrcPadProvisioned(pChildComponent, streamId))
+        {
+            return false;
+        }
 
         // If the streamId has been used "ever", since bintr creation
         if ((streamId+1) <= m_usedRequestPadIds.size())
@@ -704,23 +718,20 @@ namespace DSL
 
         // We need to request all the needed source pads while the 
         // nvstreamdemux plugin is in a NULL state. This is a workaround
-        // for the fact the the plugin does not support dynamic requests
-        for (uint i=0; i<m_maxBranches; i++)
+        // for the fact the the plugin does not support dynamic requests.
+        // Only the streams that can be active - the batch-size - and the
+        // streams with linked branches are needed, not max-branches. 
+        uint numStreams(m_batchSize);
+        if (m_pChildBranchesIndexed.size())
         {
-            std::string srcPadName = "src_" + std::to_string(i);
-                
-            GstPad* pRequestedSrcPad = gst_element_get_request_pad(
-                m_pTee->GetGstElement(), srcPadName.c_str());
-            if (!pRequestedSrcPad)
-            {
-                
-                LOG_ERROR("Failed to get a requested source pad for Demuxer '" 
-                    << GetName() << "'");
-                return false;
-            }
-            LOG_INFO("Allocated requested source pad = " << pRequestedSrcPad 
-                << " for DemuxerBintr '" << GetName() << "'");
-            m_requestedSrcPads.push_back(pRequestedSrcPad);
+            numStreams = std::max(numStreams, 
+                m_pChildBranchesIndexed.rbegin()->first + 1);
+        }
+        numStreams = std::min(numStreams, m_maxBranches);
+        
+        if (numStreams and !_provisionSrcPads(numStreams - 1))
+        {
+            return false;
         }
 
         for (auto const& imap: m_pChildBranchesIndexed)
@@ -765,6 +776,63 @@ namespace DSL
         }
    }
    
+    bool DemuxerBintr::_provisionSrcPads(uint streamId)
+    {
+        LOG_FUNC();
+        
+        if (streamId < m_requestedSrcPads.size())
+        {
+            return true;
+        }
+        if (streamId >= m_maxBranches)
+        {
+            LOG_ERROR("Stream-id = " << streamId << " exceeds max-branches = " 
+                << m_maxBranches << " for DemuxerBintr '" << GetName() << "'");
+            return false;
+        }
+        // Round up to a whole chunk so that streams added one at a time
+        // don't each require a separate request.
+        uint numPads = std::min(m_maxBranches, 
+            ((streamId / DSL_DEMUXER_SRC_PAD_CHUNK_SIZE) + 1) * 
+                DSL_DEMUXER_SRC_PAD_CHUNK_SIZE);
+                
+        for (uint i=m_requestedSrcPads.size(); i<numPads; i++)
+        {
+            std::string srcPadName = "src_" + std::to_string(i);
+                
+            GstPad* pRequestedSrcPad = gst_element_get_request_pad(
+                m_pTee->GetGstElement(), srcPadName.c_str());
+            if (!pRequestedSrcPad)
+            {
+                LOG_ERROR("Failed to get a requested source pad for Demuxer '" 
+                    << GetName() << "'");
+                return (streamId < m_requestedSrcPads.size());
+            }
+            LOG_INFO("Allocated requested source pad = " << pRequestedSrcPad 
+                << " for DemuxerBintr '" << GetName() << "'");
+            m_requestedSrcPads.push_back(pRequestedSrcPad);
+        }
+        return true;
+    }
+   
+    bool DemuxerBintr::_isSrcPadProvisioned(DSL_BINTR_PTR pChildComponent, 
+        uint streamId)
+    {
+        LOG_FUNC();
+        
+        // Pads can only be requested from LinkAll. Once linked, a Branch can 
+        // only be added to a stream-id with a pad that was provisioned then.
+        if (IsLinked() and streamId >= m_requestedSrcPads.size())
+        {
+            LOG_ERROR("Can't add Branch '" << pChildComponent->GetName() 
+                << "' to DemuxerBintr '" << GetName() << "' at stream-id = " 
+                << streamId << " as only " << m_requestedSrcPads.size() 
+                << " source pads were provisioned when linked");
+            return false;
+        }
+        return true;
+    }
+   
     uint DemuxerBintr::GetMaxBranches()
     {
         LOG_FUNC();
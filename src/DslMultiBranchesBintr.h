@@ -292,6 +292,11 @@ namespace DSL
     };
 
     //-------------------------------------------------------------------------------
+
+    /**
+     * @brief Number of Demuxer source pads requested at a time, as needed.
+     */
+    #define DSL_DEMUXER_SRC_PAD_CHUNK_SIZE                              8
     
     class DemuxerBintr : public MultiBranchesBintr
     {
@@ -344,7 +349,10 @@ namespace DSL
          * @brief links all child Component Bintrs and their elements. We need to 
          * override the parent class because we pre-allocate the requested pads.
          * This is a workaround for the NIVIDA demuxer limatation of not allowing
-         * pads to be requested in a PLAYING state.
+         * pads to be requested in a PLAYING state. Pads are requested for the
+         * current batch-size and linked stream-ids only, rounded up to a whole 
+         * chunk, not for max-branches. Branches added while linked are limited 
+         * to the stream-ids provisioned here.
          */ 
         bool LinkAll();
 
@@ -376,6 +384,25 @@ namespace DSL
          * @return true if the ComponentBintr was added correctly, false otherwise
          */
         bool _completeAddChild(DSL_BINTR_PTR pChildComponent, uint streamId);
+
+        /**
+         * @brief Ensures that a source pad has been requested for a given
+         * stream-id. Pads are requested in chunks of DSL_DEMUXER_SRC_PAD_CHUNK_SIZE,
+         * up to max-branches. Pads without a linked branch are left idle.
+         * Must only be called from LinkAll while the demuxer is unlinked.
+         * @param[in] streamId stream-id that requires a source pad.
+         * @return true if the pad is available, false otherwise.
+         */
+        bool _provisionSrcPads(uint streamId);
+
+        /**
+         * @brief Checks that a Branch can be added at a given stream-id. When
+         * linked, the stream-id must have a source pad provisioned by LinkAll.
+         * @param[in] pChildComponent shared pointer to ComponentBintr to add.
+         * @param[in] streamId stream-id to add the Branch to.
+         * @return true if the Branch can be added, false otherwise.
+         */
+        bool _isSrcPadProvisioned(DSL_BINTR_PTR pChildComponent, uint streamId);
     
         /**
          * @brief maximum number of branches this DemuxerBintr can connect.
@@ -384,9 +411,9 @@ namespace DSL
         uint m_maxBranches;
         
         /**
-         * @brief list of reguest pads -- maxBranches in length -- for the 
-         * for the DemuxerBintr. The pads are preallocated on Bintr LinkAll
-         * and released on UnlinkAll.
+         * @brief list of reguest pads for the DemuxerBintr, indexed by stream-id.
+         * The pads are allocated in chunks as needed, from LinkAll, and 
+         * released on UnlinkAll.
          */
         std::vector<GstPad*> m_requestedSrcPads;
         
@@ -1344,14 +1344,16 @@ namespace DSL
          */
         DSL_PAD_EVENT_DS_PROBE_PTR m_pSrcPadDsEventProbe;
         
-    private:
-    
         /**
          * @brief true if the GstNodetr acts as a proxy for it's parent
-         * using it's parent's bin i.e. m_pGstObj
+         * using it's parent's bin i.e. m_pGstObj, or if the GstObject has
+         * been released to the ElementPool. The GstObject is not unreferenced
+         * on delete if true.
          */
         bool m_isProxy;
         
+    private:
+    
         bool m_releaseRequestedPadOnUnlink;
     };
 
@@ -31,6 +31,7 @@ namespace DSL
 
     OdeAccumulator::OdeAccumulator(const char* name)
         : OdeBase(name)
+        , m_accumulations(0)
     {
         LOG_FUNC();
     }
@@ -45,6 +46,15 @@ namespace DSL
     void OdeAccumulator::HandleOccurrences(DSL_BASE_PTR pOdeTrigger, 
         GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
+    {
+        m_accumulations++;
+        
+        InvokeActions(pOdeTrigger, pBuffer, displayMetaData, pFrameMeta);
+    }
+
+    void OdeAccumulator::InvokeActions(DSL_BASE_PTR pOdeTrigger, 
+        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        NvDsFrameMeta* pFrameMeta)
     {
         for (const auto &imap: m_pOdeActionsIndexed)
         {
@@ -120,4 +130,358 @@ namespace DSL
         m_pOdeActionsIndexed.clear();
     }
     
+
+    // ********************************************************************
+
+    StreamingStats::StreamingStats()
+    {
+        // No function log - created per source, class and pane.
+        Clear();
+    }
+
+    void StreamingStats::Add(double value, uint64_t weight)
+    {
+        // No function log - called for each occurrence.
+        
+        if (!weight)
+        {
+            return;
+        }
+        // Weighted Welford update - weight > 1 adds repeated values, 
+        // e.g. frames without occurrences, in a single O(1) step.
+        count += weight;
+        double delta = value - mean;
+        mean += delta*weight/count;
+        m2 += delta*weight*(value - mean);
+        
+        min = std::min(min, value);
+        max = std::max(max, value);
+        
+        m_buckets[BucketIndex(value)] += weight;
+    }
+
+    void StreamingStats::Merge(const StreamingStats& other)
+    {
+        if (!other.count)
+        {
+            return;
+        }
+        if (!count)
+        {
+            *this = other;
+            return;
+        }
+        // Parallel (Chan et al.) combination of mean and variance
+        uint64_t total = count + other.count;
+        double delta = other.mean - mean;
+        mean += delta*other.count/total;
+        m2 += other.m2 + delta*delta*((double)count*other.count/total);
+        count = total;
+        
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+        
+        for (uint i = 0; i < DSL_STREAMING_STATS_BUCKETS; i++)
+        {
+            m_buckets[i] += other.m_buckets[i];
+        }
+    }
+
+    void StreamingStats::Clear()
+    {
+        count = 0;
+        mean = 0;
+        m2 = 0;
+        min = std::numeric_limits<double>::max();
+        max = std::numeric_limits<double>::lowest();
+        memset(m_buckets, 0, sizeof(m_buckets));
+    }
+
+    double StreamingStats::Quantile(double q) const
+    {
+        if (!count)
+        {
+            return 0;
+        }
+        uint64_t rank = std::max((uint64_t)1, 
+            (uint64_t)std::ceil(std::min(std::max(q, 0.0), 1.0)*count));
+            
+        uint64_t cumulative(0);
+        for (uint i = 0; i < DSL_STREAMING_STATS_BUCKETS; i++)
+        {
+            cumulative += m_buckets[i];
+            if (cumulative >= rank)
+            {
+                // Exact min and max bound the bucket's approximation.
+                return std::min(std::max(BucketValue(i), min), max);
+            }
+        }
+        return max;
+    }
+
+    uint StreamingStats::BucketIndex(double value)
+    {
+        // Values below range, including 0 and negatives, share bucket 0.
+        if (!(value >= std::ldexp(1.0, DSL_STREAMING_STATS_MIN_EXPONENT)))
+        {
+            return 0;
+        }
+        if (value >= std::ldexp(1.0, DSL_STREAMING_STATS_MAX_EXPONENT))
+        {
+            return DSL_STREAMING_STATS_BUCKETS - 1;
+        }
+        // value = mantissa*2^exponent with mantissa in [0.5, 1.0)
+        int exponent(0);
+        double mantissa = std::frexp(value, &exponent);
+        
+        return 1 + (exponent - DSL_STREAMING_STATS_MIN_EXPONENT - 1)
+            *DSL_STREAMING_STATS_SUB_BUCKETS
+            + (uint)((mantissa - 0.5)*2*DSL_STREAMING_STATS_SUB_BUCKETS);
+    }
+
+    double StreamingStats::BucketValue(uint index)
+    {
+        if (!index)
+        {
+            return 0;
+        }
+        int exponent = (index - 1)/DSL_STREAMING_STATS_SUB_BUCKETS
+            + DSL_STREAMING_STATS_MIN_EXPONENT + 1;
+        uint subBucket = (index - 1)%DSL_STREAMING_STATS_SUB_BUCKETS;
+        
+        // midpoint of the sub-bucket's mantissa range
+        double mantissa = 0.5 + (subBucket + 0.5)/
+            (2*DSL_STREAMING_STATS_SUB_BUCKETS);
+            
+        return std::ldexp(mantissa, exponent);
+    }
+
+    // ********************************************************************
+
+    StatsOdeAccumulator::StatsOdeAccumulator(const char* name, 
+        uint window, uint slide)
+        : OdeAccumulator(name)
+        , m_window(0)
+        , m_slide(0)
+        , m_numPanes(0)
+    {
+        LOG_FUNC();
+        
+        if (!SetWindowSettings(window, slide))
+        {
+            throw std::exception();
+        }
+    }
+
+    StatsOdeAccumulator::~StatsOdeAccumulator()
+    {
+        LOG_FUNC();
+    }
+
+    void StatsOdeAccumulator::HandleOccurrence(NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
+    {
+        // No function log - called for each occurrence.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        SourceWindow& sourceWindow = m_sourceWindows[pFrameMeta->source_id];
+
+        uint64_t key = ((uint64_t)pFrameMeta->source_id << 32) | 
+            pObjectMeta->class_id;
+            
+        auto ikey = m_keyStats.find(key);
+        if (ikey == m_keyStats.end())
+        {
+            ikey = m_keyStats.emplace(key, KeyStats()).first;
+            ikey->second.panes.resize(m_numPanes);
+            ikey->second.frameOccurrences = 0;
+            ikey->second.windowEndFrame = 0;
+            ikey->second.windowClosed = false;
+
+            // The source's elapsed panes in the current window had no 
+            // occurrences for the new key.
+            uint elapsedPanes = std::min((uint64_t)m_numPanes - 1,
+                sourceWindow.frames/m_slide);
+            for (uint i = 1; i <= elapsedPanes; i++)
+            {
+                ikey->second.panes[(sourceWindow.paneIndex + m_numPanes - i)
+                    % m_numPanes][DSL_ODE_STATS_METRIC_COUNT].Add(0, m_slide);
+            }
+            sourceWindow.keys.push_back(key);
+        }
+        KeyStats& keyStats = ikey->second;
+        
+        std::array<StreamingStats, DSL_ODE_STATS_NUM_METRICS>& pane = 
+            keyStats.panes[sourceWindow.paneIndex];
+            
+        pane[DSL_ODE_STATS_METRIC_CONFIDENCE].Add(pObjectMeta->confidence);
+        pane[DSL_ODE_STATS_METRIC_WIDTH].Add(pObjectMeta->rect_params.width);
+        pane[DSL_ODE_STATS_METRIC_HEIGHT].Add(pObjectMeta->rect_params.height);
+        
+        if (!keyStats.frameOccurrences++)
+        {
+            sourceWindow.touchedKeys.push_back(key);
+        }
+    }
+
+    void StatsOdeAccumulator::HandleOccurrences(DSL_BASE_PTR pOdeTrigger, 
+        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        NvDsFrameMeta* pFrameMeta)
+    {
+        m_accumulations++;
+        
+        bool windowClosed(false);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+            
+            SourceWindow& sourceWindow = m_sourceWindows[pFrameMeta->source_id];
+            
+            // Only keys with occurrences in this frame are updated. Frames 
+            // without are added as zeros when the pane closes.
+            for (auto key: sourceWindow.touchedKeys)
+            {
+                KeyStats& keyStats = m_keyStats[key];
+                keyStats.panes[sourceWindow.paneIndex]
+                    [DSL_ODE_STATS_METRIC_COUNT].Add(keyStats.frameOccurrences);
+                keyStats.frameOccurrences = 0;
+            }
+            sourceWindow.touchedKeys.clear();
+            
+            if (!(++sourceWindow.frames % m_slide))
+            {
+                windowClosed = ClosePane(sourceWindow, pFrameMeta->frame_num);
+            }
+        }
+        if (windowClosed)
+        {
+            InvokeActions(pOdeTrigger, pBuffer, displayMetaData, pFrameMeta);
+        }
+    }
+
+    bool StatsOdeAccumulator::ClosePane(SourceWindow& sourceWindow, 
+        uint64_t frameNum)
+    {
+        bool windowFull = (sourceWindow.frames >= m_window);
+        
+        uint nextPaneIndex = (sourceWindow.paneIndex + 1) % m_numPanes;
+        
+        for (auto key: sourceWindow.keys)
+        {
+            KeyStats& keyStats = m_keyStats[key];
+            
+            StreamingStats& countStats = keyStats.panes[sourceWindow.paneIndex]
+                [DSL_ODE_STATS_METRIC_COUNT];
+            if (countStats.count < m_slide)
+            {
+                countStats.Add(0, m_slide - countStats.count);
+            }
+            if (windowFull)
+            {
+                for (uint metric = 0; metric < DSL_ODE_STATS_NUM_METRICS; 
+                    metric++)
+                {
+                    keyStats.window[metric].Clear();
+                    for (auto& pane: keyStats.panes)
+                    {
+                        keyStats.window[metric].Merge(pane[metric]);
+                    }
+                }
+                keyStats.windowEndFrame = frameNum;
+                keyStats.windowClosed = true;
+            }
+            // The oldest pane is reused for the next slide.
+            for (auto& stats: keyStats.panes[nextPaneIndex])
+            {
+                stats.Clear();
+            }
+        }
+        sourceWindow.paneIndex = nextPaneIndex;
+        
+        return windowFull;
+    }
+
+    void StatsOdeAccumulator::GetWindowSettings(uint* window, uint* slide)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        *window = m_window;
+        *slide = m_slide;
+    }
+
+    bool StatsOdeAccumulator::SetWindowSettings(uint window, uint slide)
+    {
+        LOG_FUNC();
+        
+        if (!slide)
+        {
+            slide = window;
+        }
+        if (!window or window % slide or 
+            window/slide > DSL_ODE_STATS_MAX_PANES)
+        {
+            LOG_ERROR("Invalid window = " << window << " and slide = " 
+                << slide << " for StatsOdeAccumulator '" << GetName() << "'");
+            return false;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_window = window;
+        m_slide = slide;
+        m_numPanes = window/slide;
+        
+        m_keyStats.clear();
+        m_sourceWindows.clear();
+        
+        return true;
+    }
+
+    bool StatsOdeAccumulator::GetStats(uint sourceId, uint classId, 
+        uint metric, dsl_ode_stats* stats)
+    {
+        LOG_FUNC();
+        
+        if (metric >= DSL_ODE_STATS_NUM_METRICS)
+        {
+            LOG_ERROR("Invalid stats metric = " << metric);
+            return false;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        auto ikey = m_keyStats.find(((uint64_t)sourceId << 32) | classId);
+        if (ikey == m_keyStats.end() or !ikey->second.windowClosed)
+        {
+            LOG_INFO("No closed window for source = " << sourceId 
+                << " and class = " << classId << " for StatsOdeAccumulator '"
+                << GetName() << "'");
+            return false;
+        }
+        const StreamingStats& windowStats = ikey->second.window[metric];
+        
+        stats->source_id = sourceId;
+        stats->class_id = classId;
+        stats->metric = metric;
+        stats->window_end_frame = ikey->second.windowEndFrame;
+        stats->count = windowStats.count;
+        stats->mean = windowStats.mean;
+        stats->variance = (windowStats.count > 1)
+            ? windowStats.m2/(windowStats.count - 1)
+            : 0;
+        stats->min = (windowStats.count) ? windowStats.min : 0;
+        stats->max = (windowStats.count) ? windowStats.max : 0;
+        stats->p50 = windowStats.Quantile(0.50);
+        stats->p90 = windowStats.Quantile(0.90);
+        stats->p99 = windowStats.Quantile(0.99);
+        
+        return true;
+    }
+
+    void StatsOdeAccumulator::ClearStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_keyStats.clear();
+        m_sourceWindows.clear();
+    }
 }
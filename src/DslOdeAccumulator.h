@@ -29,6 +29,9 @@ THE SOFTWARE.
 #include "DslApi.h"
 #include "DslOdeBase.h"
 
+#include <array>
+#include <limits>
+
 namespace DSL
 {
     /**
@@ -38,6 +41,34 @@ namespace DSL
     #define DSL_ODE_ACCUMULATOR_NEW(name) \
         std::shared_ptr<OdeAccumulator>(new OdeAccumulator(name))
 
+    #define DSL_ODE_STATS_ACCUMULATOR_PTR std::shared_ptr<StatsOdeAccumulator>
+    #define DSL_ODE_STATS_ACCUMULATOR_NEW(name, window, slide) \
+        std::shared_ptr<StatsOdeAccumulator>(new StatsOdeAccumulator(name, \
+            window, slide))
+
+    /**
+     * @brief Number of metrics, one for each DSL_ODE_STATS_METRIC_* constant.
+     */
+    #define DSL_ODE_STATS_NUM_METRICS                                   4
+
+    /**
+     * @brief Log-linear histogram dimensions for StreamingStats. Each power
+     * of 2 from 2^MIN_EXPONENT to 2^MAX_EXPONENT is split into SUB_BUCKETS
+     * linear buckets, with an additional bucket for all values below range.
+     * Quantiles are within 1/(2*SUB_BUCKETS) of the true value.
+     */
+    #define DSL_STREAMING_STATS_SUB_BUCKETS                             8
+    #define DSL_STREAMING_STATS_MIN_EXPONENT                            -8
+    #define DSL_STREAMING_STATS_MAX_EXPONENT                            24
+    #define DSL_STREAMING_STATS_BUCKETS \
+        ((DSL_STREAMING_STATS_MAX_EXPONENT - DSL_STREAMING_STATS_MIN_EXPONENT) \
+            *DSL_STREAMING_STATS_SUB_BUCKETS + 1)
+
+    /**
+     * @brief Maximum number of panes -- window/slide -- for a sliding window.
+     */
+    #define DSL_ODE_STATS_MAX_PANES                                     16
+
     // *****************************************************************************
 
     /**
@@ -60,9 +91,18 @@ namespace DSL
          * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
          * NULL if Frame level absence, total, min, max, etc. events.
          */
-        void HandleOccurrences(DSL_BASE_PTR pOdeTrigger, 
+        virtual void HandleOccurrences(DSL_BASE_PTR pOdeTrigger, 
             GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
             NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Handles a single object occurrence, called by the Trigger
+         * for each object that triggers an ODE occurrence. No-op by default.
+         * @param[in] pFrameMeta pointer to the Frame Meta of the occurrence.
+         * @param[in] pObjectMeta pointer to the Object Meta of the occurrence.
+         */
+        virtual void HandleOccurrence(NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta){};
         
         /**
          * @brief Adds an ODE Action as a child to this OdeAccumulator
@@ -83,6 +123,25 @@ namespace DSL
          */
         void RemoveAllActions(); 
 
+        /**
+         * @brief number of frames for which the Accumulator has been called
+         * to handle the accumulated occurrences.
+         */
+        OdeCounter m_accumulations;
+
+    protected:
+
+        /**
+         * @brief Invokes all child ODE Actions in add-order.
+         * @param[in] pOdeTrigger shared pointer to the calling ODE Trigger.
+         * @param[in] pBuffer pointer to the batched stream buffer.
+         * @param[in] displayMetaData vector of Display Meta for the frame.
+         * @param[in] pFrameMeta pointer to the Frame Meta to pass to each Action.
+         */
+        void InvokeActions(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer, 
+            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            NvDsFrameMeta* pFrameMeta);
+
     private:
     
         /**
@@ -102,6 +161,217 @@ namespace DSL
 
     };
 
+    // *****************************************************************************
+
+    /**
+     * @class StreamingStats
+     * @brief Mergeable, fixed-size streaming statistics for a single metric:
+     * count, mean and variance (Welford), min, max and approximate quantiles
+     * from a log-linear histogram. Add is O(1); Merge is O(buckets).
+     */
+    class StreamingStats
+    {
+    public:
+
+        StreamingStats();
+
+        /**
+         * @brief Adds a value to the statistics.
+         * @param[in] value value to add.
+         * @param[in] weight number of times to add the value.
+         */
+        void Add(double value, uint64_t weight = 1);
+
+        /**
+         * @brief Merges another set of statistics into this set.
+         * @param[in] other statistics to merge.
+         */
+        void Merge(const StreamingStats& other);
+
+        /**
+         * @brief Clears all statistics.
+         */
+        void Clear();
+
+        /**
+         * @brief Gets an approximate quantile of all values added.
+         * @param[in] q quantile to get in the range [0.0, 1.0].
+         * @return approximate value at quantile q, 0 if count is 0.
+         */
+        double Quantile(double q) const;
+
+        /**
+         * @brief number of values added.
+         */
+        uint64_t count;
+
+        /**
+         * @brief running mean of all values added.
+         */
+        double mean;
+
+        /**
+         * @brief running sum of squared differences from the mean.
+         */
+        double m2;
+
+        /**
+         * @brief minimum and maximum values added.
+         */
+        double min;
+        double max;
+
+    private:
+
+        /**
+         * @brief Returns the histogram bucket for a given value.
+         */
+        static uint BucketIndex(double value);
+
+        /**
+         * @brief Returns the midpoint value of a given histogram bucket.
+         */
+        static double BucketValue(uint index);
+
+        /**
+         * @brief log-linear histogram of all values added.
+         */
+        uint32_t m_buckets[DSL_STREAMING_STATS_BUCKETS];
+    };
+
+    // *****************************************************************************
+
+    /**
+     * @class StatsOdeAccumulator
+     * @brief Accumulator that maintains streaming statistics per source and
+     * class over tumbling or sliding windows measured in frames. The metrics
+     * are the number of occurrences per frame and the confidence, width and
+     * height of each occurring object. On window close, the window's
+     * statistics are saved for query and all ODE Actions are invoked.
+     */
+    class StatsOdeAccumulator : public OdeAccumulator
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the StatsOdeAccumulator class
+         * @param[in] name unique name for the new Accumulator.
+         * @param[in] window window size in frames.
+         * @param[in] slide frames between window closes, 0 or window for 
+         * tumbling windows. window must be a multiple of slide.
+         */
+        StatsOdeAccumulator(const char* name, uint window, uint slide);
+
+        ~StatsOdeAccumulator();
+
+        /**
+         * @brief Updates the current frame's statistics and, on window close,
+         * invokes all ODE Actions. Called once per frame by the Trigger.
+         */
+        void HandleOccurrences(DSL_BASE_PTR pOdeTrigger, 
+            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Adds a single object occurrence to the current window. 
+         * O(1) in the number of occurrences.
+         */
+        void HandleOccurrence(NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Gets the current window settings for this Accumulator.
+         * @param[out] window window size in frames.
+         * @param[out] slide frames between window closes.
+         */
+        void GetWindowSettings(uint* window, uint* slide);
+
+        /**
+         * @brief Sets the window settings for this Accumulator. All current
+         * statistics are cleared.
+         * @param[in] window window size in frames.
+         * @param[in] slide frames between window closes, 0 for tumbling.
+         * @return true if window is a multiple of slide, false otherwise.
+         */
+        bool SetWindowSettings(uint window, uint slide);
+
+        /**
+         * @brief Gets the statistics for the last closed window for a 
+         * source, class and metric.
+         * @param[in] sourceId unique source id to query.
+         * @param[in] classId class id to query.
+         * @param[in] metric one of the DSL_ODE_STATS_METRIC_* constants.
+         * @param[out] stats statistics for the last closed window.
+         * @return true if a window has closed for the source and class, 
+         * false otherwise.
+         */
+        bool GetStats(uint sourceId, uint classId, uint metric,
+            dsl_ode_stats* stats);
+
+        /**
+         * @brief Clears all current and closed window statistics.
+         */
+        void ClearStats();
+
+    private:
+
+        /**
+         * @brief Panes and closed-window statistics for a source and class.
+         */
+        struct KeyStats
+        {
+            std::vector<std::array<StreamingStats, 
+                DSL_ODE_STATS_NUM_METRICS>> panes;
+            std::array<StreamingStats, DSL_ODE_STATS_NUM_METRICS> window;
+            uint frameOccurrences;
+            uint64_t windowEndFrame;
+            bool windowClosed;
+        };
+
+        /**
+         * @brief Pane progress and keys for a single source.
+         */
+        struct SourceWindow
+        {
+            uint64_t frames;
+            uint paneIndex;
+            std::vector<uint64_t> keys;
+            std::vector<uint64_t> touchedKeys;
+        };
+
+        /**
+         * @brief Closes the current pane for a source, saving the window's
+         * statistics for each key once the first window is full.
+         * @return true if a window was closed, false otherwise.
+         */
+        bool ClosePane(SourceWindow& sourceWindow, uint64_t frameNum);
+
+        /**
+         * @brief window size in frames.
+         */
+        uint m_window;
+
+        /**
+         * @brief frames between window closes, equal to m_window if tumbling.
+         */
+        uint m_slide;
+
+        /**
+         * @brief number of panes per window, m_window/m_slide.
+         */
+        uint m_numPanes;
+
+        /**
+         * @brief map of source and class keys to their statistics.
+         */
+        std::unordered_map<uint64_t, KeyStats> m_keyStats;
+
+        /**
+         * @brief map of source ids to their window progress.
+         */
+        std::unordered_map<uint, SourceWindow> m_sourceWindows;
+    };
+
 }
 
 #endif // _DSL_ODE_ACCUMULATOR_H
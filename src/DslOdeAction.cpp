@@ -35,8 +35,15 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    thread_local const std::set<std::string>* OdeAction::s_pFiredTriggers(NULL);
+
     OdeAction::OdeAction(const char* name)
         : OdeBase(name)
+        , m_dedupEnabled(false)
+        , m_dedupWindow(0)
+        , m_dedupFanIn(false)
+        , m_invocations(0)
+        , m_duplicates(0)
     {
         LOG_FUNC();
     }
@@ -46,6 +53,248 @@ namespace DSL
         LOG_FUNC();
     }
     
+    void OdeAction::Invoke(DSL_BASE_PTR pOdeTrigger, 
+        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        // No function log - avoid overhead.
+        
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dedupMutex);
+            
+            if (m_dedupEnabled)
+            {
+                DedupKeyT key;
+                DedupEntry* pEntry = 
+                    checkForDuplicate(pOdeTrigger, pFrameMeta, pObjectMeta, key);
+                if (!pEntry)
+                {
+                    return;
+                }
+                if (m_dedupFanIn)
+                {
+                    DSL_ODE_TRIGGER_PTR pTrigger = 
+                        std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
+
+                    pEntry->deferredIndex = m_deferredOccurrences.size();
+                    m_deferredOccurrences.push_back({pOdeTrigger, pBuffer,
+                        &displayMetaData, pFrameMeta, pObjectMeta, key,
+                        {pOdeTrigger->GetName()}, pTrigger->m_activeClassId,
+                        pTrigger->m_activeEventId, pTrigger->m_occurrences});
+                    return;
+                }
+            }
+        }
+        m_invocations++;
+        HandleOccurrence(pOdeTrigger, pBuffer, displayMetaData, 
+            pFrameMeta, pObjectMeta);
+    }
+    
+    void OdeAction::InvokeStatic(DSL_BASE_PTR pOdeTrigger, 
+        NvDsFrameMeta* pFrameMeta)
+    {
+        // No function log - avoid overhead.
+        
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dedupMutex);
+            
+            // The occurrence is never deferred for fan-in, as the Action's
+            // Display Types are already drawn by the StaticOverlay.
+            DedupKeyT key;
+            if (m_dedupEnabled and 
+                !checkForDuplicate(pOdeTrigger, pFrameMeta, NULL, key))
+            {
+                return;
+            }
+        }
+        m_invocations++;
+    }
+    
+    OdeAction::DedupEntry* OdeAction::checkForDuplicate(DSL_BASE_PTR pOdeTrigger,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta, DedupKeyT& key)
+    {
+        // internal do not lock m_dedupMutex
+        
+        DedupSourceState& sourceState = 
+            m_dedupSourceStates[pFrameMeta->source_id];
+        
+        // Purge all expired entries on the first occurrence of each
+        // new frame for the source. Untracked and frame level entries
+        // are only ever valid for the frame they were added in.
+        if (sourceState.frameNum != pFrameMeta->frame_num)
+        {
+            sourceState.frameNum = pFrameMeta->frame_num;
+            
+            for (auto ientry = sourceState.entries.begin(); 
+                ientry != sourceState.entries.end();)
+            {
+                if (!std::get<1>(ientry->first) or !m_dedupWindow or
+                    pFrameMeta->buf_pts - ientry->second.pts >=
+                        (uint64_t)m_dedupWindow*GST_MSECOND)
+                {
+                    ientry = sourceState.entries.erase(ientry);
+                }
+                else
+                {
+                    ientry++;
+                }
+            }
+        }
+        bool isTracked(pObjectMeta and 
+            pObjectMeta->object_id != UNTRACKED_OBJECT_ID);
+        key = DedupKeyT(pFrameMeta->source_id, isTracked, 
+            (isTracked) ? pObjectMeta->object_id : (uint64_t)pObjectMeta);
+            
+        auto ientry = sourceState.entries.find(key);
+        if (ientry != sourceState.entries.end())
+        {
+            // Repeat occurrence. With fan-in, add the Trigger to the 
+            // set of fired Triggers if still deferred.
+            m_duplicates++;
+            if (ientry->second.deferredIndex >= 0)
+            {
+                m_deferredOccurrences[ientry->second.deferredIndex].
+                    firedTriggers.insert(pOdeTrigger->GetName());
+            }
+            return NULL;
+        }
+        DedupEntry& entry = sourceState.entries[key];
+        entry.frameNum = pFrameMeta->frame_num;
+        entry.pts = pFrameMeta->buf_pts;
+        entry.deferredIndex = -1;
+        
+        return &entry;
+    }
+    
+    void OdeAction::CompleteDeferredOccurrences(DSL_BASE_PTR pOdeTrigger)
+    {
+        // No function log - avoid overhead.
+
+        // Only the occurrences first fired by the calling Trigger are handled,
+        // so that each is handled with its own Trigger's property mutex held.
+        std::vector<DeferredOccurrence> deferredOccurrences;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dedupMutex);
+            
+            if (m_deferredOccurrences.empty())
+            {
+                return;
+            }
+            std::vector<DeferredOccurrence> remainingOccurrences;
+            
+            for (auto& ideferred: m_deferredOccurrences)
+            {
+                auto& entries = 
+                    m_dedupSourceStates[std::get<0>(ideferred.key)].entries;
+                auto ientry = entries.find(ideferred.key);
+                
+                if (ideferred.pOdeTrigger == pOdeTrigger)
+                {
+                    if (ientry != entries.end())
+                    {
+                        ientry->second.deferredIndex = -1;
+                    }
+                    deferredOccurrences.push_back(std::move(ideferred));
+                }
+                else
+                {
+                    if (ientry != entries.end())
+                    {
+                        ientry->second.deferredIndex = 
+                            remainingOccurrences.size();
+                    }
+                    remainingOccurrences.push_back(std::move(ideferred));
+                }
+            }
+            m_deferredOccurrences.swap(remainingOccurrences);
+        }
+        if (deferredOccurrences.empty())
+        {
+            return;
+        }
+        DSL_ODE_TRIGGER_PTR pTrigger = 
+            std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
+            
+        // The Actions see the captured class id, event id, and occurrences
+        // for the duration of the call only, as for keyed Triggers.
+        uint activeClassId = pTrigger->m_activeClassId;
+        uint64_t activeEventId = pTrigger->m_activeEventId;
+        uint occurrences = pTrigger->m_occurrences;
+        
+        for (auto& ideferred: deferredOccurrences)
+        {
+            s_pFiredTriggers = &ideferred.firedTriggers;
+            pTrigger->m_activeClassId = ideferred.classId;
+            pTrigger->m_activeEventId = ideferred.eventId;
+            pTrigger->m_occurrences = ideferred.occurrences;
+            m_invocations++;
+            try
+            {
+                HandleOccurrence(ideferred.pOdeTrigger, ideferred.pBuffer, 
+                    *ideferred.pDisplayMetaData, ideferred.pFrameMeta, 
+                    ideferred.pObjectMeta);
+            }
+            catch(...)
+            {
+                LOG_ERROR("ODE Action '" << GetName() 
+                    << "' threw exception handling deferred occurrence");
+            }
+            s_pFiredTriggers = NULL;
+        }
+        pTrigger->m_activeClassId = activeClassId;
+        pTrigger->m_activeEventId = activeEventId;
+        pTrigger->m_occurrences = occurrences;
+    }
+
+    void OdeAction::GetDedupSettings(bool* enabled, uint* window, bool* fanIn)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dedupMutex);
+        
+        *enabled = m_dedupEnabled;
+        *window = m_dedupWindow;
+        *fanIn = m_dedupFanIn;
+    }
+
+    void OdeAction::SetDedupSettings(bool enabled, uint window, bool fanIn)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dedupMutex);
+        
+        m_dedupEnabled = enabled;
+        m_dedupWindow = window;
+        m_dedupFanIn = fanIn;
+        
+        // Start over with the new settings. Any deferred occurrences 
+        // are still handled at the end of the current frame.
+        m_dedupSourceStates.clear();
+    }
+
+    const std::set<std::string>& OdeAction::GetFiredTriggers()
+    {
+        static const std::set<std::string> noTriggers;
+        
+        return (s_pFiredTriggers) ? *s_pFiredTriggers : noTriggers;
+    }
+    
+    std::string OdeAction::GetTriggerNames(DSL_BASE_PTR pOdeTrigger)
+    {
+        if (!s_pFiredTriggers or s_pFiredTriggers->size() < 2)
+        {
+            return pOdeTrigger->GetName();
+        }
+        std::string names;
+        for (auto& iname: *s_pFiredTriggers)
+        {
+            if (names.size())
+            {
+                names += ", ";
+            }
+            names += iname;
+        }
+        return names;
+    }
+    
     std::string OdeAction::Ntp2Str(uint64_t ntp)
     {
         time_t secs = round(ntp/1000000000);
@@ -111,6 +360,155 @@ namespace DSL
         return false;
     }
 
+    // ********************************************************************
+
+    SummaryOdeAction::SummaryOdeAction(const char* name) 
+        : OdeAction(name)
+        , m_summaryInterval(0)
+        , m_summarySamples(0)
+        , m_summaryTimerId(0)
+    {
+        LOG_FUNC();
+    };
+    
+    SummaryOdeAction::~SummaryOdeAction()
+    {
+        LOG_FUNC();
+        
+        StopSummaryTimer();
+    }
+
+    void SummaryOdeAction::StopSummaryTimer()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_summaryMutex);
+        
+        if (m_summaryTimerId)
+        {
+            g_source_remove(m_summaryTimerId);
+            m_summaryTimerId = 0;
+        }
+    }
+
+    void SummaryOdeAction::GetSummarySettings(uint* interval, uint* samples)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_summaryMutex);
+        
+        *interval = m_summaryInterval;
+        *samples = m_summarySamples;
+    }
+
+    void SummaryOdeAction::SetSummarySettings(uint interval, uint samples)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_summaryMutex);
+        
+        if (m_summaryTimerId)
+        {
+            g_source_remove(m_summaryTimerId);
+            m_summaryTimerId = 0;
+        }
+        m_summaryInterval = interval;
+        m_summarySamples = samples;
+        
+        // Any partial interval is discarded on change of settings.
+        m_summaries.clear();
+        
+        if (m_summaryInterval)
+        {
+            m_summaryTimerId = g_timeout_add(m_summaryInterval, 
+                do_summary_timer, this);
+        }
+    }
+
+    bool SummaryOdeAction::SummarizeOccurrence(DSL_BASE_PTR pOdeTrigger, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        // No function log - called for every occurrence.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_summaryMutex);
+        
+        if (!m_summaryInterval)
+        {
+            return true;
+        }
+        DSL_ODE_TRIGGER_PTR pTrigger = 
+            std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
+
+        int classId = (pObjectMeta) 
+            ? pObjectMeta->class_id 
+            : (int)pTrigger->m_activeClassId;
+            
+        SummaryKeyT key(pOdeTrigger.get(), pFrameMeta->source_id, classId);
+        
+        auto ientry = m_summaries.find(key);
+        if (ientry == m_summaries.end())
+        {
+            // Trigger names are only formatted once per key, per interval.
+            SummaryEntry entry{GetTriggerNames(pOdeTrigger), 0, 
+                (uint64_t)pFrameMeta->frame_num, (uint64_t)pFrameMeta->frame_num, 
+                1.0f, 0.0f, 0};
+            ientry = m_summaries.insert(std::make_pair(key, entry)).first;
+        }
+        SummaryEntry& entry = ientry->second;
+        
+        entry.occurrences++;
+        entry.lastFrame = (uint64_t)pFrameMeta->frame_num;
+        if (pObjectMeta)
+        {
+            entry.minConfidence = std::min(entry.minConfidence, 
+                pObjectMeta->confidence);
+            entry.maxConfidence = std::max(entry.maxConfidence, 
+                pObjectMeta->confidence);
+        }
+        if (entry.samples < m_summarySamples)
+        {
+            entry.samples++;
+            return true;
+        }
+        return false;
+    }
+
+    bool SummaryOdeAction::HandleSummaryTimer()
+    {
+        // No function log - called on every interval.
+        
+        std::map<SummaryKeyT, SummaryEntry> summaries;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_summaryMutex);
+            
+            summaries.swap(m_summaries);
+        }
+        
+        // Format and write the summary lines without the mutex held.
+        for (auto& imap: summaries)
+        {
+            const SummaryEntry& entry = imap.second;
+            
+            std::ostringstream line;
+            line << "Trigger: " << entry.triggerNames
+                << " | Source: " << int_to_hex(std::get<1>(imap.first))
+                << " | Class: " << std::get<2>(imap.first)
+                << " | Occurrences: " << entry.occurrences
+                << " | Frames: " << entry.firstFrame << "-" << entry.lastFrame;
+                
+            // Confidence is only aggregated for object occurrences
+            if (entry.minConfidence <= entry.maxConfidence)
+            {
+                line << " | Conf: " << std::fixed << std::setprecision(2) 
+                    << entry.minConfidence << "-" << entry.maxConfidence;
+            }
+            WriteSummary(line.str());
+        }
+        return true;
+    }
+
+    static int do_summary_timer(gpointer pAction)
+    {
+        return static_cast<SummaryOdeAction*>(pAction)->
+            HandleSummaryTimer();
+    }
+
 
     // ********************************************************************
 
@@ -469,7 +867,7 @@ namespace DSL
             }
             DSL_ODE_TRIGGER_PTR pTrigger 
                 = std::dynamic_pointer_cast<OdeTrigger>(pBase);
-            m_clientHandler(pTrigger->s_eventCount, pTrigger->m_wName.c_str(), 
+            m_clientHandler(pTrigger->m_activeEventId, pTrigger->m_wName.c_str(), 
                 pBuffer, pDisplayMeta, pFrameMeta, pObjectMeta, m_clientData);
         }
         catch(...)
@@ -499,6 +897,8 @@ namespace DSL
         , m_captureType(captureType)
         , m_outdir(outdir)
         , m_idleThreadFunctionId(0)
+        , m_pQueuedObjectsBuffer(NULL)
+        , m_queuedObjectsBatchId(0)
     {
         LOG_FUNC();
     }
@@ -506,6 +906,11 @@ namespace DSL
     CaptureOdeAction::~CaptureOdeAction()
     {
         LOG_FUNC();
+        
+        if (m_pQueuedObjectsBuffer)
+        {
+            gst_buffer_unref(m_pQueuedObjectsBuffer);
+        }
 
         // If the idle-thread for processing images is currently running.
         if (m_idleThreadFunctionId)
@@ -674,7 +1079,86 @@ namespace DSL
         {
             return;
         }
+        
+        // Object captures are queued and then captured together, with one 
+        // batched transform per frame, on PostProcessFrame.
+        if (m_captureType == DSL_CAPTURE_TYPE_OBJECT)
+        {
+            // Safety check - capture any Objects queued from a different frame.
+            if (m_pQueuedObjectsBuffer and 
+                (m_pQueuedObjectsBuffer != pBuffer or 
+                    m_queuedObjectsBatchId != pFrameMeta->batch_id))
+            {
+                CaptureQueuedObjects();
+            }
+            
+            // Create crop rectangle params ensuring that width and height are 
+            // divisable by 2. This is done to ensure that the plane width and 
+            // height (which are always created as even numbers) will match the 
+            // buffer width and height.
+            gint left = GST_ROUND_UP_2(
+                gint(std::round(pObjectMeta->rect_params.left)));
+            gint top = GST_ROUND_UP_2(
+                gint(std::round(pObjectMeta->rect_params.top)));
+            gint width = GST_ROUND_DOWN_2(
+                gint(std::round(pObjectMeta->rect_params.width)));
+            gint height = GST_ROUND_DOWN_2(
+                gint(std::round(pObjectMeta->rect_params.height)));
+                
+            if (width <= 0 or height <= 0)
+            {
+                LOG_WARN("Unable to capture object with dimensions " 
+                    << width << "x" << height << " for Action '" 
+                    << GetName() << "'");
+                return;
+            }
+            if (!m_pQueuedObjectsBuffer)
+            {
+                m_pQueuedObjectsBuffer = gst_buffer_ref(pBuffer);
+                m_queuedObjectsBatchId = pFrameMeta->batch_id;
+            }
+            
+            // this is the correct order for Transform (top first)
+            m_queuedObjectRects.push_back({(guint)top, (guint)left, 
+                (guint)width, (guint)height});
+            m_queuedObjectCaptureIds.push_back(s_captureId++);
+
+            LOG_INFO("Capturing object " << m_queuedObjectCaptureIds.back() 
+                << " with coordinates " << left << "," << top 
+                << " and dimensions " << width << "x" << height);
+            return;
+        }
+
+        std::shared_ptr<DslBufferSurface> pBufferSurface = 
+            TransformFrame(pBuffer, pFrameMeta);
+        if (pBufferSurface)
+        {
+            queueCapturedImage(pBufferSurface);
+        }
+    }
 
+    std::shared_ptr<DslBufferSurface> CaptureOdeAction::CaptureFrame(
+        GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        return TransformFrame(pBuffer, pFrameMeta);
+    }
+    
+    std::string CaptureOdeAction::GetOutdir()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        return m_outdir;
+    }
+
+    std::shared_ptr<DslBufferSurface> CaptureOdeAction::TransformFrame(
+        GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta)
+    {
+        LOG_FUNC();
+        
         // Map the current buffer
         std::unique_ptr<DslMappedBuffer> pMappedBuffer = 
             std::unique_ptr<DslMappedBuffer>(new DslMappedBuffer(pBuffer));
@@ -696,35 +1180,11 @@ namespace DSL
         // as the index
         DslMonoSurface monoSurface(pMappedBuffer->pSurface, pFrameMeta->batch_id);
 
-        // Coordinates and dimensions for our destination surface.
-        gint left(0), top(0), width(0), height(0);
-
-        // capturing full frame or object only?
-        if (m_captureType == DSL_CAPTURE_TYPE_FRAME)
-        {
-            width = pMappedBuffer->GetWidth(pFrameMeta->batch_id);
-            height = pMappedBuffer->GetHeight(pFrameMeta->batch_id);
-            LOG_INFO("Capturing frame with dimensions " 
-                << width << "x" << height);
-        }
-        // Create crop rectangle params ensuring that width and height are divisable 
-        // by 2. This is done to ensure that the plane width and height (which 
-        // are always created as even numbers) will match the buffer width and height.
-        else
-        {
-            left = GST_ROUND_UP_2(
-                gint(std::round(pObjectMeta->rect_params.left)));
-            top = GST_ROUND_UP_2(
-                gint(std::round(pObjectMeta->rect_params.top)));
-            width = GST_ROUND_DOWN_2(
-                gint(std::round(pObjectMeta->rect_params.width)));
-            height = GST_ROUND_DOWN_2(
-                gint(std::round(pObjectMeta->rect_params.height)));
-
-            LOG_INFO("Capturing object " << s_captureId 
-                << " with coordinates " << left << "," << top 
-                << " and dimensions " << width << "x" << height);
-        }
+        // Dimensions for our destination surface - capturing the full frame.
+        gint width = pMappedBuffer->GetWidth(pFrameMeta->batch_id);
+        gint height = pMappedBuffer->GetHeight(pFrameMeta->batch_id);
+        LOG_INFO("Capturing frame with dimensions " 
+            << width << "x" << height);
 
         // New "create params" for our destination surface. we only need one 
         // surface so set memory allocation (for the array of surfaces) size to 0
@@ -739,7 +1199,7 @@ namespace DSL
 
         // New "transform params" for the surface transform, croping or 
         // (future?) scaling
-        DslTransformParams transformParams(left, top, width, height);
+        DslTransformParams transformParams(0, 0, width, height);
         
         // New "Cuda stream" for the surface transform
         DslCudaStream dslCudaStream(monoSurface.gpuId);
@@ -754,7 +1214,7 @@ namespace DSL
             LOG_ERROR(
                 "Destination surface failed to set transform session params for Action '" 
                 << GetName() << "'");
-            return;
+            return nullptr;
         }
         
         // We can now transform our Mono Source surface to the first (and only) 
@@ -763,7 +1223,7 @@ namespace DSL
         {
             LOG_ERROR("Destination surface failed to transform for Action '" 
                 << GetName() << "'");
-            return;
+            return nullptr;
         }
 
         // Map the tranformed surface for read
@@ -771,10 +1231,125 @@ namespace DSL
         {
             LOG_ERROR("Destination surface failed to map for Action '" 
                 << GetName() << "'");
-            return;
+            return nullptr;
         }
 
-        queueCapturedImage(pBufferSurface);
+        return pBufferSurface;
+    }
+
+    void CaptureOdeAction::PostProcessFrame(GstBuffer* pBuffer, 
+        NvDsFrameMeta* pFrameMeta)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (m_pQueuedObjectsBuffer)
+        {
+            CaptureQueuedObjects();
+        }
+    }
+
+    void CaptureOdeAction::CaptureQueuedObjects()
+    {
+        LOG_FUNC();
+        
+        if (!TransformQueuedObjects())
+        {
+            LOG_ERROR("Failed to capture " << m_queuedObjectRects.size() 
+                << " queued objects for Action '" << GetName() << "'");
+        }
+        gst_buffer_unref(m_pQueuedObjectsBuffer);
+        m_pQueuedObjectsBuffer = NULL;
+        m_queuedObjectRects.clear();
+        m_queuedObjectCaptureIds.clear();
+    }
+
+    bool CaptureOdeAction::TransformQueuedObjects()
+    {
+        LOG_FUNC();
+        
+        uint numObjects = m_queuedObjectRects.size();
+        
+        // Map the queued buffer - once for all Objects
+        std::unique_ptr<DslMappedBuffer> pMappedBuffer = 
+            std::unique_ptr<DslMappedBuffer>(
+                new DslMappedBuffer(m_pQueuedObjectsBuffer));
+            
+        // One time read of the Device properties
+        if (!m_cudaDevicePropRead)
+        {
+            cudaGetDeviceProperties(&m_cudaDeviceProp, pMappedBuffer->pSurface->gpuId);
+            m_cudaDevicePropRead = true;
+        }
+
+        NvBufSurfaceMemType transformMemType = (m_cudaDeviceProp.integrated)
+            ? NVBUF_MEM_DEFAULT
+            : NVBUF_MEM_CUDA_PINNED;
+            
+        // New multi surface with the frame's single surface repeated once 
+        // for each Object ... becoming our new batched source surface.
+        DslMultiSurface multiSurface(pMappedBuffer->pSurface, 
+            m_queuedObjectsBatchId, numObjects);
+            
+        // All surfaces in a batch share the same dimensions, so the destination 
+        // is created large enough for the largest crop. 
+        uint maxWidth(0), maxHeight(0);
+        for (auto& irect: m_queuedObjectRects)
+        {
+            maxWidth = std::max(maxWidth, irect.width);
+            maxHeight = std::max(maxHeight, irect.height);
+        }
+        DslSurfaceCreateParams surfaceCreateParams(multiSurface.gpuId, 
+            maxWidth, maxHeight, 0, NVBUF_COLOR_FORMAT_RGBA, transformMemType);
+        
+        // New Destination surface with one surface per Object
+        std::shared_ptr<DslBufferSurface> pBatchSurface = 
+            std::shared_ptr<DslBufferSurface>(new DslBufferSurface(numObjects, 
+                surfaceCreateParams, m_queuedObjectCaptureIds.front()));
+
+        // New "transform params" with one crop rectangle per Object
+        DslBatchTransformParams transformParams(m_queuedObjectRects);
+        
+        // New "Cuda stream" for the surface transform
+        DslCudaStream dslCudaStream(multiSurface.gpuId);
+        
+        // New "Transform Session" config params using the new Cuda stream
+        DslSurfaceTransformSessionParams dslTransformSessionParams(
+            multiSurface.gpuId, dslCudaStream);
+        
+        if (!dslTransformSessionParams.Set())
+        {
+            LOG_ERROR(
+                "Destination surface failed to set transform session params for Action '" 
+                << GetName() << "'");
+            return false;
+        }
+        
+        // One transform call for all Objects in the frame
+        if (!pBatchSurface->TransformMultiSurface(multiSurface, transformParams))
+        {
+            LOG_ERROR("Destination surface failed to transform for Action '" 
+                << GetName() << "'");
+            return false;
+        }
+
+        // One map of the tranformed batched surface for read
+        if (!pBatchSurface->Map())
+        {
+            LOG_ERROR("Destination surface failed to map for Action '" 
+                << GetName() << "'");
+            return false;
+        }
+        
+        // Encoding and writing proceeds per Object, each with a view of its 
+        // crop that shares the batched surface.
+        for (uint i = 0; i < numObjects; i++)
+        {
+            queueCapturedImage(std::shared_ptr<DslBufferSurface>(
+                new DslBufferSurface(pBatchSurface, i, 
+                    m_queuedObjectRects[i].width, m_queuedObjectRects[i].height,
+                    m_queuedObjectCaptureIds[i])));
+        }
+        return true;
     }
 
     void CaptureOdeAction::queueCapturedImage(
@@ -1024,7 +1599,7 @@ namespace DSL
             // Free up the existing label memory, and reallocate to ensure suffcient size
             g_free(pObjectMeta->text_params.display_text);
             pObjectMeta->text_params.display_text = 
-                (gchar*) g_malloc0(MAX_DISPLAY_LEN);
+                DisplayTextAlloc(MAX_DISPLAY_LEN);
 
             for (auto const &iter: m_contentTypes)
             {
@@ -1125,7 +1700,7 @@ namespace DSL
             
             NvOSD_TextParams *pTextParams = 
                 &displayMetaData.at(0)->text_params[pDisplayMeta->num_labels++];
-            pTextParams->display_text = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
+            pTextParams->display_text = DisplayTextAlloc(MAX_DISPLAY_LEN);
             
             std::string text(m_formatString.c_str());
             
@@ -1180,7 +1755,7 @@ namespace DSL
 
             // Font, font-size, font-color
             pTextParams->font_params = *m_pFont;
-            pTextParams->font_params.font_name = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
+            pTextParams->font_params.font_name = DisplayTextAlloc(MAX_DISPLAY_LEN);
             m_pFont->m_fontName.copy(
                 pTextParams->font_params.font_name, MAX_DISPLAY_LEN, 0);
             
@@ -1223,9 +1798,9 @@ namespace DSL
             std::vector<std::string> body;
             
             body.push_back(std::string("Trigger Name        : " 
-                + pTrigger->GetName() + "<br>"));
+                + GetTriggerNames(pOdeTrigger) + "<br>"));
             body.push_back(std::string("  Unique ODE Id     : " 
-                + std::to_string(pTrigger->s_eventCount) + "<br>"));
+                + std::to_string(pTrigger->m_activeEventId) + "<br>"));
             body.push_back(std::string("  NTP Timestamp     : " 
                 +  Ntp2Str(pFrameMeta->ntp_timestamp) + "<br>"));
             body.push_back(std::string("  Source Data       : ------------------------<br>"));
@@ -1334,7 +1909,7 @@ namespace DSL
 
             body.push_back(std::string("  Criteria          : ------------------------<br>"));
             body.push_back(std::string("    Class Id        : " 
-                +  std::to_string(pTrigger->m_classId) + "<br>"));
+                +  std::to_string(pTrigger->m_activeClassId) + "<br>"));
             if (pTrigger->m_inferDoneOnly)
             {
                 body.push_back(std::string("    Infer Done Only       : Yes<br>"));
@@ -1370,10 +1945,14 @@ namespace DSL
         : OdeAction(name)
         , m_filePath(filePath)
         , m_mode(mode)
+        , m_streamBuffer(BUFSIZ)
         , m_forceFlush(forceFlush)
         , m_flushThreadFunctionId(0)
     {
         LOG_FUNC();
+        
+        // The buffer must be set before the stream is opened by the derived class.
+        m_ostream.rdbuf()->pubsetbuf(m_streamBuffer.data(), m_streamBuffer.size());
     }
 
     FileOdeAction::~FileOdeAction()
@@ -1487,8 +2066,8 @@ namespace DSL
         DSL_ODE_TRIGGER_PTR pTrigger = 
             std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
         
-        m_ostream << "Trigger Name        : " << pTrigger->GetName() << "\n";
-        m_ostream << "  Unique ODE Id     : " << pTrigger->s_eventCount << "\n";
+        m_ostream << "Trigger Name        : " << GetTriggerNames(pOdeTrigger) << "\n";
+        m_ostream << "  Unique ODE Id     : " << pTrigger->m_activeEventId << "\n";
         m_ostream << "  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp) << "\n";
         m_ostream << "  Source Data       : ------------------------" << "\n";
         if (pFrameMeta->bInferDone)
@@ -1560,7 +2139,7 @@ namespace DSL
         }
 
         m_ostream << "  Criteria          : ------------------------" << "\n";
-        m_ostream << "    Class Id        : " << pTrigger->m_classId << "\n";
+        m_ostream << "    Class Id        : " << pTrigger->m_activeClassId << "\n";
         m_ostream << "    Min Infer Conf  : " << pTrigger->m_minConfidence << "\n";
         m_ostream << "    Min Track Conf  : " << pTrigger->m_minTrackerConfidence << "\n";
         m_ostream << "    Min Frame Count : " << pTrigger->m_minFrameCountN
@@ -1676,7 +2255,7 @@ namespace DSL
             std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
         
         m_ostream << pTrigger->GetName() << ",";
-        m_ostream << pTrigger->s_eventCount << ",";
+        m_ostream << pTrigger->m_activeEventId << ",";
         m_ostream << pFrameMeta->ntp_timestamp << ",";
         if (pFrameMeta->bInferDone)
         {
@@ -1733,7 +2312,7 @@ namespace DSL
             m_ostream << "0,0,0,0,0";
         }
 
-        m_ostream << pTrigger->m_classId << ",";
+        m_ostream << pTrigger->m_activeClassId << ",";
         m_ostream << lrint(pTrigger->m_minWidth) << ",";
         m_ostream << lrint(pTrigger->m_minHeight) << ",";
         m_ostream << lrint(pTrigger->m_maxWidth) << ",";
@@ -1934,7 +2513,7 @@ namespace DSL
     // ********************************************************************
 
     LogOdeAction::LogOdeAction(const char* name)
-        : OdeAction(name)
+        : SummaryOdeAction(name)
     {
         LOG_FUNC();
     }
@@ -1942,6 +2521,8 @@ namespace DSL
     LogOdeAction::~LogOdeAction()
     {
         LOG_FUNC();
+        
+        StopSummaryTimer();
     }
 
     void LogOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
@@ -1950,13 +2531,14 @@ namespace DSL
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        if (m_enabled)
+        if (m_enabled and 
+            SummarizeOccurrence(pOdeTrigger, pFrameMeta, pObjectMeta))
         {
             DSL_ODE_TRIGGER_PTR pTrigger = 
                 std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
             
-            LOG_INFO("Trigger Name        : " << pTrigger->GetName());
-            LOG_INFO("  Unique ODE Id     : " << pTrigger->s_eventCount);
+            LOG_INFO("Trigger Name        : " << GetTriggerNames(pOdeTrigger));
+            LOG_INFO("  Unique ODE Id     : " << pTrigger->m_activeEventId);
             LOG_INFO("  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp));
             LOG_INFO("  Source Data       : ------------------------");
             
@@ -2042,7 +2624,7 @@ namespace DSL
                 }
             }
             LOG_INFO("  Criteria          : ------------------------");
-            LOG_INFO("    Class Id        : " << pTrigger->m_classId );
+            LOG_INFO("    Class Id        : " << pTrigger->m_activeClassId );
             LOG_INFO("    Min Infer Id    : " << pTrigger->m_inferId );
             LOG_INFO("    Min Infer Conf  : " << pTrigger->m_minConfidence);
             LOG_INFO("    Min Track Conf  : " << pTrigger->m_minTrackerConfidence);
@@ -2064,8 +2646,29 @@ namespace DSL
         }
     }
 
+    void LogOdeAction::WriteSummary(const std::string& line)
+    {
+        LOG_INFO(line);
+    }
+
     // ********************************************************************
 
+    static size_t message_action_meta_size(NvDsEventMsgMeta* pMsgMeta)
+    {
+        size_t size(sizeof(NvDsEventMsgMeta));
+        
+        for (const gchar* str: {(const gchar*)pMsgMeta->extMsg, 
+            (const gchar*)pMsgMeta->ts, (const gchar*)pMsgMeta->sensorStr, 
+            (const gchar*)pMsgMeta->objectId, (const gchar*)pMsgMeta->otherAttrs})
+        {
+            if (str)
+            {
+                size += strlen(str) + 1;
+            }
+        }
+        return size;
+    }
+
     static gpointer message_action_meta_copy(gpointer data, gpointer user_data)
     {
         NvDsUserMeta* pUserMeta = (NvDsUserMeta*)data;
@@ -2080,6 +2683,9 @@ namespace DSL
         pDstMeta->objectId = g_strdup(pSrcMeta->objectId);
         pDstMeta->otherAttrs = g_strdup(pSrcMeta->otherAttrs);
 
+        MemoryTracker::OnAlloc(DSL_MEMORY_TAG_MESSAGE_META, 
+            message_action_meta_size(pDstMeta));
+
         return pDstMeta;
     }
 
@@ -2088,6 +2694,9 @@ namespace DSL
         NvDsUserMeta *pUserMeta = (NvDsUserMeta *) data;
         NvDsEventMsgMeta *pSrcMeta = (NvDsEventMsgMeta *) pUserMeta->user_meta_data;
 
+        MemoryTracker::OnFree(DSL_MEMORY_TAG_MESSAGE_META, 
+            message_action_meta_size(pSrcMeta));
+
         g_free(pSrcMeta->extMsg);
         g_free(pSrcMeta->ts);
         g_free(pSrcMeta->sensorStr);
@@ -2123,7 +2732,7 @@ namespace DSL
                   
             DSL_ODE_TRIGGER_PTR pTrigger = 
                 std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
-            pMsgMeta->extMsg = g_strdup(pTrigger->GetName().c_str());
+            pMsgMeta->extMsg = g_strdup(GetTriggerNames(pOdeTrigger).c_str());
             pMsgMeta->extMsgSize = strlen((char*)pMsgMeta->extMsg) + 1;
 
             pMsgMeta->sensorId = pFrameMeta->source_id;
@@ -2146,11 +2755,11 @@ namespace DSL
                 pMsgMeta->bbox.width = pObjectMeta->rect_params.width;
                 pMsgMeta->bbox.height = pObjectMeta->rect_params.height;
                 
+                std::ostringstream labelStream;
+                
                 // look for classifier meta to find labels like licence plate numbers
                 if (pObjectMeta->classifier_meta_list)
                 {
-                    std::ostringstream labelStream;
-                    
                     for (NvDsClassifierMetaList* pClassifierMetaList = 
                             pObjectMeta->classifier_meta_list; pClassifierMetaList; 
                                 pClassifierMetaList = pClassifierMetaList->next)
@@ -2176,6 +2785,24 @@ namespace DSL
                             }
                         }
                     }
+                }
+                // add the kinematics written by a Tracking Trigger, if any.
+                gint64 kinematics = 
+                    pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_KINEMATICS];
+                if (kinematics)
+                {
+                    if (labelStream.str().size())
+                    {
+                        labelStream << " ";
+                    }
+                    labelStream 
+                        << "speed=" << DSL_OBJECT_KINEMATICS_SPEED(kinematics)
+                        << " heading=" << DSL_OBJECT_KINEMATICS_HEADING(kinematics)
+                        << " path=" << DSL_OBJECT_KINEMATICS_PATH_LENGTH(kinematics)
+                        << " time=" << DSL_OBJECT_KINEMATICS_TIME_IN_VIEW(kinematics);
+                }
+                if (labelStream.str().size())
+                {
                     pMsgMeta->otherAttrs = g_strdup(labelStream.str().c_str());
                 }
             }
@@ -2194,6 +2821,9 @@ namespace DSL
                     << GetName() << "'");
                 return;
             }
+            MemoryTracker::OnAlloc(DSL_MEMORY_TAG_MESSAGE_META, 
+                message_action_meta_size(pMsgMeta));
+                
             pUserMeta->user_meta_data = (void *)pMsgMeta;
             pUserMeta->base_meta.meta_type = (NvDsMetaType)m_metaType;
             pUserMeta->base_meta.copy_func = 
@@ -2256,7 +2886,7 @@ namespace DSL
             std::wstring wstrTriggerName(pTrigger->GetName().begin(), 
                 pTrigger->GetName().end());
             info.trigger_name = wstrTriggerName.c_str();
-            info.unique_ode_id = pTrigger->s_eventCount;
+            info.unique_ode_id = pTrigger->m_activeEventId;
             info.ntp_timestamp = pFrameMeta->ntp_timestamp;
             info.source_info.inference_done = pFrameMeta->bInferDone;
             info.source_info.source_id = pFrameMeta->source_id;
@@ -2347,7 +2977,7 @@ namespace DSL
             }
             
             // Trigger criteria set for this ODE occurrence.
-            info.criteria_info.class_id =  pTrigger->m_classId;
+            info.criteria_info.class_id =  pTrigger->m_activeClassId;
             info.criteria_info.inference_done_only = pTrigger->m_inferDoneOnly;
             info.criteria_info.inference_component_id = pTrigger->m_inferId;
             info.criteria_info.min_inference_confidence = pTrigger->m_minConfidence;
@@ -2644,6 +3274,8 @@ namespace DSL
         LOG_FUNC();
         
         m_pDisplayTypes.push_back(pDisplayType);
+        
+        StaticOverlay::Invalidate();
     }
     
     void AddDisplayMetaOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
@@ -2661,6 +3293,41 @@ namespace DSL
         }
     }
 
+    bool AddDisplayMetaOdeAction::IsStatic()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        return isStatic();
+    }
+    
+    void AddDisplayMetaOdeAction::GetStaticDisplayTypes(
+        std::vector<DSL_DISPLAY_TYPE_PTR>& displayTypes)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (isStatic())
+        {
+            displayTypes.insert(displayTypes.end(), 
+                m_pDisplayTypes.begin(), m_pDisplayTypes.end());
+        }
+    }
+    
+    bool AddDisplayMetaOdeAction::isStatic()
+    {
+        if (!m_enabled)
+        {
+            return false;
+        }
+        for (const auto &ivec: m_pDisplayTypes)
+        {
+            if (!ivec->IsStatic())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     // ********************************************************************
 
     RemoveObjectOdeAction::RemoveObjectOdeAction(const char* name)
@@ -2847,7 +3514,7 @@ namespace DSL
 
     PrintOdeAction::PrintOdeAction(const char* name,
         bool forceFlush)
-        : OdeAction(name)
+        : SummaryOdeAction(name)
         , m_forceFlush(forceFlush)
         , m_flushThreadFunctionId(0)
     {
@@ -2858,6 +3525,8 @@ namespace DSL
     {
         LOG_FUNC();
 
+        StopSummaryTimer();
+
         if (m_flushThreadFunctionId)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
@@ -2871,15 +3540,16 @@ namespace DSL
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        if (!m_enabled)
+        if (!m_enabled or 
+            !SummarizeOccurrence(pOdeTrigger, pFrameMeta, pObjectMeta))
         {
             return;
         }
         DSL_ODE_TRIGGER_PTR pTrigger = 
             std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
         
-        std::cout << "Trigger Name        : " << pTrigger->GetName() << "\n";
-        std::cout << "  Unique ODE Id     : " << pTrigger->s_eventCount << "\n";
+        std::cout << "Trigger Name        : " << GetTriggerNames(pOdeTrigger) << "\n";
+        std::cout << "  Unique ODE Id     : " << pTrigger->m_activeEventId << "\n";
         std::cout << "  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp) << "\n";
         std::cout << "  Source Data       : ------------------------" << "\n";
         if (pFrameMeta->bInferDone)
@@ -2965,7 +3635,7 @@ namespace DSL
         }
 
         std::cout << "  Criteria          : ------------------------" << "\n";
-        std::cout << "    Class Id        : " << pTrigger->m_classId << "\n";
+        std::cout << "    Class Id        : " << pTrigger->m_activeClassId << "\n";
         std::cout << "    Infer Id        : " << pTrigger->m_inferId << "\n";
         std::cout << "    Min Infer Conf  : " << pTrigger->m_minConfidence << "\n";
         std::cout << "    Min Track Conf  : " << pTrigger->m_minTrackerConfidence << "\n";
@@ -3005,6 +3675,18 @@ namespace DSL
         return false;
     }
 
+    void PrintOdeAction::WriteSummary(const std::string& line)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
+        
+        std::cout << line << "\n";
+        
+        if (m_forceFlush)
+        {
+            std::cout << std::flush;
+        }
+    }
+
     static gboolean PrintActionFlush(gpointer pAction)
     {
         return static_cast<PrintOdeAction*>(pAction)->Flush();
@@ -32,6 +32,10 @@ THE SOFTWARE.
 #include "DslDisplayTypes.h"
 #include "DslPlayerBintr.h"
 #include "DslMailer.h"
+#include "DslMemoryTracker.h"
+
+#include <set>
+#include <tuple>
 
 namespace DSL
 {
@@ -43,6 +47,7 @@ namespace DSL
     #define DSL_OBJECT_INFO_PRIMARY_METRIC              0
     #define DSL_OBJECT_INFO_PERSISTENCE                 1
     #define DSL_OBJECT_INFO_DIRECTION                   2
+    #define DSL_OBJECT_INFO_KINEMATICS                  3
     
     /**
      * @brief Constants for indexing "pFrameMeta->misc_frame_info" 
@@ -155,6 +160,8 @@ namespace DSL
             pLineColor, lineWidth, bboxPoint))
 
     #define DSL_ODE_ACTION_LOG_PTR std::shared_ptr<LogOdeAction>
+    #define DSL_ODE_ACTION_SUMMARY_PTR std::shared_ptr<SummaryOdeAction>
+
     #define DSL_ODE_ACTION_LOG_NEW(name) \
         std::shared_ptr<LogOdeAction>(new LogOdeAction(name))
 
@@ -316,6 +323,81 @@ namespace DSL
 
         ~OdeAction();
 
+        /**
+         * @brief Entry point for all parent Triggers to invoke the Action on
+         * the occurrence of an ODE. Calls HandleOccurrence directly unless
+         * de-duplication is enabled, in which case repeat occurrences for the
+         * same source and object, from any Trigger, are dropped within the
+         * de-duplication window. With fan-in enabled the first occurrence is
+         * deferred until CompleteDeferredOccurrences is called at the end of
+         * the frame, so that the Action can be handed the set of all Triggers
+         * that fired.
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
+         * @param[in] displayMetaData vector of Display Meta for the current frame.
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
+         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
+         * NULL if Frame level absence, total, min, max, etc. events.
+         */
+        void Invoke(DSL_BASE_PTR pOdeTrigger, 
+            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief Entry point for parent Triggers to record the occurrence of 
+         * a frame level ODE for a static Action whose Display Types are drawn
+         * by a StaticOverlay. HandleOccurrence is not called, but the 
+         * occurrence is de-duplicated and counted as for Invoke.
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
+         */
+        void InvokeStatic(DSL_BASE_PTR pOdeTrigger, NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Handles all occurrences deferred for fan-in for the current
+         * frame that were first fired by a given Trigger. Called once per 
+         * frame by each parent Trigger, with its property mutex held, once all
+         * Triggers have checked the frame.
+         * @param[in] pOdeTrigger shared pointer to the calling ODE Trigger.
+         */
+        void CompleteDeferredOccurrences(DSL_BASE_PTR pOdeTrigger);
+
+        /**
+         * @brief Gets the current de-duplication settings for this ODE Action.
+         * @param[out] enabled true if de-duplication is enabled.
+         * @param[out] window de-duplication window in milliseconds, 
+         * 0 = within the same frame only.
+         * @param[out] fanIn true if fan-in of the fired Triggers is enabled.
+         */
+        void GetDedupSettings(bool* enabled, uint* window, bool* fanIn);
+
+        /**
+         * @brief Sets the de-duplication settings for this ODE Action.
+         * @param[in] enabled set to true to enable de-duplication.
+         * @param[in] window de-duplication window in milliseconds, 
+         * 0 = within the same frame only.
+         * @param[in] fanIn set to true to defer the Action to the end of
+         * the frame and hand it the set of all Triggers that fired.
+         */
+        void SetDedupSettings(bool enabled, uint window, bool fanIn);
+
+        /**
+         * @brief Gets the names of all Triggers that fired for the occurrence
+         * currently being handled. Valid from within HandleOccurrence only.
+         * @return set of Trigger names, empty unless fan-in is enabled.
+         */
+        static const std::set<std::string>& GetFiredTriggers();
+
+        /**
+         * @brief number of times the Action has been invoked by its Triggers.
+         */
+        OdeCounter m_invocations;
+
+        /**
+         * @brief number of occurrences dropped as duplicates.
+         */
+        OdeCounter m_duplicates;
+
         /**
          * @brief Virtual function to handle the occurrence of an ODE by taking
          * a specific Action as implemented by the derived class
@@ -329,10 +411,147 @@ namespace DSL
             GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta) = 0;
         
+        /**
+         * @brief Virtual function to complete any work deferred by the derived 
+         * Action until all objects in the current frame have been processed.
+         * Called once per frame by each parent Trigger.
+         * @param[in] pBuffer pointer to the batched stream buffer being processed.
+         * @param[in] pFrameMeta pointer to the Frame Meta data being processed.
+         */
+        virtual void PostProcessFrame(GstBuffer* pBuffer, 
+            NvDsFrameMeta* pFrameMeta){};
+        
+        /**
+         * @brief Determines if the Action's only effect is to add display meta
+         * that is identical for every frame, so that it can be prebuilt into
+         * a StaticOverlay when invoked on every frame.
+         * @return true if static, false otherwise (default).
+         */
+        virtual bool IsStatic(){return false;};
+        
+        /**
+         * @brief Adds the Action's static Display Types, if any, to a list of
+         * Display Types to prebuild into a StaticOverlay.
+         * @param[out] displayTypes list of Display Types to add to.
+         */
+        virtual void GetStaticDisplayTypes(
+            std::vector<DSL_DISPLAY_TYPE_PTR>& displayTypes){};
+        
     protected:
 
         std::string Ntp2Str(uint64_t ntp);
 
+        /**
+         * @brief Gets the name, or names with fan-in, of the Trigger(s) 
+         * for the occurrence currently being handled.
+         * @param[in] pOdeTrigger Trigger passed to HandleOccurrence.
+         * @return comma separated list of Trigger names.
+         */
+        std::string GetTriggerNames(DSL_BASE_PTR pOdeTrigger);
+
+    private:
+
+        /**
+         * @brief De-duplication key - source-id, whether the object is tracked,
+         * and tracking-id, or Object Meta address for untracked objects. 
+         * Frame level occurrences use a NULL Object Meta address.
+         */
+        typedef std::tuple<uint, bool, uint64_t> DedupKeyT;
+
+        /**
+         * @brief Last handled occurrence for a single de-duplication key.
+         */
+        struct DedupEntry
+        {
+            uint64_t frameNum;
+            uint64_t pts;
+            
+            /**
+             * @brief index into m_deferredOccurrences if the occurrence is
+             * deferred for fan-in, -1 once handled.
+             */
+            int deferredIndex;
+        };
+
+        /**
+         * @brief Per-source de-duplication state, purged of expired
+         * entries on the first occurrence of each new frame.
+         */
+        struct DedupSourceState
+        {
+            uint64_t frameNum;
+            std::map<DedupKeyT, DedupEntry> entries;
+        };
+
+        /**
+         * @brief Occurrence deferred for fan-in until the end of the frame.
+         * The Trigger's active class id, event id, and occurrences are 
+         * captured when deferred, as they change before the frame ends.
+         */
+        struct DeferredOccurrence
+        {
+            DSL_BASE_PTR pOdeTrigger;
+            GstBuffer* pBuffer;
+            std::vector<NvDsDisplayMeta*>* pDisplayMetaData;
+            NvDsFrameMeta* pFrameMeta;
+            NvDsObjectMeta* pObjectMeta;
+            DedupKeyT key;
+            std::set<std::string> firedTriggers;
+            uint classId;
+            uint64_t eventId;
+            uint occurrences;
+        };
+
+        /**
+         * @brief Checks an occurrence against the de-duplication state, 
+         * counting it as a duplicate if found, or adding a new entry if not.
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
+         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
+         * NULL if Frame level event.
+         * @param[out] key de-duplication key for the occurrence.
+         * @return pointer to the new entry, NULL if a duplicate.
+         */
+        DedupEntry* checkForDuplicate(DSL_BASE_PTR pOdeTrigger, 
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta, 
+            DedupKeyT& key);
+
+        /**
+         * @brief mutex to protect the de-duplication state. Separate from the
+         * property mutex which is held by the derived HandleOccurrence.
+         */
+        DslMutex m_dedupMutex;
+
+        /**
+         * @brief true if de-duplication is enabled, false otherwise.
+         */
+        bool m_dedupEnabled;
+
+        /**
+         * @brief de-duplication window in milliseconds, 0 = same frame only.
+         */
+        uint m_dedupWindow;
+
+        /**
+         * @brief true if occurrences are deferred for fan-in.
+         */
+        bool m_dedupFanIn;
+
+        /**
+         * @brief map of source-ids to de-duplication state.
+         */
+        std::map<uint, DedupSourceState> m_dedupSourceStates;
+
+        /**
+         * @brief occurrences deferred for fan-in in the current frame(s).
+         */
+        std::vector<DeferredOccurrence> m_deferredOccurrences;
+
+        /**
+         * @brief fired Triggers for the deferred occurrence currently being
+         * handled on the calling thread, NULL otherwise.
+         */
+        static thread_local const std::set<std::string>* s_pFiredTriggers;
     };
 
     // ********************************************************************
@@ -392,6 +611,140 @@ namespace DSL
      */
     static int do_async_action(gpointer pAction);
     
+    // ********************************************************************
+    
+    /**
+     * @class SummaryOdeAction
+     * @brief Virtual class for an ODE Action that can summarize its 
+     * occurrences. When summarizing, occurrences are aggregated by Trigger, 
+     * source, and class over a fixed interval and a single line per key 
+     * is written from the main-loop at the end of each interval. Only the 
+     * first N occurrences per key, per interval, are written in full.
+     */
+    class SummaryOdeAction : public OdeAction
+    {
+    public:
+        /**
+         * @brief ctor for the SummaryOdeAction virtual class
+         * @param[in] name unique name for the ODE Action
+         */
+        SummaryOdeAction(const char* name); 
+        
+        /**
+         * @brief dtor for the SummaryOdeAction virtual class
+         */
+        ~SummaryOdeAction();
+        
+        /**
+         * @brief Gets the current summary settings for this SummaryOdeAction.
+         * @param[out] interval summary interval in milliseconds, 0 = disabled.
+         * @param[out] samples number of full records written per key, 
+         * per interval.
+         */
+        void GetSummarySettings(uint* interval, uint* samples);
+
+        /**
+         * @brief Sets the summary settings for this SummaryOdeAction.
+         * @param[in] interval summary interval in milliseconds, 0 = disabled.
+         * @param[in] samples number of full records to write per key, 
+         * per interval. 
+         */
+        void SetSummarySettings(uint interval, uint samples);
+        
+        /**
+         * @brief Writes one summary line for each key with occurrences in
+         * the interval just ended. ** To be called by the timer thread only **
+         * @return true to continue the summary timer always.
+         */
+        bool HandleSummaryTimer();
+        
+    protected:
+    
+        /**
+         * @brief Adds an occurrence to the summary for the current interval.
+         * Must be called with the property mutex held.
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered 
+         * the event.
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered 
+         * the event.
+         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
+         * NULL if Frame level absence, total, min, max, etc. events.
+         * @return true if the occurrence is to be written in full, false otherwise.
+         */
+        bool SummarizeOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief Removes the summary timer, if running. Must be called by the
+         * dtor of each derived Action so that the timer can't call the pure 
+         * virtual WriteSummary once the derived Action is destroyed.
+         */
+        void StopSummaryTimer();
+        
+        /**
+         * @brief Writes a single summary line. Implemented by each derived 
+         * Action to write to its own output.
+         * @param[in] line summary line to write.
+         */
+        virtual void WriteSummary(const std::string& line) = 0;
+    
+    private:
+    
+        /**
+         * @brief summary key - trigger, source-id, and class-id
+         */
+        typedef std::tuple<const void*, uint, int> SummaryKeyT;
+        
+        /**
+         * @brief aggregate values for a single summary key.
+         */
+        struct SummaryEntry
+        {
+            std::string triggerNames;
+            uint64_t occurrences;
+            uint64_t firstFrame;
+            uint64_t lastFrame;
+            float minConfidence;
+            float maxConfidence;
+            uint samples;
+        };
+        
+        /**
+         * @brief summary interval in milliseconds, 0 = disabled.
+         */
+        uint m_summaryInterval;
+        
+        /**
+         * @brief number of full records to write per key, per interval.
+         */
+        uint m_summarySamples;
+        
+        /**
+         * @brief g_timeout_add event source for the summary timer.
+         */
+        uint m_summaryTimerId;
+        
+        /**
+         * @brief map of summary keys to aggregate values for the current interval.
+         */
+        std::map<SummaryKeyT, SummaryEntry> m_summaries;
+        
+        /**
+         * @brief mutex to protect mutual access to the summary settings and 
+         * aggregates, separate from the property mutex so that the timer 
+         * thread never blocks the streaming thread for longer than a swap.
+         */
+        DslMutex m_summaryMutex;
+    };
+
+    /**
+     * @brief timer callback function to write the summary for a SummaryOdeAction
+     * in the context of the main-loop.
+     * @param pAction summary action to call HandleSummaryTimer().
+     * @return true to continue the timer always.
+     */
+    static int do_summary_timer(gpointer pAction);
+    
     // ********************************************************************
 
     /**
@@ -744,6 +1097,31 @@ namespace DSL
         void HandleOccurrence(GstBuffer* pBuffer, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
+        /**
+         * @brief Captures all Objects queued for the current frame with a 
+         * single batched crop-and-convert transform.
+         * @param[in] pBuffer pointer to the batched stream buffer being processed.
+         * @param[in] pFrameMeta pointer to the Frame Meta data being processed.
+         */
+        void PostProcessFrame(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Captures a full frame to a new, mapped RGBA buffer-surface 
+         * without queuing it for conversion. Used by the Frame-Capture Sink 
+         * to serve all capture requests for the same frame with one transform.
+         * @param[in] pBuffer pointer to the batched stream buffer to capture from.
+         * @param[in] pFrameMeta pointer to the Frame Meta data of the frame to capture.
+         * @return shared pointer to the new buffer-surface, nullptr on failure.
+         */
+        std::shared_ptr<DslBufferSurface> CaptureFrame(GstBuffer* pBuffer, 
+            NvDsFrameMeta* pFrameMeta);
+            
+        /**
+         * @brief Gets the output directory in use by this CaptureOdeAction.
+         * @return current output directory.
+         */
+        std::string GetOutdir();
+            
         /**
          * @brief adds a callback to be notified on Image Capture complete callback
          * @param[in] listener pointer to the client's function to call on capture complete
@@ -809,6 +1187,32 @@ namespace DSL
         int convertCapturedImage();
 
     protected:
+    
+        /**
+         * @brief Transforms all queued Object crops from the same frame into a 
+         * single batched surface, with one transform and one map, and queues
+         * a view of each crop for conversion. Must be called with the property
+         * mutex held.
+         */
+        void CaptureQueuedObjects();
+        
+        /**
+         * @brief Implements the batched transform for CaptureQueuedObjects.
+         * Virtual so that the queuing and flushing of Objects can be tested 
+         * without a batched NvBufSurface.
+         * @return true on successful transform and map, false otherwise.
+         */
+        virtual bool TransformQueuedObjects();
+        
+        /**
+         * @brief Transforms a full frame to a new, mapped RGBA buffer-surface.
+         * Must be called with the property mutex held.
+         * @param[in] pBuffer pointer to the batched stream buffer to capture from.
+         * @param[in] pFrameMeta pointer to the Frame Meta data of the frame to capture.
+         * @return shared pointer to the new buffer-surface, nullptr on failure.
+         */
+        std::shared_ptr<DslBufferSurface> TransformFrame(GstBuffer* pBuffer, 
+            NvDsFrameMeta* pFrameMeta);
         
         /**
          * @brief Device Properties, used for aarch64/x86_64 conditional logic
@@ -875,6 +1279,27 @@ namespace DSL
          */
         std::map<std::string, std::shared_ptr<MailerSpecs>> m_mailers;
         
+        /**
+         * @brief buffer for the Object crops currently queued, NULL if none.
+         * A reference is held until the crops have been captured.
+         */
+        GstBuffer* m_pQueuedObjectsBuffer;
+        
+        /**
+         * @brief batch-id of the frame for the Object crops currently queued.
+         */
+        uint m_queuedObjectsBatchId;
+        
+        /**
+         * @brief crop rectangles for the Objects queued for the current frame.
+         */
+        std::vector<NvBufSurfTransformRect> m_queuedObjectRects;
+        
+        /**
+         * @brief unique capture-ids for the Objects queued for the current frame.
+         */
+        std::vector<uint64_t> m_queuedObjectCaptureIds;
+        
     };
 
     // ********************************************************************
@@ -1152,7 +1577,7 @@ namespace DSL
      * @class LogOdeAction
      * @brief Log Ode Action class
      */
-    class LogOdeAction : public OdeAction
+    class LogOdeAction : public SummaryOdeAction
     {
     public:
     
@@ -1182,6 +1607,11 @@ namespace DSL
 
     private:
     
+        /**
+         * @brief Writes a single summary line by calling LOG_INFO.
+         * @param[in] line summary line to write.
+         */
+        void WriteSummary(const std::string& line);
     };
         
     // ********************************************************************
@@ -1424,8 +1854,26 @@ namespace DSL
             GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
+        /**
+         * @brief Determines if the Action is enabled and all of its Display
+         * Types are static.
+         * @return true if static, false otherwise.
+         */
+        bool IsStatic();
+        
+        /**
+         * @brief Adds all Display Types to the list if the Action is static.
+         * @param[out] displayTypes list of Display Types to add to.
+         */
+        void GetStaticDisplayTypes(std::vector<DSL_DISPLAY_TYPE_PTR>& displayTypes);
+
     private:
     
+        /**
+         * @brief IsStatic implementation, called with the property mutex held.
+         */
+        bool isStatic();
+    
         std::vector<DSL_DISPLAY_TYPE_PTR> m_pDisplayTypes;
     
     };
@@ -1896,7 +2344,7 @@ namespace DSL
      * @class PrintOdeAction
      * @brief Print ODE Action class
      */
-    class PrintOdeAction : public OdeAction
+    class PrintOdeAction : public SummaryOdeAction
     {
     public:
     
@@ -1932,6 +2380,12 @@ namespace DSL
 
     private:
 
+        /**
+         * @brief Writes a single summary line to the console.
+         * @param[in] line summary line to write.
+         */
+        void WriteSummary(const std::string& line);
+
         /**
          * @brief flag to enable/disable forced stream buffer flushing
          */
@@ -1998,6 +2452,13 @@ namespace DSL
          */
         uint m_mode;
         
+        /**
+         * @brief accounted storage for the output stream's buffer, the same 
+         * size as the default. Declared before, and so freed after, m_ostream.
+         */
+        std::vector<char, TaggedAllocator<char, 
+            DSL_MEMORY_TAG_FILE_ACTIONS>> m_streamBuffer;
+
         /**
          * @brief output stream for all file writes
          */
@@ -48,7 +48,8 @@ namespace DSL
     {
         LOG_FUNC();
         
-        if (!m_show)
+        // Static areas are drawn once per frame by the StaticOverlay
+        if (!m_show or IsStatic())
         {
             return;
         }
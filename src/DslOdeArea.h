@@ -89,6 +89,20 @@ namespace DSL
         void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
         
+        /**
+         * @brief Determines if the Area is shown with a static Display Type,
+         * in which case it is drawn by the ODE Handler's StaticOverlay and
+         * AddMeta is a noop.
+         * @return true if shown and static, false otherwise.
+         */
+        bool IsStatic(){return m_show and m_pDisplayType->IsStatic();};
+        
+        /**
+         * @brief Gets the Area's underlying Display Type.
+         * @return shared pointer to the Area's Display Type.
+         */
+        DSL_DISPLAY_TYPE_PTR GetDisplayType(){return m_pDisplayType;};
+        
         /**
          * @brief Checks if a bounding box - using bboxTestPoint - is inside 
          * the Area's RGBA Display Type.
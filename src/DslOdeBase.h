@@ -28,6 +28,9 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslBase.h"
+#include "DslDisplayTypes.h"
+
+#include <atomic>
 
 namespace DSL
 {
@@ -36,6 +39,61 @@ namespace DSL
      */
     #define DSL_ODE_BASE_PTR std::shared_ptr<OdeBase>
     
+    /**
+     * @brief size of a cache-line, used to isolate counters updated on the
+     * streaming thread(s) from all other data.
+     */
+    #define DSL_CACHE_LINE_SIZE                                         64
+
+    // ********************************************************************
+
+    /**
+     * @class OdeCounter
+     * @brief Lock-free, cache-line isolated event counter. All updates and
+     * reads are relaxed atomic operations so that counters can be read by
+     * the client API without contending with ODE evaluation. Behaves as a 
+     * uint64_t for all reads and simple updates.
+     */
+    class alignas(DSL_CACHE_LINE_SIZE) OdeCounter
+    {
+    public:
+
+        OdeCounter(uint64_t value = 0)
+            : m_value(value)
+        {};
+
+        inline operator uint64_t() const
+        {
+            return m_value.load(std::memory_order_relaxed);
+        };
+
+        inline OdeCounter& operator=(uint64_t value)
+        {
+            m_value.store(value, std::memory_order_relaxed);
+            return *this;
+        };
+
+        inline OdeCounter& operator+=(uint64_t value)
+        {
+            m_value.fetch_add(value, std::memory_order_relaxed);
+            return *this;
+        };
+
+        inline uint64_t operator++()
+        {
+            return m_value.fetch_add(1, std::memory_order_relaxed) + 1;
+        };
+
+        inline uint64_t operator++(int)
+        {
+            return m_value.fetch_add(1, std::memory_order_relaxed);
+        };
+
+    private:
+
+        std::atomic<uint64_t> m_value;
+    };
+
     // ********************************************************************
 
     class OdeBase : public Base
@@ -84,6 +142,9 @@ namespace DSL
             
             m_enabled = enabled;
             
+            // enabled state determines which Display Types are overlaid
+            StaticOverlay::Invalidate();
+            
             // iterate through the map of limit-state-change-listeners calling each
             for(auto const& imap: m_enabledStateChangeListeners)
             {
@@ -29,24 +29,36 @@ namespace DSL
 {
     TrackedObject::TrackedObject(uint64_t trackingId, uint64_t frameNumber,
         const NvBbox_Coords* pCoordinates, DSL_RGBA_COLOR_PTR pColor, 
-        uint maxHistory)
+        uint maxHistory, uint64_t timestamp)
         : trackingId(trackingId)
         , m_maxHistory(maxHistory)
         , frameCount(0)
         , preEventFrameCount(1)
         , onEventFrameCount(0)
+        , inRangeFrameCount(0)
+        , m_firstTimestamp(timestamp)
+        , m_lastTimestamp(timestamp)
+        , m_lastCenterX(0)
+        , m_lastCenterY(0)
+        , m_velocityX(0)
+        , m_velocityY(0)
+        , m_pendingDeltaX(0)
+        , m_pendingDeltaY(0)
+        , m_pathLength(0)
+        , m_simplifiedTestPoint(0)
+        , m_simplifiedTolerance(0)
     {
         // No function log - avoid overhead.
         
-        m_pBboxTrace = std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>>(
-            new std::deque<std::shared_ptr<NvBbox_Coords>>);
+        m_pBboxTrace = std::allocate_shared<BboxTraceT>(
+            TaggedAllocator<BboxTraceT, DSL_MEMORY_TAG_TRACE_HISTORY>());
         
         timeval creationTime;
         gettimeofday(&creationTime, NULL);
         m_creationTimeMs = creationTime.tv_sec*1000.0 + creationTime.tv_usec/1000.0;
         
         // update will increment the frameCount to 1
-        Update(frameNumber, pCoordinates);
+        Update(frameNumber, pCoordinates, timestamp);
         
         if (pColor)
         {
@@ -66,25 +78,60 @@ namespace DSL
     }
     
     void TrackedObject::Update(uint64_t currentFrameNumber, 
-        const NvBbox_Coords* pCoordinates)
+        const NvBbox_Coords* pCoordinates, uint64_t timestamp)
     {
         // No function log - avoid overhead.
         
         // increment the total number of tracked frames
         frameCount++;
         
+        double centerX = pCoordinates->left + pCoordinates->width/2;
+        double centerY = pCoordinates->top + pCoordinates->height/2;
+        
+        if (frameCount > 1)
+        {
+            double deltaX = centerX - m_lastCenterX;
+            double deltaY = centerY - m_lastCenterY;
+            
+            m_pathLength += sqrt(deltaX*deltaX + deltaY*deltaY);
+            
+            // Velocity can only be updated if the frame timestamps advance, 
+            // e.g. not if the stream does not provide timestamps. Until then,
+            // the displacement is accumulated so that none of it is lost.
+            m_pendingDeltaX += deltaX;
+            m_pendingDeltaY += deltaY;
+            
+            if (timestamp > m_lastTimestamp)
+            {
+                double deltaSec = (timestamp - m_lastTimestamp)/1000000000.0;
+                
+                // The first sample initializes the smoothed velocity.
+                double alpha = (m_lastTimestamp > m_firstTimestamp)
+                    ? DSL_TRACKED_OBJECT_VELOCITY_SMOOTHING : 1.0;
+                    
+                m_velocityX += alpha*(m_pendingDeltaX/deltaSec - m_velocityX);
+                m_velocityY += alpha*(m_pendingDeltaY/deltaSec - m_velocityY);
+                m_lastTimestamp = timestamp;
+                
+                m_pendingDeltaX = 0;
+                m_pendingDeltaY = 0;
+            }
+        }
+        m_lastCenterX = centerX;
+        m_lastCenterY = centerY;
+        
         // update the tracked object's frame number - the filter used for purging.
         frameNumber = currentFrameNumber;
         
-        // Copy only the rectangle coordinates of the Object's RectParams
-        std::shared_ptr pBboxCoords = 
-            std::shared_ptr<NvBbox_Coords>(new NvBbox_Coords);
-            
-        *pBboxCoords = *pCoordinates;
-
         // If maintaining bbox trace-point history
         if (m_maxHistory)
         {
+            // Copy only the rectangle coordinates of the Object's RectParams.
+            // The coordinates and control block are a single, accounted allocation.
+            std::shared_ptr<NvBbox_Coords> pBboxCoords = 
+                std::allocate_shared<NvBbox_Coords>(TaggedAllocator<NvBbox_Coords,
+                    DSL_MEMORY_TAG_TRACE_HISTORY>(), *pCoordinates);
+                    
             // if there's a previous trace, purge from this deque first.
             if (m_pPrevBboxTrace)
             {
@@ -122,6 +169,44 @@ namespace DSL
             m_creationTimeMs;
     }
 
+    double TrackedObject::GetSpeed()
+    {
+        return sqrt(m_velocityX*m_velocityX + m_velocityY*m_velocityY);
+    }
+
+    double TrackedObject::GetHeading()
+    {
+        if (m_velocityX == 0 and m_velocityY == 0)
+        {
+            return 0;
+        }
+        double heading = atan2(m_velocityY, m_velocityX)*180.0/M_PI;
+        
+        return (heading < 0) ? heading + 360.0 : heading;
+    }
+
+    double TrackedObject::GetPathLength()
+    {
+        return m_pathLength;
+    }
+
+    double TrackedObject::GetTimeInViewMs()
+    {
+        return (m_lastTimestamp - m_firstTimestamp)/1000000.0;
+    }
+
+    gint64 TrackedObject::EncodeKinematics()
+    {
+        // Each value is saturated at the maximum for its 16 bits.
+        uint64_t speed = std::min(lrint(GetSpeed()), 0xFFFFL);
+        uint64_t heading = std::min(lrint(GetHeading()*100), 35999L);
+        uint64_t pathLength = std::min(lrint(m_pathLength), 0xFFFFL);
+        uint64_t timeInView = std::min(lrint(GetTimeInViewMs()/1000), 0xFFFFL);
+        
+        return (gint64)((speed << 48) | (heading << 32) | 
+            (pathLength << 16) | timeInView);
+    }
+
     dsl_coordinate TrackedObject::GetFirstCoordinate(uint testPoint)
     {
         dsl_coordinate traceCoordinate{0};
@@ -141,8 +226,10 @@ namespace DSL
     {
         // No function log - avoid overhead.
         
-        // Create the trace - i.e. a vector of pre-sized blank coordinates
-        std::vector<dsl_coordinate> traceCoordinates;
+        // Create the trace - i.e. a vector of coordinates allocated from the
+        // per-frame scratch arena, copied by the new Multi-Line.
+        std::vector<dsl_coordinate, ArenaAllocator<dsl_coordinate>> traceCoordinates(
+            ArenaAllocator<dsl_coordinate>(FrameArena::GetThreadArena()));
 
         dsl_coordinate traceCoordinate{0};
             
@@ -157,6 +244,7 @@ namespace DSL
 
         else
         {
+            traceCoordinates.reserve(m_pBboxTrace->size());
             for (const auto& ideque: *m_pBboxTrace)
             {
                 getCoordinate(ideque, testPoint, traceCoordinate);
@@ -177,8 +265,10 @@ namespace DSL
             return nullptr;
         }
         
-        // Create the trace - i.e. a vector of pre-sized blank coordinates
-        std::vector<dsl_coordinate> traceCoordinates;
+        // Create the trace - i.e. a vector of coordinates allocated from the
+        // per-frame scratch arena, copied by the new Multi-Line.
+        std::vector<dsl_coordinate, ArenaAllocator<dsl_coordinate>> traceCoordinates(
+            ArenaAllocator<dsl_coordinate>(FrameArena::GetThreadArena()));
 
         dsl_coordinate traceCoordinate{0};
             
@@ -204,16 +294,206 @@ namespace DSL
             traceCoordinates.size(), lineWidth, m_pColor);
     }
 
+    DSL_RGBA_MULTI_LINE_PTR TrackedObject::GetSimplifiedTrace(
+        uint testPoint, uint method, uint lineWidth, uint tolerance)
+    {
+        // No function log - avoid overhead.
+        
+        if (method == DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS or !tolerance)
+        {
+            return GetTrace(testPoint, method, lineWidth);
+        }
+        
+        bool resimplify(m_simplifiedTrace.size() < 2 or 
+            testPoint != m_simplifiedTestPoint or 
+            tolerance != m_simplifiedTolerance);
+            
+        // The cached trace is only stale once either end-point has moved by
+        // more than the tolerance. Intermediate points are already within it.
+        if (!resimplify)
+        {
+            dsl_coordinate first = GetFirstCoordinate(testPoint);
+            dsl_coordinate last = GetLastCoordinate(testPoint);
+            const dsl_coordinate& cachedFirst = m_simplifiedTrace.front();
+            const dsl_coordinate& cachedLast = m_simplifiedTrace.back();
+            
+            double tol2 = (double)tolerance*tolerance;
+            double dxFirst = (double)first.x - cachedFirst.x;
+            double dyFirst = (double)first.y - cachedFirst.y;
+            double dxLast = (double)last.x - cachedLast.x;
+            double dyLast = (double)last.y - cachedLast.y;
+            
+            resimplify = (dxFirst*dxFirst + dyFirst*dyFirst > tol2) or
+                (dxLast*dxLast + dyLast*dyLast > tol2);
+        }
+        if (resimplify)
+        {
+            simplifyTrace(m_pBboxTrace, testPoint, tolerance, m_simplifiedTrace);
+            
+            // a change of settings invalidates the previous trace as well.
+            if (testPoint != m_simplifiedTestPoint or 
+                tolerance != m_simplifiedTolerance)
+            {
+                m_simplifiedPrevTrace.clear();
+            }
+            m_simplifiedTestPoint = testPoint;
+            m_simplifiedTolerance = tolerance;
+        }
+        return DSL_RGBA_MULTI_LINE_NEW("", m_simplifiedTrace.data(), 
+            m_simplifiedTrace.size(), lineWidth, m_pColor);
+    }
+
+    DSL_RGBA_MULTI_LINE_PTR TrackedObject::GetSimplifiedPreviousTrace(
+        uint testPoint, uint method, uint lineWidth, uint tolerance)
+    {
+        // No function log - avoid overhead.
+        
+        if (m_pPrevBboxTrace == nullptr)
+        {
+            return nullptr;
+        }
+        if (method == DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS or !tolerance)
+        {
+            return GetPreviousTrace(testPoint, method, lineWidth);
+        }
+        if (m_simplifiedPrevTrace.empty() or 
+            testPoint != m_simplifiedTestPoint or 
+            tolerance != m_simplifiedTolerance)
+        {
+            simplifyTrace(m_pPrevBboxTrace, testPoint, tolerance, 
+                m_simplifiedPrevTrace);
+                
+            // a change of settings invalidates the current trace as well.
+            if (testPoint != m_simplifiedTestPoint or 
+                tolerance != m_simplifiedTolerance)
+            {
+                m_simplifiedTrace.clear();
+            }
+            m_simplifiedTestPoint = testPoint;
+            m_simplifiedTolerance = tolerance;
+        }
+        return DSL_RGBA_MULTI_LINE_NEW("", m_simplifiedPrevTrace.data(), 
+            m_simplifiedPrevTrace.size(), lineWidth, m_pColor);
+    }
+
+    void TrackedObject::SimplifyPolyline(const dsl_coordinate* pCoordinates,
+        uint numCoordinates, uint tolerance, TraceCoordinatesT& simplified)
+    {
+        // No function log - avoid overhead.
+        
+        simplified.clear();
+        if (numCoordinates < 3)
+        {
+            simplified.assign(pCoordinates, pCoordinates + numCoordinates);
+            return;
+        }
+        
+        // Iterative Douglas-Peucker - the scratch is allocated from the
+        // per-frame arena, so steady-state frames don't allocate.
+        FrameArena* pArena = FrameArena::GetThreadArena();
+        
+        std::vector<uint8_t, ArenaAllocator<uint8_t>> keep(numCoordinates, 0,
+            ArenaAllocator<uint8_t>(pArena));
+        std::vector<std::pair<uint, uint>, ArenaAllocator<std::pair<uint, uint>>> 
+            segments(ArenaAllocator<std::pair<uint, uint>>(pArena));
+        
+        keep[0] = keep[numCoordinates-1] = 1;
+        segments.push_back(std::make_pair(0, numCoordinates-1));
+        
+        double tol2 = (double)tolerance*tolerance;
+        
+        while (segments.size())
+        {
+            uint first = segments.back().first;
+            uint last = segments.back().second;
+            segments.pop_back();
+            
+            double x1 = pCoordinates[first].x, y1 = pCoordinates[first].y;
+            double dx = (double)pCoordinates[last].x - x1;
+            double dy = (double)pCoordinates[last].y - y1;
+            double len2 = dx*dx + dy*dy;
+            
+            // find the point furthest from the segment [first, last]
+            double maxDist2(0);
+            uint maxIndex(first);
+            
+            for (uint i = first+1; i < last; i++)
+            {
+                double px = (double)pCoordinates[i].x - x1;
+                double py = (double)pCoordinates[i].y - y1;
+                double dist2;
+                
+                if (len2 == 0)
+                {
+                    dist2 = px*px + py*py;
+                }
+                else
+                {
+                    double cross = px*dy - py*dx;
+                    dist2 = cross*cross/len2;
+                }
+                if (dist2 > maxDist2)
+                {
+                    maxDist2 = dist2;
+                    maxIndex = i;
+                }
+            }
+            if (maxDist2 > tol2)
+            {
+                keep[maxIndex] = 1;
+                if (maxIndex - first > 1)
+                {
+                    segments.push_back(std::make_pair(first, maxIndex));
+                }
+                if (last - maxIndex > 1)
+                {
+                    segments.push_back(std::make_pair(maxIndex, last));
+                }
+            }
+        }
+        for (uint i = 0; i < numCoordinates; i++)
+        {
+            if (keep[i])
+            {
+                simplified.push_back(pCoordinates[i]);
+            }
+        }
+    }
+
+    void TrackedObject::simplifyTrace(std::shared_ptr<BboxTraceT> pBboxTrace, 
+        uint testPoint, uint tolerance, TraceCoordinatesT& simplified)
+    {
+        // No function log - avoid overhead.
+        
+        std::vector<dsl_coordinate, ArenaAllocator<dsl_coordinate>> traceCoordinates(
+            ArenaAllocator<dsl_coordinate>(FrameArena::GetThreadArena()));
+        traceCoordinates.reserve(pBboxTrace->size());
+
+        dsl_coordinate traceCoordinate{0};
+        for (const auto& ideque: *pBboxTrace)
+        {
+            getCoordinate(ideque, testPoint, traceCoordinate);
+            traceCoordinates.push_back(traceCoordinate);
+        }
+        SimplifyPolyline(traceCoordinates.data(), traceCoordinates.size(),
+            tolerance, simplified);
+    }
+
     void TrackedObject::HandleOccurrence()
     {
         m_pPrevBboxTrace = m_pBboxTrace;
-        m_pBboxTrace = std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>>(
-            new std::deque<std::shared_ptr<NvBbox_Coords>>);
+        m_pBboxTrace = std::allocate_shared<BboxTraceT>(
+            TaggedAllocator<BboxTraceT, DSL_MEMORY_TAG_TRACE_HISTORY>());
 
         // Add last point of previous trace as first point to current trace to ensure
         // a continuous line (line segment between previous-trace-end and current-trace-start) 
         m_pBboxTrace->push_back(m_pPrevBboxTrace->back());
 
+        // the cached current trace can lag the full trace by up to the 
+        // tolerance, so both are simplified again on next use.
+        m_simplifiedTrace.clear();
+        m_simplifiedPrevTrace.clear();
+
         preEventFrameCount = 1;
         onEventFrameCount = 0;
     }
@@ -336,10 +616,11 @@ namespace DSL
             
             // create a new tracked object for this tracking Id and source
             std::shared_ptr<TrackedObject> pTrackedObject = 
-                std::shared_ptr<TrackedObject>(new TrackedObject(
+                std::allocate_shared<TrackedObject>(TaggedAllocator<TrackedObject,
+                    DSL_MEMORY_TAG_TRACKED_OBJECTS>(), 
                     pObjectMeta->object_id, pFrameMeta->frame_num, 
                     (NvBbox_Coords*)&pObjectMeta->rect_params, 
-                    pColor, m_maxHistory));
+                    pColor, m_maxHistory, pFrameMeta->ntp_timestamp);
                 
             // create a map of tracked objects for this source    
             std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
@@ -367,10 +648,11 @@ namespace DSL
             
             // create a new tracked object for this tracking Id and source
             std::shared_ptr<TrackedObject> pTrackedObject = 
-                std::shared_ptr<TrackedObject>(new TrackedObject(
+                std::allocate_shared<TrackedObject>(TaggedAllocator<TrackedObject,
+                    DSL_MEMORY_TAG_TRACKED_OBJECTS>(), 
                     pObjectMeta->object_id, pFrameMeta->frame_num,
                     (NvBbox_Coords*)&pObjectMeta->rect_params, 
-                    pColor, m_maxHistory));
+                    pColor, m_maxHistory, pFrameMeta->ntp_timestamp);
 
             // insert the new tracked object into the new map    
             pTrackedObjects->insert(std::pair<uint64_t, 
@@ -29,9 +29,29 @@ THE SOFTWARE.
 #include "DslApi.h"
 #include "DslOdeBase.h"
 #include "DslDisplayTypes.h"
+#include "DslMemoryTracker.h"
 
 namespace DSL
 {
+    /**
+     * @brief Weight of the newest velocity sample in a Tracked Object's
+     * exponentially smoothed velocity.
+     */
+    #define DSL_TRACKED_OBJECT_VELOCITY_SMOOTHING                       0.3
+
+    /**
+     * @brief deque of bbox coordinates, accounted as trace history.
+     */
+    typedef std::deque<std::shared_ptr<NvBbox_Coords>, 
+        TaggedAllocator<std::shared_ptr<NvBbox_Coords>, 
+            DSL_MEMORY_TAG_TRACE_HISTORY>> BboxTraceT;
+
+    /**
+     * @brief vector of simplified trace coordinates, accounted as trace history.
+     */
+    typedef std::vector<dsl_coordinate, TaggedAllocator<dsl_coordinate,
+        DSL_MEMORY_TAG_TRACE_HISTORY>> TraceCoordinatesT;
+
     /**
      * @class TrackedObject
      * @file DslOdeTrackedObject.h
@@ -50,10 +70,11 @@ namespace DSL
          * @param[in] pColor shared pointer to an RGBA Color Type to
          * set a unique color for the tracked object. 
          * @param[in] maxHistory maximum number of bbox coordinates to track
+         * @param[in] timestamp NTP timestamp of the frame in nanoseconds.
          */
         TrackedObject(uint64_t trackingId, uint64_t frameNumber,
             const NvBbox_Coords* pCoordinates, DSL_RGBA_COLOR_PTR pColor, 
-            uint maxHistory);
+            uint maxHistory, uint64_t timestamp = 0);
             
         /**
          * @brief Sets the max history for this tracked object
@@ -64,11 +85,48 @@ namespace DSL
         /**
          * @brief function to update the tracked-object's last frame number and 
          * push a new set of positional bbox coordinates on to the tracked 
-         * object's m_bboxTrace queue.
+         * object's m_bboxTrace queue. The object's kinematics are updated 
+         * incrementally, at constant cost, independent of the trace history.
          * @param[in] currentFrameNumber new frame number to save
          * @param[in] pCoordinates new bounding box coordinates to push.
+         * @param[in] timestamp NTP timestamp of the frame in nanoseconds.
+         */
+        void Update(uint64_t currentFrameNumber, const NvBbox_Coords* pCoordinates,
+            uint64_t timestamp = 0);
+        
+        /**
+         * @brief Gets the smoothed speed of the object's bbox center.
+         * @return speed in pixels per second.
+         */
+        double GetSpeed();
+        
+        /**
+         * @brief Gets the heading of the object's smoothed velocity.
+         * @return heading in degrees [0, 360), clockwise from the positive 
+         * x-axis in image coordinates, i.e. 90 = moving down the frame.
+         */
+        double GetHeading();
+        
+        /**
+         * @brief Gets the total distance travelled by the object's bbox center.
+         * @return path length in pixels.
          */
-        void Update(uint64_t currentFrameNumber, const NvBbox_Coords* pCoordinates);
+        double GetPathLength();
+        
+        /**
+         * @brief Gets the time between the frames the object was first and 
+         * last detected, calculated from the frame timestamps.
+         * @return time in view in units of ms.
+         */
+        double GetTimeInViewMs();
+        
+        /**
+         * @brief Encodes the object's kinematics for pObjectMeta->misc_obj_info.
+         * See the DSL_OBJECT_KINEMATICS_* macros for decoding.
+         * @return kinematics encoded as speed, heading, path length and
+         * time in view, 16 bits each.
+         */
+        gint64 EncodeKinematics();
         
         /**
          * @brief calculates the duration of time the object has been tracked.
@@ -126,6 +184,48 @@ namespace DSL
         DSL_RGBA_MULTI_LINE_PTR GetPreviousTrace(uint testPoint, uint method, 
             uint lineWidth);
             
+        /**
+         * @brief Returns a level-of-detail trace for display, simplified with
+         * the Douglas-Peucker algorithm. The simplified coordinates are cached
+         * and only re-simplified when the first or last trace point has moved
+         * by more than the tolerance since, i.e. when the trace has materially 
+         * changed. The end-points method, or a tolerance of 0, returns GetTrace.
+         * @param[in] testPoint test-point to generate the trace with.
+         * @param[in] method one of the DSL_OBJECT_TRACE_TEST_METHOD_* constants
+         * @param[in] lineWidth the width value to assign to the line.
+         * @param[in] tolerance maximum distance in pixels between the full
+         * and simplified traces.
+         * @return shared pointer to a vector of coordinates.
+         */
+        DSL_RGBA_MULTI_LINE_PTR GetSimplifiedTrace(uint testPoint, uint method, 
+            uint lineWidth, uint tolerance);
+            
+        /**
+         * @brief Returns a level-of-detail previous trace for display. The 
+         * previous trace never changes, so is simplified once and cached.
+         * @param[in] testPoint test-point to generate the trace with.
+         * @param[in] method one of the DSL_OBJECT_TRACE_TEST_METHOD_* constants
+         * @param[in] lineWidth the width value to assign to the line.
+         * @param[in] tolerance maximum distance in pixels between the full
+         * and simplified traces.
+         * @return shared pointer to a vector of coordinates.
+         */
+        DSL_RGBA_MULTI_LINE_PTR GetSimplifiedPreviousTrace(uint testPoint, 
+            uint method, uint lineWidth, uint tolerance);
+            
+        /**
+         * @brief Simplifies a polyline with the Douglas-Peucker algorithm.
+         * @param[in] pCoordinates polyline to simplify.
+         * @param[in] numCoordinates number of coordinates in the polyline.
+         * @param[in] tolerance maximum distance in pixels between the full
+         * and simplified polylines.
+         * @param[out] simplified the simplified polyline. The first and last
+         * coordinates are always retained.
+         */
+        static void SimplifyPolyline(const dsl_coordinate* pCoordinates,
+            uint numCoordinates, uint tolerance, 
+            TraceCoordinatesT& simplified);
+
         /**
          * @brief Handles an ODE Occurrence for this tracked object. The current
          * m_pBboxTrace is moved to the m_pPreviousBboxTrace and a new/empty
@@ -159,8 +259,24 @@ namespace DSL
          */
         uint onEventFrameCount;
 
+        /**
+         * @brief number of tracked frames with the object's speed within the
+         * range of the Trigger tracking it. Equal to frameCount if no range.
+         */
+        uint inRangeFrameCount;
+
     private:
 
+        /**
+         * @brief Simplifies a trace for a specific test-point into a cache.
+         * @param[in] pBboxTrace trace to simplify.
+         * @param[in] testPoint test-point to generate the trace with.
+         * @param[in] tolerance maximum distance in pixels.
+         * @param[out] simplified cache to update.
+         */
+        void simplifyTrace(std::shared_ptr<BboxTraceT> pBboxTrace, 
+            uint testPoint, uint tolerance, TraceCoordinatesT& simplified);
+
         /**
          * @brief Get an x,y coordinate from a Bbox based on this Trigger's
          * client specified test-point
@@ -185,18 +301,61 @@ namespace DSL
         /**
          * @brief a max sized queue of Rectangle Params.
          */
-        std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>> m_pBboxTrace;
+        std::shared_ptr<BboxTraceT> m_pBboxTrace;
         
         /**
          * @brief a max sized queue of Rectangle Params.
          */
-        std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>> m_pPrevBboxTrace;
+        std::shared_ptr<BboxTraceT> m_pPrevBboxTrace;
         
         /**
          * @brief used to identify the tracked object with an RGBA color.
          */
         DSL_RGBA_COLOR_PTR m_pColor;
         
+        /**
+         * @brief NTP timestamps of the frames the object was first and last
+         * detected in, in nanoseconds.
+         */
+        uint64_t m_firstTimestamp;
+        uint64_t m_lastTimestamp;
+        
+        /**
+         * @brief center of the object's bbox when last updated.
+         */
+        double m_lastCenterX;
+        double m_lastCenterY;
+        
+        /**
+         * @brief exponentially smoothed velocity in pixels per second.
+         */
+        double m_velocityX;
+        double m_velocityY;
+        
+        /**
+         * @brief displacement of the bbox center in pixels since the velocity
+         * was last updated, accumulated over frames with no timestamp advance.
+         */
+        double m_pendingDeltaX;
+        double m_pendingDeltaY;
+        
+        /**
+         * @brief total distance travelled by the bbox center in pixels.
+         */
+        double m_pathLength;
+
+        /**
+         * @brief cached simplified coordinates for the current and previous
+         * traces, empty if not yet simplified.
+         */
+        TraceCoordinatesT m_simplifiedTrace;
+        TraceCoordinatesT m_simplifiedPrevTrace;
+        
+        /**
+         * @brief test-point and tolerance the cached traces were simplified with.
+         */
+        uint m_simplifiedTestPoint;
+        uint m_simplifiedTolerance;
     };
     
     //*******************************************************************************
@@ -309,7 +468,10 @@ namespace DSL
         /**
          * @brief map of tracked objects - Key = unique Tracking Id
          */
-        typedef std::map <uint64_t, std::shared_ptr<TrackedObject>> TrackedObjectsT;
+        typedef std::map <uint64_t, std::shared_ptr<TrackedObject>,
+            std::less<uint64_t>, TaggedAllocator<std::pair<const uint64_t,
+                std::shared_ptr<TrackedObject>>, DSL_MEMORY_TAG_TRACKED_OBJECTS>> 
+                    TrackedObjectsT;
 
         /**
          * @brief map of tracked objects per source - Key = source Id
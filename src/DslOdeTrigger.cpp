@@ -33,7 +33,7 @@ namespace DSL
 {
 
     // Initialize static Event Counter
-    uint64_t OdeTrigger::s_eventCount = 0;
+    OdeCounter OdeTrigger::s_eventCount(0);
 
     OdeTrigger::OdeTrigger(const char* name, const char* source, 
         uint classId, uint limit)
@@ -43,12 +43,18 @@ namespace DSL
         , m_sourceId(-1)
         , m_inferId(-1)
         , m_classId(classId)
+        , m_classIdMask(0)
+        , m_activeClassId(classId)
+        , m_activeEventId(0)
+        , m_unresolvedSources(0)
+        , m_occurrencesPerClass{}
         , m_triggered(0)
         , m_eventLimit(limit)
         , m_frameCount(0)
         , m_frameLimit(0)
         , m_occurrences(0)
         , m_occurrencesAccumulated(0)
+        , m_occurrencesTotal(0)
         , m_minConfidence(0)
         , m_maxConfidence(0)
         , m_minTrackerConfidence(0)
@@ -69,6 +75,8 @@ namespace DSL
         , m_nextActionIndex(0)
     {
         LOG_FUNC();
+        
+        UpdateKeyedClassIds();
     }
 
     OdeTrigger::~OdeTrigger()
@@ -109,6 +117,7 @@ namespace DSL
         m_pOdeActions[pChild->GetName()] = pChild;
         m_pOdeActionsIndexed[m_nextActionIndex] = pChild;
         
+        StaticOverlay::Invalidate();
         return true;
     }
 
@@ -131,6 +140,8 @@ namespace DSL
         // Clear the parent relationship and index
         pChild->ClearParentName();
         pChild->SetIndex(0);
+        
+        StaticOverlay::Invalidate();
         return true;
     }
     
@@ -147,6 +158,8 @@ namespace DSL
         }
         m_pOdeActions.clear();
         m_pOdeActionsIndexed.clear();
+        
+        StaticOverlay::Invalidate();
     }
     
     bool OdeTrigger::AddArea(DSL_BASE_PTR pChild)
@@ -168,6 +181,7 @@ namespace DSL
         m_pOdeAreas[pChild->GetName()] = pChild;
         m_pOdeAreasIndexed[m_nextAreaIndex] = pChild;
         
+        StaticOverlay::Invalidate();
         return true;
     }
 
@@ -191,6 +205,7 @@ namespace DSL
         pChild->ClearParentName();
         pChild->SetIndex(0);
         
+        StaticOverlay::Invalidate();
         return true;
     }
     
@@ -207,6 +222,8 @@ namespace DSL
         }
         m_pOdeAreas.clear();
         m_pOdeAreasIndexed.clear();
+        
+        StaticOverlay::Invalidate();
     }
 
     bool OdeTrigger::AddAccumulator(DSL_BASE_PTR pAccumulator)
@@ -279,6 +296,8 @@ namespace DSL
         
         m_frameCount = 0;
         
+        m_keyedStates.clear();
+        
         // iterate through the map of limit-event-listeners calling each
         for(auto const& imap: m_limitStateChangeListeners)
         {
@@ -294,6 +313,33 @@ namespace DSL
         }
     }
     
+    bool OdeTrigger::HasSameIdentity(DSL_BASE_PTR pOther)
+    {
+        LOG_FUNC();
+        
+        DSL_ODE_TRIGGER_PTR pOtherTrigger = 
+            std::dynamic_pointer_cast<OdeTrigger>(pOther);
+        
+        return (pOtherTrigger and typeid(*this) == typeid(*pOtherTrigger) and
+            m_source == pOtherTrigger->m_source and
+            m_sources == pOtherTrigger->m_sources and
+            m_classId == pOtherTrigger->m_classId and
+            m_classIdMask == pOtherTrigger->m_classIdMask);
+    }
+    
+    void OdeTrigger::TakeState(DSL_BASE_PTR pOther)
+    {
+        LOG_FUNC();
+        
+        DSL_ODE_TRIGGER_PTR pOtherTrigger = 
+            std::dynamic_pointer_cast<OdeTrigger>(pOther);
+
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&pOtherTrigger->m_propertyMutex);
+        
+        m_keyedStates.swap(pOtherTrigger->m_keyedStates);
+    }
+    
     void OdeTrigger::IncrementAndCheckTriggerCount()
     {
         LOG_FUNC();
@@ -324,6 +370,87 @@ namespace DSL
         }
     }
 
+    void OdeTrigger::IncrementOccurrences(NvDsObjectMeta* pObjectMeta)
+    {
+        // internal do not lock m_propertyMutex
+        
+        m_occurrences++;
+        
+        // class_id is known to be in range, having passed the mask criteria
+        if (m_classIdMask)
+        {
+            m_occurrencesPerClass[pObjectMeta->class_id]++;
+        }
+    }
+
+    void OdeTrigger::HandleOccurrenceMetrics(NvDsFrameMeta* pFrameMeta,
+        NvDsObjectMeta* pObjectMeta)
+    {
+        // internal do not lock m_propertyMutex
+        
+        if (m_pHeatMapper)
+        {
+            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+                pFrameMeta, pObjectMeta);
+        }
+        if (m_pAccumulator)
+        {
+            std::dynamic_pointer_cast<OdeAccumulator>(m_pAccumulator)->HandleOccurrence(
+                pFrameMeta, pObjectMeta);
+        }
+    }
+
+    uint OdeTrigger::GetKeyedOccurrences(uint classId)
+    {
+        // internal do not lock m_propertyMutex
+        
+        return (m_classIdMask) 
+            ? m_occurrencesPerClass[classId] 
+            : m_occurrences;
+    }
+
+    void OdeTrigger::InvokeKeyedActions(GstBuffer* pBuffer, 
+        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        NvDsFrameMeta* pFrameMeta, uint classId, uint occurrences)
+    {
+        // internal do not lock m_propertyMutex
+        
+        // event has been triggered
+        IncrementAndCheckTriggerCount();
+
+        // update the total event count static variable
+        m_activeEventId = ++s_eventCount;
+
+        pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
+            DSL_FRAME_INFO_OCCURRENCES;
+        pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = occurrences;
+        
+        // The Actions see the key's class and occurrences for the duration 
+        // of the call only. The frame's totals are restored for the base class.
+        uint frameOccurrences = m_occurrences;
+        m_activeClassId = classId;
+        m_occurrences = occurrences;
+        
+        for (const auto &imap: m_pOdeActionsIndexed)
+        {
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(imap.second);
+            pOdeAction->Invoke(shared_from_this(), 
+                pBuffer, displayMetaData, pFrameMeta, NULL);
+        }
+        m_activeClassId = m_classId;
+        m_occurrences = frameOccurrences;
+    }
+
+    uint& OdeTrigger::GetKeyedState(uint sourceId, uint classId, uint preset)
+    {
+        // internal do not lock m_propertyMutex
+        
+        uint64_t key = ((uint64_t)sourceId << 32) | classId;
+        
+        return m_keyedStates.emplace(key, preset).first->second;
+    }
+
     static int TriggerResetTimeoutHandler(gpointer pTrigger)
     {
         return static_cast<OdeTrigger*>(pTrigger)->
@@ -443,6 +570,46 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_classId = classId;
+        m_activeClassId = classId;
+        UpdateKeyedClassIds();
+    }
+
+    uint64_t OdeTrigger::GetClassIdMask()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        return m_classIdMask;
+    }
+    
+    void OdeTrigger::SetClassIdMask(uint64_t classIdMask)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_classIdMask = classIdMask;
+        m_occurrencesPerClass.fill(0);
+        m_keyedStates.clear();
+        UpdateKeyedClassIds();
+    }
+
+    void OdeTrigger::UpdateKeyedClassIds()
+    {
+        // internal do not lock m_propertyMutex
+        
+        m_keyedClassIds.clear();
+        if (!m_classIdMask)
+        {
+            m_keyedClassIds.push_back(m_classId);
+            return;
+        }
+        for (uint classId = 0; classId < DSL_ODE_CLASS_ID_MASK_SIZE; classId++)
+        {
+            if (m_classIdMask & (1ULL << classId))
+            {
+                m_keyedClassIds.push_back(classId);
+            }
+        }
     }
 
     uint OdeTrigger::GetEventLimit()
@@ -522,6 +689,7 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_source.assign(source);
+        StaticOverlay::Invalidate();
     }
 
     void OdeTrigger::_setSourceId(int id)
@@ -529,6 +697,54 @@ namespace DSL
         LOG_FUNC();
         
         m_sourceId = id;
+        StaticOverlay::Invalidate();
+    }
+
+    bool OdeTrigger::AddSource(const char* source)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (m_sources.find(source) != m_sources.end())
+        {
+            LOG_ERROR("Source '" << source 
+                << "' is already a source filter for ODE Trigger '" 
+                << GetName() << "'");
+            return false;
+        }
+        m_sources[source] = -1;
+        m_unresolvedSources++;
+        
+        StaticOverlay::Invalidate();
+        return true;
+    }
+
+    bool OdeTrigger::RemoveSource(const char* source)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        auto imap = m_sources.find(source);
+        if (imap == m_sources.end())
+        {
+            LOG_ERROR("Source '" << source 
+                << "' is not a source filter for ODE Trigger '" 
+                << GetName() << "'");
+            return false;
+        }
+        if (imap->second == -1)
+        {
+            m_unresolvedSources--;
+        }
+        else
+        {
+            m_sourceIds.erase(imap->second);
+        }
+        m_sources.erase(imap);
+        m_keyedStates.clear();
+        
+        StaticOverlay::Invalidate();
+        return true;
     }
     
     const char* OdeTrigger::GetInfer()
@@ -697,6 +913,7 @@ namespace DSL
         
         m_interval = interval;
         m_intervalCounter = 0;
+        StaticOverlay::Invalidate();
     }
     
     bool OdeTrigger::CheckForSourceId(int sourceId)
@@ -704,16 +921,38 @@ namespace DSL
         LOG_FUNC();
 
         // Filter on Source id if set
-        if (m_source.size())
+        if (m_source.size() or m_sources.size())
         {
             // a "one-time-get" of the source Id from the source name
-            if (m_sourceId == -1)
+            if (m_source.size() and m_sourceId == -1)
             {
                 
                 Services::GetServices()->SourceUniqueIdGet(m_source.c_str(), 
                     &m_sourceId);
+                    
+                // Overlay layers built before the Source was resolved are stale
+                if (m_sourceId != -1)
+                {
+                    StaticOverlay::Invalidate();
+                }
             }
-            if (m_sourceId != sourceId)
+            // and for any additional sources not yet resolved
+            if (m_unresolvedSources)
+            {
+                for (auto &imap: m_sources)
+                {
+                    if (imap.second == -1 and 
+                        Services::GetServices()->SourceUniqueIdGet(
+                            imap.first.c_str(), &imap.second) == DSL_RESULT_SUCCESS)
+                    {
+                        m_sourceIds.insert(imap.second);
+                        m_unresolvedSources--;
+                        StaticOverlay::Invalidate();
+                    }
+                }
+            }
+            if ((!m_source.size() or m_sourceId != sourceId) and
+                (m_sourceIds.find(sourceId) == m_sourceIds.end()))
             {
                 return false;
             }
@@ -749,13 +988,18 @@ namespace DSL
 
         // Reset the occurrences from the last frame, even if disabled  
         m_occurrences = 0;
+        if (m_classIdMask)
+        {
+            m_occurrencesPerClass.fill(0);
+        }
 
         if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id))
         {
             return;
         }
 
-        // Call on each of the Trigger's Areas to (optionally) display their Rectangle
+        // Call on each of the Trigger's Areas to (optionally) display their Rectangle.
+        // Areas with static Display Types are drawn by the StaticOverlay instead.
         for (const auto &imap: m_pOdeAreasIndexed)
         {
             DSL_ODE_AREA_PTR pOdeArea = 
@@ -775,6 +1019,55 @@ namespace DSL
         m_skipFrame = false;
     }
 
+    void OdeTrigger::GetStaticDisplayTypes(int sourceId, 
+        std::vector<DSL_DISPLAY_TYPE_PTR>& displayTypes)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+
+        if (!m_enabled or !CheckForSourceId(sourceId))
+        {
+            return;
+        }
+        for (const auto &imap: m_pOdeAreasIndexed)
+        {
+            DSL_ODE_AREA_PTR pOdeArea = 
+                std::dynamic_pointer_cast<OdeArea>(imap.second);
+            
+            if (pOdeArea->IsStatic())
+            {
+                displayTypes.push_back(pOdeArea->GetDisplayType());
+            }
+        }
+    }
+
+    void OdeTrigger::PostProcessFrameActions(GstBuffer* pBuffer, 
+        NvDsFrameMeta* pFrameMeta)
+    {
+        // No function log - called for every frame.
+        
+        // Note: function is called from the system (callback) context
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        // Called even if disabled so that any deferred Action work is completed
+        for (const auto &imap: m_pOdeActionsIndexed)
+        {
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(imap.second);
+            try
+            {
+                pOdeAction->CompleteDeferredOccurrences(shared_from_this());
+                pOdeAction->PostProcessFrame(pBuffer, pFrameMeta);
+            }
+            catch(...)
+            {
+                LOG_ERROR("Trigger '" << GetName() << "' => Action '" 
+                    << pOdeAction->GetName() << "' threw exception");
+            }
+        }
+    }
+
     uint OdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
@@ -790,6 +1083,7 @@ namespace DSL
         {
             return 0;
         }
+        m_occurrencesTotal += m_occurrences;
 
         // Don't start incrementing the frame-count until after the
         // first ODE occurrence. 
@@ -881,8 +1175,17 @@ namespace DSL
         {
             return false;
         }
-        // Filter on Class id if set
-        if ((m_classId != DSL_ODE_ANY_CLASS) and 
+        // Filter on Class id mask if set, or on Class id if set
+        if (m_classIdMask)
+        {
+            if (pObjectMeta->class_id < 0 or 
+                pObjectMeta->class_id >= DSL_ODE_CLASS_ID_MASK_SIZE or
+                !(m_classIdMask & (1ULL << pObjectMeta->class_id)))
+            {
+                return false;
+            }
+        }
+        else if ((m_classId != DSL_ODE_ANY_CLASS) and 
             (m_classId != pObjectMeta->class_id))
         {
             return false;
@@ -931,6 +1234,26 @@ namespace DSL
         return true;
     }
 
+    bool OdeTrigger::GetStaticCriteria(OdeStaticCriteria& criteria)
+    {
+        // No function log - called once per batch.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        criteria.classId = m_classId;
+        criteria.classIdMask = m_classIdMask;
+        criteria.minConfidence = m_minConfidence;
+        criteria.maxConfidence = m_maxConfidence;
+        criteria.minTrackerConfidence = m_minTrackerConfidence;
+        criteria.maxTrackerConfidence = m_maxTrackerConfidence;
+        criteria.minWidth = m_minWidth;
+        criteria.minHeight = m_minHeight;
+        criteria.maxWidth = m_maxWidth;
+        criteria.maxHeight = m_maxHeight;
+        criteria.inferDoneOnly = m_inferDoneOnly;
+        
+        return true;
+    }
+
     bool OdeTrigger::CheckForInside(NvDsObjectMeta* pObjectMeta)
     {
         LOG_FUNC();
@@ -992,11 +1315,38 @@ namespace DSL
         {
             DSL_ODE_ACTION_PTR pOdeAction = 
                 std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), 
+                
+            // Static Actions invoked on every frame are drawn by the StaticOverlay,
+            // the occurrence is still recorded for de-duplication and counters.
+            if (!m_interval and pOdeAction->IsStatic())
+            {
+                pOdeAction->InvokeStatic(shared_from_this(), pFrameMeta);
+                continue;
+            }
+            pOdeAction->Invoke(shared_from_this(), 
                 pBuffer, displayMetaData, pFrameMeta, NULL);
         }
     }
 
+    void AlwaysOdeTrigger::GetStaticDisplayTypes(int sourceId, 
+        std::vector<DSL_DISPLAY_TYPE_PTR>& displayTypes)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+
+        if (!m_enabled or !CheckForSourceId(sourceId) or m_interval or
+            m_when != DSL_ODE_PRE_OCCURRENCE_CHECK)
+        {
+            return;
+        }
+        for (const auto &imap: m_pOdeActionsIndexed)
+        {
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(imap.second);
+            pOdeAction->GetStaticDisplayTypes(displayTypes);
+        }
+    }
+
     uint AlwaysOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
@@ -1022,7 +1372,7 @@ namespace DSL
         {
             DSL_ODE_ACTION_PTR pOdeAction = 
                 std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), 
+            pOdeAction->Invoke(shared_from_this(), 
                 pBuffer, displayMetaData, pFrameMeta, NULL);
         }
         return 1;
@@ -1062,27 +1412,23 @@ namespace DSL
         m_occurrences++;
         
         // update the total event count static variable
-        s_eventCount++;
+        m_activeEventId = ++s_eventCount;
 
         // set the primary metric as the current occurrence for this frame
         pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = m_occurrences;
 
 
-        if (m_pHeatMapper)
-        {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                pFrameMeta, pObjectMeta);
-        }
+        HandleOccurrenceMetrics(pFrameMeta, pObjectMeta);
 
         for (const auto &imap: m_pOdeActionsIndexed)
         {
             DSL_ODE_ACTION_PTR pOdeAction = 
                 std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, 
+            pOdeAction->Invoke(shared_from_this(), pBuffer, 
                 displayMetaData, pFrameMeta, pObjectMeta);
             // try
             // {
-            //     pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, 
+            //     pOdeAction->Invoke(shared_from_this(), pBuffer, 
             //         displayMetaData, pFrameMeta, pObjectMeta);
             // }
             // catch(...)
@@ -1127,7 +1473,7 @@ namespace DSL
             return false;
         }
         
-        m_occurrences++;
+        IncrementOccurrences(pObjectMeta);
 
         return true;
     }
@@ -1142,27 +1488,57 @@ namespace DSL
             // Gaurd against property updates from the client API
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
             
-            if (!m_enabled or (m_eventLimit and m_triggered >= m_eventLimit) 
-                or m_occurrences) 
+            if (!m_enabled or (m_eventLimit and m_triggered >= m_eventLimit))
             {
                 return 0;
-            }        
-            
-            // since occurrences = 0, ODE occurrence for the Absence Trigger = 1
-            m_occurrences = 1;
+            }
             
-            // event has been triggered 
-            IncrementAndCheckTriggerCount();
+            // If keyed, report Absence for each class absent from the source.
+            if (IsKeyed())
+            {
+                uint absences(0);
+                for (auto classId: m_keyedClassIds)
+                {
+                    if (m_eventLimit and m_triggered >= m_eventLimit)
+                    {
+                        break;
+                    }
+                    if (!GetKeyedOccurrences(classId))
+                    {
+                        InvokeKeyedActions(pBuffer, displayMetaData, pFrameMeta,
+                            classId, 1);
+                        absences++;
+                    }
+                }
+                if (!absences)
+                {
+                    return 0;
+                }
+                m_occurrences = absences;
+            }
+            else
+            {
+                if (m_occurrences) 
+                {
+                    return 0;
+                }        
+                
+                // since occurrences = 0, ODE occurrence for the Absence Trigger = 1
+                m_occurrences = 1;
+                
+                // event has been triggered 
+                IncrementAndCheckTriggerCount();
 
-            // update the total event count static variable
-            s_eventCount++;
+                // update the total event count static variable
+                m_activeEventId = ++s_eventCount;
 
-            for (const auto &imap: m_pOdeActionsIndexed)
-            {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
-                    pBuffer, displayMetaData, pFrameMeta, NULL);
+                for (const auto &imap: m_pOdeActionsIndexed)
+                {
+                    DSL_ODE_ACTION_PTR pOdeAction = 
+                        std::dynamic_pointer_cast<OdeAction>(imap.second);
+                    pOdeAction->Invoke(shared_from_this(), 
+                        pBuffer, displayMetaData, pFrameMeta, NULL);
+                }
             }
         }
         // mutext unlocked - safe to call base class
@@ -1248,7 +1624,7 @@ namespace DSL
                 pFrameMeta->source_id, pObjectMeta->object_id);
                     
             pTrackedObject->Update(pFrameMeta->frame_num, 
-                (NvBbox_Coords*)&pObjectMeta->rect_params);
+                (NvBbox_Coords*)&pObjectMeta->rect_params, pFrameMeta->ntp_timestamp);
         }
 
         LOG_DEBUG("Tracked object with id = " 
@@ -1256,21 +1632,25 @@ namespace DSL
             << pFrameMeta->source_id << " with frame-count = " 
             << pTrackedObject->frameCount);
 
-        if (pTrackedObject->frameCount <= m_instanceCount)
+        // Instances are counted from the first frame the object's speed is in
+        // range. The speed is always 0 for the first frame it's tracked.
+        bool speedInRange = HandleKinematics(pTrackedObject, pObjectMeta);
+        if (speedInRange)
+        {
+            pTrackedObject->inRangeFrameCount++;
+        }
+        if (speedInRange and 
+            pTrackedObject->inRangeFrameCount <= m_instanceCount)
         {
             // event has been triggered
             IncrementAndCheckTriggerCount();
             m_occurrences++;
 
             // update the total event count static variable
-            s_eventCount++;
+            m_activeEventId = ++s_eventCount;
 
-            // If the client has added a heat mapper, call to add the occurrence data
-            if (m_pHeatMapper)
-            {
-                std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                    pFrameMeta, pObjectMeta);
-            }
+            // If the client has added a heat mapper or accumulator, add the occurrence
+            HandleOccurrenceMetrics(pFrameMeta, pObjectMeta);
 
             // set the primary metric as the current occurrence for this frame
             pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = m_occurrences;
@@ -1279,14 +1659,14 @@ namespace DSL
             {
                 DSL_ODE_ACTION_PTR pOdeAction = 
                     std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
+                pOdeAction->Invoke(shared_from_this(), 
                     pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
             }
             return true;
         }
         // if suppressing and we've reached the total number of frames to supress 
-        if (m_suppressionCount and 
-            pTrackedObject->frameCount >= (m_instanceCount + m_suppressionCount))
+        if (m_suppressionCount and pTrackedObject->inRangeFrameCount >= 
+            (m_instanceCount + m_suppressionCount))
         {
             // delete the object so that the instance/suppression cycle can start again
             // of the object is detected in the next frame.
@@ -1349,7 +1729,7 @@ namespace DSL
             return false;
         }
         
-        m_occurrences++;
+        IncrementOccurrences(pObjectMeta);
 
         return true;
     }
@@ -1368,21 +1748,38 @@ namespace DSL
             {
                 return 0;
             }
-            // event has been triggered
-            IncrementAndCheckTriggerCount();
+            
+            // If keyed, report the summation for each class of the source.
+            if (IsKeyed())
+            {
+                for (auto classId: m_keyedClassIds)
+                {
+                    if (m_eventLimit and m_triggered >= m_eventLimit)
+                    {
+                        break;
+                    }
+                    InvokeKeyedActions(pBuffer, displayMetaData, pFrameMeta,
+                        classId, GetKeyedOccurrences(classId));
+                }
+            }
+            else
+            {
+                // event has been triggered
+                IncrementAndCheckTriggerCount();
 
-             // update the total event count static variable
-            s_eventCount++;
+                 // update the total event count static variable
+                m_activeEventId = ++s_eventCount;
 
-            pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
-                DSL_FRAME_INFO_OCCURRENCES;
-            pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = m_occurrences;
-            for (const auto &imap: m_pOdeActionsIndexed)
-            {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
-                    pBuffer, displayMetaData, pFrameMeta, NULL);
+                pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
+                    DSL_FRAME_INFO_OCCURRENCES;
+                pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = m_occurrences;
+                for (const auto &imap: m_pOdeActionsIndexed)
+                {
+                    DSL_ODE_ACTION_PTR pOdeAction = 
+                        std::dynamic_pointer_cast<OdeAction>(imap.second);
+                    pOdeAction->Invoke(shared_from_this(), 
+                        pBuffer, displayMetaData, pFrameMeta, NULL);
+                }
             }
         }
         // mutex unlocked safe to call base class
@@ -1443,19 +1840,15 @@ namespace DSL
         m_occurrences++;
         
         // update the total event count static variable
-        s_eventCount++;
+        m_activeEventId = ++s_eventCount;
 
-        if (m_pHeatMapper)
-        {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                pFrameMeta, pObjectMeta);
-        }
+        HandleOccurrenceMetrics(pFrameMeta, pObjectMeta);
 
         for (const auto &imap: m_pOdeActionsIndexed)
         {
             DSL_ODE_ACTION_PTR pOdeAction = 
                 std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), 
+            pOdeAction->Invoke(shared_from_this(), 
                 pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
         }
         return true;
@@ -1494,13 +1887,13 @@ namespace DSL
             IncrementAndCheckTriggerCount();
 
              // update the total event count static variable
-            s_eventCount++;
+            m_activeEventId = ++s_eventCount;
 
             for (const auto &imap: m_pOdeActionsIndexed)
             {
                 DSL_ODE_ACTION_PTR pOdeAction = 
                     std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
+                pOdeAction->Invoke(shared_from_this(), 
                     pBuffer, displayMetaData, pFrameMeta, NULL);
             }
         }
@@ -1557,13 +1950,9 @@ namespace DSL
             return false;
         }
         
-        m_occurrences++;
+        IncrementOccurrences(pObjectMeta);
         
-        if (m_pHeatMapper)
-        {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                pFrameMeta, pObjectMeta);
-        }
+        HandleOccurrenceMetrics(pFrameMeta, pObjectMeta);
         return true;
     }
 
@@ -1577,23 +1966,47 @@ namespace DSL
             // Gaurd against property updates from the client API
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
             
-            if (!m_enabled or m_skipFrame or (m_eventLimit and m_triggered >= m_eventLimit) or
-                (m_occurrences < m_minimum) or (m_occurrences > m_maximum))
+            if (!m_enabled or m_skipFrame or (m_eventLimit and m_triggered >= m_eventLimit))
             {
                 return 0;
             }
-            // event has been triggered
-            IncrementAndCheckTriggerCount();
+            
+            // If keyed, check the count range for each class of the source.
+            if (IsKeyed())
+            {
+                for (auto classId: m_keyedClassIds)
+                {
+                    if (m_eventLimit and m_triggered >= m_eventLimit)
+                    {
+                        break;
+                    }
+                    uint occurrences = GetKeyedOccurrences(classId);
+                    if ((occurrences >= m_minimum) and (occurrences <= m_maximum))
+                    {
+                        InvokeKeyedActions(pBuffer, displayMetaData, pFrameMeta,
+                            classId, occurrences);
+                    }
+                }
+            }
+            else
+            {
+                if ((m_occurrences < m_minimum) or (m_occurrences > m_maximum))
+                {
+                    return 0;
+                }
+                // event has been triggered
+                IncrementAndCheckTriggerCount();
 
-             // update the total event count static variable
-            s_eventCount++;
+                 // update the total event count static variable
+                m_activeEventId = ++s_eventCount;
 
-            for (const auto &imap: m_pOdeActionsIndexed)
-            {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
-                    pBuffer, displayMetaData, pFrameMeta, NULL);
+                for (const auto &imap: m_pOdeActionsIndexed)
+                {
+                    DSL_ODE_ACTION_PTR pOdeAction = 
+                        std::dynamic_pointer_cast<OdeAction>(imap.second);
+                    pOdeAction->Invoke(shared_from_this(), 
+                        pBuffer, displayMetaData, pFrameMeta, NULL);
+                }
             }
         }
         // mutex unlocked - safe to call base class
@@ -1654,7 +2067,7 @@ namespace DSL
                 m_occurrences = 1;
                 IncrementAndCheckTriggerCount();
                 // update the total event count static variable
-                s_eventCount++;
+                m_activeEventId = ++s_eventCount;
 
                 uint smallestArea = UINT32_MAX;
                 NvDsObjectMeta* pSmallestObject(NULL);
@@ -1669,12 +2082,8 @@ namespace DSL
                         pSmallestObject = ivec;    
                     }
                 }
-                // conditionally add the 
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, pSmallestObject);
-                }
+                // If the client has added a heat mapper or accumulator, add the occurrence
+                HandleOccurrenceMetrics(pFrameMeta, pSmallestObject);
                 // set the primary metric as the smallest bounding box by area
                 pSmallestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
                     = smallestArea;
@@ -1683,7 +2092,7 @@ namespace DSL
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
                     
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->Invoke(shared_from_this(), 
                         pBuffer, displayMetaData, pFrameMeta, pSmallestObject);
                 }
             }   
@@ -1749,7 +2158,7 @@ namespace DSL
                 m_occurrences = 1;
                 IncrementAndCheckTriggerCount();
                 // update the total event count static variable
-                s_eventCount++;
+                m_activeEventId = ++s_eventCount;
 
                 uint largestArea = 0;
                 NvDsObjectMeta* pLargestObject(NULL);
@@ -1765,12 +2174,8 @@ namespace DSL
                     }
                 }
 
-                // If the client has added a heat mapper, call to add-occurrence
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, pLargestObject);
-                }
+                // If the client has added a heat mapper or accumulator, add the occurrence
+                HandleOccurrenceMetrics(pFrameMeta, pLargestObject);
                 
                 // set the primary metric as the larget area
                 pLargestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
@@ -1781,7 +2186,7 @@ namespace DSL
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
                     
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->Invoke(shared_from_this(), 
                         pBuffer, displayMetaData, pFrameMeta, pLargestObject);
                 }
             }   
@@ -1839,7 +2244,7 @@ namespace DSL
             return false;
         }
         
-        m_occurrences++;
+        IncrementOccurrences(pObjectMeta);
         
         return true;
     }
@@ -1859,7 +2264,27 @@ namespace DSL
                 return 0;
             }
             
-            if (m_occurrences < m_currentLow)
+            // If keyed, each (source, class) key has its own current low.
+            if (IsKeyed())
+            {
+                uint newLows(0);
+                for (auto classId: m_keyedClassIds)
+                {
+                    uint occurrences = GetKeyedOccurrences(classId);
+                    uint& currentLow = GetKeyedState(pFrameMeta->source_id,
+                        classId, m_preset);
+                    if (occurrences < currentLow)
+                    {
+                        currentLow = occurrences;
+                        InvokeKeyedActions(pBuffer, displayMetaData, pFrameMeta,
+                            classId, occurrences);
+                        newLows++;
+                    }
+                }
+                // new low for any key means ODE occurrence = number of keys
+                m_occurrences = newLows;
+            }
+            else if (m_occurrences < m_currentLow)
             {
                 // new low
                 m_currentLow = m_occurrences;
@@ -1868,7 +2293,7 @@ namespace DSL
                 IncrementAndCheckTriggerCount();
 
                  // update the total event count static variable
-                s_eventCount++;
+                m_activeEventId = ++s_eventCount;
 
                 // Add the New High occurrences to the frame info
                 pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
@@ -1880,7 +2305,7 @@ namespace DSL
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->Invoke(shared_from_this(), 
                         pBuffer, displayMetaData, pFrameMeta, NULL);
                 }
                 // new high m_occurrences means ODE occurrence = 1
@@ -1942,7 +2367,7 @@ namespace DSL
             return false;
         }
         
-        m_occurrences++;
+        IncrementOccurrences(pObjectMeta);
         
         return true;
     }
@@ -1962,7 +2387,27 @@ namespace DSL
                 return 0;
             }
             
-            if (m_occurrences > m_currentHigh)
+            // If keyed, each (source, class) key has its own current high.
+            if (IsKeyed())
+            {
+                uint newHighs(0);
+                for (auto classId: m_keyedClassIds)
+                {
+                    uint occurrences = GetKeyedOccurrences(classId);
+                    uint& currentHigh = GetKeyedState(pFrameMeta->source_id,
+                        classId, m_preset);
+                    if (occurrences > currentHigh)
+                    {
+                        currentHigh = occurrences;
+                        InvokeKeyedActions(pBuffer, displayMetaData, pFrameMeta,
+                            classId, occurrences);
+                        newHighs++;
+                    }
+                }
+                // new high for any key means ODE occurrence = number of keys
+                m_occurrences = newHighs;
+            }
+            else if (m_occurrences > m_currentHigh)
             {
                 // new high
                 m_currentHigh = m_occurrences;
@@ -1971,7 +2416,7 @@ namespace DSL
                 IncrementAndCheckTriggerCount();
 
                  // update the total event count static variable
-                s_eventCount++;
+                m_activeEventId = ++s_eventCount;
 
                 // Add the New High occurrences to the frame info
                 pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
@@ -1983,7 +2428,7 @@ namespace DSL
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->Invoke(shared_from_this(), 
                         pBuffer, displayMetaData, pFrameMeta, NULL);
                 }
                 // new high m_occurrences means ODE occurrence = 1
@@ -2006,6 +2451,8 @@ namespace DSL
     TrackingOdeTrigger::TrackingOdeTrigger(const char* name, const char* source, 
         uint classId, uint limit, uint maxTracePoints)
         : OdeTrigger(name, source, classId, limit)
+        , m_minSpeed(0)
+        , m_maxSpeed(0)
     {
         LOG_FUNC();
         
@@ -2030,6 +2477,54 @@ namespace DSL
         // call the base class to complete the Reset
         OdeTrigger::Reset();
     }
+    
+    void TrackingOdeTrigger::TakeState(DSL_BASE_PTR pOther)
+    {
+        LOG_FUNC();
+        {
+            std::shared_ptr<TrackingOdeTrigger> pOtherTrigger = 
+                std::dynamic_pointer_cast<TrackingOdeTrigger>(pOther);
+
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+            LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&pOtherTrigger->m_propertyMutex);
+            
+            m_pTrackedObjectsPerSource.swap(
+                pOtherTrigger->m_pTrackedObjectsPerSource);
+        }
+        // call the base class to take the remaining state
+        OdeTrigger::TakeState(pOther);
+    }
+
+    void TrackingOdeTrigger::GetSpeedRange(float* minimum, float* maximum)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        *minimum = m_minSpeed;
+        *maximum = m_maxSpeed;
+    }
+
+    void TrackingOdeTrigger::SetSpeedRange(float minimum, float maximum)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_minSpeed = minimum;
+        m_maxSpeed = maximum;
+    }
+
+    bool TrackingOdeTrigger::HandleKinematics(
+        std::shared_ptr<TrackedObject> pTrackedObject, NvDsObjectMeta* pObjectMeta)
+    {
+        // internal do not lock m_propertyMutex
+        
+        pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_KINEMATICS] = 
+            pTrackedObject->EncodeKinematics();
+            
+        double speed = pTrackedObject->GetSpeed();
+        
+        return (speed >= m_minSpeed and (!m_maxSpeed or speed <= m_maxSpeed));
+    }
    
     // *****************************************************************************
     
@@ -2047,6 +2542,9 @@ namespace DSL
         , m_testMethod(testMethod)
         , m_pTraceColor(pColor)
         , m_traceLineWidth(0)
+        , m_traceTolerance(0)
+        , m_maxTraces(0)
+        , m_tracesDisplayed(0)
     {
         LOG_FUNC();
     }
@@ -2098,7 +2596,9 @@ namespace DSL
                 pObjectMeta->object_id);
                 
         pTrackedObject->Update(pFrameMeta->frame_num, 
-            (NvBbox_Coords*)&pObjectMeta->rect_params);
+            (NvBbox_Coords*)&pObjectMeta->rect_params, pFrameMeta->ntp_timestamp);
+            
+        bool speedInRange = HandleKinematics(pTrackedObject, pObjectMeta);
             
         // Iterate through the map of 1 or more Areas to test for line cross
         for (const auto &imap: m_pOdeAreasIndexed)
@@ -2137,20 +2637,36 @@ namespace DSL
             // If the client has enabled object tracing
             if (m_traceEnabled)
             {
-                // If the object has a previous trace from a line cross event.
-                if (pTrackedObject->HasPreviousTrace())
+                // Only display traces while within the per-frame budget. The
+                // full trace is still used for the cross-test below.
+                if (!m_maxTraces or m_tracesDisplayed < m_maxTraces)
                 {
-                    DSL_RGBA_MULTI_LINE_PTR pPreviousTrace = 
-                        pTrackedObject->GetPreviousTrace(testPoint, m_testMethod, 
-                            m_traceLineWidth);
+                    m_tracesDisplayed++;
+                    
+                    // If the object has a previous trace from a line cross event.
+                    if (pTrackedObject->HasPreviousTrace())
+                    {
+                        DSL_RGBA_MULTI_LINE_PTR pPreviousTrace = 
+                            pTrackedObject->GetSimplifiedPreviousTrace(testPoint,
+                                m_testMethod, m_traceLineWidth, m_traceTolerance);
 
-                    // Add the multi-line metadata to the Frame's display-meta for 
-                    // the previous trace
-                    pPreviousTrace->AddMeta(displayMetaData, pFrameMeta);
+                        // Add the multi-line metadata to the Frame's display-meta 
+                        // for the previous trace
+                        pPreviousTrace->AddMeta(displayMetaData, pFrameMeta);
+                    }
+                    // Add the multi-line metadata to the Frame's display-meta for
+                    // the current trace, simplified if a tolerance is set.
+                    if (m_traceTolerance)
+                    {
+                        pTrackedObject->GetSimplifiedTrace(testPoint, m_testMethod, 
+                            m_traceLineWidth, m_traceTolerance)->AddMeta(
+                                displayMetaData, pFrameMeta);
+                    }
+                    else
+                    {
+                        pTrace->AddMeta(displayMetaData, pFrameMeta);
+                    }
                 }
-                // Add the multi-line metadata to the Frame's display-meta for
-                // the current trace.
-                pTrace->AddMeta(displayMetaData, pFrameMeta);
                 pObjectMeta->rect_params.border_color = pTrace->color;
                 pObjectMeta->rect_params.border_width = pTrace->line_width;
             }
@@ -2175,6 +2691,13 @@ namespace DSL
                 {
                     return false;
                 }
+                // A crossing outside of the speed range is consumed without
+                // occurrence so that it does not trigger on a later frame.
+                if (!speedInRange)
+                {
+                    pTrackedObject->HandleOccurrence();
+                    return false;
+                }
                 
                 // event has been triggered
                 IncrementAndCheckTriggerCount();
@@ -2190,14 +2713,10 @@ namespace DSL
                 }
 
                 // update the total event count static variable
-                s_eventCount++;
+                m_activeEventId = ++s_eventCount;
 
-                // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, pObjectMeta);
-                }
+                // If the client has added a heat mapper or accumulator, add the occurrence
+                HandleOccurrenceMetrics(pFrameMeta, pObjectMeta);
 
                 // add the persistence value to the array of misc_obj_info
                 // at both the Primary and Persistence specific indecies.
@@ -2212,7 +2731,7 @@ namespace DSL
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->Invoke(shared_from_this(), 
                         pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
                 }
 
@@ -2234,6 +2753,9 @@ namespace DSL
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
+        // clear the trace budget for the next frame
+        m_tracesDisplayed = 0;
+
         // Filter on skip-frame interval
         if (!m_enabled or m_skipFrame)
         {
@@ -2324,6 +2846,23 @@ namespace DSL
         m_traceLineWidth = lineWidth;
     }        
 
+    void CrossOdeTrigger::GetViewLodSettings(uint* tolerance, uint* maxTraces)
+    {
+        LOG_FUNC();
+
+        *tolerance = m_traceTolerance;
+        *maxTraces = m_maxTraces;
+    }
+    
+    void CrossOdeTrigger::SetViewLodSettings(uint tolerance, uint maxTraces)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_traceTolerance = tolerance;
+        m_maxTraces = maxTraces;
+    }        
+
     void CrossOdeTrigger::Reset()
     {
         LOG_FUNC();
@@ -2403,7 +2942,7 @@ namespace DSL
                     pObjectMeta->object_id);
                     
             pTrackedObject->Update(pFrameMeta->frame_num, 
-                (NvBbox_Coords*)&pObjectMeta->rect_params);
+                (NvBbox_Coords*)&pObjectMeta->rect_params, pFrameMeta->ntp_timestamp);
 
             double trackedTimeMs = pTrackedObject->GetDurationMs();
             
@@ -2411,22 +2950,19 @@ namespace DSL
                 << pObjectMeta->object_id << " for source = " 
                 << pFrameMeta->source_id << ", = " << trackedTimeMs << " ms");
             
-            // if the object's tracked time is within range. 
-            if (trackedTimeMs >= m_minimumMs and trackedTimeMs <= m_maximumMs)
+            // if the object's tracked time and speed are within range. 
+            if (HandleKinematics(pTrackedObject, pObjectMeta) and
+                trackedTimeMs >= m_minimumMs and trackedTimeMs <= m_maximumMs)
             {
                 // event has been triggered
                 IncrementAndCheckTriggerCount();
                 m_occurrences++;
 
                 // update the total event count static variable
-                s_eventCount++;
+                m_activeEventId = ++s_eventCount;
     
-                // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, pObjectMeta);
-                }
+                // If the client has added a heat mapper or accumulator, add the occurrence
+                HandleOccurrenceMetrics(pFrameMeta, pObjectMeta);
 
                 // add the persistence value to the array of misc_obj_info
                 // at both the Primary and Persistence specific indecies.
@@ -2438,7 +2974,7 @@ namespace DSL
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->Invoke(shared_from_this(), 
                         pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
                 }
             }
@@ -2513,11 +3049,13 @@ namespace DSL
                     pObjectMeta->object_id);
                     
             pTrackedObject->Update(pFrameMeta->frame_num, 
-                (NvBbox_Coords*)&pObjectMeta->rect_params);
+                (NvBbox_Coords*)&pObjectMeta->rect_params, pFrameMeta->ntp_timestamp);
 
             double trackedTimeMs = pTrackedObject->GetDurationMs();
             
-            if ((m_pLatestObjectMeta == NULL) or (trackedTimeMs < m_latestTrackedTimeMs))
+            if (HandleKinematics(pTrackedObject, pObjectMeta) and
+                ((m_pLatestObjectMeta == NULL) or 
+                    (trackedTimeMs < m_latestTrackedTimeMs)))
             {
                 m_pLatestObjectMeta = pObjectMeta;
                 m_latestTrackedTimeMs = trackedTimeMs;
@@ -2549,14 +3087,10 @@ namespace DSL
                 m_occurrences++;
 
                 // update the total event count static variable
-                s_eventCount++;
+                m_activeEventId = ++s_eventCount;
 
-                // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, m_pLatestObjectMeta);
-                }
+                // If the client has added a heat mapper or accumulator, add the occurrence
+                HandleOccurrenceMetrics(pFrameMeta, m_pLatestObjectMeta);
                 
                 // add the persistence value to the array of misc_obj_info
                 // as both the Primary and Persistence specific indecies.
@@ -2568,7 +3102,7 @@ namespace DSL
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->Invoke(shared_from_this(), 
                         pBuffer, displayMetaData, pFrameMeta, m_pLatestObjectMeta);
                 }
             
@@ -2630,12 +3164,13 @@ namespace DSL
                     pObjectMeta->object_id);
                     
             pTrackedObject->Update(pFrameMeta->frame_num, 
-                (NvBbox_Coords*)&pObjectMeta->rect_params);
+                (NvBbox_Coords*)&pObjectMeta->rect_params, pFrameMeta->ntp_timestamp);
 
             double trackedTimeMs = pTrackedObject->GetDurationMs();
                 
-            if ((m_pEarliestObjectMeta == NULL) or 
-                (trackedTimeMs > m_earliestTrackedTimeMs))
+            if (HandleKinematics(pTrackedObject, pObjectMeta) and
+                ((m_pEarliestObjectMeta == NULL) or 
+                    (trackedTimeMs > m_earliestTrackedTimeMs)))
             {
                 m_pEarliestObjectMeta = pObjectMeta;
                 m_earliestTrackedTimeMs = trackedTimeMs;
@@ -2667,14 +3202,10 @@ namespace DSL
                 m_occurrences++;
 
                 // update the total event count static variable
-                s_eventCount++;
+                m_activeEventId = ++s_eventCount;
 
-                // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, m_pEarliestObjectMeta);
-                }
+                // If the client has added a heat mapper or accumulator, add the occurrence
+                HandleOccurrenceMetrics(pFrameMeta, m_pEarliestObjectMeta);
 
                 // add the persistence value to the array of misc_obj_info
                 // as both the Primary and Persistence specific indecies.
@@ -2686,7 +3217,7 @@ namespace DSL
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->Invoke(shared_from_this(), 
                         pBuffer, displayMetaData, pFrameMeta, m_pEarliestObjectMeta);
                 }
             
@@ -2869,7 +3400,7 @@ namespace DSL
                             IncrementAndCheckTriggerCount();
                             
                              // update the total event count static variable
-                            s_eventCount++;
+                            m_activeEventId = ++s_eventCount;
 
                             // set the primary metric as the current occurrence for this frame
                             m_occurrenceMetaListA[i]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
@@ -2883,9 +3414,9 @@ namespace DSL
                                     std::dynamic_pointer_cast<OdeAction>(imap.second);
                                 
                                 // Invoke each action twice, once for each object in the tested pair
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
+                                pOdeAction->Invoke(shared_from_this(), 
                                     pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[i]);
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
+                                pOdeAction->Invoke(shared_from_this(), 
                                     pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[j]);
                             }
                             if (m_eventLimit and m_triggered >= m_eventLimit)
@@ -2938,7 +3469,7 @@ namespace DSL
                                 IncrementAndCheckTriggerCount();
                                 
                                  // update the total event count static variable
-                                s_eventCount++;
+                                m_activeEventId = ++s_eventCount;
 
                                 // set the primary metric as the current occurrence 
                                 // for this frame
@@ -2954,9 +3485,9 @@ namespace DSL
                                     
                                     // Invoke each action twice, once for each object 
                                     // in the tested pair
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                                    pOdeAction->Invoke(shared_from_this(), 
                                         pBuffer, displayMetaData, pFrameMeta, iterA);
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                                    pOdeAction->Invoke(shared_from_this(), 
                                         pBuffer, displayMetaData, pFrameMeta, iterB);
                                 }
                                 if (m_eventLimit and m_triggered >= m_eventLimit)
@@ -3139,7 +3670,7 @@ namespace DSL
                             IncrementAndCheckTriggerCount();
                             
                              // update the total event count static variable
-                            s_eventCount++;
+                            m_activeEventId = ++s_eventCount;
 
                             // set the primary metric as the current occurrence for this frame
                             m_occurrenceMetaListA[i]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
@@ -3153,9 +3684,9 @@ namespace DSL
                                     std::dynamic_pointer_cast<OdeAction>(imap.second);
                                 
                                 // Invoke each action twice, once for each object in the tested pair
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
+                                pOdeAction->Invoke(shared_from_this(), 
                                     pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[i]);
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
+                                pOdeAction->Invoke(shared_from_this(), 
                                     pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[j]);
                             }
                             if (m_eventLimit and m_triggered >= m_eventLimit)
@@ -3210,7 +3741,7 @@ namespace DSL
                                 IncrementAndCheckTriggerCount();
                                 
                                  // update the total event count static variable
-                                s_eventCount++;
+                                m_activeEventId = ++s_eventCount;
 
                                 // set the primary metric as the current occurrence 
                                 // for this frame
@@ -3226,9 +3757,9 @@ namespace DSL
                                     
                                     // Invoke each action twice, once for each object 
                                     // in the tested pair
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                                    pOdeAction->Invoke(shared_from_this(), 
                                         pBuffer, displayMetaData, pFrameMeta, iterA);
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                                    pOdeAction->Invoke(shared_from_this(), 
                                         pBuffer, displayMetaData, pFrameMeta, iterB);
                                 }
                                 if (m_eventLimit and m_triggered >= m_eventLimit)
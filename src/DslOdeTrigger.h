@@ -31,8 +31,17 @@ THE SOFTWARE.
 #include "DslOdeTrackedObject.h"
 #include "DslDisplayTypes.h"
 
+#include <array>
+#include <unordered_set>
+
 namespace DSL
 {
+    /**
+     * @brief Number of Class Ids that can be filtered on with a Class Id mask.
+     * Bit n of the mask enables Class Id n.
+     */
+    #define DSL_ODE_CLASS_ID_MASK_SIZE                                  64
+
     /**
      * @brief convenience macros for shared pointer abstraction
      */
@@ -138,6 +147,28 @@ namespace DSL
 
     // *****************************************************************************
 
+    /**
+     * @struct OdeStaticCriteria
+     * @brief Snapshot of the criteria of an ODE Trigger that depend only on 
+     * the Object and Frame meta, i.e. class, confidence, dimensions and 
+     * infer-done. Used by the ODE Pad Probe Handler to pre-filter all objects
+     * in a frame once, ahead of calling on the Triggers.
+     */
+    struct OdeStaticCriteria
+    {
+        uint classId;
+        uint64_t classIdMask;
+        float minConfidence;
+        float maxConfidence;
+        float minTrackerConfidence;
+        float maxTrackerConfidence;
+        float minWidth;
+        float minHeight;
+        float maxWidth;
+        float maxHeight;
+        bool inferDoneOnly;
+    };
+
     /**
      * @class OdeTrigger
      * @brief Implements a super/abstract class for all ODE Triggers
@@ -153,7 +184,7 @@ namespace DSL
         /**
          * @brief total count of all events
          */
-        static uint64_t s_eventCount;
+        static OdeCounter s_eventCount;
         
         /**
          * @brief Function to check a given Object Meta data structure for the 
@@ -179,6 +210,26 @@ namespace DSL
             std::vector<NvDsDisplayMeta*>& displayMetaData,
             NvDsFrameMeta* pFrameMeta);
         
+        /**
+         * @brief Adds the Display Types the Trigger overlays on every frame 
+         * for a given source - i.e. its shown Areas with static Display Types -
+         * to a list of Display Types to prebuild into a StaticOverlay.
+         * @param[in] sourceId unique source id of the overlay to build.
+         * @param[out] displayTypes list of Display Types to add to.
+         */
+        virtual void GetStaticDisplayTypes(int sourceId, 
+            std::vector<DSL_DISPLAY_TYPE_PTR>& displayTypes);
+        
+        /**
+         * @brief Gets a snapshot of the Trigger's static object criteria - 
+         * a subset of those tested by CheckForMinCriteria - so that objects
+         * can be pre-filtered before CheckForOccurrence is called.
+         * @param[out] criteria current static criteria for this Trigger.
+         * @return true if objects that fail the criteria can be skipped, 
+         * false if the Trigger must see every object.
+         */
+        virtual bool GetStaticCriteria(OdeStaticCriteria& criteria);
+        
         /**
          * @brief Function called to process all Occurrence/Absence data for the current frame
          * @param[in] pBuffer pointer to the GST Buffer containing all meta
@@ -190,6 +241,16 @@ namespace DSL
             std::vector<NvDsDisplayMeta*>& displayMetaData,
             NvDsFrameMeta* pFrameMeta);
 
+        /**
+         * @brief Function called after all Triggers have post processed the 
+         * current frame, to allow each of this Trigger's ODE Actions to complete
+         * any work deferred until the end of the frame.
+         * @param[in] pBuffer pointer to the GST Buffer containing all meta
+         * @param[in] pFrameMeta pointer to NvDsFrameMeta data for the frame.
+         */
+        void PostProcessFrameActions(GstBuffer* pBuffer, 
+            NvDsFrameMeta* pFrameMeta);
+
         /**
          * @brief Adds an ODE Action as a child to this OdeTrigger
          * @param[in] pChild pointer to ODE Action to add
@@ -259,6 +320,23 @@ namespace DSL
          */
         virtual void Reset();
         
+        /**
+         * @brief Determines if another Trigger has the same identity as this
+         * Trigger - i.e. the same type, source and class filters - so that 
+         * it can take over this Trigger's state on an ODE rule-set swap.
+         * @param[in] pOther Trigger to compare with.
+         * @return true if the Triggers have the same identity.
+         */
+        bool HasSameIdentity(DSL_BASE_PTR pOther);
+        
+        /**
+         * @brief Takes over the persistent state - frame-level keyed state,
+         * and tracked objects for Tracking Triggers - of a Trigger with the 
+         * same identity that this Trigger replaces.
+         * @param[in] pOther Trigger to take the state from.
+         */
+        virtual void TakeState(DSL_BASE_PTR pOther);
+        
         /**
          * @brief Timer callback function to handle the Reset timer timeout
          * @return false always to destroy the one shot timer.
@@ -311,6 +389,20 @@ namespace DSL
          */
         void SetClassId(uint classId);
         
+        /**
+         * @brief Gets the Class Id mask filter for Object detection.
+         * @return the current mask, 0 if disabled and the single ClassId 
+         * filter is in use.
+         */
+        uint64_t GetClassIdMask();
+        
+        /**
+         * @brief Sets the Class Id mask filter for Object detection. When set,
+         * frame-level state is kept and evaluated for each (source, class) key.
+         * @param[in] classIdMask bit n enables Class Id n, 0 to disable.
+         */
+        void SetClassIdMask(uint64_t classIdMask);
+        
         /**
          * @brief Gets the trigger event limit for this ODE Trigger 
          * @return the current frame limit value
@@ -348,6 +440,21 @@ namespace DSL
          */
         void SetSource(const char* source);
         
+        /**
+         * @brief Adds an additional source to the source filter. Objects from
+         * the primary source, or any additional source, meet the criteria.
+         * @param[in] source unique source name to add.
+         * @return true on successful add, false otherwise.
+         */
+        bool AddSource(const char* source);
+        
+        /**
+         * @brief Removes an additional source previously added with AddSource.
+         * @param[in] source unique source name to remove.
+         * @return true on successful remove, false otherwise.
+         */
+        bool RemoveSource(const char* source);
+        
         /**
          * @brief Note: this service is for testing purposes only. It is
          * used to set the Source Id filter, which is normally queried 
@@ -545,6 +652,68 @@ namespace DSL
          */
         void IncrementAndCheckTriggerCount();
 
+        /**
+         * @brief Determines if the Trigger keeps its frame-level state for 
+         * each (source, class) key, i.e. a Class Id mask or additional 
+         * sources have been set.
+         * @return true if keyed, false otherwise.
+         */
+        bool IsKeyed(){return m_classIdMask or m_sources.size();};
+        
+        /**
+         * @brief Increments the current frame's occurrences, both the total
+         * and the count for the Object's class if keyed by Class Id mask.
+         * @param[in] pObjectMeta Object that meets the Trigger's criteria.
+         */
+        void IncrementOccurrences(NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief Passes an object occurrence to the Trigger's Heat-Mapper 
+         * and Accumulator, if either has been added.
+         * @param[in] pFrameMeta Frame Meta of the occurrence.
+         * @param[in] pObjectMeta Object that triggered the occurrence.
+         */
+        void HandleOccurrenceMetrics(NvDsFrameMeta* pFrameMeta,
+            NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief Gets the current frame's occurrences for a given Class Id key.
+         * @param[in] classId one of the Trigger's m_keyedClassIds.
+         * @return number of occurrences in the current frame.
+         */
+        uint GetKeyedOccurrences(uint classId);
+        
+        /**
+         * @brief Invokes all Actions for a single (source, class) key. The 
+         * Actions receive the key by way of the Frame's source_id and the
+         * Trigger's m_activeClassId and m_occurrences for the duration of
+         * the call.
+         * @param[in] pBuffer pointer to the GST Buffer containing all meta.
+         * @param[in] displayMetaData vector of allocated Display metadata.
+         * @param[in] pFrameMeta pointer to NvDsFrameMeta data for the frame.
+         * @param[in] classId Class Id of the key.
+         * @param[in] occurrences occurrences for the key to report.
+         */
+        void InvokeKeyedActions(GstBuffer* pBuffer, 
+            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta, uint classId, uint occurrences);
+            
+        /**
+         * @brief Gets a mutable reference to the persistent state value for a
+         * (source, class) key, initialized to a preset value on first use.
+         * @param[in] sourceId source id of the key.
+         * @param[in] classId class id of the key.
+         * @param[in] preset initial value for a new key.
+         * @return reference to the keyed state value.
+         */
+        uint& GetKeyedState(uint sourceId, uint classId, uint preset);
+
+        /**
+         * @brief Updates the list of Class Ids to evaluate for each source,
+         * on change of the Class Id or Class Id mask.
+         */
+        void UpdateKeyedClassIds();
+
         /**
          * @brief Index variable to incremment/assign on ODE Area add.
          */
@@ -617,6 +786,40 @@ namespace DSL
          */
          bool m_skipFrame;
          
+        /**
+         * @brief map of additional source names to their unique source ids,
+         * -1 until resolved on first use.
+         */
+        std::map<std::string, int> m_sources;
+        
+        /**
+         * @brief set of resolved unique source ids for all additional sources.
+         */
+        std::unordered_set<int> m_sourceIds;
+        
+        /**
+         * @brief number of additional sources yet to be resolved.
+         */
+        uint m_unresolvedSources;
+        
+        /**
+         * @brief list of Class Ids evaluated for each source in keyed mode,
+         * either the set bits of m_classIdMask or the single m_classId.
+         */
+        std::vector<uint> m_keyedClassIds;
+        
+        /**
+         * @brief occurrences for each class in the current frame, only 
+         * updated if a Class Id mask is set.
+         */
+        std::array<uint, DSL_ODE_CLASS_ID_MASK_SIZE> m_occurrencesPerClass;
+        
+        /**
+         * @brief persistent frame-level state - e.g. current high or low - 
+         * for each (source, class) key, cleared on Trigger reset.
+         */
+        std::unordered_map<uint64_t, uint> m_keyedStates;
+         
     public:
     
         // access made public for performance reasons
@@ -629,7 +832,7 @@ namespace DSL
         /**
          * @brief trigger count, incremented on every event occurrence
          */
-        uint64_t m_triggered;    
+        OdeCounter m_triggered;    
     
         /**
          * @brief trigger event limit, once reached, actions will no longer be invoked
@@ -639,7 +842,7 @@ namespace DSL
         /**
          * @brief number of Frames the trigger has processed.
          */
-        uint64_t m_frameCount;
+        OdeCounter m_frameCount;
         
         /**
          * @brief trigger frame limit, once reached, actions will no longer be invoked
@@ -657,6 +860,12 @@ namespace DSL
          * Trigger reset. Only updated if/when the Trigger has an ODE Accumulator. 
          */
         uint m_occurrencesAccumulated;
+
+        /**
+         * @brief total number of occurrences over all frames. Unlike the 
+         * trigger and frame counts, never cleared on Trigger reset.
+         */
+        OdeCounter m_occurrencesTotal;
         
 
         /**
@@ -688,6 +897,24 @@ namespace DSL
          */
         uint m_classId;
         
+        /**
+         * @brief GIE Class Id mask filter for this event, 0 = disabled.
+         */
+        uint64_t m_classIdMask;
+        
+        /**
+         * @brief Class Id of the key the Actions are being invoked for. 
+         * Equal to m_classId when the Trigger is not keyed.
+         */
+        uint m_activeClassId;
+        
+        /**
+         * @brief Unique id of the event the Actions are being invoked for, 
+         * as returned by the increment of s_eventCount. Reading s_eventCount 
+         * directly can return the id of a later event from another Pipeline.
+         */
+        uint64_t m_activeEventId;
+        
         /**
          * Mininum inference confidence to trigger an ODE occurrence [0.0..1.0]
          */
@@ -780,6 +1007,15 @@ namespace DSL
         uint PostProcessFrame(GstBuffer* pBuffer, 
             std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta);
         
+        /**
+         * @brief Adds the Display Types of all static Actions if the Trigger
+         * invokes its Actions on every frame, pre-occurrence-checking.
+         * @param[in] sourceId unique source id of the overlay to build.
+         * @param[out] displayTypes list of Display Types to add to.
+         */
+        void GetStaticDisplayTypes(int sourceId, 
+            std::vector<DSL_DISPLAY_TYPE_PTR>& displayTypes);
+        
     private:
     
         /**
@@ -861,12 +1097,57 @@ namespace DSL
          */
         void Reset();
 
+        /**
+         * @brief Overrides the base TakeState to take over the tracked objects
+         * of the replaced Trigger as well.
+         * @param[in] pOther Trigger to take the state from.
+         */
+        void TakeState(DSL_BASE_PTR pOther);
+
+        /**
+         * @brief Gets the current speed range for this Tracking Trigger.
+         * @param[out] minimum minimum object speed in pixels per second.
+         * @param[out] maximum maximum object speed in pixels per second, 
+         * 0 = no maximum.
+         */
+        void GetSpeedRange(float* minimum, float* maximum);
+
+        /**
+         * @brief Sets the speed range for this Tracking Trigger. Tracked 
+         * objects with a speed outside of the range do not trigger.
+         * @param[in] minimum minimum object speed in pixels per second.
+         * @param[in] maximum maximum object speed in pixels per second, 
+         * 0 = no maximum.
+         */
+        void SetSpeedRange(float minimum, float maximum);
+
     protected:
 
+        /**
+         * @brief Writes a tracked object's kinematics to its Object Meta and 
+         * checks its speed against the Trigger's speed range.
+         * @param[in] pTrackedObject tracked object, updated for the current frame.
+         * @param[in] pObjectMeta Object Meta to write the kinematics to.
+         * @return true if the object's speed is within range, false otherwise.
+         */
+        bool HandleKinematics(std::shared_ptr<TrackedObject> pTrackedObject,
+            NvDsObjectMeta* pObjectMeta);
+
         /**
          * @brief map of tracked objects per source - Key = source Id
          */
         std::shared_ptr<TrackedObjects> m_pTrackedObjectsPerSource;
+
+        /**
+         * @brief minimum object speed in pixels per second to trigger.
+         */
+        float m_minSpeed;
+
+        /**
+         * @brief maximum object speed in pixels per second to trigger, 
+         * 0 = no maximum.
+         */
+        float m_maxSpeed;
     
     };
 
@@ -935,6 +1216,22 @@ namespace DSL
          */
         void SetViewSettings(bool enabled, DSL_RGBA_COLOR_PTR pColor, uint lineWidth);
 
+        /**
+         * @brief Gets the current level-of-detail settings for the trace display.
+         * @param[out] tolerance simplification tolerance in pixels, 0 = none.
+         * @param[out] maxTraces maximum number of object traces to display 
+         * per frame, 0 = no limit.
+         */
+        void GetViewLodSettings(uint* tolerance, uint* maxTraces);
+        
+        /**
+         * @brief Sets the level-of-detail settings for the trace display.
+         * @param[in] tolerance simplification tolerance in pixels, 0 = none.
+         * @param[in] maxTraces maximum number of object traces to display 
+         * per frame, 0 = no limit.
+         */
+        void SetViewLodSettings(uint tolerance, uint maxTraces);
+
         /**
          * @brief Overrides the base Reset in order to clear m_occurrencesIn and
          * m_occurrencesOut
@@ -999,6 +1296,24 @@ namespace DSL
          * @brief line width for the object trace in units of pixels.
          */
         uint m_traceLineWidth;
+        
+        /**
+         * @brief maximum distance in pixels between the full and displayed
+         * (simplified) object traces. 0 = display the full traces.
+         */
+        uint m_traceTolerance;
+        
+        /**
+         * @brief maximum number of object traces to display per frame, 
+         * 0 = no limit. Traces are still tested in full when over budget.
+         */
+        uint m_maxTraces;
+        
+        /**
+         * @brief number of object traces displayed for the current frame,
+         * reset on exit of PostProcessFrame.
+         */
+        uint m_tracesDisplayed;
     
     };
     
@@ -1696,6 +2011,13 @@ namespace DSL
             std::vector<NvDsDisplayMeta*>& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
+        /**
+         * @brief Overrides the base function as the class filter alternates 
+         * between Class A and Class B for each object.
+         * @return false always, objects are never pre-filtered.
+         */
+        bool GetStaticCriteria(OdeStaticCriteria& criteria){return false;};
+
         /**
          * @brief Function to post process the frame and generate a Distance Event 
          * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
@@ -26,7 +26,9 @@ THE SOFTWARE.
 #include "DslPadProbeHandler.h"
 #include "DslOdeTrigger.h"
 #include "DslBintr.h"
+#include "DslMemoryTracker.h"
 #include <gst-nvevent.h>
+#include <cfloat>
 
 namespace DSL
 {
@@ -286,10 +288,60 @@ namespace DSL
 
     //--------------------------------------------------------------------------------
 
+    FrameCounterPadProbeBufferHandler::FrameCounterPadProbeBufferHandler(
+        const char* name)
+        : PadProbeBufferHandler(name)
+        , m_frameCount(0)
+    {
+        LOG_FUNC();
+        
+        // Enable now
+        if (!SetEnabled(true))
+        {
+            throw;
+        }
+    }
+    
+    FrameCounterPadProbeBufferHandler::~FrameCounterPadProbeBufferHandler()
+    {
+        LOG_FUNC();
+    }
+
+    uint64_t FrameCounterPadProbeBufferHandler::GetFrameCount()
+    {
+        // No function log - called periodically by the Pipeline Scheduler.
+
+        return m_frameCount.load(std::memory_order_relaxed);
+    }
+
+    GstPadProbeReturn FrameCounterPadProbeBufferHandler::HandlePadData(
+        GstPadProbeInfo* pInfo)
+    {
+        // No mutex - the count is the only state updated.
+        
+        if (!m_isEnabled)
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        GstBuffer* pBuffer = (GstBuffer*)pInfo->data;
+        
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        if (pBatchMeta)
+        {
+            m_frameCount.fetch_add(pBatchMeta->num_frames_in_batch,
+                std::memory_order_relaxed);
+        }
+        return GST_PAD_PROBE_OK;
+    }
+
+    //--------------------------------------------------------------------------------
+
     OdePadProbeHandler::OdePadProbeHandler(const char* name)
         : PadProbeBufferHandler(name)
         , m_nextTriggerIndex(0)
         , m_displayMetaAllocSize(1)
+        , m_preFilterEnabled(false)
+        , m_swapPending(false)
     {
         LOG_FUNC();
         
@@ -315,12 +367,16 @@ namespace DSL
         }
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
         
+        // The child must be added to the committed set of Triggers
+        ApplyPendingSwap();
+        
         // increment next index, assign to the Trigger
         pChild->SetIndex(++m_nextTriggerIndex);
 
         // Add the child to the Indexed map 
         m_pChildrenIndexed[m_nextTriggerIndex] = pChild;
         
+        StaticOverlay::Invalidate();
         return true;
     }
 
@@ -334,9 +390,13 @@ namespace DSL
         }
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
         
+        // The child must be removed from the committed set of Triggers
+        ApplyPendingSwap();
+        
         // Remove the the child from Indexed map
         m_pChildrenIndexed.erase(pChild->GetIndex());
         
+        StaticOverlay::Invalidate();
         return true;
     }
 
@@ -347,8 +407,121 @@ namespace DSL
         Base::RemoveAllChildren();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
         
+        ApplyPendingSwap();
+        
         // Remove all children from Indexed map
         m_pChildrenIndexed.clear();
+        
+        StaticOverlay::Invalidate();
+    }
+
+    bool OdePadProbeHandler::SwapChildren(const std::vector<DSL_BASE_PTR>& triggers)
+    {
+        LOG_FUNC();
+        
+        // Note: the m_padHandlerMutex is not locked. The streaming thread 
+        // continues with the current set of Triggers until the next batch.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_swapMutex);
+        
+        std::map<uint, DSL_BASE_PTR> pendingChildrenIndexed;
+        std::map<std::string, DSL_BASE_PTR> newChildren;
+        
+        for (auto const& ichild: triggers)
+        {
+            if (newChildren.find(ichild->GetName()) != newChildren.end())
+            {
+                LOG_ERROR("ODE Trigger '" << ichild->GetName() 
+                    << "' is not unique in the new set for ODE Handler '" 
+                    << GetName() << "'");
+                return false;
+            }
+            newChildren[ichild->GetName()] = ichild;
+            pendingChildrenIndexed[pendingChildrenIndexed.size()+1] = ichild;
+        }
+        
+        // Remove all current children not in the new set, keeping them as
+        // candidates to hand their state over to new Triggers.
+        std::vector<DSL_BASE_PTR> removedChildren;
+        for (auto const& imap: std::map<std::string, DSL_BASE_PTR>(m_pChildren))
+        {
+            if (newChildren.find(imap.first) == newChildren.end())
+            {
+                Base::RemoveChild(imap.second);
+                removedChildren.push_back(imap.second);
+            }
+        }
+        for (auto const& ichild: triggers)
+        {
+            if (IsChild(ichild))
+            {
+                continue;
+            }
+            Base::AddChild(ichild);
+            
+            DSL_ODE_TRIGGER_PTR pTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(ichild);
+            
+            for (auto iremoved = removedChildren.begin(); 
+                iremoved != removedChildren.end(); iremoved++)
+            {
+                if (pTrigger->HasSameIdentity(*iremoved))
+                {
+                    LOG_INFO("ODE Trigger '" << ichild->GetName() 
+                        << "' will take over the state of ODE Trigger '" 
+                        << (*iremoved)->GetName() << "'");
+                    m_pendingTakeOvers.push_back(
+                        std::make_pair(ichild, *iremoved));
+                    removedChildren.erase(iremoved);
+                    break;
+                }
+            }
+        }
+        m_pPendingChildrenIndexed.swap(pendingChildrenIndexed);
+        m_swapPending.store(true, std::memory_order_release);
+        
+        return true;
+    }
+
+    void OdePadProbeHandler::ApplyPendingSwap()
+    {
+        // Note: called with the m_padHandlerMutex held.
+        if (!m_swapPending.load(std::memory_order_acquire))
+        {
+            return;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_swapMutex);
+        
+        m_pChildrenIndexed.swap(m_pPendingChildrenIndexed);
+        m_pPendingChildrenIndexed.clear();
+        
+        // Re-index all Triggers in their new execution order.
+        for (auto const& imap: m_pChildrenIndexed)
+        {
+            imap.second->SetIndex(imap.first);
+        }
+        m_nextTriggerIndex = m_pChildrenIndexed.size();
+        
+        // Take-overs for Triggers that were superseded by a later swap, 
+        // before being swapped in, are dropped.
+        for (auto const& itakeOver: m_pendingTakeOvers)
+        {
+            for (auto const& imap: m_pChildrenIndexed)
+            {
+                if (imap.second == itakeOver.first)
+                {
+                    std::dynamic_pointer_cast<OdeTrigger>(itakeOver.first)->
+                        TakeState(itakeOver.second);
+                    break;
+                }
+            }
+        }
+        m_pendingTakeOvers.clear();
+        m_swapPending.store(false, std::memory_order_release);
+        
+        StaticOverlay::Invalidate();
+        
+        LOG_INFO("ODE Handler '" << GetName() << "' swapped in a new set of "
+            << m_pChildrenIndexed.size() << " ODE Triggers");
     }
 
     uint OdePadProbeHandler::GetDisplayMetaAllocSize()
@@ -364,12 +537,172 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
         
         m_displayMetaAllocSize = size;
+        
+        StaticOverlay::Invalidate();
+    }
+    
+    bool OdePadProbeHandler::GetPreFilterEnabled()
+    {
+        LOG_FUNC();
+        
+        return m_preFilterEnabled;
+    }
+    
+    void OdePadProbeHandler::SetPreFilterEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        m_preFilterEnabled = enabled;
+    }
+    
+    void OdePadProbeHandler::PreFilterObjects(const OdeStaticCriteria& criteria,
+        uint bit, bool inferDone, const OdeObjectColumns& columns, 
+        uint64_t* pMasks)
+    {
+        // No function log - called for each Trigger on each frame.
+        
+        // The frame-level criteria fails all objects at once.
+        if (criteria.inferDoneOnly and !inferDone)
+        {
+            return;
+        }
+        
+        // A value of 0 disables a criteria, so replace with an open bound.
+        float minConfidence = criteria.minConfidence;
+        float maxConfidence = (criteria.maxConfidence) 
+            ? criteria.maxConfidence : FLT_MAX;
+        float minTrackerConfidence = criteria.minTrackerConfidence;
+        float maxTrackerConfidence = (criteria.maxTrackerConfidence) 
+            ? criteria.maxTrackerConfidence : FLT_MAX;
+        float minWidth = (criteria.minWidth > 0) ? criteria.minWidth : -FLT_MAX;
+        float minHeight = (criteria.minHeight > 0) ? criteria.minHeight : -FLT_MAX;
+        float maxWidth = (criteria.maxWidth > 0) ? criteria.maxWidth : FLT_MAX;
+        float maxHeight = (criteria.maxHeight > 0) ? criteria.maxHeight : FLT_MAX;
+        
+        uint64_t classIdMask = criteria.classIdMask;
+        uint classId = criteria.classId;
+        bool anyClass = (!classIdMask and classId == DSL_ODE_ANY_CLASS);
+        
+        // Each criteria is evaluated without branching, with the same results
+        // as OdeTrigger::CheckForMinCriteria, so the compiler can vectorize.
+        for (uint i = 0; i < columns.count; i++)
+        {
+            int objectClassId = columns.classIds[i];
+            float confidence = columns.confidences[i];
+            float trackerConfidence = columns.trackerConfidences[i];
+            float width = columns.widths[i];
+            float height = columns.heights[i];
+            
+            uint64_t classPass = (classIdMask)
+                ? ((objectClassId >= 0) & (objectClassId < DSL_ODE_CLASS_ID_MASK_SIZE) &
+                    (uint)((classIdMask >> (objectClassId & 
+                        (DSL_ODE_CLASS_ID_MASK_SIZE-1))) & 1))
+                : (anyClass | ((uint)objectClassId == classId));
+                
+            uint64_t pass = classPass &
+                ((confidence <= 0) | ((confidence >= minConfidence) & 
+                    (confidence <= maxConfidence))) &
+                ((trackerConfidence <= 0) | 
+                    ((trackerConfidence >= minTrackerConfidence) & 
+                        (trackerConfidence <= maxTrackerConfidence))) &
+                (width >= minWidth) & (width <= maxWidth) &
+                (height >= minHeight) & (height <= maxHeight);
+                
+            pMasks[i] |= (pass << bit);
+        }
+    }
+    
+    uint64_t* OdePadProbeHandler::PreFilterFrame(NvDsFrameMeta* pFrameMeta,
+        uint& numObjects)
+    {
+        // Note: called with the m_padHandlerMutex held.
+        
+        numObjects = 0;
+        for (NvDsMetaList* pMeta = pFrameMeta->obj_meta_list; pMeta; 
+            pMeta = pMeta->next)
+        {
+            numObjects++;
+        }
+        if (!numObjects)
+        {
+            return NULL;
+        }
+        FrameArena* pArena = FrameArena::GetThreadArena();
+        
+        OdeObjectColumns columns;
+        columns.count = numObjects;
+        columns.classIds = static_cast<int*>(
+            pArena->Allocate(numObjects*sizeof(int), alignof(int)));
+        columns.confidences = static_cast<float*>(
+            pArena->Allocate(numObjects*sizeof(float), alignof(float)));
+        columns.trackerConfidences = static_cast<float*>(
+            pArena->Allocate(numObjects*sizeof(float), alignof(float)));
+        columns.widths = static_cast<float*>(
+            pArena->Allocate(numObjects*sizeof(float), alignof(float)));
+        columns.heights = static_cast<float*>(
+            pArena->Allocate(numObjects*sizeof(float), alignof(float)));
+        uint64_t* pMasks = static_cast<uint64_t*>(
+            pArena->Allocate(numObjects*sizeof(uint64_t), alignof(uint64_t)));
+        
+        // Gather the object meta once, for all Triggers.
+        uint i(0);
+        for (NvDsMetaList* pMeta = pFrameMeta->obj_meta_list; pMeta; 
+            pMeta = pMeta->next, i++)
+        {
+            NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pMeta->data);
+            
+            columns.classIds[i] = pObjectMeta->class_id;
+            columns.confidences[i] = pObjectMeta->confidence;
+            columns.trackerConfidences[i] = pObjectMeta->tracker_confidence;
+            columns.widths[i] = pObjectMeta->rect_params.width;
+            columns.heights[i] = pObjectMeta->rect_params.height;
+            pMasks[i] = 0;
+        }
+        
+        // Triggers that can't be pre-filtered are passed all objects.
+        uint64_t passMask(0);
+        uint bit(0);
+        OdeStaticCriteria criteria;
+        
+        for (const auto &imap: m_pChildrenIndexed)
+        {
+            if (bit >= DSL_ODE_PRE_FILTER_MAX_TRIGGERS)
+            {
+                break;
+            }
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(imap.second);
+                
+            if (pOdeTrigger->GetStaticCriteria(criteria))
+            {
+                PreFilterObjects(criteria, bit, pFrameMeta->bInferDone, 
+                    columns, pMasks);
+            }
+            else
+            {
+                passMask |= (1ULL << bit);
+            }
+            bit++;
+        }
+        if (passMask)
+        {
+            for (i = 0; i < numObjects; i++)
+            {
+                pMasks[i] |= passMask;
+            }
+        }
+        return pMasks;
     }
     
     GstPadProbeReturn OdePadProbeHandler::HandlePadData(GstPadProbeInfo* pInfo)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
         
+        // Swap in the new set of Triggers, if pending, between batches so
+        // that no frame ever sees a partially applied set.
+        ApplyPendingSwap();
+        
         if (!m_isEnabled)
         {
             return GST_PAD_PROBE_OK;
@@ -397,6 +730,10 @@ namespace DSL
                         nvds_acquire_display_meta_from_pool(pBatchMeta);
                     displayMetaData.push_back(pDisplayMeta);
                 }
+                // Static Areas and Display Types are added first as a single,
+                // prebuilt layer, beneath all per-frame display meta.
+                AddStaticOverlay(displayMetaData, pFrameMeta);
+                
                 // Preprocess the frame
                 for (const auto &imap: m_pChildrenIndexed)
                 {
@@ -405,7 +742,17 @@ namespace DSL
                     pOdeTrigger->PreProcessFrame(pBuffer, displayMetaData, pFrameMeta);
                 }
 
+                // If enabled, test the static criteria of all Triggers once
+                // for each object, before any Actions are invoked.
+                uint numObjects(0);
+                uint64_t* pObjectMasks(NULL);
+                if (m_preFilterEnabled)
+                {
+                    pObjectMasks = PreFilterFrame(pFrameMeta, numObjects);
+                }
+
                 NvDsMetaList* pNextMeta = pFrameMeta->obj_meta_list;
+                uint objectIndex(0);
                 
                 // For each detected object in the frame.
                 while (pNextMeta != NULL)
@@ -416,13 +763,24 @@ namespace DSL
                     // from the frame meta by an action which will null the pObjectMeta 
                     // making pNextMeta in an invalid state an unable to increment. 
                     pNextMeta = pNextMeta->next;
+                    
+                    // Objects added by an Action after the pre-filter pass all.
+                    uint64_t objectMask = (pObjectMasks and objectIndex < numObjects)
+                        ? pObjectMasks[objectIndex] : UINT64_MAX;
+                    objectIndex++;
+                    uint bit(0);
 
                     // For each ODE Trigger owned by this ODE Manager, check for ODE
                     for (const auto &imap: m_pChildrenIndexed)
                     {
+                        // skip the Trigger if the object failed its pre-filter.
+                        bool preFiltered = (bit < DSL_ODE_PRE_FILTER_MAX_TRIGGERS and
+                            !((objectMask >> bit) & 1));
+                        bit++;
+                        
                         // check for valid object meta as it may have be nulled by
                         // a trigger with a remove action
-                        if (pObjectMeta != NULL)
+                        if (pObjectMeta != NULL and !preFiltered)
                         {
                             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
                                 std::dynamic_pointer_cast<OdeTrigger>(imap.second);
@@ -450,16 +808,79 @@ namespace DSL
                     pOdeTrigger->PostProcessFrame(pBuffer, displayMetaData, pFrameMeta);
                 }
                 
+                // Once all Triggers have post processed the frame, allow their 
+                // Actions to complete any work deferred to the end of the frame,
+                // e.g. batched object captures.
+                for (const auto &imap: m_pChildrenIndexed)
+                {
+                    DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                        std::dynamic_pointer_cast<OdeTrigger>(imap.second);
+                    pOdeTrigger->PostProcessFrameActions(pBuffer, pFrameMeta);
+                }
+                
                 for (const auto & ivec: displayMetaData)
                 {
                     // Add the updated display data to the frame
                     nvds_add_display_meta_to_frame(pFrameMeta, ivec);
                 }
+                
+                // All per-frame scratch allocated by the Triggers and Actions
+                // is released at once.
+                FrameArena::GetThreadArena()->Reset();
             }
         }
         return GST_PAD_PROBE_OK;
     }
 
+    void OdePadProbeHandler::AddStaticOverlay(
+        std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta)
+    {
+        if (displayMetaData.empty())
+        {
+            return;
+        }
+        DSL_STATIC_OVERLAY_PTR& pStaticOverlay = 
+            m_staticOverlays[pFrameMeta->source_id];
+        if (!pStaticOverlay)
+        {
+            pStaticOverlay = DSL_STATIC_OVERLAY_NEW();
+        }
+        
+        // Read the generation before collecting, so that any change made 
+        // while the layer is being built causes another rebuild.
+        uint generation = StaticOverlay::GetCurrentGeneration();
+        if (pStaticOverlay->GetGeneration() != generation)
+        {
+            std::vector<DSL_DISPLAY_TYPE_PTR> collected;
+            for (const auto &imap: m_pChildrenIndexed)
+            {
+                DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                    std::dynamic_pointer_cast<OdeTrigger>(imap.second);
+                pOdeTrigger->GetStaticDisplayTypes(pFrameMeta->source_id, 
+                    collected);
+            }
+            
+            // Areas and Display Types shared by multiple Triggers and Actions 
+            // are drawn once only, in first-added order.
+            std::set<DisplayType*> unique;
+            std::vector<DSL_DISPLAY_TYPE_PTR> displayTypes;
+            for (const auto &ivec: collected)
+            {
+                if (unique.insert(ivec.get()).second)
+                {
+                    displayTypes.push_back(ivec);
+                }
+            }
+            LOG_INFO("Building Static Overlay for source " 
+                << pFrameMeta->source_id << " with " << displayTypes.size() 
+                << " Display Types for ODE Handler '" << GetName() << "'");
+                
+            pStaticOverlay->Build(displayTypes, displayMetaData.size(), 
+                generation, pFrameMeta);
+        }
+        pStaticOverlay->AddMeta(displayMetaData);
+    }
+
     //--------------------------------------------------------------------------------
 
     CustomPadProbeHandler::CustomPadProbeHandler(const char* name, 
@@ -869,6 +1290,367 @@ for Buffer Timer PPH '" << GetName() << "'");
 
     //--------------------------------------------------------------------------------
 
+    EncodedCachePadProbeHandler::EncodedCachePadProbeHandler(const char* name, 
+        uint duration, uint64_t maxSize)
+        : PadProbeBufferHandler(name)
+        , m_duration(duration)
+        , m_maxSize(maxSize)
+        , m_size(0)
+        , m_frontSeq(0)
+    {
+        LOG_FUNC();
+        
+        // Enable now
+        if (!SetEnabled(true))
+        {
+            throw;
+        }
+    }
+
+    EncodedCachePadProbeHandler::~EncodedCachePadProbeHandler()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        ClearLocked();
+    }
+
+    void EncodedCachePadProbeHandler::GetSettings(uint* duration, 
+        uint64_t* maxSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        *duration = m_duration;
+        *maxSize = m_maxSize;
+    }
+    
+    void EncodedCachePadProbeHandler::SetSettings(uint duration, 
+        uint64_t maxSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        m_duration = duration;
+        m_maxSize = maxSize;
+        
+        if (!m_duration)
+        {
+            ClearLocked();
+        }
+        Trim();
+    }
+    
+    void EncodedCachePadProbeHandler::GetFillLevel(uint* duration, 
+        uint64_t* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        *duration = (m_units.size())
+            ? (m_units.back().timestamp - m_units.front().timestamp)/GST_MSECOND
+            : 0;
+        *size = m_size;
+    }
+    
+    bool EncodedCachePadProbeHandler::GetBuffers(uint duration, 
+        std::vector<GstBuffer*>& buffers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        if (m_keyFrames.empty())
+        {
+            return false;
+        }
+        GstClockTime lastTimestamp = m_units.back().timestamp;
+        GstClockTime startTimestamp = 
+            (lastTimestamp > duration*GST_SECOND)
+            ? lastTimestamp - duration*GST_SECOND
+            : 0;
+        
+        // Find the nearest key-frame at or before the start time, or the
+        // oldest key-frame if the cache holds less than the requested duration.
+        auto ikey = m_keyFrames.upper_bound(startTimestamp);
+        if (ikey != m_keyFrames.begin())
+        {
+            ikey--;
+        }
+        for (uint64_t seq = ikey->second; 
+            seq < m_frontSeq + m_units.size(); seq++)
+        {
+            buffers.push_back(gst_buffer_ref(m_units[seq - m_frontSeq].pBuffer));
+        }
+        return true;
+    }
+    
+    bool EncodedCachePadProbeHandler::Export(uint duration, 
+        const char* filePath, GstCaps* pCaps)
+    {
+        LOG_FUNC();
+        
+        // Get references to the buffers under lock only, so that the pipeline
+        // is not blocked while the file is written.
+        std::vector<GstBuffer*> buffers;
+        if (!GetBuffers(duration, buffers))
+        {
+            LOG_ERROR("Encoded Cache '" << GetName() 
+                << "' does not contain a key-frame to export");
+            return false;
+        }
+        
+        std::ofstream ofs(filePath, std::ios::out | std::ios::binary);
+        if (!ofs.is_open())
+        {
+            LOG_ERROR("Encoded Cache '" << GetName() 
+                << "' failed to open file '" << filePath << "' for export");
+            for (auto& ibuffer: buffers)
+            {
+                gst_buffer_unref(ibuffer);
+            }
+            return false;
+        }
+        
+        // Length-prefix size for avc/hvc1 stream-formats, 0 for byte-stream.
+        uint lengthSize(0);
+        
+        if (pCaps and gst_caps_get_size(pCaps))
+        {
+            GstStructure* pStructure = gst_caps_get_structure(pCaps, 0);
+            std::string mediaType(gst_structure_get_name(pStructure));
+            const GValue* pCodecData = 
+                gst_structure_get_value(pStructure, "codec_data");
+                
+            if (pCodecData and (mediaType == "video/x-h264" or 
+                mediaType == "video/x-h265"))
+            {
+                GstMapInfo mapInfo;
+                GstBuffer* pCodecBuffer = gst_value_get_buffer(pCodecData);
+                if (gst_buffer_map(pCodecBuffer, &mapInfo, GST_MAP_READ))
+                {
+                    lengthSize = WriteCodecData(ofs, mapInfo.data, mapInfo.size,
+                        (mediaType == "video/x-h265"));
+                    gst_buffer_unmap(pCodecBuffer, &mapInfo);
+                }
+            }
+        }
+        
+        static const guint8 startCode[] = {0x00, 0x00, 0x00, 0x01};
+        
+        for (auto& ibuffer: buffers)
+        {
+            GstMapInfo mapInfo;
+            if (gst_buffer_map(ibuffer, &mapInfo, GST_MAP_READ))
+            {
+                if (!lengthSize)
+                {
+                    ofs.write((const char*)mapInfo.data, mapInfo.size);
+                }
+                else
+                {
+                    gsize offset(0);
+                    while (offset + lengthSize <= mapInfo.size)
+                    {
+                        gsize nalSize(0);
+                        for (uint i = 0; i < lengthSize; i++)
+                        {
+                            nalSize = (nalSize << 8) | mapInfo.data[offset++];
+                        }
+                        if (offset + nalSize > mapInfo.size)
+                        {
+                            LOG_WARN("Encoded Cache '" << GetName() 
+                                << "' found truncated NAL unit on export");
+                            break;
+                        }
+                        ofs.write((const char*)startCode, sizeof(startCode));
+                        ofs.write((const char*)mapInfo.data + offset, nalSize);
+                        offset += nalSize;
+                    }
+                }
+                gst_buffer_unmap(ibuffer, &mapInfo);
+            }
+            gst_buffer_unref(ibuffer);
+        }
+        ofs.close();
+        
+        LOG_INFO("Encoded Cache '" << GetName() << "' exported " 
+            << buffers.size() << " buffers to file '" << filePath << "'");
+        return true;
+    }
+    
+    uint EncodedCachePadProbeHandler::WriteCodecData(std::ofstream& ofs, 
+        const guint8* data, gsize size, bool isH265)
+    {
+        static const guint8 startCode[] = {0x00, 0x00, 0x00, 0x01};
+        
+        // Each parameter set is prefixed with a 16-bit size in both formats
+        auto writeNalUnits = [&](gsize& offset, uint count) -> bool
+        {
+            for (uint i = 0; i < count; i++)
+            {
+                if (offset + 2 > size)
+                {
+                    return false;
+                }
+                gsize nalSize = (data[offset] << 8) | data[offset+1];
+                offset += 2;
+                if (offset + nalSize > size)
+                {
+                    return false;
+                }
+                ofs.write((const char*)startCode, sizeof(startCode));
+                ofs.write((const char*)data + offset, nalSize);
+                offset += nalSize;
+            }
+            return true;
+        };
+        
+        if (!isH265)
+        {
+            // avcC: [4] length-size-minus-one, [5] num-SPS, SPSs, num-PPS, PPSs
+            if (size < 7)
+            {
+                return 0;
+            }
+            gsize offset(6);
+            if (!writeNalUnits(offset, data[5] & 0x1f) or offset >= size)
+            {
+                return 0;
+            }
+            uint numPps = data[offset++];
+            if (!writeNalUnits(offset, numPps))
+            {
+                return 0;
+            }
+            return (data[4] & 0x03) + 1;
+        }
+        
+        // hvcC: [21] length-size-minus-one, [22] num-arrays, then per array
+        // [type][16-bit num-nalus] followed by the NAL units.
+        if (size < 23)
+        {
+            return 0;
+        }
+        gsize offset(23);
+        for (uint i = 0; i < data[22]; i++)
+        {
+            if (offset + 3 > size)
+            {
+                return 0;
+            }
+            uint numNalus = (data[offset+1] << 8) | data[offset+2];
+            offset += 3;
+            if (!writeNalUnits(offset, numNalus))
+            {
+                return 0;
+            }
+        }
+        return (data[21] & 0x03) + 1;
+    }
+    
+    void EncodedCachePadProbeHandler::Clear()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        ClearLocked();
+    }
+    
+    void EncodedCachePadProbeHandler::ClearLocked()
+    {
+        for (auto& iunit: m_units)
+        {
+            gst_buffer_unref(iunit.pBuffer);
+        }
+        m_frontSeq += m_units.size();
+        m_units.clear();
+        m_keyFrames.clear();
+        m_size = 0;
+    }
+    
+    void EncodedCachePadProbeHandler::Trim()
+    {
+        while (m_units.size())
+        {
+            const CachedUnit& front = m_units.front();
+            
+            bool overDuration = (m_units.back().timestamp - front.timestamp) > 
+                m_duration*GST_SECOND;
+            bool overSize = (m_maxSize and m_size > m_maxSize);
+            
+            // Always keep the cache starting on a key-frame - there's no use
+            // for delta-units without the key-frame they depend on.
+            bool isKeyFrame = (m_keyFrames.size() and 
+                m_keyFrames.begin()->second == m_frontSeq);
+            
+            // Never trim the newest key-frame's GOP, even if it's longer than
+            // the duration or larger than the budget, or the cache would empty.
+            if (isKeyFrame and ((!overDuration and !overSize) or 
+                m_keyFrames.size() == 1))
+            {
+                break;
+            }
+            if (isKeyFrame)
+            {
+                m_keyFrames.erase(m_keyFrames.begin());
+            }
+            m_size -= front.size;
+            gst_buffer_unref(front.pBuffer);
+            m_units.pop_front();
+            m_frontSeq++;
+        }
+    }
+    
+    GstPadProbeReturn EncodedCachePadProbeHandler::HandlePadData(
+        GstPadProbeInfo* pInfo)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        if (!m_isEnabled or !m_duration)
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        GstBuffer* pBuffer = (GstBuffer*)pInfo->data;
+        
+        // Use decode order timestamps if available, as presentation order
+        // timestamps are not monotonic for streams with B-frames.
+        GstClockTime timestamp = GST_BUFFER_DTS_IS_VALID(pBuffer)
+            ? GST_BUFFER_DTS(pBuffer)
+            : GST_BUFFER_PTS(pBuffer);
+        if (!GST_CLOCK_TIME_IS_VALID(timestamp))
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        
+        // On discontinuity (e.g. reconnect) start over at the next key-frame
+        if (m_units.size() and timestamp < m_units.back().timestamp)
+        {
+            LOG_INFO("Encoded Cache '" << GetName() 
+                << "' cleared on timestamp discontinuity");
+            ClearLocked();
+        }
+        
+        bool isKeyFrame = 
+            !GST_BUFFER_FLAG_IS_SET(pBuffer, GST_BUFFER_FLAG_DELTA_UNIT);
+        if (!isKeyFrame and m_units.empty())
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        if (isKeyFrame)
+        {
+            m_keyFrames[timestamp] = m_frontSeq + m_units.size();
+        }
+        gsize size = gst_buffer_get_size(pBuffer);
+        m_units.push_back({gst_buffer_ref(pBuffer), timestamp, size});
+        m_size += size;
+        
+        Trim();
+        
+        return GST_PAD_PROBE_OK;
+    }
+
+    //--------------------------------------------------------------------------------
+
     StreamEventPadProbeEventHandler::StreamEventPadProbeEventHandler(
         const char* name, dsl_pph_stream_event_handler_cb handler, void* clientData)
         : PadProbeEventHandler(name)
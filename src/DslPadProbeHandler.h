@@ -28,8 +28,12 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslBase.h"
+#include "DslDisplayTypes.h"
 #include "DslSourceMeter.h"
 
+#include <set>
+#include <atomic>
+
 
 namespace DSL
 {
@@ -67,6 +71,11 @@ namespace DSL
         std::shared_ptr<BufferTimeoutPadProbeHandler>(new BufferTimeoutPadProbeHandler( \
             name, timeout, handler, clientData))
 
+    #define DSL_PPH_ENCODED_CACHE_PTR std::shared_ptr<EncodedCachePadProbeHandler>
+    #define DSL_PPH_ENCODED_CACHE_NEW(name, duration, maxSize) \
+        std::shared_ptr<EncodedCachePadProbeHandler>( \
+            new EncodedCachePadProbeHandler(name, duration, maxSize))
+
     #define DSL_PPEH_STREAM_EVENT_PTR std::shared_ptr<StreamEventPadProbeEventHandler>
     #define DSL_PPEH_STREAM_EVENT_NEW(name, listener, clientData) \
         std::shared_ptr<StreamEventPadProbeEventHandler>( \
@@ -82,6 +91,12 @@ namespace DSL
         std::shared_ptr<EosHandlerPadProbeEventHandler>( \
             new EosHandlerPadProbeEventHandler(name, clientHandler, clientData))
 
+    #define DSL_PPH_FRAME_COUNTER_PTR std::shared_ptr \
+        <FrameCounterPadProbeBufferHandler>
+    #define DSL_PPH_FRAME_COUNTER_NEW(name) \
+        std::shared_ptr<FrameCounterPadProbeBufferHandler>( \
+            new FrameCounterPadProbeBufferHandler(name))
+
     #define DSL_PPH_FRAME_NUMBER_ADDER_PTR std::shared_ptr \
         <FrameNumberAdderPadProbeBufferHandler>
     #define DSL_PPH_FRAME_NUMBER_ADDER_NEW(name) \
@@ -509,6 +524,77 @@ namespace DSL
     
     //--------------------------------------------------------------------------------
 
+    /**
+     * @class FrameCounterPadProbeBufferHandler
+     * @brief Pad Probe Handler to count the frames in each batch processed.
+     * This PPH is added to the source pad of each Pipeline's Streammuxer to 
+     * measure the Pipeline's achieved frame rate. The count is updated with 
+     * a relaxed atomic operation only to avoid locking on the streaming thread.
+     */
+    class FrameCounterPadProbeBufferHandler : public PadProbeBufferHandler
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the Frame Counter Pad Probe Handler
+         * @param[in] name unique name for the PPH
+         */
+        FrameCounterPadProbeBufferHandler(const char* name);
+
+        /**
+         * @brief dtor for the Frame Counter Pad Probe Handler
+         */
+        ~FrameCounterPadProbeBufferHandler();
+        
+        /**
+         * @brief gets the total number of frames counted since creation.
+         * @return the current value of m_frameCount;
+         */
+        uint64_t GetFrameCount();
+
+        /**
+         * @brief Frame Counter Pad Probe Handler
+         * @param[in] pBuffer Pad buffer
+         * @return GstPadProbeReturn see GST reference, one of 
+         * [GST_PAD_PROBE_DROP, GST_PAD_PROBE_OK, GST_PAD_PROBE_REMOVE, 
+         * GST_PAD_PROBE_PASS, GST_PAD_PROBE_HANDLED]
+         */
+        GstPadProbeReturn HandlePadData(GstPadProbeInfo* pInfo);
+        
+    private:
+    
+        /**
+         * @brief total number of frames counted since creation.
+         */
+        std::atomic<uint64_t> m_frameCount;
+    };
+    
+    //--------------------------------------------------------------------------------
+
+    /**
+     * @brief Maximum number of ODE Triggers, in execution order, that can be
+     * pre-filtered by an ODE Pad Probe Handler. Additional Triggers see all objects.
+     */
+    #define DSL_ODE_PRE_FILTER_MAX_TRIGGERS                             64
+    
+    struct OdeStaticCriteria;
+    
+    /**
+     * @struct OdeObjectColumns
+     * @brief The Object meta fields tested by the ODE pre-filter, gathered 
+     * column-wise for all objects in a frame so that each Trigger's criteria
+     * can be tested with a single, branch-free pass over the frame's objects.
+     */
+    struct OdeObjectColumns
+    {
+        uint count;
+        int* classIds;
+        float* confidences;
+        float* trackerConfidences;
+        float* widths;
+        float* heights;
+    };
+    
     /**
      * @class OdePadProbeHandler
      * @brief Pad Probe Handler to Handle a collection ODE triggers
@@ -545,6 +631,18 @@ namespace DSL
          */
         void RemoveAllChildren();
         
+        /**
+         * @brief Replaces the complete set of child ODE Triggers with a new 
+         * set, built off to the side by the client. The new set is committed
+         * immediately, without waiting on the streaming thread, and is swapped
+         * in atomically between batches. Triggers in both sets are kept as is.
+         * New Triggers take over the state of removed Triggers with the same 
+         * identity.
+         * @param[in] triggers complete set of ODE Triggers in execution order.
+         * @return true on successful commit, false otherwise.
+         */
+        bool SwapChildren(const std::vector<DSL_BASE_PTR>& triggers);
+        
         /**
          * @brief Gets the current Display Meta Allocation per frame size.
          * @return the allocation size, default = 1
@@ -556,6 +654,34 @@ namespace DSL
          * @return the allocation size, default = 1
          */
         void SetDisplayMetaAllocSize(uint count);
+        
+        /**
+         * @brief Gets the current pre-filter enabled setting for this Handler.
+         * @return true if the pre-filter is enabled, default = false.
+         */
+        bool GetPreFilterEnabled();
+        
+        /**
+         * @brief Sets the pre-filter enabled setting for this Handler. When 
+         * enabled, the static criteria of all Triggers are tested once for 
+         * each object, ahead of the Triggers, and each Trigger is only called
+         * on to check the objects that pass its criteria.
+         * @param[in] enabled set to true to enable the pre-filter.
+         */
+        void SetPreFilterEnabled(bool enabled);
+        
+        /**
+         * @brief Tests the static criteria of a single Trigger for all objects 
+         * in a frame, setting the Trigger's bit in each passing object's mask.
+         * @param[in] criteria static criteria for the Trigger to test.
+         * @param[in] bit the Trigger's bit position in the object masks.
+         * @param[in] inferDone true if inference was done on the frame.
+         * @param[in] columns the frame's objects in column-wise form.
+         * @param[in,out] pMasks array of masks, one for each object.
+         */
+        static void PreFilterObjects(const OdeStaticCriteria& criteria, 
+            uint bit, bool inferDone, const OdeObjectColumns& columns, 
+            uint64_t* pMasks);
 
         /**
          * @brief ODE Pad Probe Handler
@@ -568,11 +694,42 @@ namespace DSL
         
     private:
     
+        /**
+         * @brief Adds the prebuilt StaticOverlay for the frame's source to 
+         * the frame's display meta, rebuilding the overlay first if stale.
+         * @param[in] displayMetaData vector of Display Meta acquired for the frame.
+         * @param[in] pFrameMeta frame meta for the frame being processed.
+         */
+        void AddStaticOverlay(std::vector<NvDsDisplayMeta*>& displayMetaData,
+            NvDsFrameMeta* pFrameMeta);
+    
+        /**
+         * @brief Swaps in the pending set of Triggers, if any, committed with 
+         * SwapChildren. Must be called with the m_padHandlerMutex held.
+         */
+        void ApplyPendingSwap();
+        
+        /**
+         * @brief Pre-filters all objects in a frame against the static 
+         * criteria of all Triggers. Allocated from the per-frame arena.
+         * @param[in] pFrameMeta frame meta for the frame being processed.
+         * @param[out] numObjects number of objects pre-filtered.
+         * @return array of masks, one for each object in list order, with bit 
+         * n set if the object is to be checked by the n-th Trigger. NULL if
+         * the frame has no objects.
+         */
+        uint64_t* PreFilterFrame(NvDsFrameMeta* pFrameMeta, uint& numObjects);
+    
         /**
          * @brief specifies how many Display Meta structures are allocated for each frame
          */
         uint m_displayMetaAllocSize;
         
+        /**
+         * @brief true if objects are pre-filtered ahead of the Triggers.
+         */
+        bool m_preFilterEnabled;
+        
         /**
          * @brief Index variable to incremment/assign on ODE Trigger add.
          */
@@ -583,6 +740,34 @@ namespace DSL
          */
         std::map <uint, DSL_BASE_PTR> m_pChildrenIndexed; 
         
+        /**
+         * @brief Map of prebuilt StaticOverlays indexed by unique source id.
+         */
+        std::map <uint, DSL_STATIC_OVERLAY_PTR> m_staticOverlays;
+        
+        /**
+         * @brief mutex to protect the pending swap. Never held by the 
+         * streaming thread while processing a batch.
+         */
+        DslMutex m_swapMutex;
+        
+        /**
+         * @brief true if a set of Triggers has been committed with SwapChildren
+         * and is waiting to be swapped in at the start of the next batch.
+         */
+        std::atomic<bool> m_swapPending;
+        
+        /**
+         * @brief pending set of Triggers indexed by execution order.
+         */
+        std::map <uint, DSL_BASE_PTR> m_pPendingChildrenIndexed; 
+        
+        /**
+         * @brief pending state take-overs, new Trigger and the removed 
+         * Trigger with the same identity.
+         */
+        std::vector<std::pair<DSL_BASE_PTR, DSL_BASE_PTR>> m_pendingTakeOvers;
+        
     };
     
     //--------------------------------------------------------------------------------
@@ -798,6 +983,158 @@ namespace DSL
      */
     static int buffer_timer_cb(gpointer pPph);
 
+    //--------------------------------------------------------------------------------
+
+    /**
+     * @class EncodedCachePadProbeHandler
+     * @brief Implements a pad-probe-handler that keeps a ring of references to 
+     * the last N seconds of parsed, encoded access units for a single source. 
+     * The buffers are held by reference only, so any number of readers can
+     * share one copy of the compressed data under one memory budget. Key-frames
+     * are indexed by timestamp for O(log n) seek to the nearest key-frame.
+     */
+    class EncodedCachePadProbeHandler : public PadProbeBufferHandler
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the EncodedCachePadProbeHandler.
+         * @param[in] name unique name for the EncodedCachePadProbeHandler.
+         * @param[in] duration maximum duration to cache in seconds, 0 = disabled.
+         * @param[in] maxSize memory budget for the cache in bytes, 0 = no limit.
+         */
+        EncodedCachePadProbeHandler(const char* name, 
+            uint duration, uint64_t maxSize);
+
+        /**
+         * @brief dtor for the EncodedCachePadProbeHandler.
+         */
+        ~EncodedCachePadProbeHandler();
+
+        /**
+         * @brief Gets the current cache settings.
+         * @param[out] duration maximum duration to cache in seconds.
+         * @param[out] maxSize memory budget for the cache in bytes.
+         */
+        void GetSettings(uint* duration, uint64_t* maxSize);
+
+        /**
+         * @brief Sets the cache settings, trimming the cache if required. The
+         * GOP of the newest key-frame is always kept, even if over budget.
+         * @param[in] duration maximum duration to cache in seconds, 0 = disabled.
+         * @param[in] maxSize memory budget for the cache in bytes, 0 = no limit.
+         */
+        void SetSettings(uint duration, uint64_t maxSize);
+
+        /**
+         * @brief Gets the current fill level of the cache.
+         * @param[out] duration duration of cached data in milliseconds.
+         * @param[out] size total size of all cached buffers in bytes.
+         */
+        void GetFillLevel(uint* duration, uint64_t* size);
+
+        /**
+         * @brief Gets references to all cached buffers starting at the nearest 
+         * key-frame at or before the last buffer's timestamp - duration.
+         * @param[in] duration duration of encoded data to get in seconds.
+         * @param[out] buffers vector of buffers to fill. The caller is 
+         * responsible for unreferencing each buffer when done.
+         * @return true if at least one key-frame was found, false otherwise.
+         */
+        bool GetBuffers(uint duration, std::vector<GstBuffer*>& buffers);
+
+        /**
+         * @brief Exports the last duration seconds of encoded data, starting at
+         * the nearest key-frame, to an elementary stream file. Length-prefixed
+         * H.264/H.265 NAL units are rewritten with start-codes.
+         * @param[in] duration duration of encoded data to export in seconds.
+         * @param[in] filePath absolute or relative path for the new file.
+         * @param[in] pCaps current caps for the cached buffers, may be NULL.
+         * @return true on successful export, false otherwise.
+         */
+        bool Export(uint duration, const char* filePath, GstCaps* pCaps);
+
+        /**
+         * @brief Unreferences all cached buffers.
+         */
+        void Clear();
+
+        /**
+         * @brief Encoded Cache Pad Probe Handler. Adds a reference to each
+         * buffer to the cache.
+         * @param[in] pBuffer Pad buffer
+         * @return GST_PAD_PROBE_OK always.
+         */
+        GstPadProbeReturn HandlePadData(GstPadProbeInfo* pInfo);
+
+    private:
+
+        /**
+         * @brief Removes the oldest GOPs from the cache until within the max
+         * duration and max size. The GOP of the newest key-frame is never 
+         * removed. Must be called with the handler mutex held.
+         */
+        void Trim();
+
+        /**
+         * @brief Frees all cached buffers and key-frame index entries. Must be
+         * called with the handler mutex held.
+         */
+        void ClearLocked();
+
+        /**
+         * @brief Writes the parameter sets (VPS/SPS/PPS) from avcC or hvcC 
+         * codec-data to an output stream with start-codes.
+         * @param[in] ofs output stream to write to.
+         * @param[in] data codec-data to parse.
+         * @param[in] size size of the codec-data in bytes.
+         * @param[in] isH265 true if hvcC, false if avcC.
+         * @return NAL unit length-prefix size in bytes, 0 if invalid.
+         */
+        uint WriteCodecData(std::ofstream& ofs, const guint8* data, 
+            gsize size, bool isH265);
+
+        /**
+         * @brief cached access unit - a buffer reference with its timestamp.
+         */
+        struct CachedUnit
+        {
+            GstBuffer* pBuffer;
+            GstClockTime timestamp;
+            gsize size;
+        };
+
+        /**
+         * @brief maximum duration to cache in seconds, 0 = disabled.
+         */
+        uint m_duration;
+
+        /**
+         * @brief memory budget for the cache in bytes, 0 = no limit.
+         */
+        uint64_t m_maxSize;
+
+        /**
+         * @brief total size of all cached buffers in bytes.
+         */
+        uint64_t m_size;
+
+        /**
+         * @brief ring of cached access units, oldest first.
+         */
+        std::deque<CachedUnit> m_units;
+
+        /**
+         * @brief absolute sequence number of the unit at the front of m_units.
+         */
+        uint64_t m_frontSeq;
+
+        /**
+         * @brief map of key-frame timestamps to absolute sequence number.
+         */
+        std::map<GstClockTime, uint64_t> m_keyFrames;
+    };
+
     //--------------------------------------------------------------------------------
     /**
      * @class PadProbetr
@@ -36,6 +36,7 @@ namespace DSL
         : BranchBintr(name, true)      // Pipeline = true
         , PipelineStateMgr(m_pGstObj)
         , PipelineBusSyncMgr(m_pGstObj)
+        , m_offlineEnabled(false)
     {
         LOG_FUNC();
 
@@ -62,6 +63,8 @@ namespace DSL
 
         // Add PipelineSourcesBintr as chid of this PipelineBintr.
         GstNodetr::AddChild(m_pPipelineSourcesBintr);
+        
+        m_pFileQueue = DSL_FILE_QUEUE_NEW(name);
     }
 
     PipelineBintr::~PipelineBintr()
@@ -375,6 +378,25 @@ namespace DSL
                 LOG_ERROR("Unable to prepare Pipeline '" << GetName() << "' for Play");
                 return false;
             }
+            if (m_offlineEnabled)
+            {
+                if (m_pPipelineSourcesBintr->StreammuxPlayTypeIsLiveGet())
+                {
+                    LOG_ERROR("Offline mode is not supported for Pipeline '" 
+                        << GetName() << "' with live Sources");
+                    return false;
+                }
+                // Run as fast as possible by playing without a clock. Sinks
+                // render each buffer as soon as it arrives.
+                gst_pipeline_use_clock(GST_PIPELINE(m_pGstObj), NULL);
+                
+                m_pFileQueue->ResetStats();
+                m_pPipelineSourcesBintr->SetFileQueue(m_pFileQueue);
+            }
+            else
+            {
+                gst_pipeline_auto_clock(GST_PIPELINE(m_pGstObj));
+            }
             // For non-live sources we Pause to preroll before we play
             if (!m_pPipelineSourcesBintr->StreammuxPlayTypeIsLiveGet())
             {
@@ -559,6 +581,27 @@ namespace DSL
         g_cond_signal(&m_asyncCommsCond);
     }
 
+    bool PipelineBintr::GetOfflineEnabled()
+    {
+        LOG_FUNC();
+        
+        return m_offlineEnabled;
+    }
+    
+    bool PipelineBintr::SetOfflineEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set offline mode for Pipeline '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        m_offlineEnabled = enabled;
+        return true;
+    }
+
     bool PipelineBintr::IsLive()
     {
         LOG_FUNC();
@@ -572,6 +615,16 @@ namespace DSL
         return m_pPipelineSourcesBintr->StreammuxPlayTypeIsLiveGet();
     }
     
+    void PipelineBintr::SetInferThrottleFactor(uint factor)
+    {
+        LOG_FUNC();
+        
+        for (auto const& imap: m_pPrimaryInferBintrs)
+        {
+            imap.second->SetThrottleFactor(factor);
+        }
+    }
+    
     void PipelineBintr::DumpToDot(char* filename)
     {
         LOG_FUNC();
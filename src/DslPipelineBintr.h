@@ -122,6 +122,27 @@ namespace DSL
             return m_pPipelineSourcesBintr->GetNumChildren();
         } 
         
+        /**
+         * @brief Gets the total number of frames batched by this Pipeline's
+         * Streammux since the Pipeline was created.
+         * @return total number of frames batched.
+         */
+        uint64_t GetFrameCount()
+        {
+            if (!m_pPipelineSourcesBintr)
+            {
+                return 0;
+            }
+            return m_pPipelineSourcesBintr->GetFrameCount();
+        }
+
+        /**
+         * @brief Sets the throttle factor for all Primary InferBintrs
+         * owned by this Pipeline. Called by the Pipeline Scheduler.
+         * @param[in] factor new throttle factor, 1 = no throttling.
+         */
+        void SetInferThrottleFactor(uint factor);
+
         /**
          * @brief removes a single Source Bintr from this Pipeline 
          * @param[in] pSourceBintr shared pointer to Source Bintr to add
@@ -136,6 +157,31 @@ namespace DSL
         {
             return m_pPipelineSourcesBintr;
         }
+        
+        /**
+         * @brief Gets the current offline mode enabled setting for this Pipeline.
+         * @return true if offline mode is enabled, false otherwise.
+         */
+        bool GetOfflineEnabled();
+        
+        /**
+         * @brief Sets the offline mode enabled setting for this Pipeline. When
+         * enabled, the Pipeline plays without a clock, and each File Source that
+         * reaches the end of its file is rebound to the next file in the 
+         * Pipeline's file queue. Can only be set when the Pipeline is not linked.
+         * @param[in] enabled set to true to enable, false to disable.
+         * @return true on successful set, false otherwise.
+         */
+        bool SetOfflineEnabled(bool enabled);
+        
+        /**
+         * @brief Returns the Pipeline's offline work queue of files.
+         * @return Shared pointer to the Pipeline's FileQueue.
+         */
+        DSL_FILE_QUEUE_PTR GetFileQueue()
+        {
+            return m_pFileQueue;
+        }
 
         /**
          * @brief Gets the current config-file in use by the Pipeline's Streammuxer.
@@ -355,6 +401,15 @@ namespace DSL
          */
         DSL_TILER_PTR m_pStreammuxTilerBintr;
         
+        /**
+         * @brief true if offline mode is enabled, false otherwise.
+         */
+        bool m_offlineEnabled;
+        
+        /**
+         * @brief offline work queue of files shared by all File Sources.
+         */
+        DSL_FILE_QUEUE_PTR m_pFileQueue;
         
     }; // Pipeline
     
@@ -0,0 +1,330 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslPipelineScheduler.h"
+
+namespace DSL
+{
+    PipelineScheduler* PipelineScheduler::m_pInstance = NULL;
+
+    PipelineScheduler* PipelineScheduler::GetScheduler()
+    {
+        // one time initialization of the single instance pointer
+        if (!m_pInstance)
+        {
+            LOG_INFO("PipelineScheduler Initialization");
+
+            // Single instantiation for the lib's lifetime
+            m_pInstance = new PipelineScheduler();
+        }
+        return m_pInstance;
+    }
+
+    PipelineScheduler::PipelineScheduler()
+        : m_period(DSL_PIPELINE_SCHEDULER_DEFAULT_PERIOD)
+        , m_timerId(0)
+        , m_surplusPeriods(0)
+    {
+        LOG_FUNC();
+    }
+
+    PipelineScheduler::~PipelineScheduler()
+    {
+        LOG_FUNC();
+
+        if (m_timerId)
+        {
+            g_source_remove(m_timerId);
+        }
+    }
+
+    void PipelineScheduler::AddPipeline(DSL_PIPELINE_PTR pPipeline,
+        uint priority, double targetFps)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+
+        auto ientry = m_entries.find(pPipeline->GetName());
+        if (ientry != m_entries.end())
+        {
+            // Already scheduled - update the schedule only.
+            ientry->second.priority = priority;
+            ientry->second.targetFps = targetFps;
+            return;
+        }
+        ScheduleEntry entry = {pPipeline, priority, targetFps, 0, false, 1,
+            pPipeline->GetFrameCount(), g_get_monotonic_time()};
+
+        m_entries[pPipeline->GetName()] = entry;
+
+        if (!m_timerId)
+        {
+            m_timerId = g_timeout_add(m_period,
+                PipelineSchedulerPeriodTimeoutHandler, this);
+        }
+    }
+
+    bool PipelineScheduler::RemovePipeline(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+
+        auto ientry = m_entries.find(name);
+        if (ientry == m_entries.end())
+        {
+            LOG_ERROR("Pipeline '" << name << "' is not scheduled");
+            return false;
+        }
+        SetThrottleFactor(ientry->second, 1);
+        m_entries.erase(ientry);
+
+        if (m_entries.empty() and m_timerId)
+        {
+            g_source_remove(m_timerId);
+            m_timerId = 0;
+        }
+        return true;
+    }
+
+    bool PipelineScheduler::IsScheduled(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+
+        return (m_entries.find(name) != m_entries.end());
+    }
+
+    bool PipelineScheduler::GetSchedule(const char* name, uint* priority,
+        double* targetFps)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+
+        auto ientry = m_entries.find(name);
+        if (ientry == m_entries.end())
+        {
+            LOG_ERROR("Pipeline '" << name << "' is not scheduled");
+            return false;
+        }
+        *priority = ientry->second.priority;
+        *targetFps = ientry->second.targetFps;
+        return true;
+    }
+
+    bool PipelineScheduler::GetStats(const char* name, double* achievedFps,
+        double* targetFps, uint* throttleFactor)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+
+        auto ientry = m_entries.find(name);
+        if (ientry == m_entries.end())
+        {
+            LOG_ERROR("Pipeline '" << name << "' is not scheduled");
+            return false;
+        }
+        *achievedFps = ientry->second.achievedFps;
+        *targetFps = ientry->second.targetFps;
+        *throttleFactor = ientry->second.throttleFactor;
+        return true;
+    }
+
+    uint PipelineScheduler::GetPeriod()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+
+        return m_period;
+    }
+
+    void PipelineScheduler::SetPeriod(uint period)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+
+        m_period = period;
+
+        if (m_timerId)
+        {
+            g_source_remove(m_timerId);
+            m_timerId = g_timeout_add(m_period,
+                PipelineSchedulerPeriodTimeoutHandler, this);
+        }
+    }
+
+    uint PipelineScheduler::GetNumPipelines()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+
+        return m_entries.size();
+    }
+
+    int PipelineScheduler::HandlePeriodTimeout()
+    {
+        // No function log - called on each period.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+
+        int64_t currentTime = g_get_monotonic_time();
+
+        for (auto& ientry: m_entries)
+        {
+            ScheduleEntry& entry = ientry.second;
+
+            GstState state;
+            entry.pPipeline->GetState(state, 0);
+            entry.isPlaying = (state == GST_STATE_PLAYING);
+
+            uint64_t frameCount = entry.pPipeline->GetFrameCount();
+
+            entry.achievedFps = 0;
+            if (entry.isPlaying and currentTime > entry.lastSampleTime and
+                frameCount >= entry.lastFrameCount)
+            {
+                entry.achievedFps = (double)(frameCount - entry.lastFrameCount) /
+                    ((double)(currentTime - entry.lastSampleTime) / G_USEC_PER_SEC);
+            }
+            entry.lastFrameCount = frameCount;
+            entry.lastSampleTime = currentTime;
+        }
+        Regulate();
+
+        return true;
+    }
+
+    void PipelineScheduler::Regulate()
+    {
+        // internal do not lock m_schedulerMutex
+
+        // Find the highest priority -- lowest value -- Pipeline in deficit,
+        // and the highest priority Pipeline currently throttled.
+        bool inDeficit(false);
+        uint deficitPriority(UINT32_MAX);
+        bool throttled(false);
+        uint relaxPriority(UINT32_MAX);
+
+        for (auto& ientry: m_entries)
+        {
+            ScheduleEntry& entry = ientry.second;
+
+            if (entry.isPlaying and entry.targetFps > 0 and
+                entry.achievedFps < entry.targetFps*(1-DSL_PIPELINE_SCHEDULER_TOLERANCE))
+            {
+                inDeficit = true;
+                deficitPriority = std::min(deficitPriority, entry.priority);
+            }
+            if (entry.throttleFactor > 1)
+            {
+                throttled = true;
+                relaxPriority = std::min(relaxPriority, entry.priority);
+            }
+        }
+        if (inDeficit)
+        {
+            // Throttle the lowest priority Pipelines, below the deficit
+            // priority, that can still be throttled further.
+            bool found(false);
+            uint throttlePriority(0);
+
+            for (auto& ientry: m_entries)
+            {
+                ScheduleEntry& entry = ientry.second;
+
+                if (entry.isPlaying and entry.priority > deficitPriority and
+                    entry.throttleFactor < DSL_PIPELINE_SCHEDULER_MAX_THROTTLE_FACTOR)
+                {
+                    found = true;
+                    throttlePriority = std::max(throttlePriority, entry.priority);
+                }
+            }
+            for (auto& ientry: m_entries)
+            {
+                ScheduleEntry& entry = ientry.second;
+
+                if (found and entry.isPlaying and 
+                    entry.priority == throttlePriority)
+                {
+                    SetThrottleFactor(entry, std::min(entry.throttleFactor*2,
+                        (uint)DSL_PIPELINE_SCHEDULER_MAX_THROTTLE_FACTOR));
+                }
+            }
+            // Throttling only helps Pipelines with a higher priority than
+            // those throttled. A deficit at, or below, the throttled 
+            // priorities -- e.g. a throttled Pipeline missing its own 
+            // target -- must not hold the throttles indefinitely.
+            if (deficitPriority < relaxPriority)
+            {
+                m_surplusPeriods = 0;
+                return;
+            }
+        }
+        if (!throttled)
+        {
+            m_surplusPeriods = 0;
+            return;
+        }
+
+        // Relax only after several consecutive periods without deficit
+        // to avoid oscillating at the boundary.
+        if (++m_surplusPeriods < DSL_PIPELINE_SCHEDULER_RELAX_PERIODS)
+        {
+            return;
+        }
+        m_surplusPeriods = 0;
+
+        // Relax the highest priority Pipelines that are currently throttled.
+        for (auto& ientry: m_entries)
+        {
+            ScheduleEntry& entry = ientry.second;
+
+            if (entry.throttleFactor > 1 and entry.priority == relaxPriority)
+            {
+                SetThrottleFactor(entry, entry.throttleFactor/2);
+            }
+        }
+    }
+
+    void PipelineScheduler::SetThrottleFactor(ScheduleEntry& entry, uint factor)
+    {
+        // internal do not lock m_schedulerMutex
+
+        if (entry.throttleFactor == factor)
+        {
+            return;
+        }
+        LOG_INFO("PipelineScheduler setting throttle-factor = " << factor
+            << " for Pipeline '" << entry.pPipeline->GetName()
+            << "' with achieved fps = " << entry.achievedFps);
+
+        entry.throttleFactor = factor;
+        entry.pPipeline->SetInferThrottleFactor(factor);
+    }
+
+    static int PipelineSchedulerPeriodTimeoutHandler(gpointer pScheduler)
+    {
+        return static_cast<PipelineScheduler*>(pScheduler)->
+            HandlePeriodTimeout();
+    }
+}
@@ -0,0 +1,225 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_PIPELINE_SCHEDULER_H
+#define _DSL_PIPELINE_SCHEDULER_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslPipelineBintr.h"
+
+namespace DSL
+{
+    /**
+     * @brief Maximum throttle factor the Scheduler will apply to a Pipeline.
+     */
+    #define DSL_PIPELINE_SCHEDULER_MAX_THROTTLE_FACTOR                  8
+
+    /**
+     * @brief Fraction of a Pipeline's target frame-rate it can fall below
+     * before it is considered to be in deficit.
+     */
+    #define DSL_PIPELINE_SCHEDULER_TOLERANCE                            0.05
+
+    /**
+     * @brief Number of consecutive periods without deficit before the
+     * Scheduler relaxes the next throttled Pipeline.
+     */
+    #define DSL_PIPELINE_SCHEDULER_RELAX_PERIODS                        3
+
+    /**
+     * @class PipelineScheduler
+     * @brief Process-wide singleton that enforces per-Pipeline priorities and
+     * frame-rate budgets when multiple Pipelines share the same GPU/CPU. The
+     * achieved frame-rate of each scheduled Pipeline is measured on each period.
+     * While a Pipeline is below its target, the Primary Inference of all lower
+     * priority Pipelines is throttled -- the lowest priority first -- by
+     * doubling its throttle factor. Once no Pipeline with a higher priority
+     * than the throttled Pipelines is in deficit, the throttled Pipelines are
+     * relaxed -- the highest priority first.
+     */
+    class PipelineScheduler
+    {
+    public:
+
+        /**
+         * @brief Returns a pointer to this singleton Scheduler
+         * @return instance pointer to the PipelineScheduler
+         */
+        static PipelineScheduler* GetScheduler();
+
+        /**
+         * @brief Ctor for this singleton PipelineScheduler class
+         */
+        PipelineScheduler();
+
+        /**
+         * @brief Dtor for this singleton PipelineScheduler class
+         */
+        ~PipelineScheduler();
+
+        /**
+         * @brief Adds a Pipeline to be scheduled, or updates the schedule
+         * of a Pipeline already scheduled. The Scheduler's timer is started
+         * on first add.
+         * @param[in] pPipeline Pipeline to schedule.
+         * @param[in] priority scheduling priority, 0 = highest.
+         * @param[in] targetFps target frame-rate in frames per second
+         * for all sources combined. 0 = best effort, never in deficit.
+         */
+        void AddPipeline(DSL_PIPELINE_PTR pPipeline, uint priority,
+            double targetFps);
+
+        /**
+         * @brief Removes a Pipeline from the Scheduler restoring the Pipeline's
+         * throttle factor. The Scheduler's timer is stopped on last remove.
+         * @param[in] name unique name of the Pipeline to remove.
+         * @return true on successful remove, false if not scheduled.
+         */
+        bool RemovePipeline(const char* name);
+
+        /**
+         * @brief Checks if a Pipeline is currently scheduled, without logging
+         * an error if not.
+         * @param[in] name unique name of the Pipeline to check.
+         * @return true if scheduled, false otherwise.
+         */
+        bool IsScheduled(const char* name);
+
+        /**
+         * @brief Gets the current schedule for a Pipeline.
+         * @param[in] name unique name of the Pipeline to query.
+         * @param[out] priority current scheduling priority.
+         * @param[out] targetFps current target frame-rate.
+         * @return true on successful query, false if not scheduled.
+         */
+        bool GetSchedule(const char* name, uint* priority, double* targetFps);
+
+        /**
+         * @brief Gets the current stats for a scheduled Pipeline.
+         * @param[in] name unique name of the Pipeline to query.
+         * @param[out] achievedFps frame-rate achieved over the last period.
+         * @param[out] targetFps current target frame-rate.
+         * @param[out] throttleFactor current throttle factor, 1 = none.
+         * @return true on successful query, false if not scheduled.
+         */
+        bool GetStats(const char* name, double* achievedFps,
+            double* targetFps, uint* throttleFactor);
+
+        /**
+         * @brief Gets the current scheduling period.
+         * @return current period in milliseconds.
+         */
+        uint GetPeriod();
+
+        /**
+         * @brief Sets the scheduling period, restarting the Scheduler's
+         * timer if running.
+         * @param[in] period new period in milliseconds.
+         */
+        void SetPeriod(uint period);
+
+        /**
+         * @brief Gets the number of Pipelines currently scheduled.
+         * @return current number of scheduled Pipelines.
+         */
+        uint GetNumPipelines();
+
+        /**
+         * @brief Handles the Scheduler's period timer expiration by measuring
+         * the achieved frame-rate of each Pipeline and then regulating.
+         * @return true to continue, false to self remove the timer.
+         */
+        int HandlePeriodTimeout();
+
+    private:
+
+        /**
+         * @brief Regulates the throttle factors of all scheduled Pipelines
+         * based on the achieved frame-rates from the last measurement.
+         */
+        void Regulate();
+
+        /**
+         * @brief current schedule, measurement and throttle for a Pipeline
+         */
+        struct ScheduleEntry
+        {
+            DSL_PIPELINE_PTR pPipeline;
+            uint priority;
+            double targetFps;
+            double achievedFps;
+            bool isPlaying;
+            uint throttleFactor;
+            uint64_t lastFrameCount;
+            int64_t lastSampleTime;
+        };
+
+        /**
+         * @brief Sets the throttle factor for a Pipeline's entry.
+         * @param[in] entry entry to update.
+         * @param[in] factor new throttle factor.
+         */
+        void SetThrottleFactor(ScheduleEntry& entry, uint factor);
+
+        /**
+         * @brief instance pointer for this singleton class
+         */
+        static PipelineScheduler* m_pInstance;
+
+        /**
+         * @brief mutex to protect mutual access to the scheduler
+         */
+        DslMutex m_schedulerMutex;
+
+        /**
+         * @brief map of Pipeline names to their schedule entries.
+         */
+        std::map<std::string, ScheduleEntry> m_entries;
+
+        /**
+         * @brief scheduling period in milliseconds.
+         */
+        uint m_period;
+
+        /**
+         * @brief gnome timer id for the period timer, 0 when not running.
+         */
+        uint m_timerId;
+
+        /**
+         * @brief number of consecutive periods without deficit.
+         */
+        uint m_surplusPeriods;
+    };
+
+    /**
+     * @brief Called by the main-loop on expiration of the Scheduler's period.
+     * @param[in] pScheduler pointer to the PipelineScheduler.
+     * @return true to continue, false to self remove the timer.
+     */
+    static int PipelineSchedulerPeriodTimeoutHandler(gpointer pScheduler);
+}
+
+#endif // _DSL_PIPELINE_SCHEDULER_H
@@ -107,6 +107,11 @@ namespace DSL
         // Add the Buffer and DS Event Probes to the Streammuxer - src-pad only.
         AddSrcPadProbes(m_pStreammux->GetGstElement());
         
+        // Add the frame-counter to measure the Pipeline's achieved frame-rate.
+        std::string counterName = GetName() + "-frame-counter";
+        m_pFrameCounter = DSL_PPH_FRAME_COUNTER_NEW(counterName.c_str());
+        m_pSrcPadBufferProbe->AddPadProbeHandler(m_pFrameCounter);
+        
         // If the unqiue pipeline-id is greater than 0, then we need to add the
         // SourceIdOffsetterPadProbeHandler to offset every source-id found in
         // the frame-metadata produced by the streammux plugin. 
@@ -606,6 +611,20 @@ namespace DSL
         }
     }
 
+    void PipelineSourcesBintr::SetFileQueue(DSL_FILE_QUEUE_PTR pFileQueue)
+    {
+        LOG_FUNC();
+        
+        for (auto const& imap: m_pChildSources)
+        {
+            if (imap.second->IsType(typeid(FileSourceBintr)))
+            {
+                std::dynamic_pointer_cast<FileSourceBintr>(imap.second)->
+                    SetFileQueue(pFileQueue);
+            }
+        }
+    }
+
     void PipelineSourcesBintr::GetStreammuxBatchProperties(uint* batchSize, 
         int* batchTimeout)
     {
@@ -77,6 +77,18 @@ namespace DSL
             return m_pChildSources.size();
         }
 
+        /**
+         * @brief Gets the total number of frames batched by the Streammux
+         * since this PipelineSourcesBintr was created.
+         * @return total number of frames batched.
+         */
+        uint64_t GetFrameCount()
+        {
+            // No function log - called periodically by the Pipeline Scheduler.
+            
+            return m_pFrameCounter->GetFrameCount();
+        }
+
         /**
          * @brief interates through the list of child source bintrs setting 
          * their Sensor Id's and linking to the Streammux
@@ -198,6 +210,13 @@ namespace DSL
          */
         void DisableEosConsumers();
 
+        /**
+         * @brief Sets the shared offline work queue of files for all child
+         * File Sources.
+         * @param[in] pFileQueue shared file queue, nullptr to clear.
+         */
+        void SetFileQueue(DSL_FILE_QUEUE_PTR pFileQueue);
+
         /** 
          * @brief Returns the state of the USE_NEW_NVSTREAMMUX env var.
          * @return true if USE_NEW_NVSTREAMMUX=yes, false otherwise.
@@ -324,6 +343,12 @@ namespace DSL
          */
         DSL_PPH_SOURCE_ID_OFFSETTER_PTR m_pSourceIdOffsetter;
 
+        /**
+         * @brief Pad Probe Handler to count the frames batched by the Streammux
+         * for this PipelineSourcesBintr.
+         */
+        DSL_PPH_FRAME_COUNTER_PTR m_pFrameCounter;
+
 
         DSL_ELEMENT_PTR m_pStreammux;
         
@@ -242,6 +242,9 @@ namespace DSL
         DisplayTypeDeleteAll();
         MailerDeleteAll();
         MessageBrokerDeleteAll();
+        
+        // Free all released elements held for reuse by the Element Pool
+        ElementPool::GetPool()->Clear();
     }
    
     // ------------------------------------------------------------------------------
@@ -341,6 +344,7 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_SOURCE_ELEMENT_ADD_FAILED] = L"DSL_RESULT_SOURCE_ELEMENT_ADD_FAILED";
         m_returnValueToString[DSL_RESULT_SOURCE_ELEMENT_REMOVE_FAILED] = L"DSL_RESULT_SOURCE_ELEMENT_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_SOURCE_ELEMENT_NOT_IN_USE] = L"DSL_RESULT_SOURCE_ELEMENT_NOT_IN_USE";
+        m_returnValueToString[DSL_RESULT_SOURCE_EXPORT_FAILED] = L"DSL_RESULT_SOURCE_EXPORT_FAILED";
 
         m_returnValueToString[DSL_RESULT_DEWARPER_NAME_NOT_UNIQUE] = L"DSL_RESULT_DEWARPER_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_DEWARPER_NAME_NOT_FOUND] = L"DSL_RESULT_DEWARPER_NAME_NOT_FOUND";
@@ -434,6 +438,8 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_ODE_ACCUMULATOR_ACTION_ADD_FAILED] = L"DSL_RESULT_ODE_ACCUMULATOR_ACTION_ADD_FAILED";
         m_returnValueToString[DSL_RESULT_ODE_ACCUMULATOR_ACTION_REMOVE_FAILED] = L"DSL_RESULT_ODE_ACCUMULATOR_ACTION_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_ODE_ACCUMULATOR_ACTION_NOT_IN_USE] = L"DSL_RESULT_ODE_ACCUMULATOR_ACTION_NOT_IN_USE";
+        m_returnValueToString[DSL_RESULT_ODE_ACCUMULATOR_NOT_THE_CORRECT_TYPE] = L"DSL_RESULT_ODE_ACCUMULATOR_NOT_THE_CORRECT_TYPE";
+        m_returnValueToString[DSL_RESULT_ODE_ACCUMULATOR_STATS_NOT_AVAILABLE] = L"DSL_RESULT_ODE_ACCUMULATOR_STATS_NOT_AVAILABLE";
 
         m_returnValueToString[DSL_RESULT_ODE_HEAT_MAPPER_NAME_NOT_UNIQUE] = L"DSL_RESULT_ODE_HEAT_MAPPER_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_ODE_HEAT_MAPPER_NAME_NOT_FOUND] = L"DSL_RESULT_ODE_HEAT_MAPPER_NAME_NOT_FOUND";
@@ -335,6 +335,18 @@ namespace DSL {
 
         DslReturnType OdeActionEnabledSet(const char* name, boolean enabled);
 
+        DslReturnType OdeActionDedupGet(const char* name, 
+            boolean* enabled, uint* window, boolean* fanIn);
+
+        DslReturnType OdeActionDedupSet(const char* name, 
+            boolean enabled, uint window, boolean fanIn);
+
+        DslReturnType OdeActionSummaryGet(const char* name, 
+            uint* interval, uint* samples);
+
+        DslReturnType OdeActionSummarySet(const char* name, 
+            uint interval, uint samples);
+
         DslReturnType OdeActionEnabledStateChangeListenerAdd(const char* name,
             dsl_ode_enabled_state_change_listener_cb listener, void* clientData);
 
@@ -443,6 +455,12 @@ namespace DSL {
         DslReturnType OdeTriggerPersistenceRangeSet(const char* name, 
             uint minimum, uint maximum);
 
+        DslReturnType OdeTriggerSpeedRangeGet(const char* name, 
+            float* minimum, float* maximum);
+        
+        DslReturnType OdeTriggerSpeedRangeSet(const char* name, 
+            float minimum, float maximum);
+
         DslReturnType OdeTriggerEarliestNew(const char* name, 
             const char* source, uint classId, uint limit);
             
@@ -461,6 +479,12 @@ namespace DSL {
         DslReturnType OdeTriggerCrossViewSettingsSet(const char* name, 
             boolean enabled, const char* color, uint lineWidth);
         
+        DslReturnType OdeTriggerCrossViewLodSettingsGet(const char* name, 
+            uint* tolerance, uint* maxTraces);
+            
+        DslReturnType OdeTriggerCrossViewLodSettingsSet(const char* name, 
+            uint tolerance, uint maxTraces);
+        
         DslReturnType OdeTriggerReset(const char* name);
 
         DslReturnType OdeTriggerResetTimeoutGet(const char* name, uint* timeout);
@@ -487,6 +511,10 @@ namespace DSL {
         
         DslReturnType OdeTriggerSourceSet(const char* name, const char* source);
         
+        DslReturnType OdeTriggerSourceAdd(const char* name, const char* source);
+        
+        DslReturnType OdeTriggerSourceRemove(const char* name, const char* source);
+        
         DslReturnType OdeTriggerInferGet(const char* name, const char** infer);
         
         DslReturnType OdeTriggerInferSet(const char* name, const char* infer);
@@ -495,6 +523,10 @@ namespace DSL {
         
         DslReturnType OdeTriggerClassIdSet(const char* name, uint classId);
         
+        DslReturnType OdeTriggerClassIdMaskGet(const char* name, uint64_t* classIdMask);
+        
+        DslReturnType OdeTriggerClassIdMaskSet(const char* name, uint64_t classIdMask);
+        
         DslReturnType OdeTriggerClassIdABGet(const char* name, 
             uint* classIdA, uint* classIdB);
         
@@ -591,6 +623,20 @@ namespace DSL {
 
         DslReturnType OdeAccumulatorNew(const char* name);
 
+        DslReturnType OdeAccumulatorStatsNew(const char* name, 
+            uint window, uint slide);
+
+        DslReturnType OdeAccumulatorStatsWindowGet(const char* name, 
+            uint* window, uint* slide);
+
+        DslReturnType OdeAccumulatorStatsWindowSet(const char* name, 
+            uint window, uint slide);
+
+        DslReturnType OdeAccumulatorStatsGet(const char* name, 
+            uint sourceId, uint classId, uint metric, dsl_ode_stats* stats);
+
+        DslReturnType OdeAccumulatorStatsClear(const char* name);
+
         DslReturnType OdeAccumulatorActionAdd(const char* name, const char* action);
 
         DslReturnType OdeAccumulatorActionRemove(const char* name, const char* action);
@@ -653,11 +699,18 @@ namespace DSL {
         DslReturnType PphOdeTriggerRemove(const char* name, const char* trigger);
 
         DslReturnType PphOdeTriggerRemoveAll(const char* name);
+
+        DslReturnType PphOdeTriggerSwap(const char* name, 
+            const std::vector<std::string>& triggers);
         
         DslReturnType PphOdeDisplayMetaAllocSizeGet(const char* name, uint* size);
 
         DslReturnType PphOdeDisplayMetaAllocSizeSet(const char* name, uint size);
 
+        DslReturnType PphOdePreFilterEnabledGet(const char* name, boolean* enabled);
+
+        DslReturnType PphOdePreFilterEnabledSet(const char* name, boolean enabled);
+
         DslReturnType PphBufferTimeoutNew(const char* name,
             uint timeout, dsl_pph_buffer_timeout_handler_cb handler, void* clientData);
     
@@ -666,6 +719,22 @@ namespace DSL {
     
         DslReturnType PphStreamEventNew(const char* name,
             dsl_pph_stream_event_handler_cb handler, void* clientData);
+
+        DslReturnType PphMetaStreamNew(const char* name, const char* path,
+            uint keyFrameInterval, uint maxRate);
+
+        DslReturnType PphMetaStreamKeyFrameIntervalGet(const char* name, 
+            uint* keyFrameInterval);
+
+        DslReturnType PphMetaStreamKeyFrameIntervalSet(const char* name, 
+            uint keyFrameInterval);
+
+        DslReturnType PphMetaStreamMaxRateGet(const char* name, uint* maxRate);
+
+        DslReturnType PphMetaStreamMaxRateSet(const char* name, uint maxRate);
+
+        DslReturnType PphMetaStreamStatsGet(const char* name, 
+            uint* clients, uint64_t* sent, uint64_t* dropped);
     
         DslReturnType PphEnabledGet(const char* name, boolean* enabled);
         
@@ -900,6 +969,20 @@ namespace DSL {
         DslReturnType SourceInterpipeAcceptSettingsSet(const char* name,
             boolean acceptEos, boolean acceptEvents);
             
+        DslReturnType SourceSharedNew(const char* name, const char* uri,
+            boolean isLive);
+
+        DslReturnType SourceSharedSettingsGet(const char* name,
+            uint* queueSize, uint* maxRate);
+
+        DslReturnType SourceSharedSettingsSet(const char* name,
+            uint queueSize, uint maxRate);
+
+        DslReturnType SourceSharedStatsGet(const char* name,
+            uint64_t* received, uint64_t* dropped, uint64_t* delivered);
+
+        DslReturnType SourceSharedDecoderCountGet(uint* count);
+            
         DslReturnType SourceRtspNew(const char* name, const char* uri, uint protocol, 
             uint skipFrames, uint dropFrameInterval, uint latency, uint timeout);
 
@@ -936,6 +1019,9 @@ namespace DSL {
         DslReturnType SourceVideoBufferOutFrameRateSet(const char* name, 
             uint fps_n, uint fps_d);
 
+        DslReturnType SourceVideoBufferOutStatsGet(const char* name, 
+            uint64_t* received, uint64_t* dropped, uint64_t* converted);
+
         DslReturnType SourceVideoBufferOutCropRectangleGet(const char* name, 
             uint cropAt, uint* left, uint* top, uint* width, uint* height);
 
@@ -959,6 +1045,10 @@ namespace DSL {
         DslReturnType SourceUriUriGet(const char* name, const char** uri);
 
         DslReturnType SourceUriUriSet(const char* name, const char* uri);
+
+        DslReturnType SourceUriKeyFrameScanGet(const char* name, uint* interval);
+
+        DslReturnType SourceUriKeyFrameScanSet(const char* name, uint interval);
     
         DslReturnType SourceRtspUriGet(const char* name, const char** uri);
 
@@ -1013,6 +1103,15 @@ namespace DSL {
     
         DslReturnType SourceRtspTapRemove(const char* name);
         
+        DslReturnType SourceRtspEncodedCacheSettingsGet(const char* name, 
+            uint* duration, uint64_t* maxSize);
+        
+        DslReturnType SourceRtspEncodedCacheSettingsSet(const char* name, 
+            uint duration, uint64_t maxSize);
+        
+        DslReturnType SourceRtspEncodedCacheExport(const char* name, 
+            uint duration, const char* filePath);
+        
         DslReturnType SourceUniqueIdGet(const char* name, int* uniqueId);
     
         DslReturnType SourceStreamIdGet(const char* name, int* streamId);
@@ -1600,6 +1699,17 @@ namespace DSL {
         DslReturnType SinkFrameCaptureSchedule(const char* name,
             uint64_t frameNumber);
             
+        DslReturnType SinkFrameCaptureRequest(const char* name,
+            uint64_t frameNumber, uint outputType, uint timeout,
+            dsl_sink_frame_capture_complete_cb clientHandler, void* clientData,
+            uint64_t* requestId);
+            
+        DslReturnType SinkFrameCaptureWorkersGet(const char* name,
+            uint* workers);
+            
+        DslReturnType SinkFrameCaptureWorkersSet(const char* name,
+            uint workers);
+            
         DslReturnType SinkWebRtcNew(const char* name, const char* stunServer, 
             const char* turnServer, uint encoder, uint bitrate, uint iframeInterval);
 
@@ -1885,6 +1995,41 @@ namespace DSL {
         
         DslReturnType PipelineLinkMethodSet(const char* name, uint linkMethod);
         
+        DslReturnType PipelineOfflineEnabledGet(const char* name, boolean* enabled);
+        
+        DslReturnType PipelineOfflineEnabledSet(const char* name, boolean enabled);
+        
+        DslReturnType PipelineOfflineFileQueueAdd(const char* name, 
+            const std::vector<std::string>& filePaths);
+        
+        DslReturnType PipelineOfflineFileQueueSizeGet(const char* name, uint* size);
+        
+        DslReturnType PipelineOfflineFileQueueClear(const char* name);
+        
+        DslReturnType PipelineOfflineStatsGet(const char* name, 
+            uint* filesCompleted, uint64_t* framesProcessed, double* framesPerSecond);
+        
+        DslReturnType PipelineOfflineFileCompleteListenerAdd(const char* name, 
+            dsl_file_complete_listener_cb listener, void* clientData);
+        
+        DslReturnType PipelineOfflineFileCompleteListenerRemove(const char* name, 
+            dsl_file_complete_listener_cb listener);
+        
+        DslReturnType PipelineScheduleSet(const char* name, 
+            uint priority, double targetFps);
+        
+        DslReturnType PipelineScheduleGet(const char* name, 
+            uint* priority, double* targetFps);
+        
+        DslReturnType PipelineScheduleRemove(const char* name);
+        
+        DslReturnType PipelineScheduleStatsGet(const char* name, 
+            double* achievedFps, double* targetFps, uint* throttleFactor);
+        
+        DslReturnType PipelineSchedulerPeriodGet(uint* period);
+        
+        DslReturnType PipelineSchedulerPeriodSet(uint period);
+        
         DslReturnType PipelinePause(const char* name);
         
         DslReturnType PipelinePlay(const char* name);
@@ -2103,6 +2248,29 @@ namespace DSL {
         
         DslReturnType InfoLogFunctionRestore();
         
+        DslReturnType InfoElementPoolMaxSizeGet(uint* maxSize);
+        
+        DslReturnType InfoElementPoolMaxSizeSet(uint maxSize);
+        
+        DslReturnType InfoMediaInfoGet(const char* filePath, 
+            dsl_media_info* info);
+        
+        DslReturnType InfoMediaProbeAsync(const std::vector<std::string>& filePaths,
+            dsl_info_media_probe_handler_cb clientHandler, void* clientData);
+        
+        DslReturnType InfoMediaProbeWorkersGet(uint* workers);
+        
+        DslReturnType InfoMediaProbeWorkersSet(uint workers);
+        
+        DslReturnType InfoMediaInfoCacheClear();
+
+        DslReturnType InfoMemoryStatsGet(uint tag, dsl_memory_stats* stats);
+
+        DslReturnType InfoMemoryStatsReset(uint tag);
+
+        DslReturnType InfoOdeCountersGet(dsl_ode_counter_info** counters, 
+            uint* size);
+        
         FILE* InfoLogFileHandleGet();
 
         GMainLoop* GetMainLoopHandle()
@@ -2230,6 +2398,13 @@ namespace DSL {
          */
         std::map <std::string, DSL_ODE_TRIGGER_PTR> m_odeTriggers;
         
+        /**
+         * @brief last snapshot of all ODE counters returned to the client,
+         * with the wide-string names referenced by the snapshot.
+         */
+        std::vector<dsl_ode_counter_info> m_odeCounters;
+        std::vector<std::wstring> m_odeCounterNames;
+        
         /**
          * @brief map of all ODE Handlers created by the client, key=name
          */
@@ -25,6 +25,9 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslServices.h"
+#include "DslElementPool.h"
+#include "DslMediaInfoCache.h"
+#include "DslMemoryTracker.h"
 
 namespace DSL
 {
@@ -353,6 +356,268 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::InfoElementPoolMaxSizeGet(uint* maxSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            *maxSize = ElementPool::GetPool()->GetMaxSize();
+
+            LOG_INFO("Element Pool max-size = " << *maxSize);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception getting Element Pool max-size");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::InfoElementPoolMaxSizeSet(uint maxSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            ElementPool::GetPool()->SetMaxSize(maxSize);
+
+            LOG_INFO("Element Pool max-size set to " << maxSize);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception setting Element Pool max-size");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::InfoMediaInfoGet(const char* filePath, 
+        dsl_media_info* info)
+    {
+        LOG_FUNC();
+        
+        // Note: the services mutex is not held while probing. The cache is 
+        // thread-safe, and probing a file must not block other services.
+        try
+        {
+            std::ifstream mediaFile(filePath);
+            if (!mediaFile.good())
+            {
+                LOG_ERROR("Media file '" << filePath << "' Not found");
+                return DSL_RESULT_SOURCE_FILE_NOT_FOUND;
+            }
+            if (!MediaInfoCache::GetCache()->Probe(filePath, *info))
+            {
+                LOG_ERROR("Failed to probe media file '" << filePath << "'");
+                return DSL_RESULT_FAILURE;
+            }
+            LOG_INFO("Media file '" << filePath << "' dimensions = " 
+                << info->width << "x" << info->height << " frame-rate = " 
+                << info->fps_n << "/" << info->fps_d);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception getting media info for file '"
+                << filePath << "'");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::InfoMediaProbeAsync(
+        const std::vector<std::string>& filePaths,
+        dsl_info_media_probe_handler_cb clientHandler, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            if (!MediaInfoCache::GetCache()->ProbeAsync(filePaths, 
+                clientHandler, clientData))
+            {
+                LOG_ERROR("Failed to queue " << filePaths.size() 
+                    << " media files for probing");
+                return DSL_RESULT_FAILURE;
+            }
+            LOG_INFO("Queued " << filePaths.size() 
+                << " media files for probing successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception queuing media files for probing");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::InfoMediaProbeWorkersGet(uint* workers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            *workers = MediaInfoCache::GetCache()->GetWorkers();
+
+            LOG_INFO("Media probe workers = " << *workers);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception getting media probe workers");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::InfoMediaProbeWorkersSet(uint workers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            if (!MediaInfoCache::GetCache()->SetWorkers(workers))
+            {
+                LOG_ERROR("Failed to set media probe workers = " << workers);
+                return DSL_RESULT_INVALID_INPUT_PARAM;
+            }
+            LOG_INFO("Media probe workers set to " << workers);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception setting media probe workers");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::InfoMediaInfoCacheClear()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            MediaInfoCache::GetCache()->Clear();
+
+            LOG_INFO("Media info cache cleared successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception clearing the media info cache");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::InfoMemoryStatsGet(uint tag, dsl_memory_stats* stats)
+    {
+        LOG_FUNC();
+
+        // Note: the services mutex is not held. The tracker's counters are
+        // atomic, and querying must not block other services.
+        try
+        {
+            if (!MemoryTracker::GetStats(tag, stats))
+            {
+                LOG_ERROR("Failed to get memory stats for tag = " << tag);
+                return DSL_RESULT_INVALID_INPUT_PARAM;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception getting memory stats");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::InfoMemoryStatsReset(uint tag)
+    {
+        LOG_FUNC();
+
+        try
+        {
+            if (!MemoryTracker::ResetStats(tag))
+            {
+                LOG_ERROR("Failed to reset memory stats for tag = " << tag);
+                return DSL_RESULT_INVALID_INPUT_PARAM;
+            }
+            LOG_INFO("Memory stats reset for tag = " << tag);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception resetting memory stats");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::InfoOdeCountersGet(dsl_ode_counter_info** counters, 
+        uint* size)
+    {
+        LOG_FUNC();
+        
+        // Note: the services mutex protects the component maps and the 
+        // snapshot only. The counters are read with relaxed atomic loads, 
+        // without locking any component, so that ODE evaluation is never 
+        // blocked by the query.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            m_odeCounters.clear();
+            m_odeCounterNames.clear();
+            
+            // Reserve all names up front so that the name pointers added to
+            // the snapshot remain valid.
+            m_odeCounterNames.reserve(1 + m_odeTriggers.size() + 
+                m_odeActions.size() + m_odeAccumulators.size());
+            
+            m_odeCounterNames.push_back(L"global");
+            m_odeCounters.push_back({m_odeCounterNames.back().c_str(),
+                DSL_ODE_COUNTER_TYPE_GLOBAL, OdeTrigger::s_eventCount, 0, 0});
+            
+            for (auto const& imap: m_odeTriggers)
+            {
+                m_odeCounterNames.push_back(
+                    std::wstring(imap.first.begin(), imap.first.end()));
+                m_odeCounters.push_back({m_odeCounterNames.back().c_str(),
+                    DSL_ODE_COUNTER_TYPE_TRIGGER, imap.second->m_triggered,
+                    imap.second->m_frameCount, imap.second->m_occurrencesTotal});
+            }
+            for (auto const& imap: m_odeActions)
+            {
+                m_odeCounterNames.push_back(
+                    std::wstring(imap.first.begin(), imap.first.end()));
+                m_odeCounters.push_back({m_odeCounterNames.back().c_str(),
+                    DSL_ODE_COUNTER_TYPE_ACTION, imap.second->m_invocations,
+                    0, imap.second->m_duplicates});
+            }
+            for (auto const& imap: m_odeAccumulators)
+            {
+                m_odeCounterNames.push_back(
+                    std::wstring(imap.first.begin(), imap.first.end()));
+                m_odeCounters.push_back({m_odeCounterNames.back().c_str(),
+                    DSL_ODE_COUNTER_TYPE_ACCUMULATOR, 
+                    imap.second->m_accumulations, 0, 0});
+            }
+            *counters = m_odeCounters.data();
+            *size = m_odeCounters.size();
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception getting the ODE counters");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
     static void gst_debug_log_override(GstDebugCategory * category, GstDebugLevel level,
         const gchar * file, const gchar * function, gint line,
         GObject * object, GstDebugMessage * message, gpointer unused)
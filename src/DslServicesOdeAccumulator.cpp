@@ -59,6 +59,179 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::OdeAccumulatorStatsNew(const char* name, 
+        uint window, uint slide)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure Accumulator name uniqueness 
+            if (m_odeAccumulators.find(name) != m_odeAccumulators.end())
+            {   
+                LOG_ERROR("ODE Accumulator name '" << name 
+                    << "' is not unique");
+                return DSL_RESULT_ODE_ACCUMULATOR_NAME_NOT_UNIQUE;
+            }
+            uint slideFrames = (slide) ? slide : window;
+            if (!window or window % slideFrames or 
+                window/slideFrames > DSL_ODE_STATS_MAX_PANES)
+            {
+                LOG_ERROR("Invalid window = " << window << " and slide = " 
+                    << slide << " for new ODE Stats Accumulator '" << name << "'");
+                return DSL_RESULT_ODE_ACCUMULATOR_SET_FAILED;
+            }
+            m_odeAccumulators[name] = DSL_ODE_STATS_ACCUMULATOR_NEW(name,
+                window, slide);
+            
+            LOG_INFO("New ODE Stats Accumulator '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New ODE Stats Accumulator '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_ODE_ACCUMULATOR_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeAccumulatorStatsWindowGet(const char* name, 
+        uint* window, uint* slide)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACCUMULATOR_NAME_NOT_FOUND(m_odeAccumulators, name);
+            DSL_RETURN_IF_ODE_ACCUMULATOR_IS_NOT_CORRECT_TYPE(m_odeAccumulators, 
+                name, StatsOdeAccumulator);
+
+            DSL_ODE_STATS_ACCUMULATOR_PTR pOdeAccumulator = 
+                std::dynamic_pointer_cast<StatsOdeAccumulator>(
+                    m_odeAccumulators[name]);
+         
+            pOdeAccumulator->GetWindowSettings(window, slide);
+            
+            LOG_INFO("ODE Stats Accumulator '" << name << "' returned window = "
+                << *window << " and slide = " << *slide << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Stats Accumulator '" << name 
+                << "' threw exception getting window settings");
+            return DSL_RESULT_ODE_ACCUMULATOR_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeAccumulatorStatsWindowSet(const char* name, 
+        uint window, uint slide)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACCUMULATOR_NAME_NOT_FOUND(m_odeAccumulators, name);
+            DSL_RETURN_IF_ODE_ACCUMULATOR_IS_NOT_CORRECT_TYPE(m_odeAccumulators, 
+                name, StatsOdeAccumulator);
+
+            DSL_ODE_STATS_ACCUMULATOR_PTR pOdeAccumulator = 
+                std::dynamic_pointer_cast<StatsOdeAccumulator>(
+                    m_odeAccumulators[name]);
+         
+            if (!pOdeAccumulator->SetWindowSettings(window, slide))
+            {
+                LOG_ERROR("ODE Stats Accumulator '" << name 
+                    << "' failed to set window settings");
+                return DSL_RESULT_ODE_ACCUMULATOR_SET_FAILED;
+            }
+            LOG_INFO("ODE Stats Accumulator '" << name << "' set window = "
+                << window << " and slide = " << slide << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Stats Accumulator '" << name 
+                << "' threw exception setting window settings");
+            return DSL_RESULT_ODE_ACCUMULATOR_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeAccumulatorStatsGet(const char* name, 
+        uint sourceId, uint classId, uint metric, dsl_ode_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACCUMULATOR_NAME_NOT_FOUND(m_odeAccumulators, name);
+            DSL_RETURN_IF_ODE_ACCUMULATOR_IS_NOT_CORRECT_TYPE(m_odeAccumulators, 
+                name, StatsOdeAccumulator);
+
+            if (metric > DSL_ODE_STATS_METRIC_HEIGHT)
+            {
+                LOG_ERROR("Invalid stats metric = " << metric 
+                    << " for ODE Stats Accumulator '" << name << "'");
+                return DSL_RESULT_INVALID_INPUT_PARAM;
+            }
+            DSL_ODE_STATS_ACCUMULATOR_PTR pOdeAccumulator = 
+                std::dynamic_pointer_cast<StatsOdeAccumulator>(
+                    m_odeAccumulators[name]);
+         
+            if (!pOdeAccumulator->GetStats(sourceId, classId, metric, stats))
+            {
+                return DSL_RESULT_ODE_ACCUMULATOR_STATS_NOT_AVAILABLE;
+            }
+            LOG_INFO("ODE Stats Accumulator '" << name 
+                << "' returned stats for source = " << sourceId 
+                << ", class = " << classId << ", and metric = " << metric 
+                << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Stats Accumulator '" << name 
+                << "' threw exception getting stats");
+            return DSL_RESULT_ODE_ACCUMULATOR_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeAccumulatorStatsClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACCUMULATOR_NAME_NOT_FOUND(m_odeAccumulators, name);
+            DSL_RETURN_IF_ODE_ACCUMULATOR_IS_NOT_CORRECT_TYPE(m_odeAccumulators, 
+                name, StatsOdeAccumulator);
+
+            std::dynamic_pointer_cast<StatsOdeAccumulator>(
+                m_odeAccumulators[name])->ClearStats();
+            
+            LOG_INFO("ODE Stats Accumulator '" << name 
+                << "' cleared stats successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Stats Accumulator '" << name 
+                << "' threw exception clearing stats");
+            return DSL_RESULT_ODE_ACCUMULATOR_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::OdeAccumulatorActionAdd(const char* name, 
         const char* action)
     {
@@ -2195,6 +2195,125 @@ namespace DSL
         }
     }                
 
+    DslReturnType Services::OdeActionDedupGet(const char* name, 
+        boolean* enabled, uint* window, boolean* fanIn)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(m_odeActions[name]);
+         
+            bool bEnabled(false), bFanIn(false);
+            pOdeAction->GetDedupSettings(&bEnabled, window, &bFanIn);
+            *enabled = bEnabled;
+            *fanIn = bFanIn;
+
+            LOG_INFO("ODE Action '" << name << "' returned De-dup Enabled = " 
+                << *enabled << ", Window = " << *window << "ms, Fan-in = " 
+                << *fanIn << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name 
+                << "' threw exception getting De-dup settings");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeActionDedupSet(const char* name, 
+        boolean enabled, uint window, boolean fanIn)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(m_odeActions[name]);
+         
+            pOdeAction->SetDedupSettings(enabled, window, fanIn);
+
+            LOG_INFO("ODE Action '" << name << "' set De-dup Enabled = " 
+                << enabled << ", Window = " << window << "ms, Fan-in = " 
+                << fanIn << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name 
+                << "' threw exception setting De-dup settings");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeActionSummaryGet(const char* name, 
+        uint* interval, uint* samples)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            DSL_RETURN_IF_ODE_ACTION_IS_NOT_SUMMARY_TYPE(m_odeActions, name);
+            
+            DSL_ODE_ACTION_SUMMARY_PTR pOdeAction = 
+                std::dynamic_pointer_cast<SummaryOdeAction>(m_odeActions[name]);
+         
+            pOdeAction->GetSummarySettings(interval, samples);
+
+            LOG_INFO("ODE Action '" << name << "' returned Summary Interval = " 
+                << *interval << "ms, Samples = " << *samples << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name 
+                << "' threw exception getting Summary settings");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeActionSummarySet(const char* name, 
+        uint interval, uint samples)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            DSL_RETURN_IF_ODE_ACTION_IS_NOT_SUMMARY_TYPE(m_odeActions, name);
+            
+            DSL_ODE_ACTION_SUMMARY_PTR pOdeAction = 
+                std::dynamic_pointer_cast<SummaryOdeAction>(m_odeActions[name]);
+         
+            pOdeAction->SetSummarySettings(interval, samples);
+
+            LOG_INFO("ODE Action '" << name << "' set Summary Interval = " 
+                << interval << "ms, Samples = " << samples << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name 
+                << "' threw exception setting Summary settings");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
     DslReturnType Services::OdeActionEnabledStateChangeListenerAdd(const char* name,
         dsl_ode_enabled_state_change_listener_cb listener, void* clientData)
     {
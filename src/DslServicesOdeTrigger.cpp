@@ -855,6 +855,66 @@ namespace DSL
             return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
         }
     }                
+    
+    DslReturnType Services::OdeTriggerCrossViewLodSettingsGet(const char* name, 
+        uint* tolerance, uint* maxTraces)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                CrossOdeTrigger);
+            
+            DSL_ODE_TRIGGER_CROSS_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<CrossOdeTrigger>(m_odeTriggers[name]);
+
+            pOdeTrigger->GetViewLodSettings(tolerance, maxTraces);
+
+            LOG_INFO("ODE Track Trigger '" << name 
+                << "' returned view LOD settings successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Track Trigger '" << name 
+                << "' threw exception getting view LOD settings");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerCrossViewLodSettingsSet(const char* name, 
+        uint tolerance, uint maxTraces)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                CrossOdeTrigger);
+            
+            DSL_ODE_TRIGGER_CROSS_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<CrossOdeTrigger>(m_odeTriggers[name]);
+
+            pOdeTrigger->SetViewLodSettings(tolerance, maxTraces);
+
+            LOG_INFO("ODE Track Trigger '" << name 
+                << "' set view LOD settings successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Track Trigger '" << name 
+                << "' threw exception setting view LOD settings");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
 
     DslReturnType Services::OdeTriggerPersistenceNew(const char* name, const char* source, 
         uint classId, uint limit, uint minimum, uint maximum)
@@ -949,6 +1009,67 @@ namespace DSL
         }
     }                
 
+    DslReturnType Services::OdeTriggerSpeedRangeGet(const char* name, 
+        float* minimum, float* maximum)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_ODE_TRIGGER_IS_NOT_TRACK_TYPE(m_odeTriggers, name);
+            
+            DSL_ODE_TRACKING_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<TrackingOdeTrigger>(m_odeTriggers[name]);
+
+            pOdeTrigger->GetSpeedRange(minimum, maximum);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Tracking Trigger '" << name 
+                << "' threw exception getting speed range");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerSpeedRangeSet(const char* name, 
+        float minimum, float maximum)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_ODE_TRIGGER_IS_NOT_TRACK_TYPE(m_odeTriggers, name);
+            
+            if (minimum < 0 or maximum < 0 or (maximum and minimum > maximum))
+            {
+                LOG_ERROR("Invalid speed range minimum = " << minimum 
+                    << " maximum = " << maximum << " for ODE Tracking Trigger '"
+                    << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_SET_FAILED;
+            }
+            DSL_ODE_TRACKING_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<TrackingOdeTrigger>(m_odeTriggers[name]);
+
+            pOdeTrigger->SetSpeedRange(minimum, maximum);
+            
+            LOG_INFO("ODE Tracking Trigger '" << name << "' set new speed range from mimimum " 
+                << minimum << " to maximum " << maximum << " successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Tracking Trigger '" << name 
+                << "' threw exception setting speed range");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
     DslReturnType Services::OdeTriggerLatestNew(const char* name, 
         const char* source, uint classId, uint limit)
     {
@@ -1317,6 +1438,68 @@ namespace DSL
         }
     }                
 
+    DslReturnType Services::OdeTriggerSourceAdd(const char* name, const char* source)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+
+            if (!pOdeTrigger->AddSource(source))
+            {
+                LOG_ERROR("ODE Trigger '" << name 
+                    << "' failed to add Source '" << source << "'");
+                return DSL_RESULT_ODE_TRIGGER_SET_FAILED;
+            }
+            LOG_INFO("Trigger '" << name << "' added Source = " 
+                << source << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception adding source name");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerSourceRemove(const char* name, const char* source)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+
+            if (!pOdeTrigger->RemoveSource(source))
+            {
+                LOG_ERROR("ODE Trigger '" << name 
+                    << "' failed to remove Source '" << source << "'");
+                return DSL_RESULT_ODE_TRIGGER_SET_FAILED;
+            }
+            LOG_INFO("Trigger '" << name << "' removed Source = " 
+                << source << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception removing source name");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
     DslReturnType Services::OdeTriggerInferGet(const char* name, const char** infer)
     {
         LOG_FUNC();
@@ -1425,6 +1608,62 @@ namespace DSL
         }
     }                
 
+    DslReturnType Services::OdeTriggerClassIdMaskGet(const char* name, 
+        uint64_t* classIdMask)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            *classIdMask = pOdeTrigger->GetClassIdMask();
+            
+            LOG_INFO("Trigger '" << name << "' returned Class Id mask = " 
+                << std::hex << *classIdMask << std::dec << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception getting class id mask");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerClassIdMaskSet(const char* name, 
+        uint64_t classIdMask)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            pOdeTrigger->SetClassIdMask(classIdMask);
+            
+            LOG_INFO("Trigger '" << name << "' set Class Id mask = " 
+                << std::hex << classIdMask << std::dec << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception setting class id mask");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
     DslReturnType Services::OdeTriggerClassIdABGet(const char* name, 
         uint* classIdA, uint* classIdB)
     {
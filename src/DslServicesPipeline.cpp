@@ -27,6 +27,7 @@ THE SOFTWARE.
 #include "DslServices.h"
 #include "DslServicesValidate.h"
 #include "DslPipelineBintr.h"
+#include "DslPipelineScheduler.h"
 
 namespace DSL
 {
@@ -64,6 +65,10 @@ namespace DSL
             
             DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
 
+            if (PipelineScheduler::GetScheduler()->IsScheduled(name))
+            {
+                PipelineScheduler::GetScheduler()->RemovePipeline(name);
+            }
             m_pipelines[name]->RemoveAllChildren();
             m_pipelines.erase(name);
 
@@ -88,6 +93,12 @@ namespace DSL
         {
             for (auto &imap: m_pipelines)
             {
+                if (PipelineScheduler::GetScheduler()->IsScheduled(
+                    imap.first.c_str()))
+                {
+                    PipelineScheduler::GetScheduler()->RemovePipeline(
+                        imap.first.c_str());
+                }
                 imap.second->RemoveAllChildren();
                 imap.second = nullptr;
             }
@@ -1002,6 +1013,380 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::PipelineOfflineEnabledGet(const char* name, 
+        boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+            
+            *enabled = m_pipelines[name]->GetOfflineEnabled();
+
+            LOG_INFO("Pipeline '" << name 
+                << "' returned offline enabled = " << *enabled << " successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception getting offline enabled");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PipelineOfflineEnabledSet(const char* name, 
+        boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+            
+            if (!m_pipelines[name]->SetOfflineEnabled(enabled))
+            {
+                LOG_ERROR("Pipeline '" << name 
+                    << "' failed to set offline enabled = " << enabled);
+                return DSL_RESULT_PIPELINE_SET_FAILED;
+            }
+            LOG_INFO("Pipeline '" << name 
+                << "' set offline enabled = " << enabled << " successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception setting offline enabled");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PipelineOfflineFileQueueAdd(const char* name, 
+        const std::vector<std::string>& filePaths)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+            
+            // Check all files first so that the add is all or nothing.
+            for (auto const& ivec: filePaths)
+            {
+                std::ifstream mediaFile(ivec);
+                if (!mediaFile.good())
+                {
+                    LOG_ERROR("File '" << ivec << "' Not found");
+                    return DSL_RESULT_SOURCE_FILE_NOT_FOUND;
+                }
+            }
+            for (auto const& ivec: filePaths)
+            {
+                m_pipelines[name]->GetFileQueue()->Push(ivec);
+            }
+            LOG_INFO("Pipeline '" << name << "' added " << filePaths.size()
+                << " files to its offline file queue successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception adding to its offline file queue");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PipelineOfflineFileQueueSizeGet(const char* name, 
+        uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+            
+            *size = m_pipelines[name]->GetFileQueue()->GetSize();
+
+            LOG_INFO("Pipeline '" << name 
+                << "' returned offline file queue size = " << *size 
+                << " successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception getting offline file queue size");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PipelineOfflineFileQueueClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+            
+            m_pipelines[name]->GetFileQueue()->Clear();
+
+            LOG_INFO("Pipeline '" << name 
+                << "' cleared its offline file queue successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception clearing its offline file queue");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PipelineOfflineStatsGet(const char* name, 
+        uint* filesCompleted, uint64_t* framesProcessed, double* framesPerSecond)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+            
+            m_pipelines[name]->GetFileQueue()->GetStats(filesCompleted,
+                framesProcessed, framesPerSecond);
+
+            LOG_INFO("Pipeline '" << name 
+                << "' returned offline stats: files-completed = " 
+                << *filesCompleted << ", frames-processed = " << *framesProcessed
+                << ", frames-per-second = " << *framesPerSecond << " successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception getting offline stats");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PipelineOfflineFileCompleteListenerAdd(const char* name, 
+        dsl_file_complete_listener_cb listener, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+            
+            if (!m_pipelines[name]->GetFileQueue()->AddCompleteListener(
+                listener, clientData))
+            {
+                LOG_ERROR("Pipeline '" << name 
+                    << "' failed to add a File Complete Listener");
+                return DSL_RESULT_PIPELINE_CALLBACK_ADD_FAILED;
+            }
+            LOG_INFO("Pipeline '" << name 
+                << "' added File Complete Listener successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception adding a File Complete Listener");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PipelineOfflineFileCompleteListenerRemove(
+        const char* name, dsl_file_complete_listener_cb listener)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+            
+            if (!m_pipelines[name]->GetFileQueue()->RemoveCompleteListener(listener))
+            {
+                LOG_ERROR("Pipeline '" << name 
+                    << "' failed to remove a File Complete Listener");
+                return DSL_RESULT_PIPELINE_CALLBACK_REMOVE_FAILED;
+            }
+            LOG_INFO("Pipeline '" << name 
+                << "' removed File Complete Listener successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception removing a File Complete Listener");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PipelineScheduleSet(const char* name, 
+        uint priority, double targetFps)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+            
+            if (targetFps < 0)
+            {
+                LOG_ERROR("Invalid target-fps = " << targetFps 
+                    << " for Pipeline '" << name << "'");
+                return DSL_RESULT_PIPELINE_SET_FAILED;
+            }
+            PipelineScheduler::GetScheduler()->AddPipeline(m_pipelines[name], 
+                priority, targetFps);
+
+            LOG_INFO("Pipeline '" << name << "' set schedule with priority = " 
+                << priority << " and target-fps = " << targetFps << " successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception setting its schedule");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PipelineScheduleGet(const char* name, 
+        uint* priority, double* targetFps)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+            
+            if (!PipelineScheduler::GetScheduler()->GetSchedule(name, 
+                priority, targetFps))
+            {
+                LOG_ERROR("Pipeline '" << name 
+                    << "' failed to get its schedule - not scheduled");
+                return DSL_RESULT_PIPELINE_GET_FAILED;
+            }
+            LOG_INFO("Pipeline '" << name << "' returned priority = " 
+                << *priority << " and target-fps = " << *targetFps 
+                << " successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception getting its schedule");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PipelineScheduleRemove(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+            
+            if (!PipelineScheduler::GetScheduler()->RemovePipeline(name))
+            {
+                LOG_ERROR("Pipeline '" << name 
+                    << "' failed to remove its schedule - not scheduled");
+                return DSL_RESULT_PIPELINE_SET_FAILED;
+            }
+            LOG_INFO("Pipeline '" << name << "' removed its schedule successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception removing its schedule");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PipelineScheduleStatsGet(const char* name, 
+        double* achievedFps, double* targetFps, uint* throttleFactor)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+            
+            if (!PipelineScheduler::GetScheduler()->GetStats(name, 
+                achievedFps, targetFps, throttleFactor))
+            {
+                LOG_ERROR("Pipeline '" << name 
+                    << "' failed to get its schedule stats - not scheduled");
+                return DSL_RESULT_PIPELINE_GET_FAILED;
+            }
+            LOG_INFO("Pipeline '" << name << "' returned achieved-fps = " 
+                << *achievedFps << ", target-fps = " << *targetFps 
+                << ", and throttle-factor = " << *throttleFactor << " successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception getting its schedule stats");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PipelineSchedulerPeriodGet(uint* period)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            *period = PipelineScheduler::GetScheduler()->GetPeriod();
+
+            LOG_INFO("Pipeline Scheduler returned period = " 
+                << *period << " successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline Scheduler threw an exception getting its period");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PipelineSchedulerPeriodSet(uint period)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            if (!period)
+            {
+                LOG_ERROR("Invalid period = 0 for the Pipeline Scheduler");
+                return DSL_RESULT_PIPELINE_SET_FAILED;
+            }
+            PipelineScheduler::GetScheduler()->SetPeriod(period);
+
+            LOG_INFO("Pipeline Scheduler set period = " 
+                << period << " successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline Scheduler threw an exception setting its period");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::PipelinePause(const char* name)
     {
         LOG_FUNC();
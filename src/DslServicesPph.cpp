@@ -309,6 +309,59 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::PphOdeTriggerSwap(const char* name, 
+        const std::vector<std::string>& triggers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+            
+            std::vector<DSL_BASE_PTR> odeTriggers;
+            for (auto const& itrigger: triggers)
+            {
+                DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, 
+                    itrigger.c_str());
+
+                // Can't add Triggers if they're In use by another Handler
+                if (m_odeTriggers[itrigger]->IsInUse() and 
+                    !m_odeTriggers[itrigger]->IsParent(m_padProbeHandlers[name]))
+                {
+                    LOG_ERROR("Unable to swap in ODE Trigger '" << itrigger 
+                        << "' as it is currently in use");
+                    return DSL_RESULT_ODE_TRIGGER_IN_USE;
+                }
+                odeTriggers.push_back(m_odeTriggers[itrigger]);
+            }
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+
+            if (!pOde->SwapChildren(odeTriggers))
+            {
+                LOG_ERROR("ODE Pad Probe Handler '" << name
+                    << "' failed to swap in a new set of ODE Triggers");
+                return DSL_RESULT_PPH_SET_FAILED;
+            }
+            LOG_INFO("A new set of " << triggers.size() 
+                << " ODE Triggers was committed to ODE Pad Probe Handler '" 
+                << name << "' successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name
+                << "' threw exception swapping ODE Triggers");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::PphOdeDisplayMetaAllocSizeGet(const char* name, 
         uint* size)
     {
@@ -372,6 +425,69 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::PphOdePreFilterEnabledGet(const char* name, 
+        boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+            
+            *enabled = pOde->GetPreFilterEnabled();
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' returned pre-filter enabled = " << *enabled 
+                << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception getting pre-filter enabled");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdePreFilterEnabledSet(const char* name, 
+        boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+            
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]); 
+
+            pOde->SetPreFilterEnabled(enabled);
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' set pre-filter enabled = " << enabled << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception setting pre-filter enabled");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::PphBufferTimeoutNew(const char* name,
         uint timeout, dsl_pph_buffer_timeout_handler_cb handler, void* clientData)
     {
@@ -3094,6 +3094,121 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::SinkFrameCaptureRequest(const char* name,
+        uint64_t frameNumber, uint outputType, uint timeout,
+        dsl_sink_frame_capture_complete_cb clientHandler, void* clientData,
+        uint64_t* requestId)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, 
+                name, FrameCaptureSinkBintr);
+
+            if (outputType > DSL_FRAME_CAPTURE_OUTPUT_BUFFER)
+            {
+                LOG_ERROR("Invalid output type = " << outputType 
+                    << " for Frame-Capture Sink '" << name << "'");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            if (outputType == DSL_FRAME_CAPTURE_OUTPUT_BUFFER and !clientHandler)
+            {
+                LOG_ERROR("A client handler is required for buffer output with "
+                    << "Frame-Capture Sink '" << name << "'");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+
+            DSL_FRAME_CAPTURE_SINK_PTR pFrameCaptureSink = 
+                std::dynamic_pointer_cast<FrameCaptureSinkBintr>(m_components[name]);
+
+            if (!pFrameCaptureSink->Request(frameNumber, outputType, timeout,
+                clientHandler, clientData, requestId))
+            {
+                LOG_ERROR("Frame-Capture Sink '" << name 
+                    << "' failed to add a frame-capture request");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            LOG_INFO("Frame-Capture Sink '" << name 
+                << "' added frame-capture request-id = "
+                << *requestId << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Frame-Capture Sink '" << name 
+                << "' threw an exception adding a frame-capture request");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkFrameCaptureWorkersGet(const char* name,
+        uint* workers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, 
+                name, FrameCaptureSinkBintr);
+
+            DSL_FRAME_CAPTURE_SINK_PTR pFrameCaptureSink = 
+                std::dynamic_pointer_cast<FrameCaptureSinkBintr>(m_components[name]);
+
+            *workers = pFrameCaptureSink->GetWorkers();
+
+            LOG_INFO("Frame-Capture Sink '" << name << "' returned workers = "
+                << *workers << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Frame-Capture Sink '" << name 
+                << "' threw an exception getting workers");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkFrameCaptureWorkersSet(const char* name,
+        uint workers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, 
+                name, FrameCaptureSinkBintr);
+
+            DSL_FRAME_CAPTURE_SINK_PTR pFrameCaptureSink = 
+                std::dynamic_pointer_cast<FrameCaptureSinkBintr>(m_components[name]);
+
+            if (!pFrameCaptureSink->SetWorkers(workers))
+            {
+                LOG_ERROR("Frame-Capture Sink '" << name 
+                    << "' failed to set workers = " << workers);
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            LOG_INFO("Frame-Capture Sink '" << name << "' set workers = "
+                << workers << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Frame-Capture Sink '" << name 
+                << "' threw an exception setting workers");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::SinkV4l2New(const char* name, 
         const char* deviceLocation)
     {
@@ -28,6 +28,7 @@ THE SOFTWARE.
 #include "DslServices.h"
 #include "DslServicesValidate.h"
 #include "DslSourceBintr.h"
+#include "DslSourceRegistry.h"
 
 namespace DSL
 {
@@ -1847,6 +1848,154 @@ namespace DSL
         }
     }
     
+    DslReturnType Services::SourceSharedNew(const char* name, 
+        const char* uri, boolean isLive)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Source name '" << name << "' is not unique");
+                return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+            }
+            m_components[name] = DSL_SHARED_SOURCE_NEW(name, uri, isLive);
+
+            LOG_INFO("New Shared Source '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Shared Source '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceSharedSettingsGet(const char* name,
+        uint* queueSize, uint* maxRate)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                SharedSourceBintr);
+
+            DSL_SHARED_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<SharedSourceBintr>(m_components[name]);
+         
+            pSourceBintr->GetSharedSettings(queueSize, maxRate);
+
+            LOG_INFO("Shared Source '" << name << "' returned queue-size = " 
+                << *queueSize << ", max-rate = " << *maxRate 
+                << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Shared Source '" << name 
+                << "' threw exception getting shared settings");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::SourceSharedSettingsSet(const char* name,
+        uint queueSize, uint maxRate)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                SharedSourceBintr);
+
+            DSL_SHARED_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<SharedSourceBintr>(m_components[name]);
+         
+            if (!pSourceBintr->SetSharedSettings(queueSize, maxRate))
+            {
+                LOG_ERROR("Shared Source '" << name 
+                    << "' failed to set shared settings");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+
+            LOG_INFO("Shared Source '" << name << "' set queue-size = " 
+                << queueSize << ", max-rate = " << maxRate 
+                << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Shared Source '" << name 
+                << "' threw exception setting shared settings");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::SourceSharedStatsGet(const char* name,
+        uint64_t* received, uint64_t* dropped, uint64_t* delivered)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                SharedSourceBintr);
+
+            DSL_SHARED_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<SharedSourceBintr>(m_components[name]);
+         
+            pSourceBintr->GetSharedStats(received, dropped, delivered);
+
+            LOG_INFO("Shared Source '" << name << "' returned received = " 
+                << *received << ", dropped = " << *dropped 
+                << ", and delivered = " << *delivered << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Shared Source '" << name 
+                << "' threw exception getting shared stats");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::SourceSharedDecoderCountGet(uint* count)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            *count = SourceRegistry::GetRegistry()->GetNumDecoders();
+
+            LOG_INFO("Source Registry returned shared decoder count = " 
+                << *count << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Source Registry threw exception getting decoder count");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+    
     DslReturnType Services::SourceRtspNew(const char* name, const char* uri,  uint protocol, 
        uint skipFrames, uint dropFrameInterval, uint latency, uint timeout)
     {
@@ -2315,6 +2464,37 @@ namespace DSL
         }
     }                
 
+    DslReturnType Services::SourceVideoBufferOutStatsGet(const char* name, 
+        uint64_t* received, uint64_t* dropped, uint64_t* converted)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
+            
+            DSL_VIDEO_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<VideoSourceBintr>(m_components[name]);
+         
+            pSourceBintr->GetBufferOutStats(received, dropped, converted);
+
+            LOG_INFO("Source '" << name << "' returned received = " 
+                << *received << ", dropped = " << *dropped 
+                << ", and converted = " << *converted
+                << " for buffer-out-stats successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Source '" << name 
+                << "' threw exception getting buffer-out-stats");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }                
+
     DslReturnType Services::SourceVideoBufferOutCropRectangleGet(const char* name, 
         uint cropAt, uint* left, uint* top, uint* width, uint* height)
     {
@@ -2580,6 +2760,68 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::SourceUriKeyFrameScanGet(const char* name, 
+        uint* interval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_URI_SOURCE(m_components, name);
+
+            DSL_URI_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<UriSourceBintr>(m_components[name]);
+
+            *interval = pSourceBintr->GetKeyFrameScanInterval();
+
+            LOG_INFO("URI Source '" << name << "' returned key-frame scan interval = " 
+                << *interval << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("URI Source '" << name 
+                << "' threw exception getting key-frame scan interval");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceUriKeyFrameScanSet(const char* name, 
+        uint interval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_URI_SOURCE(m_components, name);
+
+            DSL_URI_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<UriSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->SetKeyFrameScanInterval(interval))
+            {
+                LOG_ERROR("Failed to set key-frame scan interval = " 
+                    << interval << " for URI Source '" << name << "'");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+            LOG_INFO("URI Source '" << name << "' set key-frame scan interval = " 
+                << interval << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("URI Source '" << name 
+                << "' threw exception setting key-frame scan interval");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::SourceRtspUriGet(const char* name, const char** uri)
     {
         LOG_FUNC();
@@ -3288,6 +3530,111 @@ namespace DSL
             return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
+
+    DslReturnType Services::SourceRtspEncodedCacheSettingsGet(const char* name, 
+        uint* duration, uint64_t* maxSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, 
+                name, RtspSourceBintr);   
+
+            DSL_RTSP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
+
+            pSourceBintr->GetEncodedCacheSettings(duration, maxSize);
+
+            LOG_INFO("RTSP Source '" << name 
+                << "' returned encoded-cache duration = " << *duration 
+                << " and max-size = " << *maxSize << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("RTSP Source '" << name 
+                << "' threw exception getting encoded-cache settings");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+        
+    DslReturnType Services::SourceRtspEncodedCacheSettingsSet(const char* name, 
+        uint duration, uint64_t maxSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, 
+                name, RtspSourceBintr);   
+
+            DSL_RTSP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->SetEncodedCacheSettings(duration, maxSize))
+            {
+                LOG_ERROR("RTSP Source '" << name 
+                    << "' failed to set encoded-cache settings");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+
+            LOG_INFO("RTSP Source '" << name 
+                << "' set encoded-cache duration = " << duration 
+                << " and max-size = " << maxSize << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("RTSP Source '" << name 
+                << "' threw exception setting encoded-cache settings");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+        
+    DslReturnType Services::SourceRtspEncodedCacheExport(const char* name, 
+        uint duration, const char* filePath)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, 
+                name, RtspSourceBintr);   
+
+            DSL_RTSP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->ExportEncodedCache(duration, filePath))
+            {
+                LOG_ERROR("RTSP Source '" << name 
+                    << "' failed to export encoded-cache to file '" 
+                    << filePath << "'");
+                return DSL_RESULT_SOURCE_EXPORT_FAILED;
+            }
+
+            LOG_INFO("RTSP Source '" << name 
+                << "' exported last " << duration 
+                << " seconds of encoded-cache to file '" << filePath 
+                << "' successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("RTSP Source '" << name 
+                << "' threw exception exporting encoded-cache");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
     
     DslReturnType Services::SourceUniqueIdGet(const char* name, int* uniqueId)
     {
@@ -64,6 +64,16 @@ THE SOFTWARE.
     } \
 }while(0); 
 
+#define DSL_RETURN_IF_ODE_ACTION_IS_NOT_SUMMARY_TYPE(actions, name) do \
+{ \
+    if (!actions[name]->IsType(typeid(PrintOdeAction)) and \
+        !actions[name]->IsType(typeid(LogOdeAction)))\
+    { \
+        LOG_ERROR("ODE Action '" << name << "' is not the correct type"); \
+        return DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE; \
+    } \
+}while(0); 
+
 #define DSL_RETURN_IF_ODE_ACCUMULATOR_NAME_NOT_FOUND(events, name) do \
 { \
     if (events.find(name) == events.end()) \
@@ -73,6 +83,15 @@ THE SOFTWARE.
     } \
 }while(0); 
 
+#define DSL_RETURN_IF_ODE_ACCUMULATOR_IS_NOT_CORRECT_TYPE(events, name, accumulator) do \
+{ \
+    if (!events[name]->IsType(typeid(accumulator)))\
+    { \
+        LOG_ERROR("ODE Accumulator '" << name << "' is not the correct type"); \
+        return DSL_RESULT_ODE_ACCUMULATOR_NOT_THE_CORRECT_TYPE; \
+    } \
+}while(0); 
+
 #define DSL_RETURN_IF_ODE_HEAT_MAPPER_NAME_NOT_FOUND(events, name) do \
 { \
     if (events.find(name) == events.end()) \
@@ -101,6 +120,19 @@ THE SOFTWARE.
     } \
 }while(0); 
 
+#define DSL_RETURN_IF_ODE_TRIGGER_IS_NOT_TRACK_TYPE(components, name) do \
+{ \
+    if (!components[name]->IsType(typeid(CrossOdeTrigger)) and  \
+        !components[name]->IsType(typeid(InstanceOdeTrigger)) and  \
+        !components[name]->IsType(typeid(PersistenceOdeTrigger)) and  \
+        !components[name]->IsType(typeid(LatestOdeTrigger)) and  \
+        !components[name]->IsType(typeid(EarliestOdeTrigger))) \
+    { \
+        LOG_ERROR("Component '" << name << "' is not a Tracking ODE Trigger"); \
+        return DSL_RESULT_ODE_TRIGGER_IS_NOT_TRACK_TRIGGER; \
+    } \
+}while(0); 
+
 #define DSL_RETURN_IF_BRANCH_NAME_NOT_FOUND(branches, name) do \
 { \
     if (branches.find(name) == branches.end()) \
@@ -213,6 +245,16 @@ THE SOFTWARE.
     } \
 }while(0); 
 
+#define DSL_RETURN_IF_COMPONENT_IS_NOT_URI_SOURCE(components, name) do \
+{ \
+    if (!components[name]->IsType(typeid(UriSourceBintr)) and  \
+        !components[name]->IsType(typeid(FileSourceBintr))) \
+    { \
+        LOG_ERROR("Component '" << name << "' is not a URI or File Source"); \
+        return DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE; \
+    } \
+}while(0); 
+
 #define DSL_RETURN_IF_COMPONENT_IS_NOT_IMAGE_SOURCE(components, name) do \
 { \
     if (!components[name]->IsType(typeid(SingleImageSourceBintr)) and  \
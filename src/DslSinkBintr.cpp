@@ -27,6 +27,11 @@ THE SOFTWARE.
 #include "DslBranchBintr.h"
 #include "DslOdeAction.h"
 #include "DslServices.h"
+#include "DslXWindowEventMgr.h"
+
+#if (BUILD_WITH_FFMPEG == true) || (BUILD_WITH_OPENCV == true)
+#include "DslAvFile.h"
+#endif
 
 #include <gst-nvdssr.h>
 #include <gst/app/gstappsink.h>
@@ -599,6 +604,10 @@ namespace DSL
             on_new_buffer_cb, NULL)
         , m_pFrameCaptureAction(pFrameCaptureAction)
         , m_captureNextBuffer(false)
+        , m_nextRequestId(1)
+        , m_workers(DSL_FRAME_CAPTURE_DEFAULT_WORKERS)
+        , m_pWorkerPool(NULL)
+        , m_expiryTimerId(0)
     {
         LOG_FUNC();
 
@@ -620,14 +629,41 @@ namespace DSL
         LOG_INFO("      buffers        : " << m_minThresholdBuffers);
         LOG_INFO("      bytes          : " << m_minThresholdBytes);
         LOG_INFO("      time           : " << m_minThresholdTime);
+        LOG_INFO("  workers            : " << m_workers);
         
         // override the client data (set to NULL above) to this pointer.
         m_clientData = this;
+        
+        // Encoding is done off of the streaming thread by a pool of workers
+        GError* pError(NULL);
+        m_pWorkerPool = g_thread_pool_new(frame_capture_worker_cb, this,
+            m_workers, FALSE, &pError);
+        if (!m_pWorkerPool)
+        {
+            LOG_ERROR("Failed to create worker pool for FrameCaptureSinkBintr '" 
+                << name << "' with error: " << pError->message);
+            g_error_free(pError);
+            throw std::exception();
+        }
     }
     
     FrameCaptureSinkBintr::~FrameCaptureSinkBintr()
     {
         LOG_FUNC();
+        
+        // Cancel all requests still pending
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_captureMutex);
+            
+            if (m_expiryTimerId)
+            {
+                g_source_remove(m_expiryTimerId);
+                m_expiryTimerId = 0;
+            }
+            flushRequests(DSL_FRAME_CAPTURE_STATUS_CANCELED);
+        }
+        // Wait for all queued jobs to complete before freeing the pool
+        g_thread_pool_free(m_pWorkerPool, FALSE, TRUE);
     }
     
     bool FrameCaptureSinkBintr::Initiate()
@@ -660,12 +696,144 @@ namespace DSL
         return true;
     }
     
+    bool FrameCaptureSinkBintr::Request(uint64_t frameNumber, uint outputType, 
+        uint timeout, dsl_sink_frame_capture_complete_cb clientHandler, 
+        void* clientData, uint64_t* requestId)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_captureMutex);
+        
+        if (!IsLinked())
+        {
+            LOG_ERROR("Unable to request a frame-capture with FrameCaptureSinkBintr '"
+                << GetName() << "' as it's not in a linked/playing state");
+            return false;
+        }
+        
+        int64_t deadline = (timeout) 
+            ? g_get_monotonic_time() + (int64_t)timeout*1000
+            : 0;
+            
+        *requestId = m_nextRequestId++;
+        
+        m_captureRequests.push_back({*requestId, frameNumber, outputType, 
+            deadline, DSL_FRAME_CAPTURE_STATUS_COMPLETE, clientHandler, clientData});
+            
+        // Deadlines are otherwise only checked as frames arrive, so a stalled
+        // or stopped Pipeline would never complete an expired request.
+        if (deadline and !m_expiryTimerId)
+        {
+            m_expiryTimerId = g_timeout_add(DSL_FRAME_CAPTURE_EXPIRY_PERIOD_MS,
+                frame_capture_expiry_timer_cb, this);
+        }
+        return true;
+    }
+    
+    void FrameCaptureSinkBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+        
+        AppSinkBintr::UnlinkAll();
+
+        // No more frames will arrive, so complete all pending requests now.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_captureMutex);
+        
+        flushRequests(DSL_FRAME_CAPTURE_STATUS_CANCELED);
+    }
+    
+    int FrameCaptureSinkBintr::HandleExpiryTimer()
+    {
+        // don't log function - called periodically
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_captureMutex);
+        
+        FrameCaptureJob* pJob(NULL);
+        bool deadlinesPending(false);
+        int64_t now = g_get_monotonic_time();
+        
+        for (auto irequest = m_captureRequests.begin(); 
+            irequest != m_captureRequests.end();)
+        {
+            if (!irequest->deadline or now <= irequest->deadline)
+            {
+                deadlinesPending |= (irequest->deadline != 0);
+                irequest++;
+                continue;
+            }
+            if (!pJob)
+            {
+                pJob = new FrameCaptureJob{nullptr, 0, 0};
+            }
+            irequest->status = DSL_FRAME_CAPTURE_STATUS_EXPIRED;
+            pJob->requests.push_back(*irequest);
+            irequest = m_captureRequests.erase(irequest);
+        }
+        if (pJob)
+        {
+            g_thread_pool_push(m_pWorkerPool, pJob, NULL);
+        }
+        if (!deadlinesPending)
+        {
+            m_expiryTimerId = 0;
+        }
+        return deadlinesPending;
+    }
+    
+    void FrameCaptureSinkBintr::flushRequests(uint status)
+    {
+        LOG_FUNC();
+        
+        if (m_captureRequests.empty())
+        {
+            return;
+        }
+        FrameCaptureJob* pJob = new FrameCaptureJob{nullptr, 0, 0};
+        for (auto& irequest: m_captureRequests)
+        {
+            irequest.status = status;
+            pJob->requests.push_back(irequest);
+        }
+        m_captureRequests.clear();
+        g_thread_pool_push(m_pWorkerPool, pJob, NULL);
+    }
+    
+    uint FrameCaptureSinkBintr::GetWorkers()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_captureMutex);
+        
+        return m_workers;
+    }
+    
+    bool FrameCaptureSinkBintr::SetWorkers(uint workers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_captureMutex);
+        
+        if (!workers)
+        {
+            LOG_ERROR("Invalid number of workers = 0 for FrameCaptureSinkBintr '"
+                << GetName() << "'");
+            return false;
+        }
+        GError* pError(NULL);
+        if (!g_thread_pool_set_max_threads(m_pWorkerPool, workers, &pError))
+        {
+            LOG_ERROR("Failed to set workers for FrameCaptureSinkBintr '"
+                << GetName() << "' with error: " << pError->message);
+            g_error_free(pError);
+            return false;
+        }
+        m_workers = workers;
+        return true;
+    }
+    
     uint FrameCaptureSinkBintr::HandleNewBuffer(void* buffer)
     {
         // don't log function
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_captureMutex);
         
-        if (m_captureNextBuffer or m_captureFrameNumbers.size())
+        if (m_captureNextBuffer or m_captureFrameNumbers.size() or
+            m_captureRequests.size())
         {
             // flag for final determination to capture this frame.
             bool captureThisFrame(false);
@@ -711,19 +879,235 @@ namespace DSL
                 m_captureNextBuffer = false;
             }
                 
-            if (captureThisFrame)
+            // Coalesce all pending requests for this frame into one job. 
+            // Expired and missed requests are completed with the same job.
+            FrameCaptureJob* pJob(NULL);
+            int64_t now = g_get_monotonic_time();
+            
+            for (auto irequest = m_captureRequests.begin(); 
+                irequest != m_captureRequests.end();)
+            {
+                if (irequest->deadline and now > irequest->deadline)
+                {
+                    irequest->status = DSL_FRAME_CAPTURE_STATUS_EXPIRED;
+                }
+                else if (irequest->frameNumber != DSL_FRAME_CAPTURE_NEXT_FRAME and
+                    irequest->frameNumber < pFrameMeta->frame_num)
+                {
+                    irequest->status = DSL_FRAME_CAPTURE_STATUS_MISSED;
+                }
+                else if (irequest->frameNumber != DSL_FRAME_CAPTURE_NEXT_FRAME and
+                    irequest->frameNumber > pFrameMeta->frame_num)
+                {
+                    irequest++;
+                    continue;
+                }
+                if (!pJob)
+                {
+                    pJob = new FrameCaptureJob{nullptr, 
+                        pFrameMeta->frame_num, pFrameMeta->source_id};
+                }
+                pJob->requests.push_back(*irequest);
+                irequest = m_captureRequests.erase(irequest);
+            }
+            
+            bool requestsToCapture(false);
+            if (pJob)
             {
-                // Need to up-cast the base pointer to our frame-capture action
-                DSL_ODE_ACTION_CAPTURE_FRAME_PTR pCaptureAction =
-                    std::dynamic_pointer_cast<CaptureFrameOdeAction>(m_pFrameCaptureAction);
+                for (auto& irequest: pJob->requests)
+                {
+                    requestsToCapture |= 
+                        (irequest.status == DSL_FRAME_CAPTURE_STATUS_COMPLETE);
+                }
+            }
+                
+            // Need to up-cast the base pointer to our frame-capture action
+            DSL_ODE_ACTION_CAPTURE_FRAME_PTR pCaptureAction =
+                std::dynamic_pointer_cast<CaptureFrameOdeAction>(m_pFrameCaptureAction);
                 
+            // The Action's own capture is subject to its enabled setting.
+            captureThisFrame = captureThisFrame and pCaptureAction->GetEnabled();
                 
-                pCaptureAction->HandleOccurrence((GstBuffer*)buffer, pFrameMeta, NULL);
+            if (captureThisFrame or requestsToCapture)
+            {
+                // One transform for the Action and all requests for this frame.
+                std::shared_ptr<DslBufferSurface> pBufferSurface = 
+                    pCaptureAction->CaptureFrame((GstBuffer*)buffer, pFrameMeta);
+
+                if (captureThisFrame and pBufferSurface)
+                {
+                    pCaptureAction->queueCapturedImage(pBufferSurface);
+                }
+                if (requestsToCapture)
+                {
+                    pJob->pBufferSurface = pBufferSurface;
+                    if (!pBufferSurface)
+                    {
+                        for (auto& irequest: pJob->requests)
+                        {
+                            if (irequest.status == DSL_FRAME_CAPTURE_STATUS_COMPLETE)
+                            {
+                                irequest.status = DSL_FRAME_CAPTURE_STATUS_FAILED;
+                            }
+                        }
+                    }
+                }
+            }
+            if (pJob)
+            {
+                g_thread_pool_push(m_pWorkerPool, pJob, NULL);
             }
         }
         
         return GST_FLOW_OK;
     }
+    
+    void FrameCaptureSinkBintr::ProcessCaptureJob(FrameCaptureJob* pJob)
+    {
+        LOG_FUNC();
+        
+        std::unique_ptr<FrameCaptureJob> pJobOwner(pJob);
+        
+        std::vector<uint8_t> jpegData;
+        std::string dirpath, filename;
+        
+        if (pJob->pBufferSurface)
+        {
+            // Recheck the deadlines as the job may have been queued behind others
+            int64_t now = g_get_monotonic_time();
+            bool fileOutput(false), bufferOutput(false);
+            
+            for (auto& irequest: pJob->requests)
+            {
+                if (irequest.status != DSL_FRAME_CAPTURE_STATUS_COMPLETE)
+                {
+                    continue;
+                }
+                if (irequest.deadline and now > irequest.deadline)
+                {
+                    irequest.status = DSL_FRAME_CAPTURE_STATUS_EXPIRED;
+                    continue;
+                }
+                fileOutput |= (irequest.outputType == DSL_FRAME_CAPTURE_OUTPUT_FILE);
+                bufferOutput |= (irequest.outputType == DSL_FRAME_CAPTURE_OUTPUT_BUFFER);
+            }
+            
+            if (fileOutput or bufferOutput)
+            {
+                // Encode once for all requests, file and buffer output alike.
+                bool encoded(false);
+                try
+                {
+#if (BUILD_WITH_FFMPEG == true) || (BUILD_WITH_OPENCV == true)
+                    AvJpgOutputFile avJpgOutFile(pJob->pBufferSurface, jpegData);
+                    encoded = true;
+#else
+                    LOG_ERROR("FrameCaptureSinkBintr '" << GetName() 
+                        << "' requires FFmpeg or OpenCV to encode");
+#endif                
+                }
+                catch(...)
+                {
+                    LOG_ERROR("FrameCaptureSinkBintr '" << GetName() 
+                        << "' failed to encode frame-number = " << pJob->frameNumber);
+                }
+                
+                // Write the encoded image to file once for all file requests.
+                if (encoded and fileOutput)
+                {
+                    DSL_ODE_ACTION_CAPTURE_FRAME_PTR pCaptureAction =
+                        std::dynamic_pointer_cast<CaptureFrameOdeAction>(
+                            m_pFrameCaptureAction);
+                        
+                    std::ostringstream fileNameStream;
+                    fileNameStream << GetName() << "_" 
+                        << std::setw(5) << std::setfill('0') 
+                        << pJob->pBufferSurface->GetUniqueId()
+                        << "_" << pJob->pBufferSurface->GetDateTimeStr() << ".jpeg";
+                        
+                    dirpath = pCaptureAction->GetOutdir();
+                    filename = fileNameStream.str();
+                    
+                    std::ofstream outfile(dirpath + "/" + filename, 
+                        std::ios::out | std::ios::binary);
+                    outfile.write((const char*)jpegData.data(), jpegData.size());
+                    if (!outfile.good())
+                    {
+                        LOG_ERROR("FrameCaptureSinkBintr '" << GetName() 
+                            << "' failed to write file '" << filename << "'");
+                        dirpath.clear();
+                        filename.clear();
+                    }
+                }
+                for (auto& irequest: pJob->requests)
+                {
+                    if (irequest.status == DSL_FRAME_CAPTURE_STATUS_COMPLETE and
+                        (!encoded or (irequest.outputType == 
+                            DSL_FRAME_CAPTURE_OUTPUT_FILE and filename.empty())))
+                    {
+                        irequest.status = DSL_FRAME_CAPTURE_STATUS_FAILED;
+                    }
+                }
+            }
+        }
+        completeRequests(pJob, jpegData, dirpath, filename);
+    }
+    
+    void FrameCaptureSinkBintr::completeRequests(FrameCaptureJob* pJob, 
+        const std::vector<uint8_t>& jpegData, 
+        const std::string& dirpath, const std::string& filename)
+    {
+        LOG_FUNC();
+        
+        // convert the filename and dirpath to wchar string types 
+        // i.e the client's format.
+        std::wstring wstrFilename(filename.begin(), filename.end());
+        std::wstring wstrDirpath(dirpath.begin(), dirpath.end());
+        
+        for (auto& irequest: pJob->requests)
+        {
+            LOG_INFO("FrameCaptureSinkBintr '" << GetName() 
+                << "' completed request-id = " << irequest.requestId 
+                << " with status = " << irequest.status);
+                
+            if (!irequest.clientHandler)
+            {
+                continue;
+            }
+            dsl_frame_capture_result result{0};
+            
+            result.request_id = irequest.requestId;
+            result.status = irequest.status;
+            
+            if (irequest.status == DSL_FRAME_CAPTURE_STATUS_COMPLETE)
+            {
+                result.frame_number = pJob->frameNumber;
+                result.source_id = pJob->sourceId;
+                result.width = (&(*pJob->pBufferSurface))->surfaceList[0].width;
+                result.height = (&(*pJob->pBufferSurface))->surfaceList[0].height;
+                
+                if (irequest.outputType == DSL_FRAME_CAPTURE_OUTPUT_FILE)
+                {
+                    result.dirpath = wstrDirpath.c_str();
+                    result.filename = wstrFilename.c_str();
+                }
+                else
+                {
+                    result.data = jpegData.data();
+                }
+                result.size = jpegData.size();
+            }
+            try
+            {
+                irequest.clientHandler(&result, irequest.clientData);
+            }
+            catch(...)
+            {
+                LOG_ERROR("FrameCaptureSinkBintr '" << GetName() 
+                    << "' threw exception calling Client Handler");
+            }
+        }
+    }
 
     static uint on_new_buffer_cb(uint data_type, 
         void* data, void* client_data)
@@ -732,6 +1116,18 @@ namespace DSL
             HandleNewBuffer(data);
     }
 
+    static void frame_capture_worker_cb(gpointer job, gpointer client_data)
+    {
+        static_cast<FrameCaptureSinkBintr*>(client_data)->
+            ProcessCaptureJob(static_cast<FrameCaptureJob*>(job));
+    }
+
+    static int frame_capture_expiry_timer_cb(gpointer client_data)
+    {
+        return static_cast<FrameCaptureSinkBintr*>(client_data)->
+            HandleExpiryTimer();
+    }
+
     //-------------------------------------------------------------------------
     FakeSinkBintr::FakeSinkBintr(const char* name)
         : SinkBintr(name)
@@ -826,6 +1222,7 @@ namespace DSL
         , m_pXDisplay(0)
         , m_pXWindow(0)
         , m_pXWindowCreated(false)
+        , m_wmDeleteMessage(None)
         , m_xWindowfullScreenEnabled(false)
         , m_pSharedClientCbMutex(NULL)
     {
@@ -839,20 +1236,19 @@ namespace DSL
         // cleanup all resources
         if (m_pXDisplay)
         {
-            // create scope for the mutex
+            // create scope for the lock
             {
-                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
+                LOCK_XDISPLAY_FOR_CURRENT_SCOPE();
 
                 if (m_pXWindow and m_pXWindowCreated)
                 {
                     XDestroyWindow(m_pXDisplay, m_pXWindow);
                 }
-                
-                XCloseDisplay(m_pXDisplay);
-                // Setting the display handle to NULL will terminate the XWindow Event Thread.
-                m_pXDisplay = NULL;
             }
-            g_thread_join(m_pXWindowEventThread);
+            // The shared XDisplay is closed, and the event thread stopped,
+            // by the XWindowEventMgr when the last Window Sink is removed.
+            XWindowEventMgr::GetMgr()->RemoveWindowSink(this);
+            m_pXDisplay = NULL;
         }
     };
 
@@ -862,8 +1258,10 @@ namespace DSL
         
         // If the Pipeline is linked and has an XWindow, then we need to get the 
         // current XWindow attributes as the window may have been moved.
-        if (m_pXWindow)
+        if (m_pXWindow and m_pXDisplay)
         {
+            LOCK_XDISPLAY_FOR_CURRENT_SCOPE();
+
             XWindowAttributes attrs;
             XGetWindowAttributes(m_pXDisplay, m_pXWindow, &attrs);
             m_offsetX = attrs.x;
@@ -883,8 +1281,10 @@ namespace DSL
 
         // If the Pipeline is linked and has an XWindow, then we need to set  
         // XWindow attributes to actually resize the window
-        if (m_pXWindow)
+        if (m_pXWindow and m_pXDisplay)
         {
+            LOCK_XDISPLAY_FOR_CURRENT_SCOPE();
+
             XMoveResizeWindow(m_pXDisplay, m_pXWindow, 
                 m_offsetX, m_offsetY, 
                 m_width, m_height);
@@ -903,8 +1303,10 @@ namespace DSL
         
         // If the Pipeline is linked and has an XWindow, then we need to get the 
         // current XWindow attributes as the window may have been moved.
-        if (m_pXWindow)
+        if (m_pXWindow and m_pXDisplay)
         {
+            LOCK_XDISPLAY_FOR_CURRENT_SCOPE();
+
             XWindowAttributes attrs;
             XGetWindowAttributes(m_pXDisplay, m_pXWindow, &attrs);
             m_width = attrs.width;
@@ -921,7 +1323,7 @@ namespace DSL
 
         // If the Pipeline is linked and has an XWindow, then we need to set  
         // XWindow attributes to actually resize the window
-        if (m_pXWindow)
+        if (m_pXWindow and m_pXDisplay)
         {
             if ((width > m_XDisplayWidth) or (height > m_XDisplayHeight))
             {
@@ -929,6 +1331,8 @@ namespace DSL
             }
             m_width = std::min(width, m_XDisplayWidth);
             m_height = std::min(height, m_XDisplayHeight);
+
+            LOCK_XDISPLAY_FOR_CURRENT_SCOPE();
             XMoveResizeWindow(m_pXDisplay, m_pXWindow, 
                 m_offsetX, m_offsetY, 
                 m_width, m_height);
@@ -1088,16 +1492,21 @@ namespace DSL
                 }
                 m_pSharedClientCbMutex = pSharedClientCbMutex;
             }
-            else
+            else if (m_pXDisplay)
             {
+                LOCK_XDISPLAY_FOR_CURRENT_SCOPE();
                 XMapRaised(m_pXDisplay, m_pXWindow);
             }
             gst_video_overlay_set_window_handle(
                 GST_VIDEO_OVERLAY(m_pSink->GetGstObject()), m_pXWindow);
 
-            XMoveResizeWindow(m_pXDisplay, m_pXWindow, 
-                m_offsetX, m_offsetY, 
-                m_width, m_height);
+            if (m_pXDisplay)
+            {
+                LOCK_XDISPLAY_FOR_CURRENT_SCOPE();
+                XMoveResizeWindow(m_pXDisplay, m_pXWindow, 
+                    m_offsetX, m_offsetY, 
+                    m_width, m_height);
+            }
 
             gst_video_overlay_expose(
                 GST_VIDEO_OVERLAY(m_pSink->GetGstObject()));
@@ -1113,13 +1522,17 @@ namespace DSL
     {
         LOG_FUNC();
         
-        // Open a connection to the X server that controls a display,
-        m_pXDisplay = XOpenDisplay(NULL);
+        // Get the connection to the X server shared by all Window Sinks. The 
+        // XWindowEventMgr opens the XDisplay on first use.
+        m_pXDisplay = XWindowEventMgr::GetMgr()->AddWindowSink(this);
         if (!m_pXDisplay)
         {
-            LOG_ERROR("Failed to create new XDisplay");
+            LOG_ERROR("Failed to get the shared XDisplay for WindowSinkBintr '"
+                << GetName() << "'");
             return false;
         }
+        LOCK_XDISPLAY_FOR_CURRENT_SCOPE();
+
         // Get the XDisplay defaults
         int defaultScreen = XDefaultScreen(m_pXDisplay);
         m_XDisplayWidth = XDisplayWidth(m_pXDisplay, defaultScreen);
@@ -1175,10 +1588,10 @@ namespace DSL
         attr.event_mask = ButtonPress | KeyRelease;
         XChangeWindowAttributes(m_pXDisplay, m_pXWindow, CWEventMask, &attr);
 
-        Atom wmDeleteMessage = XInternAtom(m_pXDisplay, "WM_DELETE_WINDOW", False);
-        if (wmDeleteMessage != None)
+        m_wmDeleteMessage = XInternAtom(m_pXDisplay, "WM_DELETE_WINDOW", False);
+        if (m_wmDeleteMessage != None)
         {
-            XSetWMProtocols(m_pXDisplay, m_pXWindow, &wmDeleteMessage, 1);
+            XSetWMProtocols(m_pXDisplay, m_pXWindow, &m_wmDeleteMessage, 1);
         }
         
         XMapRaised(m_pXDisplay, m_pXWindow);
@@ -1200,88 +1613,93 @@ namespace DSL
                 SubstructureRedirectMask | SubstructureNotifyMask, &xev);
         }
         // flush the XWindow output buffer and then wait until all requests have been 
-        // received and processed by the X server. TRUE = Discard all queued events
-        XSync(m_pXDisplay, TRUE);
-
-        // Start the X window event thread
-        m_pXWindowEventThread = g_thread_new(NULL, XWindowEventThread, this);
+        // received and processed by the X server. FALSE = Keep all queued events 
+        // as the XDisplay is shared with all other Window Sinks.
+        XSync(m_pXDisplay, FALSE);
 
-        return true;
+        // Route all events for the new XWindow to this Window Sink
+        return XWindowEventMgr::GetMgr()->RegisterWindow(m_pXWindow, this);
     }
 
-    void WindowSinkBintr::HandleXWindowEvents()
+    void WindowSinkBintr::HandleXWindowEvent(XEvent& xEvent, 
+        XWindowEventCallbacks& callbacks)
     {
-        while (m_pXDisplay)
+        XButtonEvent buttonEvent = xEvent.xbutton;
+        switch (xEvent.type) 
         {
+        case ButtonPress:
+            LOG_INFO("Button '" << buttonEvent.button << "' pressed: xpos = " 
+                << buttonEvent.x << ": ypos = " << buttonEvent.y);
+            
+            callbacks.buttonEventHandlers = m_xWindowButtonEventHandlers;
+            callbacks.button = buttonEvent.button;
+            callbacks.xpos = buttonEvent.x;
+            callbacks.ypos = buttonEvent.y;
+            break;
+            
+        case KeyRelease:
             {
-                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
-                while (m_pXDisplay and XPending(m_pXDisplay)) 
+                KeySym key;
+                char keyString[255];
+                int length(0);
                 {
-
-                    XEvent xEvent;
-                    XNextEvent(m_pXDisplay, &xEvent);
-                    XButtonEvent buttonEvent = xEvent.xbutton;
-                    switch (xEvent.type) 
-                    {
-                    case ButtonPress:
-                        LOG_INFO("Button '" << buttonEvent.button << "' pressed: xpos = " 
-                            << buttonEvent.x << ": ypos = " << buttonEvent.y);
-                        
-                        // iterate through the map of XWindow Button Event handlers 
-                        // calling each one
-                        for(auto const& imap: m_xWindowButtonEventHandlers)
-                        {
-                            LOCK_MUTEX_FOR_CURRENT_SCOPE(&*m_pSharedClientCbMutex);
-                            
-                            imap.first(buttonEvent.button, 
-                                buttonEvent.x, buttonEvent.y, imap.second);
-                        }
-                        break;
-                        
-                    case KeyRelease:
-                        KeySym key;
-                        char keyString[255];
-                        if (XLookupString(&xEvent.xkey, keyString, 255, &key,0))
-                        {   
-                            keyString[1] = 0;
-                            std::string cstrKeyString(keyString);
-                            std::wstring wstrKeyString(cstrKeyString.begin(), 
-                                cstrKeyString.end());
-                            LOG_INFO("Key released = '" << cstrKeyString << "'"); 
-                            
-                            // iterate through the map of XWindow Key Event handlers 
-                            // calling each one
-                            for(auto const& imap: m_xWindowKeyEventHandlers)
-                            {
-                                LOCK_MUTEX_FOR_CURRENT_SCOPE(&*m_pSharedClientCbMutex);
-                                
-                                imap.first(wstrKeyString.c_str(), imap.second);
-                            }
-                        }
-                        break;
-                        
-                    case ClientMessage:
-                        LOG_INFO("Client message");
-
-                        if (XInternAtom(m_pXDisplay, "WM_DELETE_WINDOW", True) != None)
-                        {
-                            LOG_INFO("WM_DELETE_WINDOW message received");
-                            // iterate through the map of XWindow Delete Event handlers 
-                            // calling each one
-                            for(auto const& imap: m_xWindowDeleteEventHandlers)
-                            {
-                                LOCK_MUTEX_FOR_CURRENT_SCOPE(&*m_pSharedClientCbMutex);
-                                imap.first(imap.second);
-                            }
-                        }
-                        break;
-                        
-                    default:
-                        break;
-                    }
+                    // Key lookup may require a round trip to the X server
+                    LOCK_XDISPLAY_FOR_CURRENT_SCOPE();
+                    length = XLookupString(&xEvent.xkey, keyString, 255, &key, 0);
                 }
+                if (length)
+                {   
+                    keyString[1] = 0;
+                    std::string cstrKeyString(keyString);
+                    LOG_INFO("Key released = '" << cstrKeyString << "'"); 
+                    
+                    callbacks.keyEventHandlers = m_xWindowKeyEventHandlers;
+                    callbacks.keyString.assign(cstrKeyString.begin(), 
+                        cstrKeyString.end());
+                }
+            }
+            break;
+            
+        case ClientMessage:
+            LOG_INFO("Client message");
+
+            if (m_wmDeleteMessage != None and 
+                (Atom)xEvent.xclient.data.l[0] == m_wmDeleteMessage)
+            {
+                LOG_INFO("WM_DELETE_WINDOW message received");
+                callbacks.deleteEventHandlers = m_xWindowDeleteEventHandlers;
             }
-            g_usleep(G_USEC_PER_SEC / 20);
+            break;
+            
+        default:
+            break;
+        }
+        callbacks.pClientCbMutex = m_pSharedClientCbMutex;
+    }
+
+    void WindowSinkBintr::CallXWindowEventHandlers(
+        XWindowEventCallbacks& callbacks)
+    {
+        // iterate through each map of XWindow Event handlers calling each one,
+        // only one of the maps is populated for any single event.
+        for(auto const& imap: callbacks.buttonEventHandlers)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&*callbacks.pClientCbMutex);
+            
+            imap.first(callbacks.button, 
+                callbacks.xpos, callbacks.ypos, imap.second);
+        }
+        for(auto const& imap: callbacks.keyEventHandlers)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&*callbacks.pClientCbMutex);
+            
+            imap.first(callbacks.keyString.c_str(), imap.second);
+        }
+        for(auto const& imap: callbacks.deleteEventHandlers)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&*callbacks.pClientCbMutex);
+            
+            imap.first(imap.second);
         }
     }
 
@@ -1318,12 +1736,15 @@ namespace DSL
         }
         if (m_pXWindowCreated)
         {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
-            
-            XDestroyWindow(m_pXDisplay, m_pXWindow);
+            {
+                LOCK_XDISPLAY_FOR_CURRENT_SCOPE();
+                
+                XDestroyWindow(m_pXDisplay, m_pXWindow);
+            }
             m_pXWindow = 0;
             m_pXWindowCreated = False;
-            XCloseDisplay(m_pXDisplay);
+            XWindowEventMgr::GetMgr()->RemoveWindowSink(this);
+            m_pXDisplay = NULL;
             LOG_INFO("WindowSinkBintr destroyed its own XWindow to use the client's");
         }
         m_pXWindow = handle;
@@ -1339,16 +1760,10 @@ namespace DSL
             LOG_ERROR("WindowSinkBintr does not own a XWindow to clear");
             return false;
         }
+        LOCK_XDISPLAY_FOR_CURRENT_SCOPE();
         XClearWindow(m_pXDisplay, m_pXWindow);
         return true;
     }
-
-    static gpointer XWindowEventThread(gpointer pRenderSink)
-    {
-        static_cast<WindowSinkBintr*>(pRenderSink)->HandleXWindowEvents();
-       
-        return NULL;
-    }
     
     //-------------------------------------------------------------------------
 
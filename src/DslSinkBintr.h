@@ -31,6 +31,7 @@ THE SOFTWARE.
 #include "DslElementr.h"
 #include "DslRecordMgr.h"
 #include "DslSourceMeter.h"
+#include "DslSurfaceTransform.h"
 
 namespace DSL
 {
@@ -343,6 +344,79 @@ namespace DSL
         
     //-------------------------------------------------------------------------
 
+    /**
+     * @struct FrameCaptureRequest
+     * @brief Client request to capture a frame with a Frame-Capture Sink.
+     */
+    struct FrameCaptureRequest
+    {
+        /**
+         * @brief unique id for this request.
+         */
+        uint64_t requestId;
+        
+        /**
+         * @brief frame-number to capture or DSL_FRAME_CAPTURE_NEXT_FRAME.
+         */
+        uint64_t frameNumber;
+        
+        /**
+         * @brief one of the DSL_FRAME_CAPTURE_OUTPUT constants.
+         */
+        uint outputType;
+        
+        /**
+         * @brief monotonic time in microseconds after which the request
+         * expires, 0 = no deadline.
+         */
+        int64_t deadline;
+        
+        /**
+         * @brief one of the DSL_FRAME_CAPTURE_STATUS constants, set once 
+         * the request is removed from the queue.
+         */
+        uint status;
+        
+        /**
+         * @brief client callback to call on request completion, may be NULL.
+         */
+        dsl_sink_frame_capture_complete_cb clientHandler;
+        
+        /**
+         * @brief opaque pointer to client data to return with the callback.
+         */
+        void* clientData;
+    };
+    
+    /**
+     * @struct FrameCaptureJob
+     * @brief Unit of work for the Frame-Capture Sink's worker pool; a set of
+     * requests to complete, along with the frame captured for them if any. 
+     */
+    struct FrameCaptureJob
+    {
+        /**
+         * @brief captured frame to encode, nullptr if there is nothing to 
+         * encode, i.e. all requests have expired, been missed, etc.
+         */
+        std::shared_ptr<DslBufferSurface> pBufferSurface;
+        
+        /**
+         * @brief frame-number of the captured frame.
+         */
+        uint64_t frameNumber;
+        
+        /**
+         * @brief source-id of the captured frame.
+         */
+        uint sourceId;
+        
+        /**
+         * @brief requests to complete with this job.
+         */
+        std::vector<FrameCaptureRequest> requests;
+    };
+
     /**
      * @class FrameCaptureSinkBintr
      * @brief Implements a Frame-Capture Sink to encode and save a frame-buffer
@@ -380,6 +454,48 @@ namespace DSL
          * true otherwise.
          */
         bool Schedule(uint64_t frameNumber);
+        
+        /**
+         * @brief Adds a new capture request to the Sink's request queue.
+         * @param[in] frameNumber frame-number of the buffer to capture, or
+         * DSL_FRAME_CAPTURE_NEXT_FRAME to capture the next buffer.
+         * @param[in] outputType one of the DSL_FRAME_CAPTURE_OUTPUT constants.
+         * @param[in] timeout time to wait for the frame in ms, 0 = no timeout.
+         * @param[in] clientHandler client callback to call on completion.
+         * @param[in] clientData opaque pointer to client data.
+         * @param[out] requestId unique id for the new request.
+         * @return false if the Sink is unlinked, true otherwise.
+         */
+        bool Request(uint64_t frameNumber, uint outputType, uint timeout,
+            dsl_sink_frame_capture_complete_cb clientHandler, void* clientData,
+            uint64_t* requestId);
+            
+        /**
+         * @brief Gets the current number of encoder worker threads.
+         * @return current number of worker threads.
+         */
+        uint GetWorkers();
+        
+        /**
+         * @brief Sets the number of encoder worker threads to use.
+         * @param[in] workers new number of worker threads, must be > 0.
+         * @return true on successful update, false otherwise.
+         */
+        bool SetWorkers(uint workers);
+
+        /**
+         * @brief Unlinks all Child Elementrs owned by this Bintr. All pending
+         * capture requests are completed with a status of canceled.
+         */
+        void UnlinkAll();
+
+        /**
+         * @brief Handles the expiry timer by completing all pending requests
+         * that have passed their deadline, whether frames arrive or not.
+         * @return true to continue while requests with deadlines are pending,
+         * false to destroy the timer otherwise.
+         */
+        int HandleExpiryTimer();
 
         /**
          * @brief Function to handle each new buffer provided by the AppSinkBintr.
@@ -388,7 +504,34 @@ namespace DSL
          */
         uint HandleNewBuffer(void* buffer);
         
+        /**
+         * @brief Function to process a FrameCaptureJob on a worker thread.
+         * Encodes the captured frame, if any, once for all requests and 
+         * notifies each requesting client.
+         * @param[in] pJob job to process, deleted on return.
+         */
+        void ProcessCaptureJob(FrameCaptureJob* pJob);
+        
     private:
+    
+        /**
+         * @brief Completes each request in a FrameCaptureJob by calling its
+         * client handler with the result.
+         * @param[in] pJob job with the requests to complete.
+         * @param[in] jpegData encoded image, empty if not encoded.
+         * @param[in] dirpath directory of the saved image file, if any.
+         * @param[in] filename name of the saved image file, if any.
+         */
+        void completeRequests(FrameCaptureJob* pJob, 
+            const std::vector<uint8_t>& jpegData, 
+            const std::string& dirpath, const std::string& filename);
+
+        /**
+         * @brief Completes all pending requests with a given status.
+         * Must be called with the capture mutex held.
+         * @param[in] status one of the DSL_FRAME_CAPTURE_STATUS constants.
+         */
+        void flushRequests(uint status);
 
         /**
          * @brief boolean flag used by the client to signal to the HandleNewBuffer
@@ -400,6 +543,31 @@ namespace DSL
          * @brief queue of scheduled frame-numbers to capture.
          */
         std::queue<uint64_t> m_captureFrameNumbers;
+        
+        /**
+         * @brief list of pending capture requests in order of arrival.
+         */
+        std::list<FrameCaptureRequest> m_captureRequests;
+        
+        /**
+         * @brief unique id to assign to the next capture request.
+         */
+        uint64_t m_nextRequestId;
+        
+        /**
+         * @brief current number of encoder worker threads.
+         */
+        uint m_workers;
+        
+        /**
+         * @brief pool of encoder worker threads to process FrameCaptureJobs.
+         */
+        GThreadPool* m_pWorkerPool;
+
+        /**
+         * @brief gnome timer id for the request expiry timer, 0 if not running.
+         */
+        uint m_expiryTimerId;
 
         /**
          * @brief mutex to protect mutual access to the Sink's capture control 
@@ -424,6 +592,20 @@ namespace DSL
     static uint on_new_buffer_cb(uint data_type, 
         void* buffer, void* client_data);    
 
+    /**
+     * @brief function for the FrameCaptureSinkBintr's worker pool threads.
+     * @param[in] job pointer to the FrameCaptureJob to process.
+     * @param[in] client_data this pointer to the FrameCaptureSinkBintr instance.
+     */
+    static void frame_capture_worker_cb(gpointer job, gpointer client_data);
+
+    /**
+     * @brief timer callback to expire the FrameCaptureSinkBintr's requests.
+     * @param[in] client_data this pointer to the FrameCaptureSinkBintr instance.
+     * @return true to continue, false to destroy the timer.
+     */
+    static int frame_capture_expiry_timer_cb(gpointer client_data);
+
     //*********************************************************************************
 
     /**
@@ -627,10 +809,44 @@ namespace DSL
         bool RemoveDeleteEventHandler(dsl_sink_window_delete_event_handler_cb handler);
         
         /**
-         * @brief handles incoming window KEY & BUTTON events by calling
-         * all client installed event handlers for each queued event.
+         * @struct XWindowEventCallbacks
+         * @brief Copy of the client event handlers, and the event values to
+         * call them with, for a single XEvent. Allows the handlers to be 
+         * called after the WindowSinkBintr has been removed, or deleted.
+         */
+        struct XWindowEventCallbacks
+        {
+            std::shared_ptr<DslMutex> pClientCbMutex;
+            std::map<dsl_sink_window_key_event_handler_cb, void*> 
+                keyEventHandlers;
+            std::wstring keyString;
+            std::map<dsl_sink_window_button_event_handler_cb, void*> 
+                buttonEventHandlers;
+            uint button;
+            int xpos;
+            int ypos;
+            std::map<dsl_sink_window_delete_event_handler_cb, void*> 
+                deleteEventHandlers;
+        };
+        
+        /**
+         * @brief handles a single incoming window KEY, BUTTON, or DELETE event 
+         * by copying all client installed event handlers for the event type.
+         * Called by the XWindowEventMgr's event thread, with its dispatch 
+         * mutex held.
+         * @param[in] xEvent event routed to this WindowSinkBintr by Window id.
+         * @param[out] callbacks handlers and values to call once the dispatch
+         * mutex has been released.
+         */
+        void HandleXWindowEvent(XEvent& xEvent, XWindowEventCallbacks& callbacks);
+
+        /**
+         * @brief calls all client event handlers copied by HandleXWindowEvent.
+         * Called by the XWindowEventMgr's event thread, without any of its 
+         * mutexes held, so that the handlers can delete the WindowSinkBintr.
+         * @param[in] callbacks handlers and values to call.
          */
-        void HandleXWindowEvents();
+        static void CallXWindowEventHandlers(XWindowEventCallbacks& callbacks);
 
         /**
          * @brief Creates a new XWindow for the current XDisplay
@@ -729,7 +945,8 @@ namespace DSL
             m_xWindowDeleteEventHandlers;
         
         /**
-         * @brief Pointer to the XDisplay opened in CreateXWindow().
+         * @brief Pointer to the XDisplay shared by all WindowSinkBintrs, 
+         * provided by the XWindowEventMgr in CreateXWindow().
          */
         Display* m_pXDisplay;
         
@@ -743,12 +960,6 @@ namespace DSL
          */
         uint m_XDisplayHeight;
         
-        /**
-         * @brief Mutex to ensures mutual exclusion for the m_pXDisplay member
-         * accessed by multiple threads.
-         */
-        DslMutex m_displayMutex;
-
         /**
          * @brief handle to X Window
          */
@@ -762,10 +973,9 @@ namespace DSL
         bool m_pXWindowCreated;
         
         /**
-         * @brief handle to the X Window event thread, 
-         * active for the life of the Pipeline
+         * @brief WM_DELETE_WINDOW Atom for the XWindow, None until created.
          */
-        GThread* m_pXWindowEventThread;        
+        Atom m_wmDeleteMessage;
         
         /**
          * @brief Mutex for display thread shared by all WindowSinkBintrs
@@ -781,8 +991,6 @@ namespace DSL
 
     };
 
-    static gpointer XWindowEventThread(gpointer pWindowSink);
-    
     //-------------------------------------------------------------------------
 
     class ThreeDSinkBintr : public WindowSinkBintr
@@ -29,13 +29,11 @@ THE SOFTWARE.
 #include "DslSourceBintr.h"
 #include "DslPipelineBintr.h"
 #include "DslSurfaceTransform.h"
+#include "DslMediaInfoCache.h"
+#include "DslSourceRegistry.h"
 #include <nvdsgstutils.h>
 #include <gst/app/gstappsrc.h>
 
-#if (BUILD_WITH_FFMPEG == true) || (BUILD_WITH_OPENCV == true)
-#include "DslAvFile.h"
-#endif
-
 namespace DSL
 {
     static bool set_full_caps(DSL_ELEMENT_PTR pElement, 
@@ -148,6 +146,12 @@ namespace DSL
         , m_bufferOutFpsN(0)
         , m_bufferOutFpsD(0)
         , m_bufferOutOrientation(DSL_VIDEO_ORIENTATION_NONE)
+        , m_bufferOutProbeId(0)
+        , m_bufferOutInterval(0)
+        , m_bufferOutNextPts(GST_CLOCK_TIME_NONE)
+        , m_bufferOutReceived(0)
+        , m_bufferOutDropped(0)
+        , m_bufferOutConverted(0)
     {
         LOG_FUNC();
 
@@ -171,6 +175,14 @@ namespace DSL
         // Get property defaults that aren't specifically set
         m_pBufferOutVidConv->GetAttribute("gpu-id", &m_gpuId);
         m_pBufferOutVidConv->GetAttribute("nvbuf-memory-type", &m_nvbufMemType);
+
+        // Frames are decimated on the Video Converter's sink-pad so that 
+        // only those frames kept for the buffer-out-frame-rate are converted.
+        GstPad* pConvSinkPad = gst_element_get_static_pad(
+            m_pBufferOutVidConv->GetGstElement(), "sink");
+        m_bufferOutProbeId = gst_pad_add_probe(pConvSinkPad, 
+            GST_PAD_PROBE_TYPE_BUFFER, BufferOutDecimationProbeCB, this, NULL);
+        gst_object_unref(pConvSinkPad);
         
         // ---- Caps Filter Setup
 
@@ -198,6 +210,13 @@ namespace DSL
     VideoSourceBintr::~VideoSourceBintr()
     {
         LOG_FUNC();
+
+        // The Video Converter may outlive this Source if released to the 
+        // ElementPool, so the decimation probe must be removed explicitly.
+        GstPad* pConvSinkPad = gst_element_get_static_pad(
+            m_pBufferOutVidConv->GetGstElement(), "sink");
+        gst_pad_remove_probe(pConvSinkPad, m_bufferOutProbeId);
+        gst_object_unref(pConvSinkPad);
     }
     
     bool VideoSourceBintr::LinkToCommon(DSL_NODETR_PTR pSrcNodetr)
@@ -243,6 +262,12 @@ namespace DSL
         // Add the queue as first or next element to the vector of common elements.
         m_linkedCommonElements.push_back(m_pQueue);
 
+        // Restart decimation and the buffer-out counters for the new stream.
+        m_bufferOutNextPts = GST_CLOCK_TIME_NONE;
+        m_bufferOutReceived = 0;
+        m_bufferOutDropped = 0;
+        m_bufferOutConverted = 0;
+
         // We now have the first element (dewarper or queue) so we can link it
         // with the Source specific pSrcPad passed into this function.
         GstPad* pStaticSinkPad = gst_element_get_static_pad(
@@ -262,7 +287,8 @@ namespace DSL
             return false;
         }
 
-        // Link and add the Video Converter next
+        // Link and add the Video Converter next. Frames are decimated for the 
+        // buffer-out-frame-rate by the probe on the converter's sink-pad.
         if (!m_linkedCommonElements.back()->LinkToSink(m_pBufferOutVidConv))
         {
             return false;
@@ -270,7 +296,8 @@ namespace DSL
         m_linkedCommonElements.push_back(m_pBufferOutVidConv);
         
         // If the viderate was created, add it as the next common element
-        // and link it to the Source's Video Converter.
+        // and link it to the Source's Video Converter. When scaling down, it
+        // receives the decimated frames and only updates the negotiated rate.
         if (m_pBufferOutVidRate)
         {
             if (!m_linkedCommonElements.back()->LinkToSink(m_pBufferOutVidRate))
@@ -611,10 +638,59 @@ namespace DSL
             // delete the viderate element now
             m_pBufferOutVidRate = nullptr;
         }
+        // Decimate, prior to conversion, only when the frame-rate is scaled.
+        m_bufferOutInterval = (fpsN and fpsD) 
+            ? gst_util_uint64_scale(GST_SECOND, fpsD, fpsN) : 0;
+            
         // Update the output-buffer's caps filter now
         return updateVidConvCaps();
     }
     
+    void VideoSourceBintr::GetBufferOutStats(uint64_t* received, 
+        uint64_t* dropped, uint64_t* converted)
+    {
+        LOG_FUNC();
+        
+        *received = m_bufferOutReceived;
+        *dropped = m_bufferOutDropped;
+        *converted = m_bufferOutConverted;
+    }
+
+    GstPadProbeReturn VideoSourceBintr::HandleBufferOutDecimation(
+        GstPadProbeInfo* pInfo)
+    {
+        // No function log - called for every frame.
+        
+        m_bufferOutReceived.fetch_add(1, std::memory_order_relaxed);
+        
+        uint64_t interval = m_bufferOutInterval.load(std::memory_order_relaxed);
+        GstClockTime pts = GST_BUFFER_PTS(GST_PAD_PROBE_INFO_BUFFER(pInfo));
+        
+        if (interval and GST_CLOCK_TIME_IS_VALID(pts))
+        {
+            // Allow for timestamp jitter of up to 1/8 of the interval so that
+            // frames that land just short of the boundary aren't skipped.
+            GstClockTime tolerance = interval/8;
+            
+            // Restart on the first frame, or if the timestamps jump back, 
+            // e.g. on seek, or forward by more than an interval, e.g. on gap.
+            if (!GST_CLOCK_TIME_IS_VALID(m_bufferOutNextPts) or
+                pts + interval < m_bufferOutNextPts or
+                pts > m_bufferOutNextPts + interval)
+            {
+                m_bufferOutNextPts = pts;
+            }
+            if (pts + tolerance < m_bufferOutNextPts)
+            {
+                m_bufferOutDropped.fetch_add(1, std::memory_order_relaxed);
+                return GST_PAD_PROBE_DROP;
+            }
+            m_bufferOutNextPts += interval;
+        }
+        m_bufferOutConverted.fetch_add(1, std::memory_order_relaxed);
+        return GST_PAD_PROBE_OK;
+    }
+    
     void tokenize(std::string const &str, const char delim,
                 std::vector<std::string> &out)
     {
@@ -683,11 +759,11 @@ namespace DSL
         if (cropAt == DSL_VIDEO_CROP_AT_SRC)
         {
             m_pBufferOutVidConv->SetAttribute("src-crop", cropSettings.c_str());
+            
+            // The output dimensions may be derived from the source crop.
+            return updateVidConvCaps();
         }
-        else
-        {
-            m_pBufferOutVidConv->SetAttribute("dest-crop", cropSettings.c_str());
-        }
+        m_pBufferOutVidConv->SetAttribute("dest-crop", cropSettings.c_str());
 
         return true;
     }
@@ -713,7 +789,8 @@ namespace DSL
         m_bufferOutOrientation = orientation;
         m_pBufferOutVidConv->SetAttribute("flip-method", m_bufferOutOrientation);
 
-        return true;
+        // The output dimensions may be derived from the orientation.
+        return updateVidConvCaps();
     }
 
     bool VideoSourceBintr::SetGpuId(uint gpuId)
@@ -758,9 +835,37 @@ namespace DSL
     {
         LOG_FUNC();
 
+        // The crop, scale, rotate, and format conversion are all performed
+        // in a single pass by the buffer-out Video Converter. If the output
+        // dimensions are not set, they're derived from the transform so that
+        // a cropped region is never scaled back up to the full input frame.
+        uint width(m_bufferOutWidth), height(m_bufferOutHeight);
+        
+        if (!width and !height)
+        {
+            uint left(0), top(0);
+            GetBufferOutCropRectangle(DSL_VIDEO_CROP_AT_SRC, 
+                &left, &top, &width, &height);
+                
+            // All orientations that transpose the image swap the dimensions.
+            if (m_bufferOutOrientation == 
+                    DSL_VIDEO_ORIENTATION_ROTATE_COUNTER_CLOCKWISE_90 or
+                m_bufferOutOrientation == 
+                    DSL_VIDEO_ORIENTATION_ROTATE_CLOCKWISE_90 or
+                m_bufferOutOrientation == 
+                    DSL_VIDEO_ORIENTATION_FLIP_UPPER_RIGHT_TO_LOWER_LEFT or
+                m_bufferOutOrientation == 
+                    DSL_VIDEO_ORIENTATION_FLIP_UPPER_LEFT_TO_LOWER_RIGHT)
+            {
+                std::swap(width, height);
+            }
+        }
+        LOG_INFO("VideoSourceBintr '" << GetName() 
+            << "' buffer-out transform output = " << width << "x" << height
+            << " in format " << m_bufferOutFormat);
+
         DslCaps Caps(m_mediaType.c_str(), m_bufferOutFormat.c_str(),
-            m_bufferOutWidth, m_bufferOutHeight, 
-            m_bufferOutFpsN, m_bufferOutFpsD, true);
+            width, height, m_bufferOutFpsN, m_bufferOutFpsD, true);
 
         // Set the Caps for the Buffer output
         m_pBufferOutCapsFilter->SetAttribute("caps", &Caps);
@@ -2071,6 +2176,14 @@ namespace DSL
         , m_pDecoderStaticSinkpad(NULL)
         , m_bufferProbeId(0)
         , m_repeatEnabled(false)
+        , m_fileFrameCount(0)
+        , m_nextFileTimerId(0)
+        , m_keyFrameScanInterval(0)
+        , m_keyFrameCount(0)
+        , m_keyFrameScanProbeId(0)
+        , m_keyFrameScanSeekPending(false)
+        , m_keyFrameScanSeekTimerId(0)
+        , m_keyFrameScanSeekSegmentPending(false)
     {
         LOG_FUNC();
         
@@ -2195,11 +2308,15 @@ namespace DSL
 #if (BUILD_WITH_FFMPEG == true) || (BUILD_WITH_OPENCV == true)
         try
         {
-            AvInputFile avFile(uri);
-            m_fpsN = avFile.fpsN;
-            m_fpsD = avFile.fpsD;
-            m_width = avFile.videoWidth; 
-            m_height = avFile.videoHeight;
+            dsl_media_info info{0};
+            if (!MediaInfoCache::GetCache()->Probe(uri, info))
+            {
+                return false;
+            }
+            m_fpsN = info.fps_n;
+            m_fpsD = info.fps_d;
+            m_width = info.width; 
+            m_height = info.height;
         }
         catch(...)
         {
@@ -2225,6 +2342,7 @@ namespace DSL
         }
 
         m_isLinked = true;
+        m_keyFrameCount = 0;
 
         return true;
     }
@@ -2262,8 +2380,24 @@ namespace DSL
         LOG_INFO("Caps structs name " << name);
         if (name.find("video") != std::string::npos)
         {
-            LinkToCommon(pPad);
-            m_isFullyLinked = true;
+            // If the uridecodebin was rebound to the next file in offline mode,
+            // the common elements are still linked - link the new pad only.
+            if (m_isFullyLinked)
+            {
+                GstPad* pStaticSinkPad = gst_element_get_static_pad(
+                    m_linkedCommonElements.front()->GetGstElement(), "sink");
+                if (gst_pad_link(pPad, pStaticSinkPad) != GST_PAD_LINK_OK) 
+                {
+                    LOG_ERROR("Failed to relink UriSourceBintr '" << GetName()
+                        << "' to its first common element");
+                }
+                gst_object_unref(pStaticSinkPad);
+            }
+            else
+            {
+                LinkToCommon(pPad);
+                m_isFullyLinked = true;
+            }
             
             // Update the cap memebers for this URI Source Bintr
             gst_structure_get_uint(structure, "width", &m_width);
@@ -2326,8 +2460,9 @@ namespace DSL
             g_object_set(pObject, "num-extra-surfaces", m_numExtraSurfaces, NULL);
 
             // if the source is from file, then setup Stream buffer probe function
-            // to handle the stream restart/loop on GST_EVENT_EOS.
-            if (!m_isLive and m_repeatEnabled)
+            // to handle the stream restart/loop, or the rebind to the next file
+            // in offline mode, on GST_EVENT_EOS.
+            if (!m_isLive and (m_repeatEnabled or m_pFileQueue))
             {
                 GstPadProbeType mask = (GstPadProbeType) 
                     (GST_PAD_PROBE_TYPE_EVENT_BOTH |
@@ -2342,6 +2477,24 @@ namespace DSL
                     
                 // Note - m_pDecoderStaticSinkpad unreferenced in DisableEosConsumer
             }
+            
+            // if scanning key-frames, setup the buffer probe to drop all but
+            // the scanned key-frames before they're decoded.
+            if (!m_isLive and m_keyFrameScanInterval)
+            {
+                if (!m_pDecoderStaticSinkpad)
+                {
+                    m_pDecoderStaticSinkpad = 
+                        gst_element_get_static_pad(GST_ELEMENT(pObject), "sink");
+                }
+                m_keyFrameScanProbeId = gst_pad_add_probe(m_pDecoderStaticSinkpad, 
+                    GST_PAD_PROBE_TYPE_BUFFER, KeyFrameScanProbeCB, this, NULL);
+                
+                // A new decoder is created for each file, including each file
+                // rebound in offline mode, so the trick-mode seek is requested
+                // for each. Repeated passes are seeked in trick-mode on restart.
+                m_keyFrameScanSeekPending = true;
+            }
         }
     }
     
@@ -2356,22 +2509,58 @@ namespace DSL
         if (pInfo->type & GST_PAD_PROBE_TYPE_BUFFER)
         {
             GST_BUFFER_PTS(GST_BUFFER(pInfo->data)) += m_prevAccumulatedBase;
+            m_fileFrameCount++;
         }
         
         if (pInfo->type & GST_PAD_PROBE_TYPE_EVENT_BOTH)
         {
             if (GST_EVENT_TYPE(event) == GST_EVENT_EOS)
             {
-                g_timeout_add(1, StreamBufferSeekCB, this);
+                if (m_pFileQueue)
+                {
+                    m_pFileQueue->NotifyComplete(GetName(), 
+                        m_uri.substr(m_uri.find(':')+1), m_fileFrameCount);
+                    m_fileFrameCount = 0;
+
+                    // Rebind to the next file, or let the EOS through to the
+                    // Streammuxer if the queue is empty and not repeating.
+                    if (m_pFileQueue->Pop(m_nextFilePath))
+                    {
+                        m_nextFileTimerId = g_timeout_add(1, NextFileCB, this);
+                    }
+                    else if (!m_repeatEnabled)
+                    {
+                        return GST_PAD_PROBE_OK;
+                    }
+                    else
+                    {
+                        g_timeout_add(1, StreamBufferSeekCB, this);
+                    }
+                }
+                else
+                {
+                    g_timeout_add(1, StreamBufferSeekCB, this);
+                }
             }
             if (GST_EVENT_TYPE(event) == GST_EVENT_SEGMENT)
             {
                 GstSegment* segment;
 
                 gst_event_parse_segment(event, (const GstSegment**)&segment);
-                segment->base = m_accumulatedBase;
-                m_prevAccumulatedBase = m_accumulatedBase;
-                m_accumulatedBase += segment->stop;
+                
+                // The segment from a key-frame scan seek is part of the current
+                // pass, so it reuses the pass's base without accumulating.
+                if (m_keyFrameScanSeekSegmentPending)
+                {
+                    m_keyFrameScanSeekSegmentPending = false;
+                    segment->base = m_prevAccumulatedBase;
+                }
+                else
+                {
+                    segment->base = m_accumulatedBase;
+                    m_prevAccumulatedBase = m_accumulatedBase;
+                    m_accumulatedBase += segment->stop;
+                }
             }
             switch (GST_EVENT_TYPE (event))
             {
@@ -2404,9 +2593,17 @@ namespace DSL
     {
         SetState(GST_STATE_PAUSED, DSL_DEFAULT_STATE_CHANGE_TIMEOUT_IN_SEC * GST_SECOND);
         
+        GstSeekFlags flags = (GstSeekFlags)(GST_SEEK_FLAG_KEY_UNIT | 
+            GST_SEEK_FLAG_FLUSH);
+            
+        // When scanning, request key-frames only from the demuxer.
+        if (m_keyFrameScanInterval)
+        {
+            flags = (GstSeekFlags)(flags | GST_SEEK_FLAG_TRICKMODE | 
+                GST_SEEK_FLAG_TRICKMODE_KEY_UNITS | GST_SEEK_FLAG_TRICKMODE_NO_AUDIO);
+        }
         gboolean retval = gst_element_seek(GetGstElement(), 1.0, GST_FORMAT_TIME,
-            (GstSeekFlags)(GST_SEEK_FLAG_KEY_UNIT | GST_SEEK_FLAG_FLUSH),
-            GST_SEEK_TYPE_SET, 0, GST_SEEK_TYPE_NONE, GST_CLOCK_TIME_NONE);
+            flags, GST_SEEK_TYPE_SET, 0, GST_SEEK_TYPE_NONE, GST_CLOCK_TIME_NONE);
 
         if (!retval)
         {
@@ -2422,14 +2619,237 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_repeatEnabledMutex);
         
+        // Cancel any pending rebind to the next file and leave offline mode.
+        if (m_nextFileTimerId)
+        {
+            g_source_remove(m_nextFileTimerId);
+            m_nextFileTimerId = 0;
+        }
+        if (m_keyFrameScanSeekTimerId)
+        {
+            g_source_remove(m_keyFrameScanSeekTimerId);
+            m_keyFrameScanSeekTimerId = 0;
+        }
+        m_keyFrameScanSeekSegmentPending = false;
+        m_pFileQueue = nullptr;
+        
+        removeDecoderProbe();
+    }
+    
+    void UriSourceBintr::SetFileQueue(DSL_FILE_QUEUE_PTR pFileQueue)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_repeatEnabledMutex);
+        
+        m_pFileQueue = pFileQueue;
+        m_fileFrameCount = 0;
+    }
+    
+    gboolean UriSourceBintr::HandleNextFile()
+    {
+        LOG_FUNC();
+        
+        std::string filePath;
+        
+        // Local copy of the File Queue, as m_pFileQueue can be reset by
+        // DisableEosConsumer once the mutex is released.
+        DSL_FILE_QUEUE_PTR pFileQueue;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_repeatEnabledMutex);
+            
+            m_nextFileTimerId = 0;
+            
+            // Offline mode may have been disabled by a Pipeline stop.
+            if (!m_pFileQueue)
+            {
+                return false;
+            }
+            pFileQueue = m_pFileQueue;
+            filePath = m_nextFilePath;
+            
+            // The decoder is destroyed with the current file. A new trick-mode
+            // seek is requested for the next file's decoder once streaming.
+            if (m_keyFrameScanSeekTimerId)
+            {
+                g_source_remove(m_keyFrameScanSeekTimerId);
+                m_keyFrameScanSeekTimerId = 0;
+            }
+            m_keyFrameScanSeekSegmentPending = false;
+            removeDecoderProbe();
+        }
+        
+        // Set the uridecodebin to NULL to release the current file. Its video
+        // pad is removed, unlinking it from the common elements which remain
+        // linked to the Streammuxer and in a state of PLAYING.
+        gst_element_set_state(m_pSourceElement->GetGstElement(), GST_STATE_NULL);
+
+        while (!SetFileUri(filePath.c_str()))
+        {
+            LOG_ERROR("UriSourceBintr '" << GetName() 
+                << "' failed to bind to next file '" << filePath << "'");
+                
+            if (!pFileQueue->Pop(filePath))
+            {
+                sendEosToCommon();
+                return false;
+            }
+        }
+        m_pSourceElement->SetAttribute("uri", m_uri.c_str());
+        
+        LOG_INFO("UriSourceBintr '" << GetName() 
+            << "' rebound to next file '" << m_uri << "'");
+
+        if (!gst_element_sync_state_with_parent(m_pSourceElement->GetGstElement()))
+        {
+            LOG_ERROR("UriSourceBintr '" << GetName() 
+                << "' failed to sync state with parent for file '" << m_uri << "'");
+            sendEosToCommon();
+        }
+        return false;
+    }
+
+    uint UriSourceBintr::GetKeyFrameScanInterval()
+    {
+        LOG_FUNC();
+        
+        return m_keyFrameScanInterval;
+    }
+    
+    bool UriSourceBintr::SetKeyFrameScanInterval(uint interval)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Cannot set key-frame scan interval for UriSourceBintr '" 
+                << GetName() << "' as it is currently Linked");
+            return false;
+        }
+        if (m_isLive and interval)
+        {
+            LOG_ERROR("Cannot enable key-frame scanning for UriSourceBintr '" 
+                << GetName() << "' as it is a live source");
+            return false;
+        }
+        m_keyFrameScanInterval = interval;
+        return true;
+    }
+    
+    GstPadProbeReturn UriSourceBintr::HandleKeyFrameScan(GstPadProbeInfo* pInfo)
+    {
+        // No function log - called for every frame.
+        
+        GstBuffer* pBuffer = GST_PAD_PROBE_INFO_BUFFER(pInfo);
+        
+        // Schedule the trick-mode seek on the first buffer received, once 
+        // the demuxer is known to be streaming.
+        if (m_keyFrameScanSeekPending)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_repeatEnabledMutex);
+            
+            m_keyFrameScanSeekPending = false;
+            m_keyFrameScanSeekTimerId = g_timeout_add(1, KeyFrameScanSeekCB, this);
+        }
+        
+        // Delta frames are dropped for containers without trick-mode support.
+        if (GST_BUFFER_FLAG_IS_SET(pBuffer, GST_BUFFER_FLAG_DELTA_UNIT))
+        {
+            return GST_PAD_PROBE_DROP;
+        }
+        return ((m_keyFrameCount++ % m_keyFrameScanInterval) == 0)
+            ? GST_PAD_PROBE_OK
+            : GST_PAD_PROBE_DROP;
+    }
+    
+    gboolean UriSourceBintr::HandleKeyFrameScanSeek()
+    {
+        LOG_FUNC();
+        
+        GstPad* pDecoderSinkPad(NULL);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_repeatEnabledMutex);
+            
+            m_keyFrameScanSeekTimerId = 0;
+            
+            if (!m_pDecoderStaticSinkpad)
+            {
+                return false;
+            }
+            pDecoderSinkPad = GST_PAD(gst_object_ref(m_pDecoderStaticSinkpad));
+            
+            // The new segment is handled by the restart probe, if installed.
+            m_keyFrameScanSeekSegmentPending = (m_bufferProbeId != 0);
+        }
+        
+        // Continue from the demuxer's current position, or from the start 
+        // if the position is unknown. The seek is sent upstream from the 
+        // decoder's sink-pad, without the mutex held, as the flush is 
+        // propagated back downstream in this thread.
+        gint64 position(0);
+        if (!gst_pad_peer_query_position(pDecoderSinkPad, 
+            GST_FORMAT_TIME, &position) or position < 0)
+        {
+            position = 0;
+        }
+        GstEvent* pSeekEvent = gst_event_new_seek(1.0, GST_FORMAT_TIME,
+            (GstSeekFlags)(GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT |
+                GST_SEEK_FLAG_TRICKMODE | GST_SEEK_FLAG_TRICKMODE_KEY_UNITS |
+                GST_SEEK_FLAG_TRICKMODE_NO_AUDIO),
+            GST_SEEK_TYPE_SET, position, GST_SEEK_TYPE_NONE, GST_CLOCK_TIME_NONE);
+            
+        if (!gst_pad_push_event(pDecoderSinkPad, pSeekEvent))
+        {
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_repeatEnabledMutex);
+                m_keyFrameScanSeekSegmentPending = false;
+            }
+            // Not an error - all but the scanned key-frames are still 
+            // dropped, prior to decoding, by the key-frame scan probe.
+            LOG_WARN("Container for UriSourceBintr '" << GetName() 
+                << "' does not support trick-mode seeking");
+        }
+        else
+        {
+            LOG_INFO("UriSourceBintr '" << GetName() 
+                << "' seeked to key-unit trick-mode at position " << position);
+        }
+        gst_object_unref(pDecoderSinkPad);
+        
+        return false;
+    }
+    
+    void UriSourceBintr::removeDecoderProbe()
+    {
         if (m_pDecoderStaticSinkpad)
         {
             if (m_bufferProbeId)
             {
                 gst_pad_remove_probe(m_pDecoderStaticSinkpad, m_bufferProbeId);
             }
+            if (m_keyFrameScanProbeId)
+            {
+                gst_pad_remove_probe(m_pDecoderStaticSinkpad, m_keyFrameScanProbeId);
+            }
             gst_object_unref(m_pDecoderStaticSinkpad);
         }
+        m_pDecoderStaticSinkpad = NULL;
+        m_bufferProbeId = 0;
+        m_keyFrameScanProbeId = 0;
+    }
+    
+    void UriSourceBintr::sendEosToCommon()
+    {
+        LOG_FUNC();
+        
+        GstPad* pStaticSinkPad = gst_element_get_static_pad(
+            m_linkedCommonElements.front()->GetGstElement(), "sink");
+            
+        if (!gst_pad_send_event(pStaticSinkPad, gst_event_new_eos()))
+        {
+            LOG_ERROR("UriSourceBintr '" << GetName() 
+                << "' failed to send EOS to its first common element");
+        }
+        gst_object_unref(pStaticSinkPad);
     }
     
     //*********************************************************************************
@@ -2689,9 +3109,13 @@ namespace DSL
         // Try to open the file and read the dimensions.
         try
         {
-            AvInputFile avFile(uri);
-            m_width = avFile.videoWidth;
-            m_height = avFile.videoHeight;
+            dsl_media_info info{0};
+            if (!MediaInfoCache::GetCache()->Probe(uri, info))
+            {
+                return false;
+            }
+            m_width = info.width;
+            m_height = info.height;
         }
         catch(...)
         {
@@ -3018,9 +3442,13 @@ namespace DSL
         // Try to open the file and read the dimensions.
         try
         {
-            AvInputFile avFile(uri);
-            m_width = avFile.videoWidth;
-            m_height = avFile.videoHeight;
+            dsl_media_info info{0};
+            if (!MediaInfoCache::GetCache()->Probe(uri, info))
+            {
+                return false;
+            }
+            m_width = info.width;
+            m_height = info.height;
         }
         catch(...)
         {
@@ -3280,6 +3708,349 @@ namespace DSL
         return true;
     }
     
+    //*********************************************************************************
+
+    SharedSourceBintr::SharedSourceBintr(const char* name, 
+        const char* uri, bool isLive)
+        : VideoSourceBintr(name)
+        , m_uri(uri)
+        , m_isConsumer(false)
+        , m_queueSize(DSL_SHARED_SOURCE_DEFAULT_QUEUE_SIZE)
+        , m_maxRate(0)
+        , m_sharedInterval(0)
+        , m_sharedNextPts(GST_CLOCK_TIME_NONE)
+        , m_pSharedCaps(NULL)
+        , m_needData(false)
+        , m_eosPending(false)
+        , m_sharedReceived(0)
+        , m_sharedDropped(0)
+        , m_sharedDelivered(0)
+    {
+        LOG_FUNC();
+        
+        // override the default settings.
+        m_isLive = isLive;
+        
+        m_pSourceElement = DSL_ELEMENT_NEW("appsrc", name);
+
+        // The decoded buffers are re-timestamped with the running-time of
+        // this Source's Pipeline as they're delivered.
+        m_pSourceElement->SetAttribute("is-live", m_isLive);
+        m_pSourceElement->SetAttribute("format", GST_FORMAT_TIME);
+        m_pSourceElement->SetAttribute("do-timestamp", true);
+        m_pSourceElement->SetAttribute("block", false);
+        
+        // Limit the appsrc's own queue to a single buffer. All other buffers
+        // wait in this Source's bounded queue, where the oldest are dropped.
+        m_pSourceElement->SetAttribute("max-bytes", (uint64_t)1);
+
+        GstAppSrcCallbacks callbacks = 
+            {SharedSourceNeedDataCB, SharedSourceEnoughDataCB, NULL};
+        gst_app_src_set_callbacks((GstAppSrc*)m_pSourceElement->GetGObject(),
+            &callbacks, this, NULL);
+
+        LOG_INFO("");
+        LOG_INFO("Initial property values for SharedSourceBintr '" << name << "'");
+        LOG_INFO("  uri               : " << m_uri);
+        LOG_INFO("  is-live           : " << m_isLive);
+        LOG_INFO("  queue-size        : " << m_queueSize);
+        LOG_INFO("  max-rate          : " << m_maxRate);
+        LOG_INFO("  media-out         : " << m_mediaType << "(memory:NVMM)");
+        LOG_INFO("  buffer-out        : ");
+        LOG_INFO("    format          : " << m_bufferOutFormat);
+        LOG_INFO("    width           : " << m_bufferOutWidth);
+        LOG_INFO("    height          : " << m_bufferOutHeight);
+        LOG_INFO("    fps-n           : " << m_bufferOutFpsN);
+        LOG_INFO("    fps-d           : " << m_bufferOutFpsD);
+        LOG_INFO("    crop-pre-conv   : 0:0:0:0" );
+        LOG_INFO("    crop-post-conv  : 0:0:0:0" );
+        LOG_INFO("    orientation     : " << m_bufferOutOrientation);
+        LOG_INFO("  queue             : " );
+        LOG_INFO("    leaky           : " << m_leaky);
+        LOG_INFO("    max-size        : ");
+        LOG_INFO("      buffers       : " << m_maxSizeBuffers);
+        LOG_INFO("      bytes         : " << m_maxSizeBytes);
+        LOG_INFO("      time          : " << m_maxSizeTime);
+        LOG_INFO("    min-threshold   : ");
+        LOG_INFO("      buffers       : " << m_minThresholdBuffers);
+        LOG_INFO("      bytes         : " << m_minThresholdBytes);
+        LOG_INFO("      time          : " << m_minThresholdTime);
+
+        // Add the new Elementr as a Child to the SourceBintr
+        AddChild(m_pSourceElement);
+    }
+    
+    SharedSourceBintr::~SharedSourceBintr()
+    {
+        LOG_FUNC();
+
+        // The decoder holds a raw pointer to this Source until removed.
+        if (m_isConsumer)
+        {
+            SourceRegistry::GetRegistry()->RemoveConsumer(m_uri.c_str(), this);
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_sharedQueueMutex);
+        
+        for (auto& ibuffer: m_sharedQueue)
+        {
+            gst_buffer_unref(ibuffer);
+        }
+        if (m_pSharedCaps)
+        {
+            gst_caps_unref(m_pSharedCaps);
+        }
+    }
+
+    bool SharedSourceBintr::LinkAll()
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("SharedSourceBintr '" << GetName() 
+                << "' is already in a linked state");
+            return false;
+        }
+        if (!LinkToCommon(m_pSourceElement))
+        {
+            LOG_ERROR("SharedSourceBintr '" << GetName() << "' failed to LinkAll");
+            return false;
+        }
+        m_sharedReceived = 0;
+        m_sharedDropped = 0;
+        m_sharedDelivered = 0;
+        m_sharedNextPts = GST_CLOCK_TIME_NONE;
+        m_eosPending = false;
+        
+        // Join the fan-out last. Buffers are queued until the appsrc needs data.
+        if (!SourceRegistry::GetRegistry()->AddConsumer(m_uri.c_str(), 
+            m_isLive, this))
+        {
+            LOG_ERROR("SharedSourceBintr '" << GetName() 
+                << "' failed to add as consumer of URI '" << m_uri << "'");
+            UnlinkCommon();
+            return false;
+        }
+        m_isConsumer = true;
+        m_isLinked = true;
+        return true;
+    }
+
+    void SharedSourceBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+
+        if (!m_isLinked)
+        {
+            LOG_ERROR("SharedSourceBintr '" << GetName() 
+                << "' is not in a linked state");
+            return;
+        }
+        // No buffers are delivered to this Source once removed.
+        SourceRegistry::GetRegistry()->RemoveConsumer(m_uri.c_str(), this);
+        m_isConsumer = false;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_sharedQueueMutex);
+            
+            for (auto& ibuffer: m_sharedQueue)
+            {
+                gst_buffer_unref(ibuffer);
+            }
+            m_sharedQueue.clear();
+            m_needData = false;
+        }
+        UnlinkCommon();
+        
+        m_isLinked = false;
+    }
+    
+    const char* SharedSourceBintr::GetUri()
+    {
+        LOG_FUNC();
+        
+        return m_uri.c_str();
+    }
+
+    void SharedSourceBintr::GetSharedSettings(uint* queueSize, uint* maxRate)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_sharedQueueMutex);
+        
+        *queueSize = m_queueSize;
+        *maxRate = m_maxRate;
+    }
+
+    bool SharedSourceBintr::SetSharedSettings(uint queueSize, uint maxRate)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_sharedQueueMutex);
+        
+        if (!queueSize)
+        {
+            LOG_ERROR("Invalid queue-size = 0 for SharedSourceBintr '" 
+                << GetName() << "'");
+            return false;
+        }
+        m_queueSize = queueSize;
+        m_maxRate = maxRate;
+        m_sharedInterval = (maxRate) ? GST_SECOND/maxRate : 0;
+        
+        // Trim the queue, oldest first, if the new size is smaller.
+        while (m_sharedQueue.size() > m_queueSize)
+        {
+            gst_buffer_unref(m_sharedQueue.front());
+            m_sharedQueue.pop_front();
+            m_sharedDropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    void SharedSourceBintr::GetSharedStats(uint64_t* received, 
+        uint64_t* dropped, uint64_t* delivered)
+    {
+        LOG_FUNC();
+        
+        *received = m_sharedReceived;
+        *dropped = m_sharedDropped;
+        *delivered = m_sharedDelivered;
+    }
+
+    void SharedSourceBintr::HandleSharedBuffer(GstBuffer* pBuffer, 
+        GstCaps* pCaps)
+    {
+        // No function log - called for every frame.
+        
+        m_sharedReceived.fetch_add(1, std::memory_order_relaxed);
+
+        // Rate limit before queuing, using the same jitter tolerance, and
+        // restart conditions, as the buffer-out decimation.
+        uint64_t interval = m_sharedInterval.load(std::memory_order_relaxed);
+        GstClockTime pts = GST_BUFFER_PTS(pBuffer);
+        
+        if (interval and GST_CLOCK_TIME_IS_VALID(pts))
+        {
+            GstClockTime tolerance = interval/8;
+            
+            if (!GST_CLOCK_TIME_IS_VALID(m_sharedNextPts) or
+                pts + interval < m_sharedNextPts or
+                pts > m_sharedNextPts + interval)
+            {
+                m_sharedNextPts = pts;
+            }
+            if (pts + tolerance < m_sharedNextPts)
+            {
+                m_sharedDropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            m_sharedNextPts += interval;
+        }
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_sharedQueueMutex);
+
+        if (!m_pSharedCaps or !gst_caps_is_equal(m_pSharedCaps, pCaps))
+        {
+            gst_caps_replace(&m_pSharedCaps, pCaps);
+            gst_app_src_set_caps((GstAppSrc*)m_pSourceElement->GetGObject(), 
+                m_pSharedCaps);
+        }
+
+        // A shallow copy references the same memory as the decoder's buffer,
+        // but has its own timestamps, cleared here to be set by the appsrc.
+        GstBuffer* pSharedBuffer = gst_buffer_copy(pBuffer);
+        GST_BUFFER_PTS(pSharedBuffer) = GST_CLOCK_TIME_NONE;
+        GST_BUFFER_DTS(pSharedBuffer) = GST_CLOCK_TIME_NONE;
+
+        // Sharing the memory does not keep the decoder's pooled buffer alive.
+        // The parent meta holds a reference to it until this copy is freed, 
+        // so the decoder can't reuse the surface while still in use here.
+        gst_buffer_add_parent_buffer_meta(pSharedBuffer, pBuffer);
+        
+        m_sharedQueue.push_back(pSharedBuffer);
+        
+        // Drop the oldest on overflow, so the latest frames are delivered.
+        if (m_sharedQueue.size() > m_queueSize)
+        {
+            gst_buffer_unref(m_sharedQueue.front());
+            m_sharedQueue.pop_front();
+            m_sharedDropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        deliverQueuedBuffers();
+    }
+
+    void SharedSourceBintr::HandleSharedEos()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_sharedQueueMutex);
+        
+        m_eosPending = true;
+        deliverQueuedBuffers();
+    }
+    
+    void SharedSourceBintr::HandleSharedError(GError* pError, 
+        const gchar* debugInfo, bool isFatal)
+    {
+        LOG_FUNC();
+
+        // Post on behalf of the appsrc, so the message is delivered on the
+        // bus of the Pipeline that owns this Source -- not the decoder's.
+        GstObject* pSrc = GST_OBJECT(m_pSourceElement->GetGstElement());
+        
+        GstMessage* pMessage = (isFatal)
+            ? gst_message_new_error(pSrc, pError, debugInfo)
+            : gst_message_new_warning(pSrc, pError, debugInfo);
+        
+        if (!gst_element_post_message(m_pSourceElement->GetGstElement(), 
+            pMessage))
+        {
+            LOG_WARN("SharedSourceBintr '" << GetName() 
+                << "' failed to post shared decoder message - not in a Pipeline");
+        }
+    }
+
+    void SharedSourceBintr::HandleNeedData()
+    {
+        // No function log - called for every frame.
+        
+        m_needData = true;
+
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_sharedQueueMutex);
+        
+        deliverQueuedBuffers();
+    }
+
+    void SharedSourceBintr::HandleEnoughData()
+    {
+        // No function log - called for every frame.
+        
+        // Must not lock the queue mutex. The appsrc calls this from within 
+        // gst_app_src_push_buffer while the mutex is held.
+        m_needData = false;
+    }
+
+    void SharedSourceBintr::deliverQueuedBuffers()
+    {
+        while (m_needData and m_sharedQueue.size())
+        {
+            GstBuffer* pSharedBuffer = m_sharedQueue.front();
+            m_sharedQueue.pop_front();
+            
+            // The appsrc takes ownership of the buffer.
+            if (gst_app_src_push_buffer(
+                (GstAppSrc*)m_pSourceElement->GetGObject(), 
+                pSharedBuffer) != GST_FLOW_OK)
+            {
+                m_sharedDropped.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            m_sharedDelivered.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (m_eosPending and m_sharedQueue.empty())
+        {
+            gst_app_src_end_of_stream((GstAppSrc*)m_pSourceElement->GetGObject());
+            m_eosPending = false;
+        }
+    }
+
     //*********************************************************************************
     
     RtspSourceBintr::RtspSourceBintr(const char* name, const char* uri, 
@@ -3303,6 +4074,7 @@ namespace DSL
         , m_currentState(GST_STATE_NULL)
         , m_previousState(GST_STATE_NULL)
         , m_listenerNotifierTimerId(0)
+        , m_isEncodedCacheAdded(false)
     {
         // ---------------------------------------------------------------------------
         // The RTSP Source is linked in one of two ways depending on whether
@@ -3426,6 +4198,11 @@ namespace DSL
         
         m_pSrcPadBufferProbe->AddPadProbeHandler(m_TimestampPph);
         
+        // New encoded cache PPH, disabled until the duration is set. Added to
+        // the parser's src pad once the parser has been created.
+        handlerName = GetName() + "-encoded-cache-pph";
+        m_pEncodedCache = DSL_PPH_ENCODED_CACHE_NEW(handlerName.c_str(), 0, 0);
+        
         // Set the default connection param values
         m_connectionData.sleep = DSL_RTSP_CONNECTION_SLEEP_S;
         m_connectionData.timeout = DSL_RTSP_CONNECTION_TIMEOUT_S;
@@ -3444,6 +4221,11 @@ namespace DSL
         // Note: don't need t worry about stopping the one-shot m_listenerNotifierTimerId
         
         m_pSrcPadBufferProbe->RemovePadProbeHandler(m_TimestampPph);
+        
+        if (m_isEncodedCacheAdded)
+        {
+            m_pParser->RemovePadProbeBufferHandler(m_pEncodedCache, DSL_PAD_SRC);
+        }
     }
     
     bool RtspSourceBintr::LinkAll()
@@ -3828,6 +4610,78 @@ namespace DSL
         return (m_pTapBintr != nullptr);
     }
 
+    void RtspSourceBintr::GetEncodedCacheSettings(uint* duration, 
+        uint64_t* maxSize)
+    {
+        LOG_FUNC();
+        
+        m_pEncodedCache->GetSettings(duration, maxSize);
+    }
+    
+    bool RtspSourceBintr::SetEncodedCacheSettings(uint duration, 
+        uint64_t maxSize)
+    {
+        LOG_FUNC();
+        
+        m_pEncodedCache->SetSettings(duration, maxSize);
+        
+        return AddEncodedCacheToParser();
+    }
+    
+    bool RtspSourceBintr::ExportEncodedCache(uint duration, const char* filePath)
+    {
+        LOG_FUNC();
+        
+        if (!m_isEncodedCacheAdded)
+        {
+            LOG_ERROR("Unable to export Encoded Cache for RtspSourceBintr '" 
+                << GetName() << "' as the cache is not enabled or not yet connected");
+            return false;
+        }
+        GstPad* pParserSrcPad = gst_element_get_static_pad(
+            m_pParser->GetGstElement(), "src");
+        GstCaps* pCaps = gst_pad_get_current_caps(pParserSrcPad);
+        gst_object_unref(pParserSrcPad);
+        
+        bool result = m_pEncodedCache->Export(duration, filePath, pCaps);
+        
+        if (pCaps)
+        {
+            gst_caps_unref(pCaps);
+        }
+        return result;
+    }
+    
+    bool RtspSourceBintr::AddEncodedCacheToParser()
+    {
+        LOG_FUNC();
+        
+        uint duration(0);
+        uint64_t maxSize(0);
+        m_pEncodedCache->GetSettings(&duration, &maxSize);
+        
+        if (!duration or m_isEncodedCacheAdded or m_pParser == nullptr)
+        {
+            return true;
+        }
+        // Insert the parameter sets in-band with every IDR so that any export,
+        // starting at any key-frame, can be decoded on its own.
+        if (m_pParser->IsFactoryName("h264parse") or 
+            m_pParser->IsFactoryName("h265parse"))
+        {
+            m_pParser->SetAttribute("config-interval", -1);
+        }
+        m_pParser->AddPadProbes();
+        if (!m_pParser->AddPadProbeBufferHandler(m_pEncodedCache, DSL_PAD_SRC))
+        {
+            LOG_ERROR("Failed to add Encoded Cache to parser for RtspSourceBintr '"
+                << GetName() << "'");
+            return false;
+        }
+        m_isEncodedCacheAdded = true;
+        return true;
+    }
+
     bool RtspSourceBintr::HandleSelectStream(GstElement *pBin, 
         uint num, GstCaps *caps)
     {
@@ -3898,6 +4752,11 @@ namespace DSL
             // so we can add them as children to this RtspSourceBintr now.
             AddChild(m_pDepay);
             AddChild(m_pParser);
+            
+            if (!AddEncodedCacheToParser())
+            {
+                return false;
+            }
 
             // If we're tapping off of the pre-decode source stream
             if (HasTapBintr())
@@ -4322,11 +5181,46 @@ namespace DSL
             HandleStreamBufferRestart(pPad, pInfo);
     }
 
+    static GstPadProbeReturn BufferOutDecimationProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource)
+    {
+        return static_cast<VideoSourceBintr*>(pSource)->
+            HandleBufferOutDecimation(pInfo);
+    }
+
+    static void SharedSourceNeedDataCB(GstAppSrc* pAppSrc, guint length, 
+        gpointer pSource)
+    {
+        static_cast<SharedSourceBintr*>(pSource)->HandleNeedData();
+    }
+
+    static void SharedSourceEnoughDataCB(GstAppSrc* pAppSrc, gpointer pSource)
+    {
+        static_cast<SharedSourceBintr*>(pSource)->HandleEnoughData();
+    }
+
     static gboolean StreamBufferSeekCB(gpointer pSource)
     {
         return static_cast<UriSourceBintr*>(pSource)->HandleStreamBufferSeek();
     }
 
+    static gboolean NextFileCB(gpointer pSource)
+    {
+        return static_cast<UriSourceBintr*>(pSource)->HandleNextFile();
+    }
+
+    static GstPadProbeReturn KeyFrameScanProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource)
+    {
+        return static_cast<UriSourceBintr*>(pSource)->
+            HandleKeyFrameScan(pInfo);
+    }
+
+    static gboolean KeyFrameScanSeekCB(gpointer pSource)
+    {
+        return static_cast<UriSourceBintr*>(pSource)->HandleKeyFrameScanSeek();
+    }
+
     static int RtspStreamManagerHandler(gpointer pSource)
     {
         return static_cast<RtspSourceBintr*>(pSource)->
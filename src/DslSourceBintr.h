@@ -32,6 +32,10 @@ THE SOFTWARE.
 #include "DslDewarperBintr.h"
 #include "DslTapBintr.h"
 #include "DslStateChange.h"
+#include "DslFileQueue.h"
+
+#include <atomic>
+#include <gst/app/gstappsrc.h>
 
 namespace DSL
 {
@@ -101,6 +105,17 @@ namespace DSL
         std::shared_ptr<DuplicateSourceBintr>(new DuplicateSourceBintr(name, \
             original, isLive))
 
+    #define DSL_SHARED_SOURCE_PTR std::shared_ptr<SharedSourceBintr>
+    #define DSL_SHARED_SOURCE_NEW(name, uri, isLive) \
+        std::shared_ptr<SharedSourceBintr>(new SharedSourceBintr(name, \
+            uri, isLive))
+
+    /**
+     * @brief Default number of decoded buffers queued for each Shared Source
+     * before the oldest is dropped.
+     */
+    #define DSL_SHARED_SOURCE_DEFAULT_QUEUE_SIZE                        4
+
     /**
      * @brief Utility function to define/set all capabilities (media, 
      * format, width, height, and frame rate) for a given element.
@@ -338,6 +353,27 @@ namespace DSL
          * @return true if successfully set, false otherwise.
          */
         bool SetBufferOutFrameRate(uint fpsN, uint fpsD);
+
+        /**
+         * @brief Gets the buffer-out frame counters for the SourceBintr.
+         * @param[out] received number of frames received by the buffer-out
+         * decimator since the SourceBintr was last linked.
+         * @param[out] dropped number of frames dropped by the decimator,
+         * prior to conversion, to achieve the buffer-out-frame-rate.
+         * @param[out] converted number of frames passed on for conversion.
+         */
+        void GetBufferOutStats(uint64_t* received, uint64_t* dropped, 
+            uint64_t* converted);
+
+        /**
+         * @brief Handles a buffer on the sink-pad of the buffer-out Video 
+         * Converter. Frames are dropped, by timestamp, to achieve the 
+         * buffer-out-frame-rate so that only the frames kept are converted.
+         * @param[in] pInfo pad probe info for the buffer.
+         * @return GST_PAD_PROBE_DROP if the frame is to be dropped,
+         * GST_PAD_PROBE_OK otherwise.
+         */
+        GstPadProbeReturn HandleBufferOutDecimation(GstPadProbeInfo* pInfo);
         
         /**
          * @brief Gets the buffer-out-crop values for the SourceBintr.
@@ -432,7 +468,9 @@ namespace DSL
     private:
 
         /**
-         * @brief Private helper function to update the Video Converter's capability filter.
+         * @brief Private helper function to update the Video Converter's capability 
+         * filter. If the buffer-out dimensions are not set, the output dimensions 
+         * are derived from the pre-conversion crop and the orientation. 
          * @return true if successful, false otherwise.
          */
         bool updateVidConvCaps();
@@ -529,10 +567,38 @@ namespace DSL
         DSL_ELEMENT_PTR m_pBufferOutVidConv;
 
         /**
-         * @brief Output-buffer Video Rate element for this SourceBintr.
+         * @brief Output-buffer Video Rate element for this SourceBintr. 
+         * When scaling down, frames are decimated prior to conversion and 
+         * the Video Rate element only updates the negotiated frame-rate.
          */
         DSL_ELEMENT_PTR m_pBufferOutVidRate;
 
+        /**
+         * @brief probe-id for the decimation probe on the sink-pad of the
+         * buffer-out Video Converter.
+         */
+        gulong m_bufferOutProbeId;
+
+        /**
+         * @brief minimum interval between kept frames in nanoseconds, derived
+         * from the buffer-out-frame-rate. 0 = no decimation. 
+         */
+        std::atomic<uint64_t> m_bufferOutInterval;
+
+        /**
+         * @brief timestamp at, or after, which the next frame is to be kept. 
+         * Accessed by the streaming thread only while linked.
+         */
+        GstClockTime m_bufferOutNextPts;
+
+        /**
+         * @brief buffer-out frame counters, received, dropped prior 
+         * to conversion, and passed on for conversion.
+         */
+        std::atomic<uint64_t> m_bufferOutReceived;
+        std::atomic<uint64_t> m_bufferOutDropped;
+        std::atomic<uint64_t> m_bufferOutConverted;
+
         /**
          * @brief Caps Filter for the SourceBintr's output-buffe.
          */
@@ -1296,6 +1362,58 @@ namespace DSL
 
         void HandleSourceElementOnPadAdded(GstElement* pBin, GstPad* pPad);
         
+        /**
+         * @brief Sets the shared work queue of files for offline mode. On 
+         * reaching the end of its current file, the Source is rebound to the 
+         * next file in the queue without stopping the Pipeline. The Source
+         * sends EOS downstream only when the queue is empty. 
+         * @param[in] pFileQueue shared file queue, nullptr to clear.
+         */
+        void SetFileQueue(DSL_FILE_QUEUE_PTR pFileQueue);
+        
+        /**
+         * @brief Rebinds the uridecodebin to the next file popped from the
+         * file queue. Must be called in the mainloop's context, i.e. timer 
+         * callback.
+         * @return false always to self destroy the one-shot timer.
+         */
+        gboolean HandleNextFile();
+
+        /**
+         * @brief Gets the current key-frame scan interval for this Source.
+         * @return 0 if scanning is disabled, otherwise N to pass every Nth 
+         * key-frame to the decoder.
+         */
+        uint GetKeyFrameScanInterval();
+
+        /**
+         * @brief Sets the key-frame scan interval for this Source. When 
+         * scanning, only key-frames are passed to the decoder. Containers 
+         * that support trick-mode are seeked to output key-frames only. 
+         * Applies to non-live sources only.
+         * @param[in] interval 0 to disable scanning, 1 to pass every key-frame,
+         * N to pass every Nth key-frame.
+         * @return true if successfully set, false otherwise.
+         */
+        bool SetKeyFrameScanInterval(uint interval);
+
+        /**
+         * @brief Handles a buffer on the decoder's sink-pad when scanning. 
+         * Delta frames, and all but every Nth key-frame, are dropped. 
+         * Timestamps are left unchanged.
+         * @param[in] pInfo pad probe info for the buffer.
+         * @return GST_PAD_PROBE_DROP if the frame is to be dropped,
+         * GST_PAD_PROBE_OK otherwise.
+         */
+        GstPadProbeReturn HandleKeyFrameScan(GstPadProbeInfo* pInfo);
+
+        /**
+         * @brief Seeks the demuxer to the current position in key-unit 
+         * trick-mode. Must be called in the mainloop's context.
+         * @return false always to self destroy the one-shot timer.
+         */
+        gboolean HandleKeyFrameScanSeek();
+        
     protected:
     
         /**
@@ -1356,6 +1474,75 @@ namespace DSL
          * @brief mutual exclusion of the repeat enabled setting.
          */
         DslMutex m_repeatEnabledMutex;
+        
+        /**
+         * @brief Removes the Buffer Probe from the nvv4l2decoder's sink pad
+         * and releases the pad. Must be called with m_repeatEnabledMutex held.
+         */
+        void removeDecoderProbe();
+        
+        /**
+         * @brief Sends an EOS event into the first common element so that the
+         * Streammuxer is notified when no further file can be bound.
+         */
+        void sendEosToCommon();
+        
+        /**
+         * @brief shared work queue of files when in offline mode, nullptr otherwise.
+         */
+        DSL_FILE_QUEUE_PTR m_pFileQueue;
+        
+        /**
+         * @brief path of the next file to bind, popped from the file queue.
+         */
+        std::string m_nextFilePath;
+        
+        /**
+         * @brief number of frames processed from the current file.
+         */
+        uint64_t m_fileFrameCount;
+        
+        /**
+         * @brief id of the one-shot timer scheduled to bind the next file,
+         * 0 when not scheduled.
+         */
+        guint m_nextFileTimerId;
+
+        /**
+         * @brief key-frame scan interval, 0 = disabled, N = pass every Nth
+         * key-frame to the decoder.
+         */
+        uint m_keyFrameScanInterval;
+
+        /**
+         * @brief number of key-frames received while scanning, used to 
+         * select every Nth key-frame.
+         */
+        uint64_t m_keyFrameCount;
+
+        /**
+         * @brief probe id for the nvv4l2decoder Buffer Probe used to 
+         * drop all but the scanned key-frames.
+         */
+        guint m_keyFrameScanProbeId;
+
+        /**
+         * @brief true if the trick-mode seek is to be scheduled on the next
+         * buffer. Accessed by the streaming thread only.
+         */
+        bool m_keyFrameScanSeekPending;
+
+        /**
+         * @brief id of the one-shot timer scheduled to perform the trick-mode
+         * seek, 0 when not scheduled.
+         */
+        guint m_keyFrameScanSeekTimerId;
+
+        /**
+         * @brief true if the next new segment is from the trick-mode seek, 
+         * and is to use the current pass's base without accumulating.
+         */
+        bool m_keyFrameScanSeekSegmentPending;
     };
 
     //*********************************************************************************
@@ -1764,6 +1951,191 @@ namespace DSL
 
     //*********************************************************************************
 
+    /**
+     * @class SharedSourceBintr
+     * @brief Implements a Source that consumes the decoded buffers of a URI
+     * through the process-wide SourceRegistry. All Shared Sources for the
+     * same URI -- in any number of Pipelines -- share one connection and one
+     * decoder. Each Shared Source has its own bounded queue and optional
+     * maximum frame-rate, so that a slow Pipeline never stalls the decoder
+     * or any of the other consumers.
+     */
+    class SharedSourceBintr : public VideoSourceBintr
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the SharedSourceBintr class
+         * @param[in] name unique name for the new SharedSourceBintr
+         * @param[in] uri URI to consume.
+         * @param[in] isLive true if the URI is a live source, false otherwise.
+         */
+        SharedSourceBintr(const char* name, const char* uri, bool isLive);
+
+        /**
+         * @brief dtor for the SharedSourceBintr class
+         */
+        ~SharedSourceBintr();
+
+        /**
+         * @brief Links all Child Elementrs owned by this Source Bintr and 
+         * adds the Source as a consumer of its URI's shared decoder.
+         * @return True success, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Removes the Source as a consumer of its URI's shared decoder
+         * and unlinks all Child Elementrs owned by this Source Bintr.
+         */
+        void UnlinkAll();
+
+        /**
+         * @brief Gets the URI consumed by this SharedSourceBintr
+         * @return URI in use.
+         */
+        const char* GetUri();
+
+        /**
+         * @brief Gets the current queue and rate settings for this Source.
+         * @param[out] queueSize max number of decoded buffers to queue.
+         * @param[out] maxRate max frames per second to accept, 0 = no limit.
+         */
+        void GetSharedSettings(uint* queueSize, uint* maxRate);
+
+        /**
+         * @brief Sets the queue and rate settings for this Source. May be 
+         * called at any time.
+         * @param[in] queueSize max number of decoded buffers to queue, > 0.
+         * @param[in] maxRate max frames per second to accept, 0 = no limit.
+         * @return true on successful update, false otherwise.
+         */
+        bool SetSharedSettings(uint queueSize, uint maxRate);
+
+        /**
+         * @brief Gets the buffer counts since the Source was last linked.
+         * @param[out] received number of buffers received from the decoder.
+         * @param[out] dropped number of buffers dropped by the rate limit 
+         * or on queue overflow.
+         * @param[out] delivered number of buffers delivered downstream.
+         */
+        void GetSharedStats(uint64_t* received, uint64_t* dropped, 
+            uint64_t* delivered);
+
+        /**
+         * @brief Handles a new decoded buffer from the shared decoder.
+         * Called on the decoder's streaming thread.
+         * @param[in] pBuffer decoded buffer, not owned. A shallow copy that
+         * references the same memory, and holds a reference to pBuffer as
+         * its parent, is queued for this Source.
+         * @param[in] pCaps caps for the decoded buffer.
+         */
+        void HandleSharedBuffer(GstBuffer* pBuffer, GstCaps* pCaps);
+
+        /**
+         * @brief Handles an end-of-stream from the shared decoder. EOS is
+         * delivered downstream once all queued buffers have been delivered.
+         */
+        void HandleSharedEos();
+
+        /**
+         * @brief Handles an error from the shared decoder by posting it, as
+         * an error or warning message, on the bus of this Source's Pipeline.
+         * @param[in] pError error received from the shared decoder.
+         * @param[in] debugInfo optional debug info, may be NULL.
+         * @param[in] isFatal if true, post as an error message. Otherwise,
+         * post as a warning while the decoder attempts to reconnect.
+         */
+        void HandleSharedError(GError* pError, const gchar* debugInfo, 
+            bool isFatal);
+
+        /**
+         * @brief Handles the "need-data" callback from the appsrc by
+         * delivering queued buffers until the appsrc has enough.
+         */
+        void HandleNeedData();
+
+        /**
+         * @brief Handles the "enough-data" callback from the appsrc.
+         */
+        void HandleEnoughData();
+
+    private:
+
+        /**
+         * @brief Pushes queued buffers to the appsrc while it needs data.
+         * Must be called with the queue mutex held.
+         */
+        void deliverQueuedBuffers();
+
+        /**
+         * @brief URI consumed by this SharedSourceBintr.
+         */
+        std::string m_uri;
+
+        /**
+         * @brief true while this Source is a consumer of its URI's decoder.
+         */
+        bool m_isConsumer;
+
+        /**
+         * @brief mutex to protect mutual access to the queue and caps.
+         */
+        DslMutex m_sharedQueueMutex;
+
+        /**
+         * @brief bounded queue of decoded buffers waiting for the appsrc.
+         */
+        std::deque<GstBuffer*> m_sharedQueue;
+
+        /**
+         * @brief max number of buffers in m_sharedQueue.
+         */
+        uint m_queueSize;
+
+        /**
+         * @brief max frames per second to accept, 0 = no limit.
+         */
+        uint m_maxRate;
+
+        /**
+         * @brief minimum PTS interval between accepted buffers, derived 
+         * from m_maxRate. 0 = no limit.
+         */
+        std::atomic<uint64_t> m_sharedInterval;
+
+        /**
+         * @brief PTS of the next buffer to accept when rate limited. Accessed
+         * on the decoder's streaming thread only.
+         */
+        GstClockTime m_sharedNextPts;
+
+        /**
+         * @brief caps last set on the appsrc.
+         */
+        GstCaps* m_pSharedCaps;
+
+        /**
+         * @brief true while the appsrc needs data, between the "need-data"
+         * and "enough-data" callbacks.
+         */
+        std::atomic<bool> m_needData;
+
+        /**
+         * @brief true if EOS is to be delivered once the queue is empty.
+         */
+        bool m_eosPending;
+
+        /**
+         * @brief buffer counts since the Source was last linked.
+         */
+        std::atomic<uint64_t> m_sharedReceived;
+        std::atomic<uint64_t> m_sharedDropped;
+        std::atomic<uint64_t> m_sharedDelivered;
+    };
+
+    //*********************************************************************************
+
     /**
      * @class RtspSourceBintr
      * @brief 
@@ -1975,6 +2347,41 @@ namespace DSL
          */
         bool HasTapBintr();
         
+        /**
+         * @brief Gets the current settings for the RtspSourceBintr's shared
+         * encoded cache.
+         * @param[out] duration maximum duration to cache in seconds, 0 = disabled.
+         * @param[out] maxSize memory budget for the cache in bytes, 0 = no limit.
+         */
+        void GetEncodedCacheSettings(uint* duration, uint64_t* maxSize);
+        
+        /**
+         * @brief Sets the settings for the RtspSourceBintr's shared encoded 
+         * cache. The cache holds references to the parsed, encoded access units
+         * received from the RTSP server, indexed by key-frame.
+         * @param[in] duration maximum duration to cache in seconds, 0 = disabled.
+         * @param[in] maxSize memory budget for the cache in bytes, 0 = no limit.
+         * @return true on successful set, false otherwise.
+         */
+        bool SetEncodedCacheSettings(uint duration, uint64_t maxSize);
+        
+        /**
+         * @brief Exports the last duration seconds of the RtspSourceBintr's 
+         * shared encoded cache, starting at the nearest key-frame, to an
+         * elementary stream file.
+         * @param[in] duration duration of encoded data to export in seconds.
+         * @param[in] filePath absolute or relative path for the new file.
+         * @return true on successful export, false otherwise.
+         */
+        bool ExportEncodedCache(uint duration, const char* filePath);
+        
+        /**
+         * @brief NOTE: Used for test purposes only, allows access to the 
+         * Source's Encoded Cache PPH.
+         * @return shared pointer to the Encoded Cache PPH.
+         */
+        DSL_PPH_ENCODED_CACHE_PTR _getEncodedCachePph(){return m_pEncodedCache;};
+        
         bool HandleSelectStream(GstElement* pBin, uint num, GstCaps* pCaps);
 
         void HandleSourceElementOnPadAdded(GstElement* pBin, GstPad* pPad);
@@ -1983,6 +2390,13 @@ namespace DSL
         
     private:
     
+        /**
+         * @brief Adds the shared encoded cache to the src pad of the parser,
+         * once the parser has been created, if the cache is enabled.
+         * @return true on successful add or if not required, false otherwise.
+         */
+        bool AddEncodedCacheToParser();
+    
         /**
          * @brief The common elements are not linked until after the rtspsrc
          * has called the select-stream callback. We don't want to try and 
@@ -2082,6 +2496,17 @@ namespace DSL
          */
         DSL_PPH_TIMESTAMP_PTR m_TimestampPph;
 
+        /**
+         * @brief Pad Probe Handler to cache the parsed, encoded access units
+         * for all readers of the source's encoded stream.
+         */
+        DSL_PPH_ENCODED_CACHE_PTR m_pEncodedCache;
+
+        /**
+         * @brief true once the Encoded Cache PPH has been added to the parser.
+         */
+        bool m_isEncodedCacheAdded;
+
         /**
          * @brief time incremented while waiting for first connection in ms.
          */
@@ -2229,6 +2654,17 @@ namespace DSL
     static GstPadProbeReturn StreamBufferRestartProbCB(GstPad* pPad, 
         GstPadProbeInfo* pInfo, gpointer pSource);
 
+    /**
+     * @brief Probe function to decimate the buffer-out frames of a
+     * Video Source prior to conversion.
+     * @param[in] pPad sink-pad of the buffer-out Video Converter.
+     * @param[in] pInfo pad probe info for the buffer.
+     * @param[in] pSource pointer to the Video Source component.
+     * @return GST_PAD_PROBE_DROP or GST_PAD_PROBE_OK.
+     */
+    static GstPadProbeReturn BufferOutDecimationProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource);
+
     /**
      * @brief 
      * @param[in] pSource shared pointer to the RTSP Source component.
@@ -2236,6 +2672,49 @@ namespace DSL
      */
     static gboolean StreamBufferSeekCB(gpointer pSource);
     
+    /**
+     * @brief Timer callback to rebind a File Source to the next file in its 
+     * offline file queue in the mainloop context.
+     * @param[in] pSource pointer to the URI Source component.
+     * @return false always to self destroy the one-shot timer.
+     */
+    static gboolean NextFileCB(gpointer pSource);
+
+    /**
+     * @brief Probe function to drop all but the scanned key-frames on the
+     * sink-pad of a URI Source's decoder.
+     * @param[in] pPad decoder sink-pad.
+     * @param[in] pInfo pad probe info for the buffer.
+     * @param[in] pSource pointer to the URI Source component.
+     * @return GST_PAD_PROBE_DROP or GST_PAD_PROBE_OK.
+     */
+    static GstPadProbeReturn KeyFrameScanProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource);
+
+    /**
+     * @brief Timer callback to seek a URI Source to key-unit trick-mode
+     * in the mainloop context.
+     * @param[in] pSource pointer to the URI Source component.
+     * @return false always to self destroy the one-shot timer.
+     */
+    static gboolean KeyFrameScanSeekCB(gpointer pSource);
+    
+    /**
+     * @brief Called by the appsrc of a Shared Source when it needs data.
+     * @param[in] pAppSrc appsrc that needs data.
+     * @param[in] length unused length hint.
+     * @param[in] pSource pointer to the Shared Source component.
+     */
+    static void SharedSourceNeedDataCB(GstAppSrc* pAppSrc, guint length, 
+        gpointer pSource);
+
+    /**
+     * @brief Called by the appsrc of a Shared Source when it has enough data.
+     * @param[in] pAppSrc appsrc that has enough data.
+     * @param[in] pSource pointer to the Shared Source component.
+     */
+    static void SharedSourceEnoughDataCB(GstAppSrc* pAppSrc, gpointer pSource);
+    
     /**
      * @brief Timer callback handler to invoke the RTSP Source's Stream manager.
      * @param pSource shared pointer to RTSP Source component to check/manage.
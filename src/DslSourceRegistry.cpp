@@ -0,0 +1,467 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslSourceRegistry.h"
+#include "DslSourceBintr.h"
+
+namespace DSL
+{
+    SharedDecoderBintr::SharedDecoderBintr(const char* name, const char* uri,
+        bool isLive)
+        : Bintr(name, true)
+        , m_uri(uri)
+        , m_isLive(isLive)
+        , m_pGstBus(NULL)
+        , m_reconnectTimerId(0)
+    {
+        LOG_FUNC();
+
+        m_pDecodeBin = DSL_ELEMENT_NEW("uridecodebin", name);
+        m_pAppSink = DSL_ELEMENT_NEW("appsink", name);
+
+        m_pDecodeBin->SetAttribute("uri", m_uri.c_str());
+
+        // Live URIs are delivered as soon as decoded. Non-live URIs are
+        // synchronized to the decoder's clock so all consumers see real-time.
+        m_pAppSink->SetAttribute("sync", !m_isLive);
+
+        // Never block the decoder on a slow fan-out, and don't hold an extra
+        // reference to the last sample, a buffer from the decoder's own pool.
+        m_pAppSink->SetAttribute("max-buffers", 1);
+        m_pAppSink->SetAttribute("drop", true);
+        m_pAppSink->SetAttribute("enable-last-sample", false);
+
+        GstAppSinkCallbacks callbacks = {NULL, NULL, SharedDecoderNewSampleCB};
+        gst_app_sink_set_callbacks((GstAppSink*)m_pAppSink->GetGObject(),
+            &callbacks, this, NULL);
+
+        g_signal_connect(m_pDecodeBin->GetGObject(), "pad-added",
+            G_CALLBACK(SharedDecoderOnPadAddedCB), this);
+
+        AddChild(m_pDecodeBin);
+        AddChild(m_pAppSink);
+
+        m_pGstBus = gst_pipeline_get_bus(GST_PIPELINE(GetGstElement()));
+        gst_bus_add_watch(m_pGstBus, SharedDecoderBusWatchCB, this);
+
+        LOG_INFO("");
+        LOG_INFO("Initial property values for SharedDecoderBintr '" << name << "'");
+        LOG_INFO("  uri               : " << m_uri);
+        LOG_INFO("  is-live           : " << m_isLive);
+    }
+
+    SharedDecoderBintr::~SharedDecoderBintr()
+    {
+        LOG_FUNC();
+
+        // Remove the reconnect timer first, so it can't restart the Pipeline.
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectMutex);
+            
+            if (m_reconnectTimerId)
+            {
+                g_source_remove(m_reconnectTimerId);
+                m_reconnectTimerId = 0;
+            }
+        }
+        // Stop the streaming threads before any members are destroyed. The
+        // base GstNodetr sets the state to NULL only after they are.
+        gst_element_set_state(GetGstElement(), GST_STATE_NULL);
+
+        gst_bus_remove_watch(m_pGstBus);
+        gst_object_unref(m_pGstBus);
+    }
+
+    bool SharedDecoderBintr::Play()
+    {
+        LOG_FUNC();
+
+        if (gst_element_set_state(GetGstElement(),
+            GST_STATE_PLAYING) == GST_STATE_CHANGE_FAILURE)
+        {
+            LOG_ERROR("SharedDecoderBintr '" << GetName()
+                << "' failed to change state to PLAYING for URI '"
+                << m_uri << "'");
+            return false;
+        }
+        return true;
+    }
+
+    bool SharedDecoderBintr::AddConsumer(SharedSourceBintr* pConsumer)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_consumersMutex);
+
+        if (std::find(m_consumers.begin(), m_consumers.end(), pConsumer)
+            != m_consumers.end())
+        {
+            LOG_ERROR("Shared Source '" << pConsumer->GetName()
+                << "' is already a consumer of SharedDecoderBintr '"
+                << GetName() << "'");
+            return false;
+        }
+        m_consumers.push_back(pConsumer);
+
+        LOG_INFO("Shared Source '" << pConsumer->GetName()
+            << "' added as consumer " << m_consumers.size()
+            << " of SharedDecoderBintr '" << GetName() << "'");
+        return true;
+    }
+
+    bool SharedDecoderBintr::RemoveConsumer(SharedSourceBintr* pConsumer)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_consumersMutex);
+
+        auto iconsumer = std::find(m_consumers.begin(), m_consumers.end(),
+            pConsumer);
+        if (iconsumer == m_consumers.end())
+        {
+            LOG_ERROR("Shared Source '" << pConsumer->GetName()
+                << "' is not a consumer of SharedDecoderBintr '"
+                << GetName() << "'");
+            return false;
+        }
+        m_consumers.erase(iconsumer);
+        return true;
+    }
+
+    uint SharedDecoderBintr::GetNumConsumers()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_consumersMutex);
+
+        return m_consumers.size();
+    }
+
+    void SharedDecoderBintr::HandleOnPadAdded(GstPad* pPad)
+    {
+        LOG_FUNC();
+
+        // Link the decoded video stream only, the audio stream is not used.
+        GstCaps* pCaps = gst_pad_query_caps(pPad, NULL);
+        std::string name = gst_structure_get_name(
+            gst_caps_get_structure(pCaps, 0));
+        gst_caps_unref(pCaps);
+
+        if (name.find("video") == std::string::npos)
+        {
+            return;
+        }
+        GstPad* pSinkPad = gst_element_get_static_pad(
+            m_pAppSink->GetGstElement(), "sink");
+
+        if (gst_pad_is_linked(pSinkPad))
+        {
+            LOG_WARN("SharedDecoderBintr '" << GetName()
+                << "' is already linked to a video stream");
+        }
+        else if (gst_pad_link(pPad, pSinkPad) != GST_PAD_LINK_OK)
+        {
+            LOG_ERROR("SharedDecoderBintr '" << GetName()
+                << "' failed to link the decoded video stream");
+        }
+        else
+        {
+            LOG_INFO("Video decode linked for SharedDecoderBintr '"
+                << GetName() << "'");
+        }
+        gst_object_unref(pSinkPad);
+    }
+
+    GstFlowReturn SharedDecoderBintr::HandleNewSample()
+    {
+        // No function log - called for every frame.
+
+        GstSample* pSample = gst_app_sink_pull_sample(
+            (GstAppSink*)m_pAppSink->GetGObject());
+        if (!pSample)
+        {
+            return GST_FLOW_OK;
+        }
+        GstBuffer* pBuffer = gst_sample_get_buffer(pSample);
+        GstCaps* pCaps = gst_sample_get_caps(pSample);
+
+        if (pBuffer and pCaps)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_consumersMutex);
+
+            // Each consumer queues a shallow copy that holds a reference to
+            // this buffer as its parent. The sample's reference is dropped 
+            // below, and the buffer returns to the decoder's pool only when
+            // the last consumer's copy is freed.
+            for (auto& iconsumer: m_consumers)
+            {
+                iconsumer->HandleSharedBuffer(pBuffer, pCaps);
+            }
+        }
+        gst_sample_unref(pSample);
+
+        return GST_FLOW_OK;
+    }
+
+    bool SharedDecoderBintr::HandleBusMessage(GstMessage* pMessage)
+    {
+        // No function log - called for every message.
+
+        switch (GST_MESSAGE_TYPE(pMessage))
+        {
+        case GST_MESSAGE_ERROR:
+        case GST_MESSAGE_WARNING:
+            {
+                GError* pError(NULL);
+                gchar* debugInfo(NULL);
+
+                if (GST_MESSAGE_TYPE(pMessage) == GST_MESSAGE_ERROR)
+                {
+                    gst_message_parse_error(pMessage, &pError, &debugInfo);
+                    LOG_ERROR("SharedDecoderBintr '" << GetName()
+                        << "' received error '" << pError->message
+                        << "' from '" << GST_OBJECT_NAME(pMessage->src) << "'");
+
+                    // A live URI is reconnected, so its consumers are only
+                    // warned. Otherwise, the error is final for all consumers.
+                    notifyConsumersOfError(pError, debugInfo, !m_isLive);
+                    if (m_isLive)
+                    {
+                        scheduleReconnect();
+                    }
+                }
+                else
+                {
+                    gst_message_parse_warning(pMessage, &pError, &debugInfo);
+                    LOG_WARN("SharedDecoderBintr '" << GetName()
+                        << "' received warning '" << pError->message
+                        << "' from '" << GST_OBJECT_NAME(pMessage->src) << "'");
+                }
+                LOG_DEBUG("Debug info: " << (debugInfo ? debugInfo : "none"));
+
+                g_error_free(pError);
+                g_free(debugInfo);
+                break;
+            }
+        case GST_MESSAGE_EOS:
+            {
+                LOG_INFO("SharedDecoderBintr '" << GetName()
+                    << "' received EOS for URI '" << m_uri << "'");
+
+                // EOS from a live URI means the connection was lost.
+                if (m_isLive)
+                {
+                    GError* pError = g_error_new(GST_RESOURCE_ERROR,
+                        GST_RESOURCE_ERROR_READ, 
+                        "Shared decoder lost connection to live URI - reconnecting");
+                    notifyConsumersOfError(pError, NULL, false);
+                    g_error_free(pError);
+                    
+                    scheduleReconnect();
+                    break;
+                }
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_consumersMutex);
+
+                for (auto& iconsumer: m_consumers)
+                {
+                    iconsumer->HandleSharedEos();
+                }
+                break;
+            }
+        default:
+            break;
+        }
+        return true;
+    }
+
+    int SharedDecoderBintr::HandleReconnectTimer()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectMutex);
+
+        LOG_INFO("SharedDecoderBintr '" << GetName() 
+            << "' reconnecting to URI '" << m_uri << "'");
+
+        // Tear down the connection and decode-bin completely. The decoded 
+        // video pad is re-added, and re-linked, on transition to PLAYING.
+        gst_element_set_state(GetGstElement(), GST_STATE_NULL);
+
+        if (!Play())
+        {
+            // Try again on the next interval.
+            return true;
+        }
+        m_reconnectTimerId = 0;
+        return false;
+    }
+
+    void SharedDecoderBintr::scheduleReconnect()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectMutex);
+
+        if (m_reconnectTimerId)
+        {
+            return;
+        }
+        LOG_INFO("SharedDecoderBintr '" << GetName() 
+            << "' scheduling reconnect in " << DSL_RTSP_CONNECTION_SLEEP_S 
+            << " seconds");
+        
+        m_reconnectTimerId = g_timeout_add(DSL_RTSP_CONNECTION_SLEEP_S*1000,
+            SharedDecoderReconnectTimerHandler, this);
+    }
+
+    void SharedDecoderBintr::notifyConsumersOfError(GError* pError,
+        const gchar* debugInfo, bool isFatal)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_consumersMutex);
+
+        for (auto& iconsumer: m_consumers)
+        {
+            iconsumer->HandleSharedError(pError, debugInfo, isFatal);
+        }
+    }
+
+    //*********************************************************************************
+
+    // Initialize the SourceRegistry single instance pointer
+    SourceRegistry* SourceRegistry::m_pInstance = NULL;
+
+    SourceRegistry* SourceRegistry::GetRegistry()
+    {
+        // one time initialization of the single instance pointer
+        if (!m_pInstance)
+        {
+            LOG_INFO("SourceRegistry Initialization");
+
+            // Single instantiation for the lib's lifetime
+            m_pInstance = new SourceRegistry();
+        }
+        return m_pInstance;
+    }
+
+    SourceRegistry::SourceRegistry()
+        : m_nextDecoderId(0)
+    {
+        LOG_FUNC();
+    }
+
+    SourceRegistry::~SourceRegistry()
+    {
+        LOG_FUNC();
+    }
+
+    bool SourceRegistry::AddConsumer(const char* uri, bool isLive,
+        SharedSourceBintr* pConsumer)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_registryMutex);
+
+        auto idecoder = m_decoders.find(uri);
+        if (idecoder != m_decoders.end())
+        {
+            // Decoder is already connected and running - join the fan-out.
+            return idecoder->second->AddConsumer(pConsumer);
+        }
+        std::string decoderName = "shared-decoder-"
+            + std::to_string(m_nextDecoderId++);
+
+        DSL_SHARED_DECODER_PTR pDecoder = DSL_SHARED_DECODER_NEW(
+            decoderName.c_str(), uri, isLive);
+
+        // Add the consumer first so that no decoded buffers are missed.
+        if (!pDecoder->AddConsumer(pConsumer) or !pDecoder->Play())
+        {
+            LOG_ERROR("SourceRegistry failed to start a new decoder for URI '"
+                << uri << "'");
+            return false;
+        }
+        m_decoders[uri] = pDecoder;
+
+        LOG_INFO("SourceRegistry started new decoder '" << decoderName
+            << "' for URI '" << uri << "'");
+        return true;
+    }
+
+    bool SourceRegistry::RemoveConsumer(const char* uri,
+        SharedSourceBintr* pConsumer)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_registryMutex);
+
+        auto idecoder = m_decoders.find(uri);
+        if (idecoder == m_decoders.end())
+        {
+            LOG_ERROR("SourceRegistry has no decoder for URI '" << uri << "'");
+            return false;
+        }
+        if (!idecoder->second->RemoveConsumer(pConsumer))
+        {
+            return false;
+        }
+        if (!idecoder->second->GetNumConsumers())
+        {
+            LOG_INFO("SourceRegistry stopping decoder '"
+                << idecoder->second->GetName() << "' for URI '" << uri
+                << "' - last consumer removed");
+
+            // Deleting the decoder stops its Pipeline
+            m_decoders.erase(idecoder);
+        }
+        return true;
+    }
+
+    uint SourceRegistry::GetNumDecoders()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_registryMutex);
+
+        return m_decoders.size();
+    }
+
+    static void SharedDecoderOnPadAddedCB(GstElement* pBin, GstPad* pPad,
+        gpointer pDecoder)
+    {
+        static_cast<SharedDecoderBintr*>(pDecoder)->HandleOnPadAdded(pPad);
+    }
+
+    static GstFlowReturn SharedDecoderNewSampleCB(GstAppSink* pAppSink,
+        gpointer pDecoder)
+    {
+        return static_cast<SharedDecoderBintr*>(pDecoder)->HandleNewSample();
+    }
+
+    static gboolean SharedDecoderBusWatchCB(GstBus* pBus, GstMessage* pMessage,
+        gpointer pDecoder)
+    {
+        return static_cast<SharedDecoderBintr*>(pDecoder)->
+            HandleBusMessage(pMessage);
+    }
+
+    static int SharedDecoderReconnectTimerHandler(gpointer pDecoder)
+    {
+        return static_cast<SharedDecoderBintr*>(pDecoder)->
+            HandleReconnectTimer();
+    }
+}
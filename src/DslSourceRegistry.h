@@ -0,0 +1,306 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_SOURCE_REGISTRY_H
+#define _DSL_SOURCE_REGISTRY_H
+
+#include "Dsl.h"
+#include "DslBintr.h"
+#include "DslElementr.h"
+
+#include <gst/app/gstappsink.h>
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_SHARED_DECODER_PTR std::shared_ptr<SharedDecoderBintr>
+    #define DSL_SHARED_DECODER_NEW(name, uri, isLive) \
+        std::shared_ptr<SharedDecoderBintr>(new SharedDecoderBintr(name, \
+            uri, isLive))
+
+    class SharedSourceBintr;
+
+    /**
+     * @class SharedDecoderBintr
+     * @brief Implements a stand-alone Pipeline that connects to, and decodes,
+     * a single URI on behalf of all Shared Sources -- in any number of
+     * Pipelines -- that consume the same URI. Each decoded buffer is fanned
+     * out to all consumers by reference. The buffer's memory is never copied.
+     * Decoder errors are forwarded to all consumers. A live URI is reconnected
+     * on error or end-of-stream, a non-live URI forwards its EOS instead.
+     */
+    class SharedDecoderBintr : public Bintr
+    {
+    public:
+
+        /**
+         * @brief ctor for the SharedDecoderBintr class
+         * @param[in] name unique name for the new SharedDecoderBintr
+         * @param[in] uri URI to connect to and decode.
+         * @param[in] isLive true if the URI is a live source, false otherwise.
+         */
+        SharedDecoderBintr(const char* name, const char* uri, bool isLive);
+
+        /**
+         * @brief dtor for the SharedDecoderBintr class
+         */
+        ~SharedDecoderBintr();
+
+        /**
+         * @brief Sets the decoder Pipeline to a state of PLAYING.
+         * @return true on successful state change, false otherwise.
+         */
+        bool Play();
+
+        /**
+         * @brief Adds a Shared Source as a consumer of the decoded buffers.
+         * @param[in] pConsumer Shared Source to add.
+         * @return true on successful add, false otherwise.
+         */
+        bool AddConsumer(SharedSourceBintr* pConsumer);
+
+        /**
+         * @brief Removes a Shared Source as a consumer of the decoded buffers.
+         * No further buffers will be delivered to the consumer on return.
+         * @param[in] pConsumer Shared Source to remove.
+         * @return true on successful remove, false otherwise.
+         */
+        bool RemoveConsumer(SharedSourceBintr* pConsumer);
+
+        /**
+         * @brief Gets the current number of consumers of the decoded buffers.
+         * @return current number of consumers.
+         */
+        uint GetNumConsumers();
+
+        /**
+         * @brief Handles the "pad-added" signal from the uridecodebin by
+         * linking the decoded video pad to the appsink.
+         * @param[in] pPad new pad added to the uridecodebin.
+         */
+        void HandleOnPadAdded(GstPad* pPad);
+
+        /**
+         * @brief Handles a new decoded sample by fanning out the buffer to
+         * all current consumers. Called on the decoder's streaming thread.
+         * @return GST_FLOW_OK always.
+         */
+        GstFlowReturn HandleNewSample();
+
+        /**
+         * @brief Handles all messages posted on the decoder Pipeline's bus.
+         * @param[in] pMessage new message to handle.
+         * @return true always to continue watching the bus.
+         */
+        bool HandleBusMessage(GstMessage* pMessage);
+
+        /**
+         * @brief Handles the reconnect timer for a live URI by restarting
+         * the decoder Pipeline after an error or loss of stream.
+         * @return false to destroy the one-shot timer on successful restart,
+         * true to retry on the next interval otherwise.
+         */
+        int HandleReconnectTimer();
+
+    private:
+
+        /**
+         * @brief Starts the reconnect timer if not already running.
+         */
+        void scheduleReconnect();
+
+        /**
+         * @brief Forwards an error to all current consumers.
+         * @param[in] pError error to forward.
+         * @param[in] debugInfo optional debug info, may be NULL.
+         * @param[in] isFatal true to forward as an error, false as a warning.
+         */
+        void notifyConsumersOfError(GError* pError, const gchar* debugInfo,
+            bool isFatal);
+
+        /**
+         * @brief URI this SharedDecoderBintr connects to and decodes.
+         */
+        std::string m_uri;
+
+        /**
+         * @brief true if the URI is a live source, false otherwise.
+         */
+        bool m_isLive;
+
+        /**
+         * @brief uridecodebin element for this SharedDecoderBintr.
+         */
+        DSL_ELEMENT_PTR m_pDecodeBin;
+
+        /**
+         * @brief appsink element for this SharedDecoderBintr.
+         */
+        DSL_ELEMENT_PTR m_pAppSink;
+
+        /**
+         * @brief bus for the decoder Pipeline.
+         */
+        GstBus* m_pGstBus;
+
+        /**
+         * @brief mutex to protect mutual access to the consumers.
+         */
+        DslMutex m_consumersMutex;
+
+        /**
+         * @brief current consumers of the decoded buffers.
+         */
+        std::vector<SharedSourceBintr*> m_consumers;
+
+        /**
+         * @brief mutex to protect mutual access to the reconnect timer id.
+         */
+        DslMutex m_reconnectMutex;
+
+        /**
+         * @brief gnome timer id for the live URI reconnect timer, 0 if not
+         * running.
+         */
+        uint m_reconnectTimerId;
+    };
+
+    /**
+     * @class SourceRegistry
+     * @brief Process-wide singleton that maps each URI in use by one or more
+     * Shared Sources to a single SharedDecoderBintr, so that camera connections
+     * and decoder instances scale with the number of URIs and not with the
+     * number of Pipelines. A decoder is created and started when its first
+     * consumer is added, and stopped and deleted when its last is removed.
+     */
+    class SourceRegistry
+    {
+    public:
+
+        /**
+         * @brief Returns a pointer to this singleton Registry
+         * @return instance pointer to the SourceRegistry
+         */
+        static SourceRegistry* GetRegistry();
+
+        /**
+         * @brief Ctor for this singleton SourceRegistry class
+         */
+        SourceRegistry();
+
+        /**
+         * @brief Dtor for this singleton SourceRegistry class
+         */
+        ~SourceRegistry();
+
+        /**
+         * @brief Adds a Shared Source as a consumer of a URI, creating and
+         * starting a new SharedDecoderBintr for the URI if not in use.
+         * @param[in] uri URI to consume.
+         * @param[in] isLive true if the URI is a live source. Used only
+         * if a new decoder is created.
+         * @param[in] pConsumer Shared Source to add.
+         * @return true on successful add, false otherwise.
+         */
+        bool AddConsumer(const char* uri, bool isLive,
+            SharedSourceBintr* pConsumer);
+
+        /**
+         * @brief Removes a Shared Source as a consumer of a URI, stopping and
+         * deleting the URI's SharedDecoderBintr if it was the last consumer.
+         * @param[in] uri URI the Shared Source is consuming.
+         * @param[in] pConsumer Shared Source to remove.
+         * @return true on successful remove, false otherwise.
+         */
+        bool RemoveConsumer(const char* uri, SharedSourceBintr* pConsumer);
+
+        /**
+         * @brief Gets the number of SharedDecoderBintrs currently in use.
+         * @return current number of decoders, one per URI in use.
+         */
+        uint GetNumDecoders();
+
+    private:
+
+        /**
+         * @brief instance pointer for this singleton class
+         */
+        static SourceRegistry* m_pInstance;
+
+        /**
+         * @brief mutex to protect mutual access to the registry
+         */
+        DslMutex m_registryMutex;
+
+        /**
+         * @brief map of URIs to the SharedDecoderBintr in use for each.
+         */
+        std::map<std::string, DSL_SHARED_DECODER_PTR> m_decoders;
+
+        /**
+         * @brief id to use for the name of the next new decoder.
+         */
+        uint m_nextDecoderId;
+    };
+
+    /**
+     * @brief Called on new Pad Added to link the decoded video pad.
+     * @param[in] pBin uridecodebin that added the pad.
+     * @param[in] pPad new pad added.
+     * @param[in] pDecoder pointer to the SharedDecoderBintr.
+     */
+    static void SharedDecoderOnPadAddedCB(GstElement* pBin, GstPad* pPad,
+        gpointer pDecoder);
+
+    /**
+     * @brief Called by the appsink on each new decoded sample.
+     * @param[in] pAppSink appsink with the new sample.
+     * @param[in] pDecoder pointer to the SharedDecoderBintr.
+     * @return GST_FLOW_OK always.
+     */
+    static GstFlowReturn SharedDecoderNewSampleCB(GstAppSink* pAppSink,
+        gpointer pDecoder);
+
+    /**
+     * @brief Called by the main-loop on each new message posted on the
+     * decoder Pipeline's bus.
+     * @param[in] pBus bus with the new message.
+     * @param[in] pMessage new message to handle.
+     * @param[in] pDecoder pointer to the SharedDecoderBintr.
+     * @return true always to continue watching the bus.
+     */
+    static gboolean SharedDecoderBusWatchCB(GstBus* pBus, GstMessage* pMessage,
+        gpointer pDecoder);
+
+    /**
+     * @brief Timer callback to reconnect a live URI's decoder Pipeline.
+     * @param[in] pDecoder pointer to the SharedDecoderBintr.
+     * @return false to destroy the timer on successful restart.
+     */
+    static int SharedDecoderReconnectTimerHandler(gpointer pDecoder);
+}
+
+#endif // _DSL_SOURCE_REGISTRY_H
@@ -224,6 +224,54 @@ namespace DSL
         
     };
 
+    // -------------------------------------------------------------------------------
+    
+    /**
+     * @struct DslMultiSurface
+     * @brief New multi surface buffer with one single surface, from a batched 
+     * surface buffer, repeated count times. Used as the source for a batched
+     * transform of multiple regions from the same frame.
+     */
+    struct DslMultiSurface : public NvBufSurface
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the DslMultiSurface structure
+         * @param pBatchedSurface batched surface buffer as source surface buffer
+         * @param index index into the batched surface list
+         * @param count number of times to repeat the indexed surface
+         */
+        DslMultiSurface(NvBufSurface* pBatchedSurface, int index, uint32_t count)
+            : NvBufSurface{0}
+            , m_surfaceParams(count, pBatchedSurface->surfaceList[index])
+        {   
+            LOG_FUNC();
+
+            // copy the shared surface properties
+            *static_cast<NvBufSurface*>(this) = *pBatchedSurface;
+            
+            numFilled = count;
+            batchSize = count;
+            surfaceList = m_surfaceParams.data();
+        }   
+
+        /**
+         * @brief dtor for the DslMultiSurface structure
+         */
+        ~DslMultiSurface()
+        {
+            LOG_FUNC();
+        }
+        
+    private:
+    
+        /**
+         * @brief count copies of the indexed surface's params.
+         */
+        std::vector<NvBufSurfaceParams> m_surfaceParams;
+    };
+
     // ---------------------------------------------------------------------------------------------------------------
     
     /**
@@ -286,6 +334,62 @@ namespace DSL
         NvBufSurfTransformRect m_dstRect;
     };
     
+    // ---------------------------------------------------------------------------------------------------------------
+    
+    /**
+     * @struct DslBatchTransformParams
+     * @brief Surface transform params with one source crop rectangle per 
+     * surface in the batch. Each crop is transformed to the upper left corner
+     * of its destination surface without scaling.
+     */
+    struct DslBatchTransformParams : public NvBufSurfTransformParams
+    {
+    public:
+
+        /**
+         * @brief ctor for the DslBatchTransformParams structure
+         * @param srcRects vector of source crop rectangles, one per surface.
+         */
+        DslBatchTransformParams(const std::vector<NvBufSurfTransformRect>& srcRects)
+            : NvBufSurfTransformParams{0}
+            , m_srcRects(srcRects) 
+        {
+            LOG_FUNC();
+
+            for (auto& irect: m_srcRects)
+            {
+                m_dstRects.push_back({0, 0, irect.width, irect.height});
+            }
+            src_rect = m_srcRects.data();
+            dst_rect = m_dstRects.data();
+            transform_flag = NVBUFSURF_TRANSFORM_CROP_SRC | 
+                NVBUFSURF_TRANSFORM_CROP_DST;
+            transform_filter = NvBufSurfTransformInter_Default;    
+        }   
+
+        /**
+         * @brief dtor for the DslBatchTransformParams structure
+         */
+        ~DslBatchTransformParams()
+        {
+            LOG_FUNC();
+        }
+
+    private:
+
+        /**
+         * @brief coordinates and dimensions of the rectangles to 
+         * transform within each source surface.
+         */
+        std::vector<NvBufSurfTransformRect> m_srcRects;
+
+        /**
+         * @brief coordinates and dimensions of the rectangles to 
+         * transform to within each destination surface.
+         */
+        std::vector<NvBufSurfTransformRect> m_dstRects;
+    };
+    
     // ---------------------------------------------------------------------------------------------------------------
 
     /**
@@ -392,6 +496,8 @@ namespace DSL
             : m_pBufSurface(NULL)
             , m_uniqueId(uniqueId)
             , m_isMapped(false)
+            , m_viewSurface{0}
+            , m_viewSurfaceParams{0}
         {
             LOG_FUNC();
 
@@ -416,6 +522,38 @@ namespace DSL
             m_dateTimeStr = dateTime;
         }
         
+        /**
+         * @brief ctor for a DslBufferSurface that is a view of a single surface
+         * within a mapped, batched DslBufferSurface. The view keeps the batched
+         * surface alive, and limits the surface dimensions to width and height.
+         * @param[in] pBatchSurface mapped, batched surface to view.
+         * @param[in] index index of the surface within the batch.
+         * @param[in] width width of the region to view from the upper left corner.
+         * @param[in] height height of the region to view from the upper left corner.
+         * @param[in] uniqueId unique id for the new view.
+         */
+        DslBufferSurface(std::shared_ptr<DslBufferSurface> pBatchSurface, 
+            uint32_t index, uint32_t width, uint32_t height, uint64_t uniqueId)
+            : m_pBufSurface(&m_viewSurface)
+            , m_uniqueId(uniqueId)
+            , m_isMapped(false)
+            , m_dateTimeStr(pBatchSurface->GetDateTimeStr())
+            , m_pBatchSurface(pBatchSurface)
+            , m_viewSurface(*(&(*pBatchSurface)))
+            , m_viewSurfaceParams((&(*pBatchSurface))->surfaceList[index])
+        {
+            LOG_FUNC();
+            
+            m_viewSurface.batchSize = 1;
+            m_viewSurface.numFilled = 1;
+            m_viewSurface.surfaceList = &m_viewSurfaceParams;
+            
+            m_viewSurfaceParams.width = width;
+            m_viewSurfaceParams.height = height;
+            m_viewSurfaceParams.planeParams.width[0] = width;
+            m_viewSurfaceParams.planeParams.height[0] = height;
+        }
+        
         /**
          * @brief dtor for the DslBufferSurface class
          */
@@ -423,6 +561,11 @@ namespace DSL
         {
             LOG_FUNC();
 
+            // Views are unmapped and destroyed with their batched surface.
+            if (m_pBatchSurface)
+            {
+                return;
+            }
             if (m_isMapped)
             {
                 LOG_DEBUG("NvBufSurfaceUnMap");
@@ -454,6 +597,22 @@ namespace DSL
                 == NvBufSurfTransformError_Success);
         }
         
+        /**
+         * @brief function to transform each surface in a multi source surface 
+         * to the surface with the same index in this batched surface, with 
+         * a single transform call.
+         * @return true on successful transform, false otherwise
+         */
+        bool TransformMultiSurface(DslMultiSurface& srcSurface, 
+            DslBatchTransformParams& transformParams)
+        {
+            m_pBufSurface->numFilled = srcSurface.numFilled;
+            
+            return (NvBufSurfTransform(&srcSurface, 
+                m_pBufSurface, &transformParams)
+                == NvBufSurfTransformError_Success);
+        }
+        
         /**
          * @brief function to map the newly transformed batched surface buffer.
          * @return true on successful mapping, false otherwise
@@ -527,6 +686,22 @@ namespace DSL
          * @brief date-time string for the creation of the DslBufferSurface
          */
         std::string m_dateTimeStr;
+        
+        /**
+         * @brief batched surface this DslBufferSurface is a view of, 
+         * nullptr if not a view.
+         */
+        std::shared_ptr<DslBufferSurface> m_pBatchSurface;
+        
+        /**
+         * @brief mono surface for a view, with a surface list of one.
+         */
+        NvBufSurface m_viewSurface;
+        
+        /**
+         * @brief copy of the viewed surface's params with limited dimensions.
+         */
+        NvBufSurfaceParams m_viewSurfaceParams;
 
     };
 
@@ -0,0 +1,351 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslXWindowEventMgr.h"
+#include "DslSinkBintr.h"
+
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+namespace DSL
+{
+    // Initialize the XWindowEventMgr single instance pointer
+    XWindowEventMgr* XWindowEventMgr::m_pInstance = NULL;
+
+    XWindowEventMgr* XWindowEventMgr::GetMgr()
+    {
+        // one time initialization of the single instance pointer
+        if (!m_pInstance)
+        {
+            LOG_INFO("XWindowEventMgr Initialization");
+
+            // Single instantiation for the lib's lifetime
+            m_pInstance = new XWindowEventMgr();
+        }
+        return m_pInstance;
+    }
+
+    XWindowEventMgr::XWindowEventMgr()
+        : m_pXDisplay(NULL)
+        , m_pEventThread(NULL)
+        , m_isRunning(false)
+        , m_wakeupPipe{-1, -1}
+    {
+        LOG_FUNC();
+
+        // Self-pipe used to wake the event thread from poll() on Stop/Notify.
+        // Both ends are non-blocking so that Notify never stalls the caller.
+        if (pipe(m_wakeupPipe) != 0)
+        {
+            LOG_ERROR("XWindowEventMgr failed to create wakeup pipe");
+            throw std::exception();
+        }
+        for (auto fd: m_wakeupPipe)
+        {
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+            fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+    }
+
+    XWindowEventMgr::~XWindowEventMgr()
+    {
+        LOG_FUNC();
+
+        Stop();
+
+        close(m_wakeupPipe[0]);
+        close(m_wakeupPipe[1]);
+    }
+
+    Display* XWindowEventMgr::AddWindowSink(WindowSinkBintr* pWindowSink)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_mgrMutex);
+
+        if (m_windowSinks.find(pWindowSink) != m_windowSinks.end())
+        {
+            // Already a user of the shared display.
+            return m_pXDisplay;
+        }
+        if (m_windowSinks.empty() and !Start())
+        {
+            return NULL;
+        }
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
+            m_windowSinks.insert(pWindowSink);
+        }
+        LOG_INFO("WindowSinkBintr '" << pWindowSink->GetName()
+            << "' added to the XWindowEventMgr");
+
+        return m_pXDisplay;
+    }
+
+    bool XWindowEventMgr::RemoveWindowSink(WindowSinkBintr* pWindowSink)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_mgrMutex);
+
+        {
+            // Wait for any in-progress dispatch to complete before removing
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatchMutex);
+            LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
+
+            if (m_windowSinks.find(pWindowSink) == m_windowSinks.end())
+            {
+                LOG_ERROR("WindowSinkBintr '" << pWindowSink->GetName()
+                    << "' was not found in the XWindowEventMgr");
+                return false;
+            }
+            m_windowSinks.erase(pWindowSink);
+
+            for (auto imap = m_windows.begin(); imap != m_windows.end();)
+            {
+                if (imap->second == pWindowSink)
+                {
+                    imap = m_windows.erase(imap);
+                }
+                else
+                {
+                    imap++;
+                }
+            }
+        }
+        LOG_INFO("WindowSinkBintr '" << pWindowSink->GetName()
+            << "' removed from the XWindowEventMgr");
+
+        // Shut down the event thread and close the display on last remove
+        if (m_windowSinks.empty())
+        {
+            Stop();
+        }
+        return true;
+    }
+
+    bool XWindowEventMgr::RegisterWindow(Window window,
+        WindowSinkBintr* pWindowSink)
+    {
+        LOG_FUNC();
+
+        // Note: the caller holds the display mutex while creating the Window
+
+        if (m_windowSinks.find(pWindowSink) == m_windowSinks.end())
+        {
+            LOG_ERROR("WindowSinkBintr '" << pWindowSink->GetName()
+                << "' must be added before registering a Window");
+            return false;
+        }
+        if (m_windows.find(window) != m_windows.end())
+        {
+            LOG_ERROR("Window = " << int_to_hex(window)
+                << " is already registered with the XWindowEventMgr");
+            return false;
+        }
+        m_windows[window] = pWindowSink;
+        return true;
+    }
+
+    GMutex* XWindowEventMgr::GetDisplayMutex()
+    {
+        // Note: do not log function entry - called for every XDisplay access
+        return &m_displayMutex;
+    }
+
+    bool XWindowEventMgr::HasQueuedEvents()
+    {
+        return (m_pXDisplay and XQLength(m_pXDisplay));
+    }
+
+    void XWindowEventMgr::Notify()
+    {
+        // A full pipe means a wakeup is already pending - safe to ignore.
+        if (write(m_wakeupPipe[1], "x", 1) < 0 and errno != EAGAIN)
+        {
+            LOG_ERROR("XWindowEventMgr failed to write to wakeup pipe");
+        }
+    }
+
+    uint XWindowEventMgr::GetNumWindowSinks()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
+
+        return m_windowSinks.size();
+    }
+
+    bool XWindowEventMgr::Start()
+    {
+        LOG_FUNC();
+
+        // Open a single connection to the X server for all Window Sinks. All
+        // calls on the connection are serialized with the display mutex.
+        m_pXDisplay = XOpenDisplay(NULL);
+        if (!m_pXDisplay)
+        {
+            LOG_ERROR("XWindowEventMgr failed to open XDisplay");
+            return false;
+        }
+        {
+            // The event thread compares itself with m_pEventThread under lock.
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
+            m_isRunning = true;
+            m_pEventThread = g_thread_new("dsl-xwindow-events",
+                XWindowEventThread, this);
+        }
+
+        LOG_INFO("XWindowEventMgr started with XDisplay connection fd = "
+            << ConnectionNumber(m_pXDisplay));
+        return true;
+    }
+
+    void XWindowEventMgr::Stop()
+    {
+        LOG_FUNC();
+
+        if (!m_pEventThread)
+        {
+            return;
+        }
+        // If called from a client handler on the event thread, the thread 
+        // can't be joined. It is detached instead, and exits on return from
+        // the handler without further use of the XDisplay.
+        if (g_thread_self() == m_pEventThread)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
+            m_isRunning = false;
+            g_thread_unref(m_pEventThread);
+            m_pEventThread = NULL;
+        }
+        else
+        {
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
+                m_isRunning = false;
+            }
+            Notify();
+            g_thread_join(m_pEventThread);
+            m_pEventThread = NULL;
+        }
+
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
+        XCloseDisplay(m_pXDisplay);
+        m_pXDisplay = NULL;
+
+        LOG_INFO("XWindowEventMgr stopped and XDisplay closed");
+    }
+
+    void XWindowEventMgr::HandleXWindowEvents()
+    {
+        LOG_FUNC();
+
+        struct pollfd fds[2];
+        fds[0].events = POLLIN;
+        fds[1].fd = m_wakeupPipe[0];
+        fds[1].events = POLLIN;
+
+        std::vector<std::pair<WindowSinkBintr*, XEvent>> events;
+
+        while (true)
+        {
+            // Read all pending events under lock, routing each by Window id.
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
+
+                if (!m_isRunning)
+                {
+                    break;
+                }
+                fds[0].fd = ConnectionNumber(m_pXDisplay);
+
+                while (XPending(m_pXDisplay))
+                {
+                    XEvent xEvent;
+                    XNextEvent(m_pXDisplay, &xEvent);
+
+                    auto imap = m_windows.find(xEvent.xany.window);
+                    if (imap != m_windows.end())
+                    {
+                        events.push_back(std::make_pair(imap->second, xEvent));
+                    }
+                }
+            }
+            // Dispatch outside of the display lock so that client callbacks
+            // can call back into the Window Sink services.
+            for (auto& ievent: events)
+            {
+                WindowSinkBintr::XWindowEventCallbacks callbacks;
+                {
+                    LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatchMutex);
+                    
+                    // Sink may have been removed after the event was read.
+                    bool isRegistered(false);
+                    {
+                        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
+                        isRegistered = (m_windowSinks.find(ievent.first)
+                            != m_windowSinks.end());
+                    }
+                    if (!isRegistered)
+                    {
+                        continue;
+                    }
+                    ievent.first->HandleXWindowEvent(ievent.second, callbacks);
+                }
+                // The client handlers are called from the copy, without the 
+                // dispatch mutex held, as a handler may delete its Window Sink.
+                WindowSinkBintr::CallXWindowEventHandlers(callbacks);
+                
+                // Exit now if stopped by the handler, as the XDisplay is closed
+                // and a new event thread may already have been started.
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
+                if (m_pEventThread != g_thread_self())
+                {
+                    LOG_INFO("XWindowEventMgr event thread stopped by client handler");
+                    return;
+                }
+            }
+            events.clear();
+            // Block until the X connection is readable, or until woken
+            if (poll(fds, 2, -1) < 0 and errno != EINTR)
+            {
+                LOG_ERROR("XWindowEventMgr poll failed with errno = " << errno);
+                break;
+            }
+            if (fds[1].revents & POLLIN)
+            {
+                char drain[64];
+                while (read(m_wakeupPipe[0], drain, sizeof(drain)) > 0);
+            }
+        }
+        LOG_INFO("XWindowEventMgr event thread exiting");
+    }
+
+    static gpointer XWindowEventThread(gpointer pXWindowEventMgr)
+    {
+        static_cast<XWindowEventMgr*>(pXWindowEventMgr)->HandleXWindowEvents();
+
+        return NULL;
+    }
+}
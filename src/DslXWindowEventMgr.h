@@ -0,0 +1,235 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_XWINDOW_EVENT_MGR_H
+#define _DSL_XWINDOW_EVENT_MGR_H
+
+#include "Dsl.h"
+
+#include <set>
+
+namespace DSL
+{
+    // Forward declaration - defined in DslSinkBintr.h
+    class WindowSinkBintr;
+
+    /**
+     * @class XWindowEventMgr
+     * @brief Process-wide singleton that owns the one XDisplay connection
+     * shared by all WindowSinkBintrs, and a single event thread that blocks
+     * on the connection's file descriptor. Incoming XEvents are routed to
+     * the owning WindowSinkBintr by Window id. The display is opened when the
+     * first WindowSinkBintr is added and closed when the last is removed.
+     */
+    class XWindowEventMgr
+    {
+    public:
+
+        /**
+         * @brief Returns a pointer to this singleton Manager
+         * @return instance pointer to the XWindowEventMgr
+         */
+        static XWindowEventMgr* GetMgr();
+
+        /**
+         * @brief Ctor for this singleton XWindowEventMgr class
+         */
+        XWindowEventMgr();
+
+        /**
+         * @brief Dtor for this singleton XWindowEventMgr class
+         */
+        ~XWindowEventMgr();
+
+        /**
+         * @brief Adds a WindowSinkBintr as a user of the shared XDisplay.
+         * The XDisplay is opened, and the event thread started, on first add.
+         * @param[in] pWindowSink unique WindowSinkBintr to add.
+         * @return pointer to the shared XDisplay, NULL on failure.
+         */
+        Display* AddWindowSink(WindowSinkBintr* pWindowSink);
+
+        /**
+         * @brief Removes a WindowSinkBintr previously added with AddWindowSink,
+         * along with all of its registered Windows. The event thread is stopped
+         * and the XDisplay closed when the last WindowSinkBintr is removed.
+         * @param[in] pWindowSink unique WindowSinkBintr to remove.
+         * @return true on successful remove, false otherwise.
+         */
+        bool RemoveWindowSink(WindowSinkBintr* pWindowSink);
+
+        /**
+         * @brief Registers a Window to route XEvents to its owning WindowSinkBintr.
+         * Must be called with the display mutex held.
+         * @param[in] window unique Window id to register.
+         * @param[in] pWindowSink WindowSinkBintr that owns the Window.
+         * @return true on successful registration, false otherwise.
+         */
+        bool RegisterWindow(Window window, WindowSinkBintr* pWindowSink);
+
+        /**
+         * @brief Gets the mutex that must be held for all calls on the shared
+         * XDisplay, from any thread.
+         * @return pointer to the shared display mutex.
+         */
+        GMutex* GetDisplayMutex();
+
+        /**
+         * @brief Determines if there are XEvents in the shared XDisplay's queue
+         * that have yet to be dispatched. Must be called with the display 
+         * mutex held.
+         * @return true if XEvents are queued, false otherwise.
+         */
+        bool HasQueuedEvents();
+
+        /**
+         * @brief Wakes the event thread so that any XEvents read into the
+         * XDisplay's queue by another thread are dispatched without delay.
+         */
+        void Notify();
+
+        /**
+         * @brief Gets the current number of WindowSinkBintrs using the shared
+         * XDisplay.
+         * @return number of WindowSinkBintrs currently added.
+         */
+        uint GetNumWindowSinks();
+
+        /**
+         * @brief Function for the event thread. Blocks on the XDisplay's
+         * connection file descriptor, dispatching all pending XEvents to the
+         * owning WindowSinkBintr on each wakeup, until stopped.
+         */
+        void HandleXWindowEvents();
+
+    private:
+
+        /**
+         * @brief Opens the shared XDisplay and starts the event thread.
+         * @return true on successful start, false otherwise.
+         */
+        bool Start();
+
+        /**
+         * @brief Stops and joins the event thread and closes the shared XDisplay.
+         */
+        void Stop();
+
+        /**
+         * @brief instance pointer for this singleton class
+         */
+        static XWindowEventMgr* m_pInstance;
+
+        /**
+         * @brief mutex to serialize Add/Remove of WindowSinkBintrs, held
+         * across the start and stop of the event thread.
+         */
+        DslMutex m_mgrMutex;
+
+        /**
+         * @brief mutex that must be held for all calls on the shared XDisplay.
+         */
+        DslMutex m_displayMutex;
+
+        /**
+         * @brief mutex held by the event thread while routing an event to a
+         * WindowSinkBintr, so that a WindowSinkBintr can't be removed while 
+         * it is handling an event. Not held while calling client handlers.
+         */
+        DslMutex m_dispatchMutex;
+
+        /**
+         * @brief shared XDisplay, NULL when no WindowSinkBintrs have been added.
+         */
+        Display* m_pXDisplay;
+
+        /**
+         * @brief handle to the event thread, NULL when not running.
+         */
+        GThread* m_pEventThread;
+
+        /**
+         * @brief set to true to start the event thread, false to stop.
+         */
+        bool m_isRunning;
+
+        /**
+         * @brief self-pipe used to wake the event thread from poll().
+         * [0] = read end, [1] = write end.
+         */
+        int m_wakeupPipe[2];
+
+        /**
+         * @brief set of WindowSinkBintrs currently using the shared XDisplay.
+         */
+        std::set<WindowSinkBintr*> m_windowSinks;
+
+        /**
+         * @brief map of registered Window ids to their owning WindowSinkBintr.
+         */
+        std::map<Window, WindowSinkBintr*> m_windows;
+    };
+
+    /**
+     * @brief Thread function for the XWindowEventMgr event thread.
+     * @param[in] pXWindowEventMgr pointer to the singleton XWindowEventMgr.
+     * @return NULL on thread exit.
+     */
+    static gpointer XWindowEventThread(gpointer pXWindowEventMgr);
+
+    #define LOCK_XDISPLAY_FOR_CURRENT_SCOPE() LockXDisplayForCurrentScope xlock
+
+    /**
+     * @class LockXDisplayForCurrentScope
+     * @brief Locks the shared XDisplay for the current scope {}. On unlock,
+     * the event thread is notified if the calling thread has read any XEvents
+     * into the XDisplay's queue.
+     */
+    class LockXDisplayForCurrentScope
+    {
+    public:
+        LockXDisplayForCurrentScope()
+            : m_pMgr(XWindowEventMgr::GetMgr())
+            , m_pMutex(XWindowEventMgr::GetMgr()->GetDisplayMutex())
+        {
+            g_mutex_lock(m_pMutex);
+        }
+
+        ~LockXDisplayForCurrentScope()
+        {
+            bool hasQueuedEvents = m_pMgr->HasQueuedEvents();
+            g_mutex_unlock(m_pMutex);
+            if (hasQueuedEvents)
+            {
+                m_pMgr->Notify();
+            }
+        }
+
+    private:
+        XWindowEventMgr* m_pMgr;
+        GMutex* m_pMutex;
+    };
+}
+
+#endif // _DSL_XWINDOW_EVENT_MGR_H
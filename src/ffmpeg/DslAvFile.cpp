@@ -40,7 +40,11 @@ namespace DSL
     {
         LOG_FUNC();
         
-        avformat_network_init();
+        // Network initialization is only required for remote media
+        if (strstr(filepath, "://"))
+        {
+            avformat_network_init();
+        }
         
         m_pFormatCtx = avformat_alloc_context();
         
@@ -49,44 +53,57 @@ namespace DSL
             LOG_ERROR("Unable to open video file: " << filepath);
             throw std::invalid_argument("Invalid media file - failed to open.");
         }
-        // Retrieve stream information
-        if (avformat_find_stream_info(m_pFormatCtx, NULL) < 0)
+        
+        // Containers such as MP4 and MOV provide the dimensions and frame-rate
+        // in their headers. The full stream-info probe, which reads and 
+        // decodes frames, is only required when the headers are incomplete.
+        if (!getVideoParams(true))
         {
-            LOG_ERROR("Unable to find stream info from file: " << filepath);
-            throw std::invalid_argument("Invalid Media File - no stream info.");
+            // Retrieve stream information
+            if (avformat_find_stream_info(m_pFormatCtx, NULL) < 0)
+            {
+                LOG_ERROR("Unable to find stream info from file: " << filepath);
+                throw std::invalid_argument("Invalid Media File - no stream info.");
+            }
+            if(!getVideoParams(false))
+            {
+                LOG_ERROR("Unsupported codec found in media file: " << filepath);
+                throw std::invalid_argument(
+                    "Invalid media file - NO video codec found.");
+            }
         }
-
-        bool videoCodecFound(false);
-        
+        LOG_INFO("Video codec data found in media file: " << filepath);
+        LOG_INFO("  dimensions : " << videoWidth << "x" << videoHeight);
+        LOG_INFO("  frame-rate : " << fpsN << "/" << fpsD);
+    }
+    
+    bool AvInputFile::getVideoParams(bool requireAll)
+    {
         for (int i = 0 ; i < m_pFormatCtx->nb_streams; i++)
         {
-            AVCodecParameters* pCodecParameters = NULL;
-            pCodecParameters = m_pFormatCtx->streams[i]->codecpar;
+            AVCodecParameters* pCodecParameters = 
+                m_pFormatCtx->streams[i]->codecpar;
 
+            // We only want the first video codec, on the chance 
+            // that there are multiple? 
             if (pCodecParameters->codec_type == AVMEDIA_TYPE_VIDEO)
             {
-                // We only want the first video codec, on the chance 
-                // that there are multiple? 
-                if(!videoCodecFound)
+                AVRational frameRate = m_pFormatCtx->streams[i]->r_frame_rate;
+                
+                if (requireAll and (!pCodecParameters->width or 
+                    !pCodecParameters->height or 
+                    frameRate.num <= 0 or frameRate.den <= 0))
                 {
-                    videoCodecFound = true;
-                    videoWidth = pCodecParameters->width;
-                    videoHeight = pCodecParameters->height;
-                    fpsN = m_pFormatCtx->streams[i]->r_frame_rate.num;
-                    fpsD = m_pFormatCtx->streams[i]->r_frame_rate.den;
-
-                    LOG_INFO("Video codec data found in media file: " << filepath);
-                    LOG_INFO("  dimensions : " << videoWidth << "x" << videoHeight);
-                    LOG_INFO("  frame-rate : " << fpsN << "/" << fpsD);
+                    return false;
                 }
+                videoWidth = pCodecParameters->width;
+                videoHeight = pCodecParameters->height;
+                fpsN = frameRate.num;
+                fpsD = frameRate.den;
+                return true;
             }
         }
-        if(!videoCodecFound)
-        {
-            LOG_ERROR("Unsupported codec found in media file: " << filepath);
-            throw std::invalid_argument(
-                "Invalid media file - NO video codec found.");
-        }
+        return false;
     }
         
     AvInputFile::~AvInputFile()
@@ -109,6 +126,28 @@ namespace DSL
         , m_pScaleContext(NULL)
     {
         LOG_FUNC();
+        
+        encode(pBufferSurface, filepath, NULL);
+    }
+    
+    AvJpgOutputFile::AvJpgOutputFile(
+        std::shared_ptr<DslBufferSurface> pBufferSurface, 
+        std::vector<uint8_t>& jpegData)
+        : m_rgbaImage(NULL)
+        , m_outfile(NULL)
+        , m_pPkt(NULL)
+        , m_pMjpegCodecContext(NULL)
+        , m_pScaleContext(NULL)
+    {
+        LOG_FUNC();
+        
+        encode(pBufferSurface, NULL, &jpegData);
+    }
+    
+    void AvJpgOutputFile::encode(std::shared_ptr<DslBufferSurface> pBufferSurface, 
+        const char* filepath, std::vector<uint8_t>* pJpegData)
+    {
+        LOG_FUNC();
 
         // Get the dimensions of the buffer-surface
         uint width = (&(*pBufferSurface))->surfaceList[0].width;
@@ -235,7 +274,15 @@ namespace DSL
         }
         
         // Open the output file using the provided filepath
-        m_outfile = fopen(filepath, "wb");
+        if (filepath)
+        {
+            m_outfile = fopen(filepath, "wb");
+            if (!m_outfile)
+            {
+                LOG_ERROR("Failed to open output file '" << filepath << "'");
+                throw std::system_error();
+            }
+        }
         while (retval >= 0)
         {
             retval = avcodec_receive_packet(m_pMjpegCodecContext, m_pPkt);
@@ -248,7 +295,16 @@ namespace DSL
                 LOG_ERROR("Failed to send frame to codec: AV_CODEC_ID_MJPEG");
                 throw std::system_error();
             }
-            fwrite(m_pPkt->data, 1, m_pPkt->size, m_outfile);
+            if (pJpegData)
+            {
+                pJpegData->insert(pJpegData->end(), 
+                    m_pPkt->data, m_pPkt->data + m_pPkt->size);
+            }
+            else
+            {
+                fwrite(m_pPkt->data, 1, m_pPkt->size, m_outfile);
+            }
+            av_packet_unref(m_pPkt);
         }
         
         av_freep(&pDstFrame->data[0]);
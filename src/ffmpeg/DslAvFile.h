@@ -77,6 +77,14 @@ namespace DSL
         
     private:
     
+        /**
+         * @brief Reads the dimensions and frame-rate of the first video stream.
+         * @param[in] requireAll if true, fails if any value is unknown.
+         * @return true if a video stream was found, and all values are known 
+         * when required, false otherwise.
+         */
+        bool getVideoParams(bool requireAll);
+    
         /**
          * @brief pointer to a AV Format Context populated with avformat_open_input.
          */
@@ -101,6 +109,14 @@ namespace DSL
         AvJpgOutputFile(std::shared_ptr<DslBufferSurface> pBufferSurface, 
             const char* filepath);
         
+        /**
+         * @brief ctor for the AvJpgOutputFile utility class to encode to memory.
+         * @param[in] pBufferSurface machine aligned surface buffer.
+         * @param[out] jpegData vector to receive the encoded JPEG image.
+         */
+        AvJpgOutputFile(std::shared_ptr<DslBufferSurface> pBufferSurface, 
+            std::vector<uint8_t>& jpegData);
+        
         /**
          * @brief ctor for the AvJpgOutputFile utility class.
          */
@@ -108,6 +124,16 @@ namespace DSL
         
     private:
     
+        /**
+         * @brief Encodes the buffer-surface to JPEG, writing the image to either
+         * filepath or pJpegData.
+         * @param[in] pBufferSurface machine aligned surface buffer.
+         * @param[in] filepath for the JPEG output file to save, NULL if none.
+         * @param[out] pJpegData vector to receive the encoded image, NULL if none.
+         */
+        void encode(std::shared_ptr<DslBufferSurface> pBufferSurface, 
+            const char* filepath, std::vector<uint8_t>* pJpegData);
+    
         /**
          * @brief buffer for the packed RGBA Image.
          */
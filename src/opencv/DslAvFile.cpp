@@ -66,6 +66,31 @@ namespace DSL
         : m_pBgrFrame(NULL)
     {
         LOG_FUNC();
+        
+        convert(pBufferSurface);
+
+        cv::imwrite(filepath, *m_pBgrFrame);        
+    }
+    
+    AvJpgOutputFile::AvJpgOutputFile(
+        std::shared_ptr<DslBufferSurface> pBufferSurface, 
+        std::vector<uint8_t>& jpegData)
+        : m_pBgrFrame(NULL)
+    {
+        LOG_FUNC();
+        
+        convert(pBufferSurface);
+
+        if (!cv::imencode(".jpg", *m_pBgrFrame, jpegData))
+        {
+            LOG_ERROR("Failed to encode JPEG image to memory");
+            throw std::system_error();
+        }
+    }
+    
+    void AvJpgOutputFile::convert(std::shared_ptr<DslBufferSurface> pBufferSurface)
+    {
+        LOG_FUNC();
 
         // Get the dimensions of the buffer-surface
         uint width = (&(*pBufferSurface))->surfaceList[0].width;
@@ -85,8 +110,6 @@ namespace DSL
 #else
         cv::cvtColor(in_mat, *m_pBgrFrame, CV_RGBA2BGR);
 #endif
-
-        cv::imwrite(filepath, *m_pBgrFrame);        
     }
     
     AvJpgOutputFile::~AvJpgOutputFile()
@@ -97,12 +97,26 @@ namespace DSL
         AvJpgOutputFile(std::shared_ptr<DslBufferSurface> pBufferSurface, 
             const char* filepath);
         
+        /**
+         * @brief ctor for the AvJpgOutputFile utility class to encode to memory.
+         * @param[in] pBufferSurface machine aligned surface buffer.
+         * @param[out] jpegData vector to receive the encoded JPEG image.
+         */
+        AvJpgOutputFile(std::shared_ptr<DslBufferSurface> pBufferSurface, 
+            std::vector<uint8_t>& jpegData);
+        
         /**
          * @brief ctor for the AvJpgOutputFile utility class.
          */
         ~AvJpgOutputFile();
         
     private:
+    
+        /**
+         * @brief Converts the RGBA buffer-surface to the BGR frame.
+         * @param[in] pBufferSurface machine aligned surface buffer.
+         */
+        void convert(std::shared_ptr<DslBufferSurface> pBufferSurface);
         
         /**
          * @brief SW Scale utility context to provide context all Scale/format calls.
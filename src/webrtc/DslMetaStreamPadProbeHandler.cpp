@@ -0,0 +1,669 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslMetaStreamPadProbeHandler.h"
+#include "DslSoupServerMgr.h"
+
+namespace DSL
+{
+    /**
+     * @brief Appends an unsigned LEB128 varint to a message buffer.
+     */
+    static void PutVarint(std::vector<guint8>& buf, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            buf.push_back((guint8)(value | 0x80));
+            value >>= 7;
+        }
+        buf.push_back((guint8)value);
+    }
+
+    /**
+     * @brief Appends a signed value as a zigzag varint to a message buffer,
+     * so that small negative deltas stay small on the wire.
+     */
+    static void PutZigzag(std::vector<guint8>& buf, int64_t value)
+    {
+        PutVarint(buf, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+    }
+
+    /**
+     * @brief Quantizes a confidence value to a single byte.
+     */
+    static guint8 QuantizeConfidence(float confidence)
+    {
+        return (guint8)(CLAMP(confidence, 0.0, 1.0) * 255.0 + 0.5);
+    }
+
+    MetaStreamPadProbeHandler::MetaStreamPadProbeHandler(const char* name,
+        const char* path, uint keyFrameInterval, uint maxRate)
+        : PadProbeBufferHandler(name)
+        , m_path(path)
+        , m_keyFrameInterval(keyFrameInterval)
+        , m_maxRate(maxRate)
+        , m_flushSourceId(0)
+        , m_pJsonParser(NULL)
+        , m_sent(0)
+        , m_dropped(0)
+    {
+        LOG_FUNC();
+
+        // Route all connections on our path to this handler.
+        if (!SoupServerMgr::GetMgr()->AddMetaStreamHandler(this))
+        {
+            throw std::exception();
+        }
+
+        // New JSON Parser to use for all client subscription messages
+        m_pJsonParser = json_parser_new();
+
+        // Enable now
+        if (!SetEnabled(true))
+        {
+            throw std::exception();
+        }
+    }
+
+    MetaStreamPadProbeHandler::~MetaStreamPadProbeHandler()
+    {
+        LOG_FUNC();
+
+        // Remove first so that no new connections can be routed to us.
+        SoupServerMgr::GetMgr()->RemoveMetaStreamHandler(this);
+
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        if (m_flushSourceId)
+        {
+            g_source_remove(m_flushSourceId);
+        }
+        for (auto& ivec: m_clients)
+        {
+            FreeClient(ivec);
+        }
+        m_clients.clear();
+
+        if (m_pJsonParser)
+        {
+            g_object_unref(G_OBJECT(m_pJsonParser));
+        }
+    }
+
+    const char* MetaStreamPadProbeHandler::GetPath()
+    {
+        LOG_FUNC();
+
+        return m_path.c_str();
+    }
+
+    uint MetaStreamPadProbeHandler::GetKeyFrameInterval()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        return m_keyFrameInterval;
+    }
+
+    void MetaStreamPadProbeHandler::SetKeyFrameInterval(uint keyFrameInterval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        m_keyFrameInterval = keyFrameInterval;
+
+        // Start every source over on a key-frame with the new interval
+        for (auto& imap: m_sourceStates)
+        {
+            imap.second.framesSinceKeyFrame = 0;
+        }
+    }
+
+    uint MetaStreamPadProbeHandler::GetMaxRate()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        return m_maxRate;
+    }
+
+    void MetaStreamPadProbeHandler::SetMaxRate(uint maxRate)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        m_maxRate = maxRate;
+    }
+
+    void MetaStreamPadProbeHandler::GetStats(uint* clients,
+        uint64_t* sent, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        *clients = m_clients.size();
+        *sent = m_sent;
+        *dropped = m_dropped;
+    }
+
+    void MetaStreamPadProbeHandler::AddConnection(
+        SoupWebsocketConnection* pConnection)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        MetaStreamClient* pClient = new MetaStreamClient();
+        pClient->pHandler = this;
+
+        // Need to add a reference so the object won't be freed on return.
+        pClient->pConnection = pConnection;
+        g_object_ref(G_OBJECT(pConnection));
+
+        // New clients get all sources and message types until they subscribe
+        pClient->topics = (1 << (DSL_META_STREAM_MSG_TYPE_OBJECTS-1)) |
+            (1 << (DSL_META_STREAM_MSG_TYPE_OCCURRENCES-1));
+        pClient->maxRate = m_maxRate;
+        pClient->dropped = 0;
+
+        pClient->closedSignalHandlerId = g_signal_connect(G_OBJECT(pConnection),
+            "closed", G_CALLBACK(on_meta_stream_closed_cb), (gpointer)pClient);
+        pClient->messageSignalHandlerId = g_signal_connect(G_OBJECT(pConnection),
+            "message", G_CALLBACK(on_meta_stream_message_cb), (gpointer)pClient);
+
+        m_clients.push_back(pClient);
+
+        LOG_INFO("New client connected to Meta-Stream Handler '" << GetName()
+            << "' on path '" << m_path << "'");
+    }
+
+    void MetaStreamPadProbeHandler::OnClosed(MetaStreamClient* pClient)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        m_clients.erase(std::remove(m_clients.begin(), m_clients.end(),
+            pClient), m_clients.end());
+        FreeClient(pClient);
+
+        LOG_INFO("Client disconnected from Meta-Stream Handler '"
+            << GetName() << "'");
+    }
+
+    void MetaStreamPadProbeHandler::OnMessage(MetaStreamClient* pClient,
+        SoupWebsocketDataType dataType, GBytes* message)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        if (dataType != SOUP_WEBSOCKET_DATA_TEXT)
+        {
+            LOG_WARN("Meta-Stream Handler '" << GetName()
+                << "' received unexpected binary message");
+            return;
+        }
+        gsize size(0);
+        const gchar* data = (const gchar*)g_bytes_get_data(message, &size);
+
+        if (!json_parser_load_from_data(m_pJsonParser, data, size, NULL))
+        {
+            LOG_ERROR("Meta-Stream Handler '" << GetName()
+                << "' failed to parse subscription message");
+            return;
+        }
+        JsonNode* pRoot = json_parser_get_root(m_pJsonParser);
+        if (!pRoot or !JSON_NODE_HOLDS_OBJECT(pRoot))
+        {
+            LOG_ERROR("Meta-Stream Handler '" << GetName()
+                << "' received invalid subscription message");
+            return;
+        }
+        JsonObject* pObject = json_node_get_object(pRoot);
+
+        if (json_object_has_member(pObject, "sources"))
+        {
+            JsonNode* pSourcesNode = json_object_get_member(pObject, "sources");
+            JsonArray* pSources = (JSON_NODE_HOLDS_ARRAY(pSourcesNode))
+                ? json_node_get_array(pSourcesNode) : NULL;
+            pClient->sources.clear();
+            for (uint i = 0; pSources and i < json_array_get_length(pSources); i++)
+            {
+                // Source-ids must be non-negative integers, skip all others.
+                JsonNode* pSource = json_array_get_element(pSources, i);
+                if (!JSON_NODE_HOLDS_VALUE(pSource) or 
+                    json_node_get_value_type(pSource) != G_TYPE_INT64 or
+                    json_node_get_int(pSource) < 0)
+                {
+                    LOG_WARN("Meta-Stream Handler '" << GetName()
+                        << "' received invalid source-id at index " << i);
+                    continue;
+                }
+                pClient->sources.insert((uint)json_node_get_int(pSource));
+            }
+        }
+        if (json_object_has_member(pObject, "topics"))
+        {
+            JsonNode* pTopicsNode = json_object_get_member(pObject, "topics");
+            JsonArray* pTopics = (JSON_NODE_HOLDS_ARRAY(pTopicsNode))
+                ? json_node_get_array(pTopicsNode) : NULL;
+            pClient->topics = 0;
+            for (uint i = 0; pTopics and i < json_array_get_length(pTopics); i++)
+            {
+                // Topics must be strings, skip all others.
+                JsonNode* pTopic = json_array_get_element(pTopics, i);
+                if (!JSON_NODE_HOLDS_VALUE(pTopic) or 
+                    json_node_get_value_type(pTopic) != G_TYPE_STRING)
+                {
+                    LOG_WARN("Meta-Stream Handler '" << GetName()
+                        << "' received invalid topic at index " << i);
+                    continue;
+                }
+                std::string topic(json_node_get_string(pTopic));
+                if (topic == "objects")
+                {
+                    pClient->topics |= (1 << (DSL_META_STREAM_MSG_TYPE_OBJECTS-1));
+                }
+                else if (topic == "occurrences")
+                {
+                    pClient->topics |=
+                        (1 << (DSL_META_STREAM_MSG_TYPE_OCCURRENCES-1));
+                }
+                else
+                {
+                    LOG_WARN("Meta-Stream Handler '" << GetName()
+                        << "' received unknown topic '" << topic << "'");
+                }
+            }
+        }
+        if (json_object_has_member(pObject, "maxRate"))
+        {
+            JsonNode* pMaxRate = json_object_get_member(pObject, "maxRate");
+            if (!JSON_NODE_HOLDS_VALUE(pMaxRate) or 
+                json_node_get_value_type(pMaxRate) != G_TYPE_INT64 or
+                json_node_get_int(pMaxRate) < 0)
+            {
+                LOG_WARN("Meta-Stream Handler '" << GetName()
+                    << "' received invalid max-rate - current value unchanged");
+            }
+            else
+            {
+                pClient->maxRate = (uint)json_node_get_int(pMaxRate);
+            }
+        }
+        LOG_INFO("Meta-Stream Handler '" << GetName()
+            << "' updated client subscription: sources = "
+            << pClient->sources.size() << ", topics = " << pClient->topics
+            << ", max-rate = " << pClient->maxRate);
+    }
+
+    gboolean MetaStreamPadProbeHandler::Flush()
+    {
+        std::vector<std::pair<SoupWebsocketConnection*, GBytes*>> sends;
+        bool isPending(false);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+            m_flushSourceId = 0;
+
+            for (auto& ivec: m_clients)
+            {
+                if (ivec->queue.empty())
+                {
+                    continue;
+                }
+                // Hold back while the client's socket can't take more data.
+                // Its queue will fill and be dropped if it doesn't recover.
+                GOutputStream* pStream = g_io_stream_get_output_stream(
+                    soup_websocket_connection_get_io_stream(ivec->pConnection));
+                if (G_IS_POLLABLE_OUTPUT_STREAM(pStream) and
+                    !g_pollable_output_stream_is_writable(
+                        G_POLLABLE_OUTPUT_STREAM(pStream)))
+                {
+                    isPending = true;
+                    continue;
+                }
+                for (auto& imsg: ivec->queue)
+                {
+                    g_object_ref(G_OBJECT(ivec->pConnection));
+                    sends.push_back(std::make_pair(ivec->pConnection, imsg));
+                }
+                ivec->queue.clear();
+            }
+            if (isPending)
+            {
+                m_flushSourceId = g_timeout_add(10, meta_stream_flush_cb, this);
+            }
+        }
+        // Send outside of the lock so the streaming thread is never held up
+        uint64_t sent(0);
+        for (auto& isend: sends)
+        {
+            if (soup_websocket_connection_get_state(isend.first) ==
+                SOUP_WEBSOCKET_STATE_OPEN)
+            {
+                gsize size(0);
+                gconstpointer data = g_bytes_get_data(isend.second, &size);
+                soup_websocket_connection_send_binary(isend.first, data, size);
+                sent++;
+            }
+            g_bytes_unref(isend.second);
+            g_object_unref(G_OBJECT(isend.first));
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        m_sent += sent;
+
+        return G_SOURCE_REMOVE;
+    }
+
+    GstPadProbeReturn MetaStreamPadProbeHandler::HandlePadData(
+        GstPadProbeInfo* pInfo)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        if (!m_isEnabled or m_clients.empty())
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        // Only encode the message types that at least one client wants
+        uint topics(0);
+        for (auto& ivec: m_clients)
+        {
+            topics |= ivec->topics;
+        }
+
+        GstBuffer* pBuffer = (GstBuffer*)pInfo->data;
+
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        if (!pBatchMeta)
+        {
+            return GST_PAD_PROBE_OK;
+        }
+
+        // For each frame in the batched meta data
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list;
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            if (pFrameMeta == NULL)
+            {
+                continue;
+            }
+            if (topics & (1 << (DSL_META_STREAM_MSG_TYPE_OBJECTS-1)))
+            {
+                SourceState& state = m_sourceStates[pFrameMeta->source_id];
+                bool isKeyFrame = (state.framesSinceKeyFrame == 0);
+                state.framesSinceKeyFrame =
+                    (state.framesSinceKeyFrame + 1) % m_keyFrameInterval;
+
+                GBytes* pMessage = EncodeObjects(pFrameMeta, isKeyFrame);
+                if (pMessage)
+                {
+                    QueueMessage(pFrameMeta->source_id,
+                        DSL_META_STREAM_MSG_TYPE_OBJECTS, isKeyFrame, pMessage);
+                    g_bytes_unref(pMessage);
+                }
+            }
+            if (topics & (1 << (DSL_META_STREAM_MSG_TYPE_OCCURRENCES-1)))
+            {
+                // Occurrences are self-contained, i.e. always key-frames
+                GBytes* pMessage = EncodeOccurrences(pFrameMeta);
+                if (pMessage)
+                {
+                    QueueMessage(pFrameMeta->source_id,
+                        DSL_META_STREAM_MSG_TYPE_OCCURRENCES, true, pMessage);
+                    g_bytes_unref(pMessage);
+                }
+            }
+        }
+        return GST_PAD_PROBE_OK;
+    }
+
+    GBytes* MetaStreamPadProbeHandler::EncodeObjects(NvDsFrameMeta* pFrameMeta,
+        bool isKeyFrame)
+    {
+        uint count = g_list_length(pFrameMeta->obj_meta_list);
+        if (!count and !isKeyFrame)
+        {
+            return NULL;
+        }
+        SourceState& state = m_sourceStates[pFrameMeta->source_id];
+        if (isKeyFrame)
+        {
+            state.references.clear();
+        }
+
+        std::vector<guint8> buf;
+        buf.reserve(16 + count*12);
+
+        buf.push_back(DSL_META_STREAM_VERSION);
+        buf.push_back(DSL_META_STREAM_MSG_TYPE_OBJECTS);
+        buf.push_back(isKeyFrame ? DSL_META_STREAM_MSG_FLAG_KEY_FRAME : 0);
+        PutVarint(buf, pFrameMeta->source_id);
+        PutVarint(buf, pFrameMeta->frame_num);
+        PutVarint(buf, pFrameMeta->buf_pts / GST_MSECOND);
+        PutVarint(buf, count);
+
+        for (NvDsMetaList* pMeta = pFrameMeta->obj_meta_list; pMeta;
+            pMeta = pMeta->next)
+        {
+            NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pMeta->data);
+
+            // Quantize the box to whole pixels
+            std::array<int, 4> box = {
+                (int)lround(pObjectMeta->rect_params.left),
+                (int)lround(pObjectMeta->rect_params.top),
+                (int)lround(pObjectMeta->rect_params.width),
+                (int)lround(pObjectMeta->rect_params.height)};
+
+            bool isTracked = (pObjectMeta->object_id != UNTRACKED_OBJECT_ID);
+            const std::array<int, 4>* pReference(NULL);
+
+            if (isTracked)
+            {
+                if (isKeyFrame)
+                {
+                    state.references[pObjectMeta->object_id] = box;
+                }
+                else
+                {
+                    auto iref = state.references.find(pObjectMeta->object_id);
+                    if (iref != state.references.end())
+                    {
+                        pReference = &iref->second;
+                    }
+                }
+            }
+            buf.push_back((isTracked ? DSL_META_STREAM_OBJ_FLAG_TRACKED : 0) |
+                (pReference ? DSL_META_STREAM_OBJ_FLAG_DELTA : 0));
+            PutZigzag(buf, pObjectMeta->class_id);
+            if (isTracked)
+            {
+                PutVarint(buf, pObjectMeta->object_id);
+            }
+            buf.push_back(QuantizeConfidence(pObjectMeta->confidence));
+
+            for (uint i = 0; i < 4; i++)
+            {
+                PutZigzag(buf, (pReference) ? box[i] - (*pReference)[i] : box[i]);
+            }
+        }
+        return g_bytes_new(buf.data(), buf.size());
+    }
+
+    GBytes* MetaStreamPadProbeHandler::EncodeOccurrences(NvDsFrameMeta* pFrameMeta)
+    {
+        std::vector<NvDsEventMsgMeta*> occurrences;
+
+        for (NvDsMetaList* pMeta = pFrameMeta->frame_user_meta_list; pMeta;
+            pMeta = pMeta->next)
+        {
+            NvDsUserMeta* pUserMeta = (NvDsUserMeta*)(pMeta->data);
+            if (pUserMeta and
+                pUserMeta->base_meta.meta_type == NVDS_EVENT_MSG_META)
+            {
+                occurrences.push_back(
+                    (NvDsEventMsgMeta*)pUserMeta->user_meta_data);
+            }
+        }
+        if (occurrences.empty())
+        {
+            return NULL;
+        }
+        std::vector<guint8> buf;
+        buf.reserve(16 + occurrences.size()*32);
+
+        buf.push_back(DSL_META_STREAM_VERSION);
+        buf.push_back(DSL_META_STREAM_MSG_TYPE_OCCURRENCES);
+        buf.push_back(0);
+        PutVarint(buf, pFrameMeta->source_id);
+        PutVarint(buf, pFrameMeta->frame_num);
+        PutVarint(buf, pFrameMeta->buf_pts / GST_MSECOND);
+        PutVarint(buf, occurrences.size());
+
+        for (auto& ivec: occurrences)
+        {
+            // The ODE Trigger name is carried in the extended message.
+            const char* name = (const char*)ivec->extMsg;
+            gsize nameSize = (name) ? strnlen(name, ivec->extMsgSize) : 0;
+            PutVarint(buf, nameSize);
+            buf.insert(buf.end(), name, name + nameSize);
+
+            bool isTracked = (ivec->trackingId != (gint64)UNTRACKED_OBJECT_ID);
+            buf.push_back(isTracked ? DSL_META_STREAM_OBJ_FLAG_TRACKED : 0);
+            if (isTracked)
+            {
+                PutVarint(buf, ivec->trackingId);
+            }
+            buf.push_back(QuantizeConfidence(ivec->confidence));
+            PutZigzag(buf, lround(ivec->bbox.left));
+            PutZigzag(buf, lround(ivec->bbox.top));
+            PutZigzag(buf, lround(ivec->bbox.width));
+            PutZigzag(buf, lround(ivec->bbox.height));
+        }
+        return g_bytes_new(buf.data(), buf.size());
+    }
+
+    void MetaStreamPadProbeHandler::QueueMessage(uint sourceId, uint msgType,
+        bool isKeyFrame, GBytes* pMessage)
+    {
+        uint key = (sourceId << 2) | msgType;
+        uint64_t now = g_get_monotonic_time();
+        bool isQueued(false);
+
+        for (auto& ivec: m_clients)
+        {
+            if (!(ivec->topics & (1 << (msgType-1))) or
+                (ivec->sources.size() and
+                    ivec->sources.find(sourceId) == ivec->sources.end()))
+            {
+                continue;
+            }
+            // Delta frames are useless without the current key-frame, and
+            // key-frames are never rate limited so clients can always resync.
+            if (!isKeyFrame)
+            {
+                if (ivec->synced.find(key) == ivec->synced.end())
+                {
+                    continue;
+                }
+                if (ivec->maxRate and
+                    (now - ivec->lastSendTimes[key]) < (1000000 / ivec->maxRate))
+                {
+                    continue;
+                }
+            }
+            // A full queue means a slow client. Drop everything and resync
+            // on the next key-frame rather than hold up the streaming thread.
+            if (ivec->queue.size() >= DSL_META_STREAM_MAX_CLIENT_QUEUE_SIZE)
+            {
+                for (auto& imsg: ivec->queue)
+                {
+                    g_bytes_unref(imsg);
+                }
+                ivec->dropped += ivec->queue.size();
+                m_dropped += ivec->queue.size();
+                ivec->queue.clear();
+                ivec->synced.clear();
+
+                LOG_WARN("Meta-Stream Handler '" << GetName()
+                    << "' dropped queue for slow client, total dropped = "
+                    << ivec->dropped);
+                if (!isKeyFrame)
+                {
+                    continue;
+                }
+            }
+            ivec->queue.push_back(g_bytes_ref(pMessage));
+            ivec->lastSendTimes[key] = now;
+            if (isKeyFrame)
+            {
+                ivec->synced.insert(key);
+            }
+            isQueued = true;
+        }
+        if (isQueued and !m_flushSourceId)
+        {
+            m_flushSourceId = g_idle_add(meta_stream_flush_cb, this);
+        }
+    }
+
+    void MetaStreamPadProbeHandler::FreeClient(MetaStreamClient* pClient)
+    {
+        if (pClient->closedSignalHandlerId)
+        {
+            g_signal_handler_disconnect(G_OBJECT(pClient->pConnection),
+                pClient->closedSignalHandlerId);
+        }
+        if (pClient->messageSignalHandlerId)
+        {
+            g_signal_handler_disconnect(G_OBJECT(pClient->pConnection),
+                pClient->messageSignalHandlerId);
+        }
+        for (auto& imsg: pClient->queue)
+        {
+            g_bytes_unref(imsg);
+        }
+        g_object_unref(G_OBJECT(pClient->pConnection));
+        delete pClient;
+    }
+
+    static void on_meta_stream_closed_cb(SoupWebsocketConnection* pConnection,
+        gpointer pClient)
+    {
+        static_cast<MetaStreamClient*>(pClient)->pHandler->OnClosed(
+            static_cast<MetaStreamClient*>(pClient));
+    }
+
+    static void on_meta_stream_message_cb(SoupWebsocketConnection* pConnection,
+        SoupWebsocketDataType dataType, GBytes* message, gpointer pClient)
+    {
+        static_cast<MetaStreamClient*>(pClient)->pHandler->OnMessage(
+            static_cast<MetaStreamClient*>(pClient), dataType, message);
+    }
+
+    static gboolean meta_stream_flush_cb(gpointer pHandler)
+    {
+        return static_cast<MetaStreamPadProbeHandler*>(pHandler)->Flush();
+    }
+}
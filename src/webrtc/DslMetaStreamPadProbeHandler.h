@@ -0,0 +1,346 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_META_STREAM_PAD_PROBE_HANDLER_H
+#define _DSL_META_STREAM_PAD_PROBE_HANDLER_H
+
+#include <libsoup/soup.h>
+#include <json-glib/json-glib.h>
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslPadProbeHandler.h"
+
+#include <set>
+#include <array>
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_PPH_META_STREAM_PTR std::shared_ptr<MetaStreamPadProbeHandler>
+    #define DSL_PPH_META_STREAM_NEW(name, path, keyFrameInterval, maxRate) \
+        std::shared_ptr<MetaStreamPadProbeHandler>(new MetaStreamPadProbeHandler( \
+            name, path, keyFrameInterval, maxRate))
+
+    /**
+     * @brief Message header constants for the binary meta-stream format.
+     */
+    #define DSL_META_STREAM_VERSION                                     0xD1
+    #define DSL_META_STREAM_MSG_TYPE_OBJECTS                            1
+    #define DSL_META_STREAM_MSG_TYPE_OCCURRENCES                        2
+    #define DSL_META_STREAM_MSG_FLAG_KEY_FRAME                          0x01
+    #define DSL_META_STREAM_OBJ_FLAG_DELTA                              0x01
+    #define DSL_META_STREAM_OBJ_FLAG_TRACKED                            0x02
+
+    /**
+     * @brief Maximum number of messages queued for a single client before
+     * the client is considered slow and its queue is dropped.
+     */
+    #define DSL_META_STREAM_MAX_CLIENT_QUEUE_SIZE                       32
+
+    class MetaStreamPadProbeHandler;
+
+    /**
+     * @struct MetaStreamClient
+     * @brief Per-connection subscription and send-queue state for a
+     * MetaStreamPadProbeHandler.
+     */
+    struct MetaStreamClient
+    {
+        /**
+         * @brief parent handler that owns this client.
+         */
+        MetaStreamPadProbeHandler* pHandler;
+
+        /**
+         * @brief client's Websocket connection, referenced for the life
+         * of the client.
+         */
+        SoupWebsocketConnection* pConnection;
+
+        /**
+         * @brief Handler Ids for the Websocket "closed" and "message" signals.
+         */
+        gulong closedSignalHandlerId;
+        gulong messageSignalHandlerId;
+
+        /**
+         * @brief set of subscribed source-ids, empty = all sources.
+         */
+        std::set<uint> sources;
+
+        /**
+         * @brief mask of subscribed message types, one bit for each
+         * DSL_META_STREAM_MSG_TYPE_* value.
+         */
+        uint topics;
+
+        /**
+         * @brief maximum messages per second, per source and type, 0 = no limit.
+         */
+        uint maxRate;
+
+        /**
+         * @brief monotonic time of the last message sent for each
+         * source/type key, used for rate limiting.
+         */
+        std::map<uint, uint64_t> lastSendTimes;
+
+        /**
+         * @brief set of source/type keys for which the client has been sent
+         * the current key-frame. Delta frames are withheld until synced.
+         */
+        std::set<uint> synced;
+
+        /**
+         * @brief encoded messages waiting to be sent from the main-loop.
+         */
+        std::deque<GBytes*> queue;
+
+        /**
+         * @brief number of messages dropped for this client.
+         */
+        uint64_t dropped;
+    };
+
+    /**
+     * @class MetaStreamPadProbeHandler
+     * @brief Pad Probe Handler that publishes per-frame object metadata and
+     * ODE occurrences to subscribed Websocket clients. Each frame is encoded
+     * once, in a compact binary form, and shared by all clients. Bounding-box
+     * coordinates are quantized to whole pixels and delta encoded, as zigzag
+     * varints, against the last key-frame for the same tracked object, so that
+     * any client holding the current key-frame can decode any frame.
+     *
+     * Clients connect on the handler's Websocket path and subscribe by sending
+     * a JSON text message, e.g.
+     *   {"sources":[0,2], "topics":["objects","occurrences"], "maxRate":10}
+     *
+     * Encoded messages are queued per client on the streaming thread and sent
+     * from the main-loop. A client whose queue is full is considered slow;
+     * its queue is dropped and the client is resynced on the next key-frame,
+     * so the streaming thread never waits on a client.
+     */
+    class MetaStreamPadProbeHandler : public PadProbeBufferHandler
+    {
+    public:
+
+        /**
+         * @brief ctor for the MetaStreamPadProbeHandler.
+         * @param[in] name unique name for the new Handler.
+         * @param[in] path Websocket path for clients to connect on.
+         * @param[in] keyFrameInterval number of frames between key-frames.
+         * @param[in] maxRate default maximum messages per second, per source
+         * and type, for clients that don't specify a rate. 0 = no limit.
+         */
+        MetaStreamPadProbeHandler(const char* name, const char* path,
+            uint keyFrameInterval, uint maxRate);
+
+        /**
+         * @brief dtor for the MetaStreamPadProbeHandler.
+         */
+        ~MetaStreamPadProbeHandler();
+
+        /**
+         * @brief Gets the Websocket path for this handler.
+         * @return Websocket path clients connect on.
+         */
+        const char* GetPath();
+
+        /**
+         * @brief Gets the current key-frame interval.
+         * @return number of frames between key-frames.
+         */
+        uint GetKeyFrameInterval();
+
+        /**
+         * @brief Sets the key-frame interval.
+         * @param[in] keyFrameInterval number of frames between key-frames.
+         */
+        void SetKeyFrameInterval(uint keyFrameInterval);
+
+        /**
+         * @brief Gets the default maximum rate for new clients.
+         * @return max messages per second, per source and type. 0 = no limit.
+         */
+        uint GetMaxRate();
+
+        /**
+         * @brief Sets the default maximum rate for new clients.
+         * @param[in] maxRate max messages per second, per source and type.
+         */
+        void SetMaxRate(uint maxRate);
+
+        /**
+         * @brief Gets the current publishing statistics for this handler.
+         * @param[out] clients number of currently connected clients.
+         * @param[out] sent total number of messages sent to all clients.
+         * @param[out] dropped total number of messages dropped for slow clients.
+         */
+        void GetStats(uint* clients, uint64_t* sent, uint64_t* dropped);
+
+        /**
+         * @brief Adds a new Websocket connection as a client of this handler.
+         * Called by the SoupServerMgr from the main-loop.
+         * @param[in] pConnection new connection to add.
+         */
+        void AddConnection(SoupWebsocketConnection* pConnection);
+
+        /**
+         * @brief Called when a client's Websocket is closed.
+         * @param[in] pClient client that closed.
+         */
+        void OnClosed(MetaStreamClient* pClient);
+
+        /**
+         * @brief Called on incoming subscription message from a client.
+         * @param[in] pClient client that sent the message.
+         * @param[in] dataType one of SOUP_WEBSOCKET_DATA_TEXT or _BINARY.
+         * @param[in] message message data.
+         */
+        void OnMessage(MetaStreamClient* pClient,
+            SoupWebsocketDataType dataType, GBytes* message);
+
+        /**
+         * @brief Sends all queued messages to their clients. Called from
+         * the main-loop only.
+         * @return G_SOURCE_REMOVE always.
+         */
+        gboolean Flush();
+
+        /**
+         * @brief Meta-Stream Pad Probe Handler. Encodes the object and
+         * occurrence metadata for each frame in the batch and queues the
+         * messages for all subscribed clients.
+         * @param[in] pBuffer Pad buffer
+         * @return GST_PAD_PROBE_OK always.
+         */
+        GstPadProbeReturn HandlePadData(GstPadProbeInfo* pInfo);
+
+    private:
+
+        /**
+         * @brief Encodes the object metadata for a single frame.
+         * @param[in] pFrameMeta frame metadata to encode.
+         * @param[in] isKeyFrame true to encode all boxes in full and update
+         * the source's key-frame reference, false to delta encode.
+         * @return new GBytes message, NULL if there are no objects to encode
+         * on a delta frame.
+         */
+        GBytes* EncodeObjects(NvDsFrameMeta* pFrameMeta, bool isKeyFrame);
+
+        /**
+         * @brief Encodes the ODE occurrences, added to the frame as event
+         * message meta, for a single frame.
+         * @param[in] pFrameMeta frame metadata to encode.
+         * @return new GBytes message, NULL if there are no occurrences.
+         */
+        GBytes* EncodeOccurrences(NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Queues a message for all clients subscribed to the source
+         * and message type. Must be called with the handler mutex held.
+         * @param[in] sourceId source-id for the message.
+         * @param[in] msgType one of DSL_META_STREAM_MSG_TYPE_*.
+         * @param[in] isKeyFrame true if the message is a key-frame.
+         * @param[in] pMessage message to queue, each client adds a reference.
+         */
+        void QueueMessage(uint sourceId, uint msgType, bool isKeyFrame,
+            GBytes* pMessage);
+
+        /**
+         * @brief Disconnects, unreferences and frees a client.
+         * Must be called with the handler mutex held.
+         * @param[in] pClient client to free.
+         */
+        void FreeClient(MetaStreamClient* pClient);
+
+        /**
+         * @brief Websocket path clients connect on.
+         */
+        std::string m_path;
+
+        /**
+         * @brief number of frames between key-frames.
+         */
+        uint m_keyFrameInterval;
+
+        /**
+         * @brief default maximum messages per second for new clients.
+         */
+        uint m_maxRate;
+
+        /**
+         * @brief key-frame reference for a single source - the last key-frame
+         * box for each tracked object, in whole pixels.
+         */
+        struct SourceState
+        {
+            uint framesSinceKeyFrame;
+            std::map<uint64_t, std::array<int, 4>> references;
+        };
+
+        /**
+         * @brief map of source-ids to key-frame reference state.
+         */
+        std::map<uint, SourceState> m_sourceStates;
+
+        /**
+         * @brief currently connected clients.
+         */
+        std::vector<MetaStreamClient*> m_clients;
+
+        /**
+         * @brief main-loop idle source id for the pending Flush, 0 if none.
+         */
+        guint m_flushSourceId;
+
+        /**
+         * @brief JSON parser for client subscription messages.
+         */
+        JsonParser* m_pJsonParser;
+
+        /**
+         * @brief total messages sent to all clients.
+         */
+        uint64_t m_sent;
+
+        /**
+         * @brief total messages dropped for slow clients.
+         */
+        uint64_t m_dropped;
+    };
+
+    static void on_meta_stream_closed_cb(SoupWebsocketConnection* pConnection,
+        gpointer pClient);
+
+    static void on_meta_stream_message_cb(SoupWebsocketConnection* pConnection,
+        SoupWebsocketDataType dataType, GBytes* message, gpointer pClient);
+
+    static gboolean meta_stream_flush_cb(gpointer pHandler);
+}
+
+#endif // _DSL_META_STREAM_PAD_PROBE_HANDLER_H
@@ -0,0 +1,233 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslServices.h"
+#include "DslServicesValidate.h"
+#include "DslMetaStreamPadProbeHandler.h"
+
+namespace DSL
+{
+    DslReturnType Services::PphMetaStreamNew(const char* name, const char* path,
+        uint keyFrameInterval, uint maxRate)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure handler name uniqueness 
+            if (m_padProbeHandlers.find(name) != m_padProbeHandlers.end())
+            {   
+                LOG_ERROR("Meta-Stream Pad Probe Handler name '" << name 
+                    << "' is not unique");
+                return DSL_RESULT_PPH_NAME_NOT_UNIQUE;
+            }
+            if (!keyFrameInterval)
+            {
+                LOG_ERROR("Meta-Stream Pad Probe Handler '" << name 
+                    << "' failed to create, key-frame interval must be greater than 0");
+                return DSL_RESULT_PPH_SET_FAILED;
+            }
+            m_padProbeHandlers[name] = DSL_PPH_META_STREAM_NEW(name, 
+                path, keyFrameInterval, maxRate);
+
+            LOG_INFO("New Meta-Stream Pad Probe Handler '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Meta-Stream Pad Probe Handler '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphMetaStreamKeyFrameIntervalGet(const char* name, 
+        uint* keyFrameInterval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                MetaStreamPadProbeHandler);
+
+            DSL_PPH_META_STREAM_PTR pMetaStream = 
+                std::dynamic_pointer_cast<MetaStreamPadProbeHandler>(
+                    m_padProbeHandlers[name]);
+
+            *keyFrameInterval = pMetaStream->GetKeyFrameInterval();
+
+            LOG_INFO("Meta-Stream Pad Probe Handler '" << name 
+                << "' returned Key-Frame Interval = " << *keyFrameInterval 
+                << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meta-Stream Pad Probe Handler '" << name 
+                << "' threw an exception getting key-frame interval");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphMetaStreamKeyFrameIntervalSet(const char* name, 
+        uint keyFrameInterval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                MetaStreamPadProbeHandler);
+
+            if (!keyFrameInterval)
+            {
+                LOG_ERROR("Meta-Stream Pad Probe Handler '" << name 
+                    << "' failed to set key-frame interval, must be greater than 0");
+                return DSL_RESULT_PPH_SET_FAILED;
+            }
+            DSL_PPH_META_STREAM_PTR pMetaStream = 
+                std::dynamic_pointer_cast<MetaStreamPadProbeHandler>(
+                    m_padProbeHandlers[name]);
+
+            pMetaStream->SetKeyFrameInterval(keyFrameInterval);
+
+            LOG_INFO("Meta-Stream Pad Probe Handler '" << name 
+                << "' set Key-Frame Interval = " << keyFrameInterval 
+                << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meta-Stream Pad Probe Handler '" << name 
+                << "' threw an exception setting key-frame interval");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphMetaStreamMaxRateGet(const char* name, 
+        uint* maxRate)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                MetaStreamPadProbeHandler);
+
+            DSL_PPH_META_STREAM_PTR pMetaStream = 
+                std::dynamic_pointer_cast<MetaStreamPadProbeHandler>(
+                    m_padProbeHandlers[name]);
+
+            *maxRate = pMetaStream->GetMaxRate();
+
+            LOG_INFO("Meta-Stream Pad Probe Handler '" << name 
+                << "' returned Max-Rate = " << *maxRate << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meta-Stream Pad Probe Handler '" << name 
+                << "' threw an exception getting max-rate");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphMetaStreamMaxRateSet(const char* name, 
+        uint maxRate)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                MetaStreamPadProbeHandler);
+
+            DSL_PPH_META_STREAM_PTR pMetaStream = 
+                std::dynamic_pointer_cast<MetaStreamPadProbeHandler>(
+                    m_padProbeHandlers[name]);
+
+            pMetaStream->SetMaxRate(maxRate);
+
+            LOG_INFO("Meta-Stream Pad Probe Handler '" << name 
+                << "' set Max-Rate = " << maxRate << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meta-Stream Pad Probe Handler '" << name 
+                << "' threw an exception setting max-rate");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphMetaStreamStatsGet(const char* name, 
+        uint* clients, uint64_t* sent, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                MetaStreamPadProbeHandler);
+
+            DSL_PPH_META_STREAM_PTR pMetaStream = 
+                std::dynamic_pointer_cast<MetaStreamPadProbeHandler>(
+                    m_padProbeHandlers[name]);
+
+            pMetaStream->GetStats(clients, sent, dropped);
+
+            LOG_INFO("Meta-Stream Pad Probe Handler '" << name 
+                << "' returned Clients = " << *clients << ", Sent = " << *sent
+                << ", Dropped = " << *dropped << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meta-Stream Pad Probe Handler '" << name 
+                << "' threw an exception getting stats");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+}
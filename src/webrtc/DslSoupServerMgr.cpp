@@ -23,6 +23,7 @@ THE SOFTWARE.
 */
 
 #include "DslSoupServerMgr.h"
+#include "DslMetaStreamPadProbeHandler.h"
 
 namespace DSL
 {
@@ -386,10 +387,72 @@ namespace DSL
     }
 
 
+    bool SoupServerMgr::AddMetaStreamHandler(MetaStreamPadProbeHandler* pHandler)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_serverMutex);
+
+        std::string path(pHandler->GetPath());
+
+        if (m_metaStreamHandlers.find(path) != m_metaStreamHandlers.end())
+        {
+            LOG_ERROR("Path '" << path 
+                << "' is already in use by a Meta-Stream Handler");
+            return false;
+        }
+        // The default path is always handled, all others are added now.
+        if (path != "/ws")
+        {
+            soup_server_add_websocket_handler(m_pSoupServer, path.c_str(), 
+                NULL, NULL, websocket_handler_cb, (gpointer)this, NULL);
+        }
+        m_metaStreamHandlers[path] = pHandler;
+
+        LOG_INFO("Meta-Stream Handler added to the Websocket Server Manager for Path: " 
+            << path);
+        return true;
+    }
+
+    bool SoupServerMgr::RemoveMetaStreamHandler(MetaStreamPadProbeHandler* pHandler)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_serverMutex);
+
+        std::string path(pHandler->GetPath());
+
+        auto imap = m_metaStreamHandlers.find(path);
+        if (imap == m_metaStreamHandlers.end() or imap->second != pHandler)
+        {
+            LOG_ERROR("Meta-Stream Handler was never added to the Websocket Server Manager");
+            return false;
+        }
+        if (path != "/ws")
+        {
+            soup_server_remove_handler(m_pSoupServer, path.c_str());
+        }
+        m_metaStreamHandlers.erase(imap);
+
+        LOG_INFO("Meta-Stream Handler removed from the Websocket Server Manager for Path: " 
+            << path);
+        return true;
+    }
+
     void SoupServerMgr::HandleOpen(SoupWebsocketConnection* pConnection, const char* path)
     {
         LOG_FUNC();
 
+        // Metadata clients are routed by path, ahead of WebRTC signaling.
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_serverMutex);
+
+            auto imap = m_metaStreamHandlers.find(path);
+            if (imap != m_metaStreamHandlers.end())
+            {
+                imap->second->AddConnection(pConnection);
+                return;
+            }
+        }
+
         // If we have registered client listeners, call them first to allow
         // the client to add a WebRTC Signaling Transciever based on the path
         if (m_clientListeners.size())
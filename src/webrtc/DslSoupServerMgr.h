@@ -37,6 +37,9 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    // Forward declaration - defined in DslMetaStreamPadProbeHandler.h
+    class MetaStreamPadProbeHandler;
+
     class SignalingTransceiver
     {
     public:
@@ -229,6 +232,22 @@ namespace DSL
          */
         bool RemoveClientListener(dsl_websocket_server_client_listener_cb listener);
 
+        /**
+         * @brief Adds a Meta-Stream Pad Probe Handler to this server. All new
+         * connections on the Handler's path are routed to the Handler
+         * instead of the Signaling Transceivers.
+         * @param[in] pHandler unique Meta-Stream Handler to add.
+         * @return true on successful add, false if the path is in use.
+         */
+        bool AddMetaStreamHandler(MetaStreamPadProbeHandler* pHandler);
+
+        /**
+         * @brief Removes a Meta-Stream Pad Probe Handler from this server.
+         * @param[in] pHandler unique Meta-Stream Handler to remove.
+         * @return true on successful remove, false otherwise.
+         */
+        bool RemoveMetaStreamHandler(MetaStreamPadProbeHandler* pHandler);
+
     private:
 
         /**
@@ -268,6 +287,11 @@ namespace DSL
          */
         std::map<dsl_websocket_server_client_listener_cb, void*> m_clientListeners;
 
+        /**
+         * @brief map of Meta-Stream Handlers mapped by their Websocket path.
+         */
+        std::map<std::string, MetaStreamPadProbeHandler*> m_metaStreamHandlers;
+
     };
 
     static void websocket_handler_cb(G_GNUC_UNUSED SoupServer* pServer, 
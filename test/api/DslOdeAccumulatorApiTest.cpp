@@ -176,6 +176,70 @@ SCENARIO( "A new ODE Accumulator can Add and Remove multiple ODE Actions",
     }
 }
 
+SCENARIO( "A new ODE Stats Accumulator can Get and Set its window settings", 
+    "[ode-accumulator-api]" )
+{
+    GIVEN( "A new ODE Stats Accumulator" ) 
+    {
+        std::wstring odeAccumulatorName(L"stats-accumulator");
+        std::wstring otherAccumulatorName(L"accumulator");
+        uint window(300), slide(30);
+
+        // window must be a multiple of slide
+        REQUIRE( dsl_ode_accumulator_stats_new(odeAccumulatorName.c_str(),
+            window, 40) == DSL_RESULT_ODE_ACCUMULATOR_SET_FAILED );
+
+        REQUIRE( dsl_ode_accumulator_stats_new(odeAccumulatorName.c_str(),
+            window, slide) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_ode_accumulator_new(
+            otherAccumulatorName.c_str()) == DSL_RESULT_SUCCESS );
+
+        uint retWindow(0), retSlide(0);
+        REQUIRE( dsl_ode_accumulator_stats_window_get(odeAccumulatorName.c_str(),
+            &retWindow, &retSlide) == DSL_RESULT_SUCCESS );
+        REQUIRE( retWindow == window );
+        REQUIRE( retSlide == slide );
+
+        WHEN( "The window settings are updated" ) 
+        {
+            uint newWindow(600), newSlide(0);
+            REQUIRE( dsl_ode_accumulator_stats_window_set(
+                odeAccumulatorName.c_str(), newWindow, newSlide) == 
+                    DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_ode_accumulator_stats_window_get(
+                    odeAccumulatorName.c_str(), &retWindow, &retSlide) == 
+                        DSL_RESULT_SUCCESS );
+                REQUIRE( retWindow == newWindow );
+                REQUIRE( retSlide == newWindow );
+                
+                // No window has closed
+                dsl_ode_stats stats{0};
+                REQUIRE( dsl_ode_accumulator_stats_get(odeAccumulatorName.c_str(),
+                    0, 0, DSL_ODE_STATS_METRIC_COUNT, &stats) == 
+                        DSL_RESULT_ODE_ACCUMULATOR_STATS_NOT_AVAILABLE );
+                REQUIRE( dsl_ode_accumulator_stats_get(odeAccumulatorName.c_str(),
+                    0, 0, DSL_ODE_STATS_METRIC_HEIGHT+1, &stats) == 
+                        DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_accumulator_stats_clear(
+                    odeAccumulatorName.c_str()) == DSL_RESULT_SUCCESS );
+                
+                // Stats services fail for other Accumulator types
+                REQUIRE( dsl_ode_accumulator_stats_window_get(
+                    otherAccumulatorName.c_str(), &retWindow, &retSlide) == 
+                        DSL_RESULT_ODE_ACCUMULATOR_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_ode_accumulator_stats_clear(
+                    otherAccumulatorName.c_str()) == 
+                        DSL_RESULT_ODE_ACCUMULATOR_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_ode_accumulator_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
 SCENARIO( "The ODE Accumulator API checks for NULL input parameters", "[ode-accumulator-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -216,6 +280,23 @@ SCENARIO( "The ODE Accumulator API checks for NULL input parameters", "[ode-accu
                     ode_accumulator_name.c_str(), NULL) == 
                         DSL_RESULT_INVALID_INPUT_PARAM );
 
+                REQUIRE( dsl_ode_accumulator_stats_new(NULL, 1, 0) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_accumulator_stats_window_get(NULL, 
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_accumulator_stats_window_get(
+                    ode_accumulator_name.c_str(), NULL, NULL) == 
+                        DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_accumulator_stats_window_set(NULL, 
+                    1, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_accumulator_stats_get(NULL, 
+                    0, 0, 0, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_accumulator_stats_get(
+                    ode_accumulator_name.c_str(), 0, 0, 0, NULL) == 
+                        DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_accumulator_stats_clear(NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+
                 REQUIRE( dsl_ode_accumulator_delete(NULL) == 
                     DSL_RESULT_INVALID_INPUT_PARAM );
 
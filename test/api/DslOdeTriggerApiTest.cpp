@@ -1231,6 +1231,79 @@ SCENARIO( "An ODE Persistence Trigger's minimum and maximum can be set/get",
     }
 }    
 
+SCENARIO( "An ODE Tracking Trigger's speed range can be set/get",
+    "[ode-trigger-api]" )
+{
+    GIVEN( "An ODE Persistence Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"persistence");
+        uint class_id(0);
+        uint limit(0);
+
+        REQUIRE( dsl_ode_trigger_persistence_new(odeTriggerName.c_str(), 
+            NULL, class_id, limit, 1, 2) == DSL_RESULT_SUCCESS );
+
+        float ret_minimum(1), ret_maximum(1);
+        REQUIRE( dsl_ode_trigger_speed_range_get(odeTriggerName.c_str(), 
+            &ret_minimum, &ret_maximum) == DSL_RESULT_SUCCESS );
+        REQUIRE( ret_minimum == 0 );
+        REQUIRE( ret_maximum == 0 );
+
+        WHEN( "When the Trigger's speed range is updated" )         
+        {
+            float new_minimum(20.5), new_maximum(200.0);
+            REQUIRE( dsl_ode_trigger_speed_range_set(odeTriggerName.c_str(), 
+                new_minimum, new_maximum) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_ode_trigger_speed_range_get(
+                    odeTriggerName.c_str(), &ret_minimum, &ret_maximum) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( new_minimum == ret_minimum );
+                REQUIRE( new_maximum == ret_maximum );
+                
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "When an invalid speed range is set" )         
+        {
+            THEN( "The update fails" ) 
+            {
+                REQUIRE( dsl_ode_trigger_speed_range_set(odeTriggerName.c_str(), 
+                    200.0, 100.0) == DSL_RESULT_ODE_TRIGGER_SET_FAILED );
+                REQUIRE( dsl_ode_trigger_speed_range_set(odeTriggerName.c_str(), 
+                    -1.0, 0) == DSL_RESULT_ODE_TRIGGER_SET_FAILED );
+                
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+    GIVEN( "An ODE Occurrence Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"occurrence");
+
+        REQUIRE( dsl_ode_trigger_occurrence_new(odeTriggerName.c_str(), 
+            NULL, 0, 0) == DSL_RESULT_SUCCESS );
+
+        WHEN( "When the Trigger's speed range is queried" )         
+        {
+            float ret_minimum(1), ret_maximum(1);
+            
+            THEN( "The service fails as the Trigger is not a Tracking Trigger" ) 
+            {
+                REQUIRE( dsl_ode_trigger_speed_range_get(odeTriggerName.c_str(), 
+                    &ret_minimum, &ret_maximum) == 
+                    DSL_RESULT_ODE_TRIGGER_IS_NOT_TRACK_TRIGGER );
+                REQUIRE( dsl_ode_trigger_speed_range_set(odeTriggerName.c_str(), 
+                    10.0, 0) == DSL_RESULT_ODE_TRIGGER_IS_NOT_TRACK_TRIGGER );
+                
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
 SCENARIO( "A New High Trigger can be created and deleted correctly", "[ode-trigger-api]" )
 {
     GIVEN( "Attributes for a new High Trigger" ) 
@@ -1468,6 +1541,67 @@ SCENARIO( "A Cross Trigger can update its view settings correctly", "[ode-trigge
     }
 }    
 
+SCENARIO( "A Cross Trigger can update its view LOD settings correctly", "[ode-trigger-api]" )
+{
+    GIVEN( "A new Cross Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"Cross");
+        uint limit(0);
+        uint min_frame_count(10);
+        uint max_trace_points(20);
+
+        uint ret_tolerance(99), ret_max_traces(99);
+        
+        REQUIRE( dsl_ode_trigger_cross_new(odeTriggerName.c_str(), 
+            NULL, 0, limit, min_frame_count, max_trace_points,
+            DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS) == DSL_RESULT_SUCCESS );
+            
+        REQUIRE( dsl_ode_trigger_cross_view_lod_settings_get(odeTriggerName.c_str(), 
+            &ret_tolerance, &ret_max_traces) == DSL_RESULT_SUCCESS );
+        REQUIRE( ret_tolerance == 0 );
+        REQUIRE( ret_max_traces == 0 );
+
+        WHEN( "When the Trigger's view LOD settings are updated" )
+        {
+            uint new_tolerance(4), new_max_traces(20);
+            
+            REQUIRE( dsl_ode_trigger_cross_view_lod_settings_set(odeTriggerName.c_str(), 
+                new_tolerance, new_max_traces) == DSL_RESULT_SUCCESS );
+                
+            THEN( "The correct values are returned on get" )
+            {
+                REQUIRE( dsl_ode_trigger_cross_view_lod_settings_get(
+                    odeTriggerName.c_str(), &ret_tolerance, &ret_max_traces) == 
+                        DSL_RESULT_SUCCESS );
+                REQUIRE( ret_tolerance == new_tolerance );
+                REQUIRE( ret_max_traces == new_max_traces );
+
+                REQUIRE( dsl_ode_trigger_delete(odeTriggerName.c_str()) 
+                    == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "When a non-Cross Trigger is used" )
+        {
+            std::wstring instanceTriggerName(L"instance");
+            
+            REQUIRE( dsl_ode_trigger_instance_new(instanceTriggerName.c_str(), 
+                NULL, 0, limit) == DSL_RESULT_SUCCESS );
+                
+            THEN( "The view LOD settings services fail" )
+            {
+                REQUIRE( dsl_ode_trigger_cross_view_lod_settings_get(
+                    instanceTriggerName.c_str(), &ret_tolerance, &ret_max_traces) == 
+                        DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_ode_trigger_cross_view_lod_settings_set(
+                    instanceTriggerName.c_str(), 4, 20) == 
+                        DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
 SCENARIO( "The Cross Trigger API checks all parameters correctly ", "[ode-trigger-api]" )
 {
     GIVEN( "Attributes for a new Cross Trigger" ) 
@@ -1805,6 +1939,50 @@ SCENARIO( "An ODE Trigger notifies its enabled-state-change-listener on change",
     }
 }    
 
+SCENARIO( "A snapshot of all ODE counters can be queried", "[ode-trigger-api]" )
+{
+    GIVEN( "A new ODE Trigger and ODE Action" ) 
+    {
+        std::wstring odeTriggerName(L"occurrence");
+        std::wstring odeActionName(L"print");
+        
+        REQUIRE( dsl_ode_trigger_occurrence_new(odeTriggerName.c_str(), 
+            NULL, 0, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_ode_action_print_new(odeActionName.c_str(), 
+            false) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The ODE counters are queried" ) 
+        {
+            dsl_ode_counter_info* counters(NULL);
+            uint size(0);
+            
+            REQUIRE( dsl_info_ode_counters_get(&counters, 
+                &size) == DSL_RESULT_SUCCESS );
+
+            THEN( "The snapshot includes the global, Trigger and Action counters" ) 
+            {
+                REQUIRE( size == 3 );
+                REQUIRE( counters[0].type == DSL_ODE_COUNTER_TYPE_GLOBAL );
+                REQUIRE( counters[1].type == DSL_ODE_COUNTER_TYPE_TRIGGER );
+                REQUIRE( std::wstring(counters[1].name) == odeTriggerName );
+                REQUIRE( counters[1].events == 0 );
+                REQUIRE( counters[1].frames == 0 );
+                REQUIRE( counters[2].type == DSL_ODE_COUNTER_TYPE_ACTION );
+                REQUIRE( std::wstring(counters[2].name) == odeActionName );
+                REQUIRE( counters[2].events == 0 );
+                
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_delete_all() == DSL_RESULT_SUCCESS );
+                
+                REQUIRE( dsl_info_ode_counters_get(NULL, 
+                    &size) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_info_ode_counters_get(&counters, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+            }
+        }
+    }
+}    
+
 SCENARIO( "The ODE Trigger API checks for NULL input parameters", "[ode-trigger-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -1861,6 +2039,15 @@ SCENARIO( "The ODE Trigger API checks for NULL input parameters", "[ode-trigger-
                     DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_cross_view_settings_set(triggerName.c_str(), 0, NULL, 0) == 
                     DSL_RESULT_INVALID_INPUT_PARAM );
+                uint tolerance(0), max_traces(0);
+                REQUIRE( dsl_ode_trigger_cross_view_lod_settings_get(NULL, 
+                    &tolerance, &max_traces) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_cross_view_lod_settings_get(triggerName.c_str(), 
+                    NULL, &max_traces) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_cross_view_lod_settings_get(triggerName.c_str(), 
+                    &tolerance, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_cross_view_lod_settings_set(NULL, 
+                    tolerance, max_traces) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_ode_trigger_custom_new(NULL, NULL, 0, 0, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_custom_new(triggerName.c_str(), NULL, 0, 0, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
@@ -1883,6 +2070,12 @@ SCENARIO( "The ODE Trigger API checks for NULL input parameters", "[ode-trigger-
                 REQUIRE( dsl_ode_trigger_persistence_range_get(NULL, &minimum, &maximum)  == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_persistence_range_set(NULL, minimum, maximum)  == DSL_RESULT_INVALID_INPUT_PARAM );
 
+                float min_speed(0), max_speed(0);
+                REQUIRE( dsl_ode_trigger_speed_range_get(NULL, &min_speed, &max_speed)  == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_speed_range_get(triggerName.c_str(), NULL, &max_speed)  == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_speed_range_get(triggerName.c_str(), &min_speed, NULL)  == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_speed_range_set(NULL, min_speed, max_speed)  == DSL_RESULT_INVALID_INPUT_PARAM );
+
                 REQUIRE( dsl_ode_trigger_new_low_new(NULL, NULL, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_new_high_new(NULL, NULL, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
 
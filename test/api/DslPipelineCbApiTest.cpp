@@ -34,6 +34,11 @@ static void eos_listener_cb(void* client_data)
 {
 }
 
+static void file_complete_listener_cb(const wchar_t* source, 
+    const wchar_t* file_path, uint64_t frames, void* client_data)
+{
+}
+
 static void error_message_handler(const wchar_t* source, 
     const wchar_t* message, void* client_data)
 {
@@ -148,6 +153,110 @@ SCENARIO( "A EOS-listener can be removed", "[pipeline-cb-api]" )
     }
 }
 
+SCENARIO( "A file-complete-listener can be added and removed", "[pipeline-cb-api]" )
+{
+    std::wstring pipelineName = L"test-pipeline";
+
+    GIVEN( "A Pipeline in memory" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "A file-complete-listener is added" )
+        {
+            REQUIRE( dsl_pipeline_offline_file_complete_listener_add(
+                pipelineName.c_str(), file_complete_listener_cb, 
+                (void*)0x12345678) == DSL_RESULT_SUCCESS );
+
+            // second call must fail
+            REQUIRE( dsl_pipeline_offline_file_complete_listener_add(
+                pipelineName.c_str(), file_complete_listener_cb, 
+                NULL) == DSL_RESULT_PIPELINE_CALLBACK_ADD_FAILED );
+
+            THEN( "The same listener can be removed only once" ) 
+            {
+                REQUIRE( dsl_pipeline_offline_file_complete_listener_remove(
+                    pipelineName.c_str(), file_complete_listener_cb) 
+                        == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_offline_file_complete_listener_remove(
+                    pipelineName.c_str(), file_complete_listener_cb) 
+                        == DSL_RESULT_PIPELINE_CALLBACK_REMOVE_FAILED );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+            }
+        }
+    }
+}    
+
+SCENARIO( "Files can be added to and cleared from a Pipeline's offline file queue", 
+    "[pipeline-cb-api]" )
+{
+    std::wstring pipelineName = L"test-pipeline";
+    std::wstring filePath = 
+        L"/opt/nvidia/deepstream/deepstream/samples/streams/sample_1080p_h265.mp4";
+    std::wstring badFilePath = L"./bad/path/to/file.mp4";
+
+    GIVEN( "A Pipeline in memory" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(true);
+        REQUIRE( dsl_pipeline_offline_enabled_get(pipelineName.c_str(), 
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+
+        uint size(99);
+        REQUIRE( dsl_pipeline_offline_file_queue_size_get(pipelineName.c_str(), 
+            &size) == DSL_RESULT_SUCCESS );
+        REQUIRE( size == 0 );
+
+        WHEN( "Offline mode is enabled and files are added to the queue" )
+        {
+            REQUIRE( dsl_pipeline_offline_enabled_set(pipelineName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+
+            const wchar_t* filePaths[] = {filePath.c_str(), filePath.c_str(), NULL};
+            REQUIRE( dsl_pipeline_offline_file_queue_add(pipelineName.c_str(), 
+                filePaths) == DSL_RESULT_SUCCESS );
+
+            // A list with one bad file must fail without adding any files.
+            const wchar_t* badFilePaths[] = {filePath.c_str(), 
+                badFilePath.c_str(), NULL};
+            REQUIRE( dsl_pipeline_offline_file_queue_add(pipelineName.c_str(), 
+                badFilePaths) == DSL_RESULT_SOURCE_FILE_NOT_FOUND );
+
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_pipeline_offline_enabled_get(pipelineName.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+                REQUIRE( dsl_pipeline_offline_file_queue_size_get(
+                    pipelineName.c_str(), &size) == DSL_RESULT_SUCCESS );
+                REQUIRE( size == 2 );
+                
+                uint filesCompleted(99);
+                uint64_t framesProcessed(99);
+                double framesPerSecond(99);
+                REQUIRE( dsl_pipeline_offline_stats_get(pipelineName.c_str(), 
+                    &filesCompleted, &framesProcessed, &framesPerSecond) 
+                        == DSL_RESULT_SUCCESS );
+                REQUIRE( filesCompleted == 0 );
+                REQUIRE( framesProcessed == 0 );
+                REQUIRE( framesPerSecond == 0 );
+
+                REQUIRE( dsl_pipeline_offline_file_queue_clear(
+                    pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_offline_file_queue_size_get(
+                    pipelineName.c_str(), &size) == DSL_RESULT_SUCCESS );
+                REQUIRE( size == 0 );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+            }
+        }
+    }
+}    
+
 SCENARIO( "An error-message-handler can be added and removed", "[pipeline-cb-api]" )
 {
     std::wstring pipelineName = L"test-pipeline";
@@ -251,6 +360,27 @@ SCENARIO( "The Pipeline Callback API checks for NULL input parameters", "[pipeli
                     NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pipeline_buffering_message_handler_remove(NULL, 
                     NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_pipeline_offline_enabled_get(NULL, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_offline_enabled_set(NULL, 
+                    false) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_offline_file_queue_add(NULL, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_offline_file_queue_add(pipeline_name.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_offline_file_queue_size_get(NULL, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_offline_file_queue_clear(
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_offline_stats_get(NULL, 
+                    NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_offline_file_complete_listener_add(NULL, 
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_offline_file_complete_listener_add(
+                    pipeline_name.c_str(), NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_offline_file_complete_listener_remove(NULL, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                     
             }
         }
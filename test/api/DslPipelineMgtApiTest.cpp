@@ -144,3 +144,155 @@ SCENARIO( "A non-unique Pipeline name fails when creating Many Pipelines", "[Pip
         REQUIRE( dsl_pipeline_list_size() == 0 );
     }
 }
+
+SCENARIO( "A Pipeline's schedule can be set, queried, and removed correctly", 
+    "[PipelineMgt]" )
+{
+    GIVEN( "A new Pipeline" ) 
+    {
+        std::wstring pipelineName  = L"test-pipeline";
+        
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        uint ret_priority(99);
+        double ret_target_fps(99), ret_achieved_fps(99);
+        uint ret_throttle_factor(99);
+
+        REQUIRE( dsl_pipeline_schedule_get(pipelineName.c_str(), 
+            &ret_priority, &ret_target_fps) == DSL_RESULT_PIPELINE_GET_FAILED );
+
+        WHEN( "The Pipeline's schedule is set" ) 
+        {
+            uint priority(2);
+            double target_fps(60.0);
+            
+            REQUIRE( dsl_pipeline_schedule_set(pipelineName.c_str(), 
+                priority, target_fps) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct schedule and stats are returned" ) 
+            {
+                REQUIRE( dsl_pipeline_schedule_get(pipelineName.c_str(), 
+                    &ret_priority, &ret_target_fps) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_priority == priority );
+                REQUIRE( ret_target_fps == target_fps );
+
+                REQUIRE( dsl_pipeline_schedule_stats_get(pipelineName.c_str(), 
+                    &ret_achieved_fps, &ret_target_fps, &ret_throttle_factor) 
+                        == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_achieved_fps == 0 );
+                REQUIRE( ret_target_fps == target_fps );
+                REQUIRE( ret_throttle_factor == 1 );
+                
+                REQUIRE( dsl_pipeline_schedule_remove(pipelineName.c_str()) 
+                    == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_schedule_remove(pipelineName.c_str()) 
+                    == DSL_RESULT_PIPELINE_SET_FAILED );
+                REQUIRE( dsl_pipeline_schedule_stats_get(pipelineName.c_str(), 
+                    &ret_achieved_fps, &ret_target_fps, &ret_throttle_factor) 
+                        == DSL_RESULT_PIPELINE_GET_FAILED );
+                
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A scheduled Pipeline is deleted" ) 
+        {
+            REQUIRE( dsl_pipeline_schedule_set(pipelineName.c_str(), 
+                0, 30.0) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_delete(pipelineName.c_str()) 
+                == DSL_RESULT_SUCCESS );
+
+            THEN( "The Pipeline is no longer scheduled when recreated" ) 
+            {
+                REQUIRE( dsl_pipeline_new(pipelineName.c_str()) 
+                    == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_schedule_get(pipelineName.c_str(), 
+                    &ret_priority, &ret_target_fps) 
+                        == DSL_RESULT_PIPELINE_GET_FAILED );
+                
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "An invalid target frame-rate is used" ) 
+        {
+            THEN( "The set service fails" ) 
+            {
+                REQUIRE( dsl_pipeline_schedule_set(pipelineName.c_str(), 
+                    0, -1.0) == DSL_RESULT_PIPELINE_SET_FAILED );
+                
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Pipeline Scheduler's period can be set and queried correctly", 
+    "[PipelineMgt]" )
+{
+    GIVEN( "The Pipeline Scheduler's default period" ) 
+    {
+        uint ret_period(0);
+        
+        REQUIRE( dsl_pipeline_scheduler_period_get(&ret_period) 
+            == DSL_RESULT_SUCCESS );
+        REQUIRE( ret_period == DSL_PIPELINE_SCHEDULER_DEFAULT_PERIOD );
+
+        WHEN( "The period is updated" ) 
+        {
+            REQUIRE( dsl_pipeline_scheduler_period_set(500) 
+                == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct value is returned on get" ) 
+            {
+                REQUIRE( dsl_pipeline_scheduler_period_get(&ret_period) 
+                    == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_period == 500 );
+                
+                REQUIRE( dsl_pipeline_scheduler_period_set(0) 
+                    == DSL_RESULT_PIPELINE_SET_FAILED );
+                REQUIRE( dsl_pipeline_scheduler_period_set(
+                    DSL_PIPELINE_SCHEDULER_DEFAULT_PERIOD) == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Pipeline Scheduler API checks for NULL input parameters", 
+    "[PipelineMgt]" )
+{
+    GIVEN( "An empty list of Pipelines" ) 
+    {
+        std::wstring pipelineName  = L"test-pipeline";
+        uint priority(0), throttle_factor(0), period(0);
+        double target_fps(0), achieved_fps(0);
+        
+        WHEN( "When NULL pointers are used as input" ) 
+        {
+            THEN( "The API returns DSL_RESULT_INVALID_INPUT_PARAM in all cases" ) 
+            {
+                REQUIRE( dsl_pipeline_schedule_set(NULL, 0, 0) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_schedule_get(NULL, &priority, &target_fps) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_schedule_get(pipelineName.c_str(), 
+                    NULL, &target_fps) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_schedule_get(pipelineName.c_str(), 
+                    &priority, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_schedule_remove(NULL) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_schedule_stats_get(NULL, &achieved_fps, 
+                    &target_fps, &throttle_factor) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_schedule_stats_get(pipelineName.c_str(), 
+                    NULL, &target_fps, &throttle_factor) 
+                        == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_schedule_stats_get(pipelineName.c_str(), 
+                    &achieved_fps, NULL, &throttle_factor) 
+                        == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_schedule_stats_get(pipelineName.c_str(), 
+                    &achieved_fps, &target_fps, NULL) 
+                        == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_scheduler_period_get(NULL) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+            }
+        }
+    }
+}
@@ -199,6 +199,68 @@ SCENARIO( "The Components container is updated correctly on new and delete Frame
     }
 }
     
+SCENARIO( "A Frame-Capture Sink's workers and requests are handled correctly", 
+    "[sink-api]" )
+{
+    GIVEN( "A new Frame-Capture Sink" ) 
+    {
+        std::wstring action_name(L"capture-action");
+        std::wstring outdir(L"./");
+
+        std::wstring sink_name = L"frame-capture-sink";
+
+        REQUIRE( dsl_ode_action_capture_frame_new(action_name.c_str(), 
+            outdir.c_str()) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_sink_frame_capture_new(sink_name.c_str(), 
+            action_name.c_str()) == DSL_RESULT_SUCCESS );
+
+        uint workers(0);
+        REQUIRE( dsl_sink_frame_capture_workers_get(sink_name.c_str(), 
+            &workers) == DSL_RESULT_SUCCESS );
+        REQUIRE( workers == DSL_FRAME_CAPTURE_DEFAULT_WORKERS );
+
+        WHEN( "The Sink's workers are updated" ) 
+        {
+            REQUIRE( dsl_sink_frame_capture_workers_set(sink_name.c_str(), 
+                4) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct value is returned on get" ) 
+            {
+                REQUIRE( dsl_sink_frame_capture_workers_get(sink_name.c_str(), 
+                    &workers) == DSL_RESULT_SUCCESS );
+                REQUIRE( workers == 4 );
+
+                // 0 workers is invalid
+                REQUIRE( dsl_sink_frame_capture_workers_set(sink_name.c_str(), 
+                    0) == DSL_RESULT_SINK_SET_FAILED );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A request is added while the Sink is unlinked" ) 
+        {
+            uint64_t request_id(0);
+            
+            THEN( "The request fails" ) 
+            {
+                REQUIRE( dsl_sink_frame_capture_request(sink_name.c_str(), 
+                    DSL_FRAME_CAPTURE_NEXT_FRAME, DSL_FRAME_CAPTURE_OUTPUT_FILE, 
+                    0, NULL, NULL, &request_id) == DSL_RESULT_SINK_SET_FAILED );
+
+                // buffer output requires a client handler
+                REQUIRE( dsl_sink_frame_capture_request(sink_name.c_str(), 
+                    DSL_FRAME_CAPTURE_NEXT_FRAME, DSL_FRAME_CAPTURE_OUTPUT_BUFFER, 
+                    0, NULL, NULL, &request_id) == DSL_RESULT_SINK_SET_FAILED );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+    
 SCENARIO( "The Components container is updated correctly on new and delete Custom Sink",
     "[sink-api]" )
 {
@@ -3022,6 +3084,16 @@ SCENARIO( "The Sink API checks for NULL input parameters", "[sink-api]" )
                     == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_sink_frame_capture_schedule(NULL, 0) 
                     == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_frame_capture_request(NULL, 0, 0, 0, 
+                    NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_frame_capture_request(sink_name.c_str(), 0, 0, 0, 
+                    NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_frame_capture_workers_get(NULL, NULL) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_frame_capture_workers_get(sink_name.c_str(), NULL) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_frame_capture_workers_set(NULL, 1) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_sink_v4l2_new(NULL, 
                     NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
@@ -598,6 +598,26 @@ SCENARIO( "An App Source can update its buffer-out settings correctly",
                 REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
             }
         }
+        WHEN( "The App Source's buffer-out-frame-rate is scaled down" ) 
+        {
+            REQUIRE( dsl_source_video_buffer_out_frame_rate_set(source_name.c_str(), 
+                5, 1) == DSL_RESULT_SUCCESS );
+
+            THEN( "The buffer-out-stats are zero until the Source is linked" ) 
+            {
+                uint64_t received(99), dropped(99), converted(99);
+                REQUIRE( dsl_source_video_buffer_out_stats_get(source_name.c_str(), 
+                    &received, &dropped, &converted) == DSL_RESULT_SUCCESS );
+                REQUIRE( received == 0 );
+                REQUIRE( dropped == 0 );
+                REQUIRE( converted == 0 );
+
+                REQUIRE( dsl_source_video_buffer_out_stats_get(source_name.c_str(), 
+                    NULL, &dropped, &converted) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
         
         WHEN( "The App Source's buffer-out-crop settings are set" ) 
         {
@@ -1297,6 +1317,47 @@ SCENARIO( "An RTSP Source's udp-buffer-size can be updated correctly",
     }
 }
 
+SCENARIO( "An RTSP Source's encoded-cache settings can be updated correctly", 
+    "[source-api]" )
+{
+    GIVEN( "A new RTSP Source" )
+    {
+        REQUIRE( dsl_source_rtsp_new(source_name.c_str(), rtsp_uri.c_str(), protocol,
+            skip_frames, interval, latency, timeout) == DSL_RESULT_SUCCESS );
+            
+        uint ret_duration(99);
+        uint64_t ret_max_size(99);
+        
+        REQUIRE( dsl_source_rtsp_encoded_cache_settings_get(source_name.c_str(), 
+            &ret_duration, &ret_max_size) == DSL_RESULT_SUCCESS );
+        REQUIRE( ret_duration == 0 );
+        REQUIRE( ret_max_size == 0 );
+
+        WHEN( "The RTSP Source's encoded-cache settings are updated" ) 
+        {
+            uint new_duration(30);
+            uint64_t new_max_size(8ULL*1024*1024*1024);
+                
+            REQUIRE( dsl_source_rtsp_encoded_cache_settings_set(source_name.c_str(), 
+                new_duration, new_max_size) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct values are returned after update" )
+            {
+                REQUIRE( dsl_source_rtsp_encoded_cache_settings_get(source_name.c_str(), 
+                    &ret_duration, &ret_max_size) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_duration == new_duration );
+                REQUIRE( ret_max_size == new_max_size );
+                
+                // Export must fail as the Source has yet to connect
+                REQUIRE( dsl_source_rtsp_encoded_cache_export(source_name.c_str(), 
+                    10, L"./encoded-cache.h264") == DSL_RESULT_SOURCE_EXPORT_FAILED );
+                    
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
 static void source_state_change_listener_cb1(uint prev_state, uint curr_state, void* user_data)
 {
 }
@@ -1426,6 +1487,37 @@ SCENARIO( "A File Source Component can Set/Get its Repeat Enabled setting", "[so
     }
 }
 
+SCENARIO( "A File Source Component can Set/Get its key-frame scan interval", 
+    "[source-api]" )
+{
+    GIVEN( "A new File Source" )
+    {
+        REQUIRE( dsl_source_file_new(source_name.c_str(), 
+            uri.c_str(), false) == DSL_RESULT_SUCCESS );
+
+        uint retInterval(99);
+        REQUIRE( dsl_source_uri_keyframe_scan_get(source_name.c_str(), 
+            &retInterval) == DSL_RESULT_SUCCESS );
+        REQUIRE( retInterval == 0 );
+
+        WHEN( "The Source's key-frame scan interval is set" ) 
+        {
+            uint newInterval(4);
+            REQUIRE( dsl_source_uri_keyframe_scan_set(source_name.c_str(), 
+                newInterval) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct value is returned on get" )
+            {
+                REQUIRE( dsl_source_uri_keyframe_scan_get(source_name.c_str(), 
+                    &retInterval) == DSL_RESULT_SUCCESS );
+                REQUIRE( retInterval == newInterval );
+                    
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
 SCENARIO( "A Multi-Image Source returns the correct attribute values", "[source-api]" )
 {
     GIVEN( "Attributes for a new Multi Image Source" ) 
@@ -1566,6 +1658,68 @@ SCENARIO( "A Image Stream Source Component can Set/Get its Display Timeout setti
     }
 }
 
+SCENARIO( "A new Shared Source can update its settings correctly", 
+    "[source-api]" )
+{
+    GIVEN( "A new Shared Source" ) 
+    {
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_shared_new(source_name.c_str(), 
+            L"rtsp://208.72.70.171:80/mjpg/video.mjpg", true) == DSL_RESULT_SUCCESS );
+
+        uint queue_size(0), max_rate(99);
+        REQUIRE( dsl_source_shared_settings_get(source_name.c_str(),
+            &queue_size, &max_rate) == DSL_RESULT_SUCCESS );
+        REQUIRE( queue_size == 4 );
+        REQUIRE( max_rate == 0 );
+
+        uint64_t received(99), dropped(99), delivered(99);
+        REQUIRE( dsl_source_shared_stats_get(source_name.c_str(),
+            &received, &dropped, &delivered) == DSL_RESULT_SUCCESS );
+        REQUIRE( received == 0 );
+        REQUIRE( dropped == 0 );
+        REQUIRE( delivered == 0 );
+
+        // No decoder is started until the Source is linked.
+        uint count(99);
+        REQUIRE( dsl_source_shared_decoder_count_get(&count) == DSL_RESULT_SUCCESS );
+        REQUIRE( count == 0 );
+
+        WHEN( "The Shared Source's settings are updated" ) 
+        {
+            REQUIRE( dsl_source_shared_settings_set(source_name.c_str(),
+                2, 5) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_source_shared_settings_get(source_name.c_str(),
+                    &queue_size, &max_rate) == DSL_RESULT_SUCCESS );
+                REQUIRE( queue_size == 2 );
+                REQUIRE( max_rate == 5 );
+
+                REQUIRE( dsl_source_is_live(source_name.c_str()) == TRUE );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "An invalid queue size is set" ) 
+        {
+            REQUIRE( dsl_source_shared_settings_set(source_name.c_str(),
+                0, 5) == DSL_RESULT_SOURCE_SET_FAILED );
+
+            THEN( "The previous values are unchanged" ) 
+            {
+                REQUIRE( dsl_source_shared_settings_get(source_name.c_str(),
+                    &queue_size, &max_rate) == DSL_RESULT_SUCCESS );
+                REQUIRE( queue_size == 4 );
+                REQUIRE( max_rate == 0 );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
 SCENARIO( "A new Duplicate Source returns the correct attribute values", 
     "[source-api]" )
 {
@@ -1841,6 +1995,18 @@ SCENARIO( "The Source API checks for NULL input parameters", "[source-api]" )
                 REQUIRE( dsl_source_uri_uri_get(source_name.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_source_uri_uri_set(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_source_uri_uri_set(source_name.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_uri_keyframe_scan_get(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_uri_keyframe_scan_get(source_name.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_uri_keyframe_scan_set(NULL, 1) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_source_shared_new(NULL, NULL, false) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_shared_new(source_name.c_str(), NULL, false) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_shared_settings_get(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_shared_settings_get(source_name.c_str(), NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_shared_settings_set(NULL, 1, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_shared_stats_get(NULL, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_shared_stats_get(source_name.c_str(), NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_shared_decoder_count_get(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_source_video_dewarper_add(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_source_video_dewarper_add(source_name.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
@@ -1867,6 +2033,17 @@ SCENARIO( "The Source API checks for NULL input parameters", "[source-api]" )
                 REQUIRE( dsl_source_rtsp_tap_remove(NULL) 
                     == DSL_RESULT_INVALID_INPUT_PARAM );
 
+                REQUIRE( dsl_source_rtsp_encoded_cache_settings_get(NULL,
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_encoded_cache_settings_get(source_name.c_str(),
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_encoded_cache_settings_set(NULL,
+                    0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_encoded_cache_export(NULL,
+                    0, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_encoded_cache_export(source_name.c_str(),
+                    0, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
                 REQUIRE( dsl_source_image_multi_new(NULL, 
                     NULL, fps_n, fps_d) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_source_image_multi_new(source_name.c_str(), 
@@ -24,6 +24,7 @@ THE SOFTWARE.
 
 #include "catch.hpp"
 #include "DslAvFile.h"
+#include "DslMediaInfoCache.h"
 
 using namespace DSL;
 
@@ -122,3 +123,41 @@ SCENARIO( "An AvInputFile utility can read a MJPG file correctly",  "[AvFile]" )
     }
 }
 
+
+SCENARIO( "The MediaInfoCache serves a second probe of an unchanged file from cache",
+    "[AvFile]" )
+{
+    GIVEN( "A file path to an MP4 file and an empty MediaInfoCache" ) 
+    {
+        std::string filepath(
+            "/opt/nvidia/deepstream/deepstream/samples/streams/sample_1080p_h265.mp4");
+            
+        MediaInfoCache::GetCache()->Clear();
+        REQUIRE( MediaInfoCache::GetCache()->GetSize() == 0 );
+    
+        WHEN( "When the file is probed twice" )
+        {
+            dsl_media_info info1{0}, info2{0};
+            REQUIRE( MediaInfoCache::GetCache()->Probe(filepath.c_str(), 
+                info1) == true );
+            REQUIRE( MediaInfoCache::GetCache()->Probe(filepath.c_str(), 
+                info2) == true );
+            
+            THEN( "Both results are correct and only one entry is cached")
+            {
+                REQUIRE( info1.width == 1920 );
+                REQUIRE( info1.height == 1080 );
+                REQUIRE( info1.fps_n == 30 );
+                REQUIRE( info1.fps_d == 1 );
+                REQUIRE( info2.width == info1.width );
+                REQUIRE( info2.height == info1.height );
+                REQUIRE( info2.fps_n == info1.fps_n );
+                REQUIRE( info2.fps_d == info1.fps_d );
+                REQUIRE( MediaInfoCache::GetCache()->GetSize() == 1 );
+                
+                MediaInfoCache::GetCache()->Clear();
+                REQUIRE( MediaInfoCache::GetCache()->GetSize() == 0 );
+            }
+        }
+    }
+}
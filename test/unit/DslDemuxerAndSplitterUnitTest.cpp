@@ -331,6 +331,73 @@ SCENARIO( "Adding a BranchBintr to a DemuxerBintr at a specified stream_id is ma
 }
 
 
+SCENARIO( "Adding a BranchBintr to a linked DemuxerBintr is limited to the provisioned source pads", 
+    "[Tee]" )
+{
+    GIVEN( "A linked DemuxerBintr with one BranchBintr and max-branches beyond one chunk" ) 
+    {
+        std::string demuxerBintrName("demuxer");
+        std::string branchBintrName0("branch0");
+        std::string branchBintrName1("branch1");
+        std::string sinkName0("fake-sink0");
+        std::string sinkName1("fake-sink1");
+        
+        uint maxBranchces(DSL_DEMUXER_SRC_PAD_CHUNK_SIZE*2);
+
+        DSL_DEMUXER_PTR pDemuxerBintr = DSL_DEMUXER_NEW(demuxerBintrName.c_str(), maxBranchces);
+        
+        DSL_BRANCH_PTR pBranchBintr0 = DSL_BRANCH_NEW(branchBintrName0.c_str());
+        DSL_BRANCH_PTR pBranchBintr1 = DSL_BRANCH_NEW(branchBintrName1.c_str());
+
+        DSL_FAKE_SINK_PTR pSinkBintr0 = DSL_FAKE_SINK_NEW(sinkName0.c_str());
+        DSL_FAKE_SINK_PTR pSinkBintr1 = DSL_FAKE_SINK_NEW(sinkName1.c_str());
+
+        REQUIRE( pSinkBintr0->AddToParent(pBranchBintr0) == true );
+        REQUIRE( pSinkBintr1->AddToParent(pBranchBintr1) == true );
+
+        REQUIRE( pDemuxerBintr->AddChildTo(std::dynamic_pointer_cast<Bintr>(
+            pBranchBintr0), 0) == true );
+        
+        // A single stream-id provisions the first chunk of source pads only.
+        REQUIRE( pDemuxerBintr->LinkAll() == true );
+            
+        WHEN( "A BranchBintr is added to a stream_id within the provisioned pads" )
+        {
+            REQUIRE( pDemuxerBintr->AddChildTo(std::dynamic_pointer_cast<Bintr>(
+                pBranchBintr1), DSL_DEMUXER_SRC_PAD_CHUNK_SIZE-1) == true );
+
+            THEN( "The BranchBintr is added and linked correctly" )
+            {
+                REQUIRE( pBranchBintr1->IsInUse() == true );
+                REQUIRE( pBranchBintr1->IsLinkedToSource() == true );
+                REQUIRE( pBranchBintr1->GetRequestPadId() == 
+                    DSL_DEMUXER_SRC_PAD_CHUNK_SIZE-1 );
+                REQUIRE( pDemuxerBintr->GetNumChildren() == 2 );
+            }
+        }
+        WHEN( "A BranchBintr is added to a stream_id that would require a new pad" )
+        {
+            REQUIRE( pDemuxerBintr->AddChildTo(std::dynamic_pointer_cast<Bintr>(
+                pBranchBintr1), DSL_DEMUXER_SRC_PAD_CHUNK_SIZE) == false );
+
+            THEN( "The BranchBintr fails to add and can be added once unlinked" )
+            {
+                REQUIRE( pBranchBintr1->IsInUse() == false );
+                REQUIRE( pBranchBintr1->GetRequestPadId() == -1 );
+                REQUIRE( pDemuxerBintr->GetNumChildren() == 1 );
+
+                pDemuxerBintr->UnlinkAll();
+                REQUIRE( pDemuxerBintr->AddChildTo(std::dynamic_pointer_cast<Bintr>(
+                    pBranchBintr1), DSL_DEMUXER_SRC_PAD_CHUNK_SIZE) == true );
+                REQUIRE( pDemuxerBintr->LinkAll() == true );
+                REQUIRE( pBranchBintr1->IsLinkedToSource() == true );
+                REQUIRE( pBranchBintr1->GetRequestPadId() == 
+                    DSL_DEMUXER_SRC_PAD_CHUNK_SIZE );
+            }
+        }
+    }
+}
+
 SCENARIO( "Multiple Branches linked to a Splitter component can be unlinked correctly", "[Tee]" )
 {
     GIVEN( "A new DemuxerBintr with several new BranchBintrs" ) 
@@ -545,3 +545,90 @@ SCENARIO( "A Source Frame Rate Display is constructed correctly", "[DisplayTypes
         }
     }
 }
+
+SCENARIO( "Static and dynamic Display Types are identified correctly", "[DisplayTypes]" )
+{
+    GIVEN( "A static RGBA Color and a dynamic RGBA Random Color" )
+    {
+        DSL_RGBA_COLOR_PTR pStaticColor = DSL_RGBA_COLOR_NEW("static-color", 
+            0.12, 0.34, 0.56, 0.78);
+        DSL_RGBA_RANDOM_COLOR_PTR pRandomColor = DSL_RGBA_RANDOM_COLOR_NEW(
+            "random-color", DSL_COLOR_HUE_RANDOM, DSL_COLOR_LUMINOSITY_RANDOM, 
+            1.0, 0);
+
+        WHEN( "Display Types are created with each Color" )
+        {
+            DSL_RGBA_RECTANGLE_PTR pStaticRectangle = DSL_RGBA_RECTANGLE_NEW(
+                "static-rectangle", 12, 34, 56, 78, 4, 
+                pStaticColor, false, pStaticColor);
+            DSL_RGBA_RECTANGLE_PTR pDynamicRectangle = DSL_RGBA_RECTANGLE_NEW(
+                "dynamic-rectangle", 12, 34, 56, 78, 4, 
+                pStaticColor, true, pRandomColor);
+            DSL_RGBA_LINE_PTR pDynamicLine = DSL_RGBA_LINE_NEW("dynamic-line", 
+                12, 34, 56, 78, 4, pRandomColor);
+
+            THEN( "Each is identified correctly" )
+            {
+                REQUIRE( pStaticColor->IsStatic() == true );
+                REQUIRE( pRandomColor->IsStatic() == false );
+                REQUIRE( pStaticRectangle->IsStatic() == true );
+                REQUIRE( pDynamicRectangle->IsStatic() == false );
+                REQUIRE( pDynamicLine->IsStatic() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A StaticOverlay is built and added to Display Meta correctly", "[DisplayTypes]" )
+{
+    GIVEN( "A set of static Display Types" )
+    {
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW("my-color", 
+            0.12, 0.34, 0.56, 0.78);
+        DSL_RGBA_FONT_PTR pFont = DSL_RGBA_FONT_NEW("my-font", 
+            "arial", 20, pColor);
+            
+        std::vector<DSL_DISPLAY_TYPE_PTR> displayTypes;
+        displayTypes.push_back(DSL_RGBA_RECTANGLE_NEW("my-rectangle", 
+            12, 34, 56, 78, 4, pColor, false, pColor));
+        displayTypes.push_back(DSL_RGBA_LINE_NEW("my-line", 
+            12, 34, 56, 78, 4, pColor));
+        displayTypes.push_back(DSL_RGBA_TEXT_NEW("my-text", 
+            "legend", 10, 10, pFont, false, pColor));
+            
+        DSL_STATIC_OVERLAY_PTR pStaticOverlay = DSL_STATIC_OVERLAY_NEW();
+        
+        REQUIRE( pStaticOverlay->GetGeneration() == 0 );
+
+        WHEN( "The StaticOverlay is built" )
+        {
+            uint generation = StaticOverlay::GetCurrentGeneration();
+            pStaticOverlay->Build(displayTypes, 1, generation, NULL);
+            
+            REQUIRE( pStaticOverlay->GetGeneration() == generation );
+            
+            THEN( "The prebuilt layer is copied to each frame's Display Meta" )
+            {
+                NvDsDisplayMeta displayMeta{};
+                std::vector<NvDsDisplayMeta*> displayMetaData{&displayMeta};
+                
+                pStaticOverlay->AddMeta(displayMetaData);
+                
+                REQUIRE( displayMeta.num_rects == 1 );
+                REQUIRE( displayMeta.rect_params[0].left == 12 );
+                REQUIRE( displayMeta.num_lines == 1 );
+                REQUIRE( displayMeta.num_labels == 1 );
+                REQUIRE( std::string(displayMeta.text_params[0].display_text) 
+                    == "legend" );
+                    
+                g_free(displayMeta.text_params[0].display_text);
+                g_free(displayMeta.text_params[0].font_params.font_name);
+                
+                // layer must be rebuilt on any change to the overlay path
+                StaticOverlay::Invalidate();
+                REQUIRE( pStaticOverlay->GetGeneration() != 
+                    StaticOverlay::GetCurrentGeneration() );
+            }
+        }
+    }
+}
@@ -127,3 +127,74 @@ SCENARIO( "An Elementr can set and get its caps property", "[Elementr]" )
     }
 }
 
+
+SCENARIO( "A deleted Elementr's element is reused and reset by the ElementPool", 
+    "[Elementr]" )
+{
+    GIVEN( "A Queue Elementr with non-default properties in memory" ) 
+    {
+        std::string queueElementName  = "test-queue";
+        uint maxSizeBuffers(0);
+        uint defaultMaxSizeBuffers(0);
+        
+        ElementPool::GetPool()->Clear();
+        
+        DSL_ELEMENT_PTR pQueue = DSL_ELEMENT_NEW("queue", queueElementName.c_str());
+        pQueue->GetAttribute("max-size-buffers", &defaultMaxSizeBuffers);
+        pQueue->SetAttribute("max-size-buffers", defaultMaxSizeBuffers+10);
+        
+        GstElement* pGstElement = pQueue->GetGstElement();
+            
+        WHEN( "The Queue Elementr is deleted" )
+        {
+            pQueue = nullptr;
+            REQUIRE( ElementPool::GetPool()->GetSize() == 1 );
+            
+            THEN( "The next Queue Elementr reuses the reset element" )
+            {
+                pQueue = DSL_ELEMENT_NEW("queue", queueElementName.c_str());
+                REQUIRE( ElementPool::GetPool()->GetSize() == 0 );
+                REQUIRE( pQueue->GetGstElement() == pGstElement );
+                
+                pQueue->GetAttribute("max-size-buffers", &maxSizeBuffers);
+                REQUIRE( maxSizeBuffers == defaultMaxSizeBuffers );
+            }
+        }
+        WHEN( "A pad-probe is added to the Queue's element outside of the Elementr" )
+        {
+            static boolean probeRemoved(false);
+            probeRemoved = false;
+            
+            GstPad* pStaticPad = gst_element_get_static_pad(pGstElement, "src");
+            gst_pad_add_probe(pStaticPad, GST_PAD_PROBE_TYPE_BUFFER,
+                [](GstPad*, GstPadProbeInfo*, gpointer) -> GstPadProbeReturn
+                    {return GST_PAD_PROBE_OK;}, 
+                NULL, [](gpointer){probeRemoved = true;});
+            gst_object_unref(pStaticPad);
+            
+            pQueue = nullptr;
+            REQUIRE( ElementPool::GetPool()->GetSize() == 1 );
+            
+            THEN( "The pad-probe is removed before the element is reused" )
+            {
+                REQUIRE( probeRemoved == true );
+                
+                pQueue = DSL_ELEMENT_NEW("queue", queueElementName.c_str());
+                REQUIRE( pQueue->GetGstElement() == pGstElement );
+            }
+        }
+        WHEN( "Element pooling is disabled and the Queue Elementr is deleted" )
+        {
+            ElementPool::GetPool()->SetMaxSize(0);
+            pQueue = nullptr;
+            
+            THEN( "The element is not kept by the ElementPool" )
+            {
+                REQUIRE( ElementPool::GetPool()->GetSize() == 0 );
+                
+                ElementPool::GetPool()->SetMaxSize(
+                    DSL_ELEMENT_POOL_DEFAULT_MAX_SIZE);
+            }
+        }
+    }
+}
@@ -130,3 +130,190 @@ SCENARIO( "An OdeAccumulator executes its ODE Actions in the correct order ", "[
         }
     }
 }
+
+SCENARIO( "A new StatsOdeAccumulator is created correctly", "[OdeAccumulator]" )
+{
+    GIVEN( "Attributes for a new StatsOdeAccumulator" ) 
+    {
+        std::string odeAccumulatorName("stats-accumulator");
+        uint window(300), slide(30);
+
+        WHEN( "A new StatsOdeAccumulator is created" )
+        {
+            DSL_ODE_STATS_ACCUMULATOR_PTR pOdeAccumlator = 
+                DSL_ODE_STATS_ACCUMULATOR_NEW(odeAccumulatorName.c_str(),
+                    window, slide);
+
+            THEN( "The StatsOdeAccumulator's memebers are setup and returned correctly" )
+            {
+                REQUIRE( pOdeAccumlator->GetName() == odeAccumulatorName );
+                
+                uint retWindow(0), retSlide(0);
+                pOdeAccumlator->GetWindowSettings(&retWindow, &retSlide);
+                REQUIRE( retWindow == window );
+                REQUIRE( retSlide == slide );
+                
+                // window must be a multiple of slide
+                REQUIRE( pOdeAccumlator->SetWindowSettings(300, 40) == false );
+                
+                // tumbling window when slide is 0
+                REQUIRE( pOdeAccumlator->SetWindowSettings(300, 0) == true );
+                pOdeAccumlator->GetWindowSettings(&retWindow, &retSlide);
+                REQUIRE( retSlide == 300 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A StatsOdeAccumulator closes a tumbling window correctly", "[OdeAccumulator]" )
+{
+    GIVEN( "A new StatsOdeAccumulator and Frame and Object Meta" ) 
+    {
+        std::string odeAccumulatorName("stats-accumulator");
+        std::string odeTriggerName("occurence");
+        std::string source;
+        uint classId(1);
+        
+        DSL_ODE_STATS_ACCUMULATOR_PTR pOdeAccumlator = 
+            DSL_ODE_STATS_ACCUMULATOR_NEW(odeAccumulatorName.c_str(), 2, 0);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, 0);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.frame_num = 1;
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta1 = {0};
+        objectMeta1.class_id = classId;
+        objectMeta1.confidence = 0.5;
+        objectMeta1.rect_params.width = 100;
+        objectMeta1.rect_params.height = 200;
+
+        NvDsObjectMeta objectMeta2 = {0};
+        objectMeta2.class_id = classId;
+        objectMeta2.confidence = 0.7;
+        objectMeta2.rect_params.width = 300;
+        objectMeta2.rect_params.height = 400;
+        
+        WHEN( "Two occurrences are accumulated over a two frame window" )
+        {
+            pOdeAccumlator->HandleOccurrence(&frameMeta, &objectMeta1);
+            pOdeAccumlator->HandleOccurrence(&frameMeta, &objectMeta2);
+            pOdeAccumlator->HandleOccurrences(pOdeTrigger, 
+                NULL, displayMetaData, &frameMeta);
+
+            dsl_ode_stats stats{0};
+            
+            // window is still open after the first frame.
+            REQUIRE( pOdeAccumlator->GetStats(frameMeta.source_id, classId,
+                DSL_ODE_STATS_METRIC_COUNT, &stats) == false );
+
+            // second frame has no occurrences.
+            frameMeta.frame_num = 2;
+            pOdeAccumlator->HandleOccurrences(pOdeTrigger, 
+                NULL, displayMetaData, &frameMeta);
+
+            THEN( "The window's statistics are returned correctly" )
+            {
+                REQUIRE( pOdeAccumlator->GetStats(frameMeta.source_id, classId,
+                    DSL_ODE_STATS_METRIC_COUNT, &stats) == true );
+                REQUIRE( stats.window_end_frame == 2 );
+                REQUIRE( stats.count == 2 );
+                REQUIRE( stats.mean == 1.0 );
+                REQUIRE( stats.variance == 2.0 );
+                REQUIRE( stats.min == 0.0 );
+                REQUIRE( stats.max == 2.0 );
+                REQUIRE( stats.p99 == 2.0 );
+
+                REQUIRE( pOdeAccumlator->GetStats(frameMeta.source_id, classId,
+                    DSL_ODE_STATS_METRIC_WIDTH, &stats) == true );
+                REQUIRE( stats.count == 2 );
+                REQUIRE( stats.mean == 200.0 );
+                REQUIRE( stats.min == 100.0 );
+                REQUIRE( stats.max == 300.0 );
+                
+                // percentiles are approximate, bounded by min and max.
+                REQUIRE( stats.p50 >= 100.0*(1.0 - 0.0625) );
+                REQUIRE( stats.p50 <= 100.0*(1.0 + 0.0625) );
+                
+                // unknown source returns false
+                REQUIRE( pOdeAccumlator->GetStats(0, classId,
+                    DSL_ODE_STATS_METRIC_COUNT, &stats) == false );
+                    
+                pOdeAccumlator->ClearStats();
+                REQUIRE( pOdeAccumlator->GetStats(frameMeta.source_id, classId,
+                    DSL_ODE_STATS_METRIC_COUNT, &stats) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A StatsOdeAccumulator closes a sliding window correctly", "[OdeAccumulator]" )
+{
+    GIVEN( "A new StatsOdeAccumulator and Frame and Object Meta" ) 
+    {
+        std::string odeAccumulatorName("stats-accumulator");
+        std::string odeTriggerName("occurence");
+        std::string source;
+        uint classId(1);
+        
+        // 4 frame window sliding every 2 frames
+        DSL_ODE_STATS_ACCUMULATOR_PTR pOdeAccumlator = 
+            DSL_ODE_STATS_ACCUMULATOR_NEW(odeAccumulatorName.c_str(), 4, 2);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, 0);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.source_id = 0;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+        objectMeta.confidence = 0.5;
+        objectMeta.rect_params.width = 100;
+        objectMeta.rect_params.height = 100;
+        
+        WHEN( "One occurrence is accumulated in each of six frames" )
+        {
+            dsl_ode_stats stats{0};
+            
+            for (uint i = 1; i <= 6; i++)
+            {
+                frameMeta.frame_num = i;
+                objectMeta.confidence = 0.1*i;
+                pOdeAccumlator->HandleOccurrence(&frameMeta, &objectMeta);
+                pOdeAccumlator->HandleOccurrences(pOdeTrigger, 
+                    NULL, displayMetaData, &frameMeta);
+                    
+                // first window closes on frame 4
+                if (i < 4)
+                {
+                    REQUIRE( pOdeAccumlator->GetStats(frameMeta.source_id, 
+                        classId, DSL_ODE_STATS_METRIC_CONFIDENCE, 
+                        &stats) == false );
+                }
+            }
+            THEN( "The last window covers the last four frames only" )
+            {
+                REQUIRE( pOdeAccumlator->GetStats(frameMeta.source_id, classId,
+                    DSL_ODE_STATS_METRIC_CONFIDENCE, &stats) == true );
+                REQUIRE( stats.window_end_frame == 6 );
+                REQUIRE( stats.count == 4 );
+                REQUIRE( stats.min == Approx(0.3) );
+                REQUIRE( stats.max == Approx(0.6) );
+                REQUIRE( stats.mean == Approx(0.45) );
+                
+                REQUIRE( pOdeAccumlator->GetStats(frameMeta.source_id, classId,
+                    DSL_ODE_STATS_METRIC_COUNT, &stats) == true );
+                REQUIRE( stats.count == 4 );
+                REQUIRE( stats.mean == 1.0 );
+                REQUIRE( stats.variance == 0.0 );
+            }
+        }
+    }
+}
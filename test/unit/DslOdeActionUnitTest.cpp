@@ -499,6 +499,130 @@ SCENARIO( "A CustomOdeAction handles an ODE Occurence correctly", "[OdeAction]"
     }
 }
 
+static uint dedupFiredTriggers(0);
+static uint64_t dedupEventId(0);
+
+static void ode_occurrence_counter_cb(uint64_t event_id, const wchar_t* name,
+    void* buffer, void* display_meta, void* frame_meta, void* object_meta, void* client_data)
+{
+    (*(uint*)client_data)++;
+    dedupFiredTriggers = OdeAction::GetFiredTriggers().size();
+    dedupEventId = event_id;
+}
+
+SCENARIO( "An OdeAction with de-duplication handles each object once", "[OdeAction]" )
+{
+    GIVEN( "A CustomOdeAction shared by two Triggers" ) 
+    {
+        std::string source;
+        uint classId(1);
+        uint limit(0);
+        uint count(0);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger1 = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("trigger-1", source.c_str(), classId, limit);
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger2 = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("trigger-2", source.c_str(), classId, limit);
+
+        DSL_ODE_ACTION_CUSTOM_PTR pAction = DSL_ODE_ACTION_CUSTOM_NEW(
+            "ode-action", ode_occurrence_counter_cb, &count);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;
+        frameMeta.frame_num = 1;
+        frameMeta.buf_pts = 0;
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+        objectMeta.object_id = 1; 
+
+        WHEN( "De-duplication is enabled for the same frame only" )
+        {
+            pAction->SetDedupSettings(true, 0, false);
+
+            THEN( "The Action is invoked once per frame" )
+            {
+                pAction->Invoke(pTrigger1, NULL, displayMetaData, 
+                    &frameMeta, &objectMeta);
+                pAction->Invoke(pTrigger2, NULL, displayMetaData, 
+                    &frameMeta, &objectMeta);
+                REQUIRE( count == 1 );
+                
+                frameMeta.frame_num = 2;
+                pAction->Invoke(pTrigger1, NULL, displayMetaData, 
+                    &frameMeta, &objectMeta);
+                REQUIRE( count == 2 );
+            }
+        }
+        WHEN( "De-duplication is enabled with a time window" )
+        {
+            pAction->SetDedupSettings(true, 1000, false);
+
+            THEN( "The Action is invoked once within the window" )
+            {
+                pAction->Invoke(pTrigger1, NULL, displayMetaData, 
+                    &frameMeta, &objectMeta);
+                
+                frameMeta.frame_num = 2;
+                frameMeta.buf_pts = 500*GST_MSECOND;
+                pAction->Invoke(pTrigger2, NULL, displayMetaData, 
+                    &frameMeta, &objectMeta);
+                REQUIRE( count == 1 );
+                
+                frameMeta.frame_num = 3;
+                frameMeta.buf_pts = 1000*GST_MSECOND;
+                pAction->Invoke(pTrigger2, NULL, displayMetaData, 
+                    &frameMeta, &objectMeta);
+                REQUIRE( count == 2 );
+            }
+        }
+        WHEN( "De-duplication is enabled with fan-in" )
+        {
+            pAction->SetDedupSettings(true, 0, true);
+
+            THEN( "The Action is invoked once, by the first Trigger, with all fired Triggers" )
+            {
+                pTrigger1->m_activeEventId = 5;
+                pAction->Invoke(pTrigger1, NULL, displayMetaData, 
+                    &frameMeta, &objectMeta);
+                pTrigger1->m_activeEventId = 7;
+                pAction->Invoke(pTrigger2, NULL, displayMetaData, 
+                    &frameMeta, &objectMeta);
+                REQUIRE( count == 0 );
+                
+                pAction->CompleteDeferredOccurrences(pTrigger2);
+                REQUIRE( count == 0 );
+                
+                pAction->CompleteDeferredOccurrences(pTrigger1);
+                pAction->CompleteDeferredOccurrences(pTrigger1);
+                REQUIRE( count == 1 );
+                REQUIRE( dedupFiredTriggers == 2 );
+                REQUIRE( dedupEventId == 5 );
+                REQUIRE( pTrigger1->m_activeEventId == 7 );
+                REQUIRE( OdeAction::GetFiredTriggers().size() == 0 );
+            }
+        }
+        WHEN( "De-duplication is enabled and a static occurrence is recorded" )
+        {
+            pAction->SetDedupSettings(true, 0, false);
+
+            THEN( "The static occurrence is counted and de-duplicated" )
+            {
+                pAction->InvokeStatic(pTrigger1, &frameMeta);
+                REQUIRE( count == 0 );
+                REQUIRE( pAction->m_invocations == 1 );
+                
+                pAction->Invoke(pTrigger2, NULL, displayMetaData, 
+                    &frameMeta, NULL);
+                REQUIRE( count == 0 );
+                REQUIRE( pAction->m_invocations == 1 );
+                REQUIRE( pAction->m_duplicates == 1 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new MonitorOdeAction is created correctly", "[OdeAction]" )
 {
     GIVEN( "Attributes for a new MonitorOdeAction" ) 
@@ -631,6 +755,161 @@ SCENARIO( "A new CaptureOjbectOdeAction is created correctly", "[OdeAction]" )
     }
 }
 
+/**
+ * @class TestCaptureObjectOdeAction
+ * @brief Capture Object Action that records each flush of its queued Objects
+ * in place of the batched transform, which requires a batched NvBufSurface.
+ */
+class TestCaptureObjectOdeAction : public CaptureObjectOdeAction
+{
+public:
+
+    TestCaptureObjectOdeAction(const char* name, const char* outdir)
+        : CaptureObjectOdeAction(name, outdir)
+    {};
+    
+    bool TransformQueuedObjects()
+    {
+        flushedBuffers.push_back(m_pQueuedObjectsBuffer);
+        flushedBatchIds.push_back(m_queuedObjectsBatchId);
+        flushedRects.push_back(m_queuedObjectRects);
+        flushedCaptureIds.push_back(m_queuedObjectCaptureIds);
+        return true;
+    }
+    
+    std::vector<GstBuffer*> flushedBuffers;
+    std::vector<uint> flushedBatchIds;
+    std::vector<std::vector<NvBufSurfTransformRect>> flushedRects;
+    std::vector<std::vector<uint64_t>> flushedCaptureIds;
+};
+
+SCENARIO( "A CaptureObjectOdeAction queues all Objects in a frame for a single transform", 
+    "[OdeAction]" )
+{
+    GIVEN( "A new CaptureObjectOdeAction and three Objects from the same frame" ) 
+    {
+        std::string actionName("ode-action");
+        std::string outdir("./");
+
+        std::shared_ptr<TestCaptureObjectOdeAction> pAction = 
+            std::shared_ptr<TestCaptureObjectOdeAction>(
+                new TestCaptureObjectOdeAction(actionName.c_str(), outdir.c_str()));
+        
+        GstBuffer* pBuffer = gst_buffer_new();
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.frame_num = 1;
+        frameMeta.batch_id = 0;
+
+        NvDsObjectMeta objectMeta[3] = {0};
+        for (uint i = 0; i < 3; i++)
+        {
+            objectMeta[i].rect_params.left = 10*i;
+            objectMeta[i].rect_params.top = 20*i;
+            objectMeta[i].rect_params.width = 100 + 10*i;
+            objectMeta[i].rect_params.height = 200 + 10*i;
+        }
+
+        WHEN( "The Objects are captured and the frame is post processed" )
+        {
+            for (uint i = 0; i < 3; i++)
+            {
+                pAction->HandleOccurrence(pBuffer, &frameMeta, &objectMeta[i]);
+            }
+            REQUIRE( pAction->flushedRects.size() == 0 );
+            
+            pAction->PostProcessFrame(pBuffer, &frameMeta);
+            
+            THEN( "The Objects are transformed once, with one output per Object" )
+            {
+                REQUIRE( pAction->flushedRects.size() == 1 );
+                REQUIRE( pAction->flushedBuffers[0] == pBuffer );
+                REQUIRE( pAction->flushedRects[0].size() == 3 );
+                REQUIRE( pAction->flushedCaptureIds[0].size() == 3 );
+                REQUIRE( pAction->flushedCaptureIds[0][0] != 
+                    pAction->flushedCaptureIds[0][1] );
+                REQUIRE( pAction->flushedCaptureIds[0][1] != 
+                    pAction->flushedCaptureIds[0][2] );
+                for (uint i = 0; i < 3; i++)
+                {
+                    REQUIRE( pAction->flushedRects[0][i].left == 10*i );
+                    REQUIRE( pAction->flushedRects[0][i].top == 20*i );
+                    REQUIRE( pAction->flushedRects[0][i].width == 100 + 10*i );
+                    REQUIRE( pAction->flushedRects[0][i].height == 200 + 10*i );
+                }
+                
+                // A second post process, with nothing queued, is a NOP
+                pAction->PostProcessFrame(pBuffer, &frameMeta);
+                REQUIRE( pAction->flushedRects.size() == 1 );
+            }
+        }
+        WHEN( "An Object is captured from a different buffer" )
+        {
+            GstBuffer* pNextBuffer = gst_buffer_new();
+            
+            pAction->HandleOccurrence(pBuffer, &frameMeta, &objectMeta[0]);
+            pAction->HandleOccurrence(pBuffer, &frameMeta, &objectMeta[1]);
+            pAction->HandleOccurrence(pNextBuffer, &frameMeta, &objectMeta[2]);
+            
+            THEN( "The Objects queued from the previous buffer are flushed first" )
+            {
+                REQUIRE( pAction->flushedRects.size() == 1 );
+                REQUIRE( pAction->flushedBuffers[0] == pBuffer );
+                REQUIRE( pAction->flushedRects[0].size() == 2 );
+                
+                pAction->PostProcessFrame(pNextBuffer, &frameMeta);
+                REQUIRE( pAction->flushedRects.size() == 2 );
+                REQUIRE( pAction->flushedBuffers[1] == pNextBuffer );
+                REQUIRE( pAction->flushedRects[1].size() == 1 );
+            }
+            gst_buffer_unref(pNextBuffer);
+        }
+        WHEN( "An Object is captured from a different frame in the same batch" )
+        {
+            NvDsFrameMeta nextFrameMeta =  {0};
+            nextFrameMeta.frame_num = 1;
+            nextFrameMeta.batch_id = 1;
+            
+            pAction->HandleOccurrence(pBuffer, &frameMeta, &objectMeta[0]);
+            pAction->HandleOccurrence(pBuffer, &nextFrameMeta, &objectMeta[1]);
+            
+            THEN( "The Objects queued from the previous frame are flushed first" )
+            {
+                REQUIRE( pAction->flushedRects.size() == 1 );
+                REQUIRE( pAction->flushedBatchIds[0] == 0 );
+                REQUIRE( pAction->flushedRects[0].size() == 1 );
+                
+                pAction->PostProcessFrame(pBuffer, &nextFrameMeta);
+                REQUIRE( pAction->flushedRects.size() == 2 );
+                REQUIRE( pAction->flushedBatchIds[1] == 1 );
+                REQUIRE( pAction->flushedRects[1].size() == 1 );
+            }
+        }
+        WHEN( "Objects with a zero width or height crop are captured" )
+        {
+            // Dimensions are rounded down to even values, so 1 becomes 0
+            objectMeta[0].rect_params.width = 0;
+            objectMeta[1].rect_params.height = 1;
+            
+            pAction->HandleOccurrence(pBuffer, &frameMeta, &objectMeta[0]);
+            pAction->HandleOccurrence(pBuffer, &frameMeta, &objectMeta[1]);
+            
+            THEN( "The Objects are skipped and not passed to the transform" )
+            {
+                pAction->PostProcessFrame(pBuffer, &frameMeta);
+                REQUIRE( pAction->flushedRects.size() == 0 );
+                
+                pAction->HandleOccurrence(pBuffer, &frameMeta, &objectMeta[2]);
+                pAction->PostProcessFrame(pBuffer, &frameMeta);
+                REQUIRE( pAction->flushedRects.size() == 1 );
+                REQUIRE( pAction->flushedRects[0].size() == 1 );
+                REQUIRE( pAction->flushedRects[0][0].width == 120 );
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
 static void capture_complete_listener_cb1(dsl_capture_info* info, void* user_data)
 {
     std::cout << "Capture complete lister 1 called \n";
@@ -1946,6 +2225,63 @@ SCENARIO( "A PrintOdeAction handles an ODE Occurence correctly", "[OdeAction]" )
     }
 }
 
+SCENARIO( "A PrintOdeAction summarizes ODE Occurrences correctly", "[OdeAction]" )
+{
+    GIVEN( "A new PrintOdeAction" ) 
+    {
+        std::string triggerName("first-occurence");
+        std::string source;
+        uint classId(1);
+        uint limit(1);
+        
+        std::string actionName = "ode-action";
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(triggerName.c_str(), source.c_str(), classId, limit);
+
+        DSL_ODE_ACTION_PRINT_PTR pAction = 
+            DSL_ODE_ACTION_PRINT_NEW(actionName.c_str(), false);
+
+        uint retInterval(99), retSamples(99);
+        pAction->GetSummarySettings(&retInterval, &retSamples);
+        REQUIRE( retInterval == 0 );
+        REQUIRE( retSamples == 0 );
+
+        WHEN( "The PrintOdeAction's summary settings are set" )
+        {
+            uint interval(1000), samples(1);
+            pAction->SetSummarySettings(interval, samples);
+
+            NvDsFrameMeta frameMeta =  {0};
+            frameMeta.bInferDone = true;
+            frameMeta.frame_num = 444;
+            frameMeta.source_id = 2;
+
+            NvDsObjectMeta objectMeta = {0};
+            objectMeta.class_id = classId;
+            objectMeta.confidence = 0.5;
+            
+            THEN( "The Occurrences are summarized and the summary written" )
+            {
+                pAction->GetSummarySettings(&retInterval, &retSamples);
+                REQUIRE( retInterval == interval );
+                REQUIRE( retSamples == samples );
+
+                // Only the first occurrence is printed in full
+                for (uint i = 0; i < 10; i++)
+                {
+                    frameMeta.frame_num++;
+                    pAction->HandleOccurrence(pTrigger, NULL, 
+                        displayMetaData, &frameMeta, &objectMeta);
+                }
+                REQUIRE( pAction->HandleSummaryTimer() == true );
+                
+                pAction->SetSummarySettings(0, 0);
+            }
+        }
+    }
+}
+
 SCENARIO( "A new RedactOdeAction is created correctly", "[OdeAction]" )
 {
     GIVEN( "Attributes for a new RedactOdeAction" ) 
@@ -148,6 +148,196 @@ SCENARIO( "A TrackedObject generates the correct trace", "[TrackedObject]" )
     }
 }
 
+SCENARIO( "A TrackedObject updates its kinematics correctly", "[TrackedObject]" )
+{
+    GIVEN( "A new TrackedObject" ) 
+    {
+        uint frame_num(1);
+        uint64_t timestamp(1000000000);
+        
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.object_id = 1234; 
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 100;
+
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW("my-color", 
+            0.1, 0.2, 0.3, 0.4);
+
+        std::shared_ptr<TrackedObject> pTrackedObject = std::shared_ptr<TrackedObject>
+            (new TrackedObject(objectMeta.object_id, frame_num, 
+                (NvBbox_Coords*)&objectMeta.rect_params, pColor, 10, timestamp));
+        
+        REQUIRE( pTrackedObject->GetSpeed() == 0 );
+        REQUIRE( pTrackedObject->GetPathLength() == 0 );
+        REQUIRE( pTrackedObject->GetTimeInViewMs() == 0 );
+        REQUIRE( pTrackedObject->EncodeKinematics() == 0 );
+        
+        WHEN( "The TrackedObject moves 10 pixels right every 100 ms" )
+        {
+            for (auto i = 1; i <= 3; i++)
+            {
+                objectMeta.rect_params.left += 10;
+                timestamp += 100000000;
+                pTrackedObject->Update(++frame_num, 
+                    (NvBbox_Coords*)&objectMeta.rect_params, timestamp);
+            }
+            THEN( "The speed, heading, path length and time-in-view are correct" )
+            {
+                REQUIRE( pTrackedObject->GetSpeed() == Approx(100.0) );
+                REQUIRE( pTrackedObject->GetHeading() == Approx(0.0) );
+                REQUIRE( pTrackedObject->GetPathLength() == Approx(30.0) );
+                REQUIRE( pTrackedObject->GetTimeInViewMs() == Approx(300.0) );
+                
+                gint64 kinematics = pTrackedObject->EncodeKinematics();
+                REQUIRE( DSL_OBJECT_KINEMATICS_SPEED(kinematics) == 100 );
+                REQUIRE( DSL_OBJECT_KINEMATICS_HEADING(kinematics) == 0 );
+                REQUIRE( DSL_OBJECT_KINEMATICS_PATH_LENGTH(kinematics) == 30 );
+                REQUIRE( DSL_OBJECT_KINEMATICS_TIME_IN_VIEW(kinematics) == 0 );
+            }
+        }
+        WHEN( "The TrackedObject moves 10 pixels down every 100 ms" )
+        {
+            for (auto i = 1; i <= 3; i++)
+            {
+                objectMeta.rect_params.top += 10;
+                timestamp += 100000000;
+                pTrackedObject->Update(++frame_num, 
+                    (NvBbox_Coords*)&objectMeta.rect_params, timestamp);
+            }
+            THEN( "The heading is 90 degrees clockwise from the x-axis" )
+            {
+                REQUIRE( pTrackedObject->GetSpeed() == Approx(100.0) );
+                REQUIRE( pTrackedObject->GetHeading() == Approx(90.0) );
+
+                gint64 kinematics = pTrackedObject->EncodeKinematics();
+                REQUIRE( DSL_OBJECT_KINEMATICS_HEADING(kinematics) == Approx(90.0) );
+            }
+        }
+        WHEN( "The TrackedObject moves 10 pixels right twice per timestamp" )
+        {
+            for (auto i = 1; i <= 3; i++)
+            {
+                // The first update of each pair repeats the last timestamp.
+                objectMeta.rect_params.left += 10;
+                pTrackedObject->Update(++frame_num, 
+                    (NvBbox_Coords*)&objectMeta.rect_params, timestamp);
+                    
+                objectMeta.rect_params.left += 10;
+                timestamp += 100000000;
+                pTrackedObject->Update(++frame_num, 
+                    (NvBbox_Coords*)&objectMeta.rect_params, timestamp);
+            }
+            THEN( "The displacement is accumulated until the timestamp advances" )
+            {
+                REQUIRE( pTrackedObject->GetSpeed() == Approx(200.0) );
+                REQUIRE( pTrackedObject->GetPathLength() == Approx(60.0) );
+            }
+        }
+    }
+}
+
+SCENARIO( "A polyline is simplified correctly", "[TrackedObject]" )
+{
+    GIVEN( "A polyline with small deviations and one corner" ) 
+    {
+        dsl_coordinate coordinates[] = {{0,0}, {10,1}, {20,0}, {30,1}, {40,0}, 
+            {40,10}, {41,20}, {40,30}};
+        TraceCoordinatesT simplified;
+        
+        WHEN( "The polyline is simplified with a tolerance of 2 pixels" )
+        {
+            TrackedObject::SimplifyPolyline(coordinates, 8, 2, simplified);
+            
+            THEN( "Only the end-points and the corner are retained" )
+            {
+                REQUIRE( simplified.size() == 3 );
+                REQUIRE( simplified[0].x == 0 );
+                REQUIRE( simplified[0].y == 0 );
+                REQUIRE( simplified[1].x == 40 );
+                REQUIRE( simplified[1].y == 0 );
+                REQUIRE( simplified[2].x == 40 );
+                REQUIRE( simplified[2].y == 30 );
+            }
+        }
+        WHEN( "The polyline is simplified with a tolerance below the deviations" )
+        {
+            TrackedObject::SimplifyPolyline(coordinates, 8, 0, simplified);
+            
+            THEN( "All points are retained" )
+            {
+                REQUIRE( simplified.size() == 8 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A TrackedObject caches its simplified trace correctly", "[TrackedObject]" )
+{
+    GIVEN( "A new TrackedObject moving in a straight line" ) 
+    {
+        uint frame_num(1);
+        
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.object_id = 1234; 
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 100;
+
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW("my-color", 
+            0.1, 0.2, 0.3, 0.4);
+
+        std::shared_ptr<TrackedObject> pTrackedObject = std::shared_ptr<TrackedObject>
+            (new TrackedObject(objectMeta.object_id, frame_num, 
+                (NvBbox_Coords*)&objectMeta.rect_params, pColor, 10));
+        
+        for (auto i = 1; i <= 4; i++)
+        {
+            objectMeta.rect_params.left += 10;
+            pTrackedObject->Update(++frame_num, 
+                (NvBbox_Coords*)&objectMeta.rect_params);
+        }
+        DSL_RGBA_MULTI_LINE_PTR pTrace = pTrackedObject->GetSimplifiedTrace(
+            DSL_BBOX_POINT_NORTH_WEST, DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS, 
+            4, 5);
+        REQUIRE( pTrace->num_coordinates == 2 );
+        REQUIRE( pTrace->coordinates[1].x == 50 );
+        
+        WHEN( "The TrackedObject moves by less than the tolerance" )
+        {
+            objectMeta.rect_params.left += 4;
+            pTrackedObject->Update(++frame_num, 
+                (NvBbox_Coords*)&objectMeta.rect_params);
+
+            THEN( "The cached trace is returned" )
+            {
+                pTrace = pTrackedObject->GetSimplifiedTrace(
+                    DSL_BBOX_POINT_NORTH_WEST, 
+                    DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS, 4, 5);
+                REQUIRE( pTrace->num_coordinates == 2 );
+                REQUIRE( pTrace->coordinates[1].x == 50 );
+            }
+        }
+        WHEN( "The TrackedObject moves by more than the tolerance" )
+        {
+            objectMeta.rect_params.left += 10;
+            pTrackedObject->Update(++frame_num, 
+                (NvBbox_Coords*)&objectMeta.rect_params);
+
+            THEN( "The trace is simplified again" )
+            {
+                pTrace = pTrackedObject->GetSimplifiedTrace(
+                    DSL_BBOX_POINT_NORTH_WEST, 
+                    DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS, 4, 5);
+                REQUIRE( pTrace->num_coordinates == 2 );
+                REQUIRE( pTrace->coordinates[1].x == 60 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A TrackedObjects Container is created correctly", "[TrackedObject]" )
 {
     GIVEN( "Attributes for a new TrackedObjects container" ) 
@@ -352,3 +542,72 @@ SCENARIO( "A TrackedObjects Container manages multiple Tracked Objects correctly
     }
 }
 
+
+SCENARIO( "A TrackedObjects Container accounts for its memory correctly", "[TrackedObject]" )
+{
+    GIVEN( "A new TrackedObjects container" ) 
+    {
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.ntp_timestamp = INT64_MAX;
+        frameMeta.frame_num = 1;
+        frameMeta.source_id = 987;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = 432;
+        objectMeta.object_id = 123;
+        objectMeta.rect_params.left = 20;
+        objectMeta.rect_params.top = 20;
+        objectMeta.rect_params.width = 210;
+        objectMeta.rect_params.height = 110;
+
+        uint maxTracePoints(10);
+
+        dsl_memory_stats objectStats{0}, traceStats{0};
+        REQUIRE( MemoryTracker::GetStats(DSL_MEMORY_TAG_TRACKED_OBJECTS, 
+            &objectStats) == true );
+        REQUIRE( MemoryTracker::GetStats(DSL_MEMORY_TAG_TRACE_HISTORY, 
+            &traceStats) == true );
+
+        WHEN( "An Object is tracked" )
+        {
+            std::shared_ptr<TrackedObjects>pTrackedObjectsPerSource = 
+                std::shared_ptr<TrackedObjects>(new TrackedObjects(
+                    maxTracePoints, 0));
+
+            REQUIRE( pTrackedObjectsPerSource->Track(&frameMeta, 
+                &objectMeta, nullptr) != nullptr );
+            
+            THEN( "The live bytes increase and are released on Clear" )
+            {
+                dsl_memory_stats stats{0};
+                REQUIRE( MemoryTracker::GetStats(DSL_MEMORY_TAG_TRACKED_OBJECTS, 
+                    &stats) == true );
+                REQUIRE( stats.live_bytes > objectStats.live_bytes );
+                REQUIRE( stats.peak_bytes >= stats.live_bytes );
+                REQUIRE( MemoryTracker::GetStats(DSL_MEMORY_TAG_TRACE_HISTORY, 
+                    &stats) == true );
+                REQUIRE( stats.live_bytes > traceStats.live_bytes );
+                
+                pTrackedObjectsPerSource->Clear();
+
+                REQUIRE( MemoryTracker::GetStats(DSL_MEMORY_TAG_TRACKED_OBJECTS, 
+                    &stats) == true );
+                REQUIRE( stats.live_bytes == objectStats.live_bytes );
+                REQUIRE( MemoryTracker::GetStats(DSL_MEMORY_TAG_TRACE_HISTORY, 
+                    &stats) == true );
+                REQUIRE( stats.live_bytes == traceStats.live_bytes );
+            }
+        }
+        WHEN( "An invalid memory tag is used" )
+        {
+            dsl_memory_stats stats{0};
+            
+            THEN( "The query fails" )
+            {
+                REQUIRE( MemoryTracker::GetStats(DSL_MEMORY_TAG_COUNT, 
+                    &stats) == false );
+                REQUIRE( MemoryTracker::ResetStats(DSL_MEMORY_TAG_COUNT) == false );
+            }
+        }
+    }
+}
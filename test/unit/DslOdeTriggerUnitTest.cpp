@@ -2986,6 +2986,72 @@ SCENARIO( "A CountOdeTrigger handles ODE Occurrence correctly", "[OdeTrigger]" )
     }
 }
 
+SCENARIO( "A CountOdeTrigger with a class_id mask handles each class separately", 
+    "[OdeTrigger]" )
+{
+    GIVEN( "A new CountOdeTrigger with a class_id mask for classes 1 and 2" ) 
+    {
+        std::string odeTriggerName("count");
+        std::string source;
+        uint classId(DSL_ODE_ANY_CLASS);
+        uint limit(0);
+        uint minimum(2);
+        uint maximum(2);
+
+        std::string odeActionName("action");
+
+        DSL_ODE_TRIGGER_COUNT_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_COUNT_NEW(odeTriggerName.c_str(), source.c_str(), 
+                classId, limit, minimum, maximum);
+
+        DSL_ODE_ACTION_PRINT_PTR pOdeAction = 
+            DSL_ODE_ACTION_PRINT_NEW(odeActionName.c_str(), false);
+            
+        REQUIRE( pOdeTrigger->AddAction(pOdeAction) == true );        
+        
+        pOdeTrigger->SetClassIdMask((1 << 1) | (1 << 2));
+        REQUIRE( pOdeTrigger->GetClassIdMask() == ((1 << 1) | (1 << 2)) );
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.frame_num = 444;
+        frameMeta.ntp_timestamp = INT64_MAX;
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta1 = {0};
+        objectMeta1.class_id = 1;
+        
+        NvDsObjectMeta objectMeta2 = {0};
+        objectMeta2.class_id = 1;
+        
+        NvDsObjectMeta objectMeta3 = {0};
+        objectMeta3.class_id = 2;
+
+        NvDsObjectMeta objectMeta4 = {0};
+        objectMeta4.class_id = 3; // not in the mask
+        
+        WHEN( "Two objects of class 1 and one object of class 2 occur" )
+        {
+            pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+            
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta1) == true );
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta2) == true );
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta3) == true );
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta4) == false );
+            
+            THEN( "Only the class 1 key meets the count criteria" )
+            {
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == 3 );
+                REQUIRE( pOdeTrigger->m_triggered == 1 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A SmallestOdeTrigger handles an ODE Occurrence correctly", "[OdeTrigger]" )
 {
     GIVEN( "A new SmallestOdeTrigger" ) 
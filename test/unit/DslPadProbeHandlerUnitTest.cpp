@@ -168,6 +168,123 @@ SCENARIO( "A OdePadProbeHandler can add and remove an OdeTrigger", "[PadProbeHan
     }
 }
 
+SCENARIO( "A OdePadProbeHandler can swap in a new set of OdeTriggers", "[PadProbeHandler]" )
+{
+    GIVEN( "A new OdePadProbeHandler with two OdeTriggers" ) 
+    {
+        uint classId(1);
+        uint limit(0);
+
+        DSL_PPH_ODE_PTR pPadProbeHandler = DSL_PPH_ODE_NEW("ode-handler");
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTriggerA = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("trigger-a", "", classId, limit);
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTriggerB = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("trigger-b", "", classId+1, limit);
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTriggerC = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("trigger-c", "", classId, limit);
+
+        REQUIRE( pPadProbeHandler->AddChild(pTriggerA) == true );
+        REQUIRE( pPadProbeHandler->AddChild(pTriggerB) == true );
+
+        WHEN( "A new set of Triggers is swapped in" )
+        {
+            std::vector<DSL_BASE_PTR> triggers = {pTriggerB, pTriggerC};
+            
+            REQUIRE( pPadProbeHandler->SwapChildren(triggers) == true );
+            
+            THEN( "The Handler's children are updated correctly" )
+            {
+                REQUIRE( pPadProbeHandler->IsChild(pTriggerA) == false );
+                REQUIRE( pTriggerA->IsInUse() == false );
+                REQUIRE( pPadProbeHandler->IsChild(pTriggerB) == true );
+                REQUIRE( pPadProbeHandler->IsChild(pTriggerC) == true );
+                REQUIRE( pTriggerC->IsParent(pPadProbeHandler) == true );
+                
+                // Trigger C has the same identity as the Trigger it replaces
+                REQUIRE( pTriggerC->HasSameIdentity(pTriggerA) == true );
+                REQUIRE( pTriggerC->HasSameIdentity(pTriggerB) == false );
+                
+                // The swap is applied before the next remove
+                REQUIRE( pPadProbeHandler->RemoveChild(pTriggerC) == true );
+                REQUIRE( pPadProbeHandler->GetNumChildren() == 1 );
+            }
+        }
+        WHEN( "A new set of Triggers with a duplicate Trigger is swapped in" )
+        {
+            std::vector<DSL_BASE_PTR> triggers = {pTriggerC, pTriggerC};
+            
+            THEN( "The swap fails and the Handler's children are unchanged" )
+            {
+                REQUIRE( pPadProbeHandler->SwapChildren(triggers) == false );
+                REQUIRE( pPadProbeHandler->IsChild(pTriggerA) == true );
+                REQUIRE( pPadProbeHandler->IsChild(pTriggerC) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A OdePadProbeHandler pre-filters objects correctly", "[PadProbeHandler]" )
+{
+    GIVEN( "An OdeTrigger and a frame of objects in column-wise form" ) 
+    {
+        uint classId(1);
+        uint limit(0);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("trigger", "", classId, limit);
+            
+        pTrigger->SetMinConfidence(0.5);
+        pTrigger->SetMinDimensions(20, 0);
+        
+        int classIds[] = {1, 1, 1, 2, 1};
+        float confidences[] = {0.9, 0.4, 0.9, 0.9, 0.0};
+        float trackerConfidences[] = {0.0, 0.0, 0.0, 0.0, 0.0};
+        float widths[] = {50, 50, 10, 50, 50};
+        float heights[] = {50, 50, 50, 50, 50};
+        
+        OdeObjectColumns columns = {5, classIds, confidences, 
+            trackerConfidences, widths, heights};
+        uint64_t masks[5] = {0};
+        
+        OdeStaticCriteria criteria;
+        REQUIRE( pTrigger->GetStaticCriteria(criteria) == true );
+
+        WHEN( "The objects are pre-filtered for the Trigger" )
+        {
+            OdePadProbeHandler::PreFilterObjects(criteria, 3, true, 
+                columns, masks);
+            
+            THEN( "Only the objects that meet the criteria have their bit set" )
+            {
+                REQUIRE( masks[0] == (1ULL << 3) );
+                REQUIRE( masks[1] == 0 );
+                REQUIRE( masks[2] == 0 );
+                REQUIRE( masks[3] == 0 );
+                
+                // a confidence of 0 is not tested, as with CheckForMinCriteria
+                REQUIRE( masks[4] == (1ULL << 3) );
+            }
+        }
+        WHEN( "The Trigger requires inference and inference was not done" )
+        {
+            pTrigger->SetInferDoneOnlySetting(true);
+            REQUIRE( pTrigger->GetStaticCriteria(criteria) == true );
+            
+            OdePadProbeHandler::PreFilterObjects(criteria, 3, false, 
+                columns, masks);
+            
+            THEN( "No object has its bit set" )
+            {
+                for (auto i = 0; i < 5; i++)
+                {
+                    REQUIRE( masks[i] == 0 );
+                }
+            }
+        }
+    }
+}
+
 SCENARIO( "A new MeterPadProbeHandler is created correctly", "[PadProbeHandler]" )
 {
     GIVEN( "Attributes for a new MeterPadProbeHandler" ) 
@@ -588,3 +705,177 @@ SCENARIO( "Multiple Pad-Probe-Event-Handlers can be added to the Pads of a Bintr
         } 
     }
 }
+
+static GstPadProbeInfo* new_encoded_cache_probe_info(GstClockTime timestamp, 
+    bool isKeyFrame, gsize size)
+{
+    GstBuffer* pBuffer = gst_buffer_new_allocate(NULL, size, NULL);
+    GST_BUFFER_DTS(pBuffer) = timestamp;
+    if (!isKeyFrame)
+    {
+        GST_BUFFER_FLAG_SET(pBuffer, GST_BUFFER_FLAG_DELTA_UNIT);
+    }
+    GstPadProbeInfo* pInfo = g_new0(GstPadProbeInfo, 1);
+    pInfo->type = GST_PAD_PROBE_TYPE_BUFFER;
+    pInfo->data = pBuffer;
+    return pInfo;
+}
+
+static void add_encoded_cache_buffers(DSL_PPH_ENCODED_CACHE_PTR pPadProbeHandler,
+    uint numSeconds, uint gopSize, uint fps, gsize size)
+{
+    for (uint i = 0; i < numSeconds*fps; i++)
+    {
+        GstPadProbeInfo* pInfo = new_encoded_cache_probe_info(
+            i*GST_SECOND/fps, (i % gopSize) == 0, size);
+        REQUIRE( pPadProbeHandler->HandlePadData(pInfo) == GST_PAD_PROBE_OK );
+        gst_buffer_unref((GstBuffer*)pInfo->data);
+        g_free(pInfo);
+    }
+}
+
+SCENARIO( "A new EncodedCachePadProbeHandler is created correctly", "[PadProbeHandler]" )
+{
+    GIVEN( "Attributes for a new EncodedCachePadProbeHandler" ) 
+    {
+        std::string handlerName("encoded-cache-handler");
+        uint duration(10);
+        uint64_t maxSize(6ULL*1024*1024*1024);
+
+        WHEN( "The PadProbeHandler is created " )
+        {
+            DSL_PPH_ENCODED_CACHE_PTR pPadProbeHandler = 
+                DSL_PPH_ENCODED_CACHE_NEW(handlerName.c_str(), duration, maxSize);
+                
+            THEN( "The correct attribute values are returned" )
+            {
+                uint retDuration(0);
+                uint64_t retMaxSize(0);
+                pPadProbeHandler->GetSettings(&retDuration, &retMaxSize);
+                REQUIRE( retDuration == duration );
+                REQUIRE( retMaxSize == maxSize );
+                
+                uint fillDuration(99);
+                uint64_t fillSize(99);
+                pPadProbeHandler->GetFillLevel(&fillDuration, &fillSize);
+                REQUIRE( fillDuration == 0 );
+                REQUIRE( fillSize == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An EncodedCachePadProbeHandler trims by duration and seeks to the nearest key-frame", 
+    "[PadProbeHandler]" )
+{
+    GIVEN( "A new EncodedCachePadProbeHandler with a 4 second duration" ) 
+    {
+        std::string handlerName("encoded-cache-handler");
+
+        DSL_PPH_ENCODED_CACHE_PTR pPadProbeHandler = 
+            DSL_PPH_ENCODED_CACHE_NEW(handlerName.c_str(), 4, 0);
+
+        WHEN( "10 seconds of 10 fps buffers with a 1 second GOP are added" )
+        {
+            add_encoded_cache_buffers(pPadProbeHandler, 10, 10, 10, 100);
+                
+            THEN( "The cache is trimmed to whole GOPs within the duration" )
+            {
+                uint fillDuration(0);
+                uint64_t fillSize(0);
+                pPadProbeHandler->GetFillLevel(&fillDuration, &fillSize);
+                REQUIRE( fillDuration == 3900 );
+                REQUIRE( fillSize == 40*100 );
+                
+                // 2 seconds requested from last = 9.9s -> key-frame at 7.0s
+                std::vector<GstBuffer*> buffers;
+                REQUIRE( pPadProbeHandler->GetBuffers(2, buffers) == true );
+                REQUIRE( buffers.size() == 30 );
+                REQUIRE( GST_BUFFER_DTS(buffers[0]) == 7*GST_SECOND );
+                REQUIRE( !GST_BUFFER_FLAG_IS_SET(buffers[0], 
+                    GST_BUFFER_FLAG_DELTA_UNIT) );
+                for (auto& ibuffer: buffers)
+                {
+                    gst_buffer_unref(ibuffer);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "An EncodedCachePadProbeHandler trims by memory budget", 
+    "[PadProbeHandler]" )
+{
+    GIVEN( "A new EncodedCachePadProbeHandler with a 2500 byte budget" ) 
+    {
+        std::string handlerName("encoded-cache-handler");
+
+        DSL_PPH_ENCODED_CACHE_PTR pPadProbeHandler = 
+            DSL_PPH_ENCODED_CACHE_NEW(handlerName.c_str(), 60, 2500);
+
+        WHEN( "10 seconds of 10 fps buffers with a 1 second GOP are added" )
+        {
+            add_encoded_cache_buffers(pPadProbeHandler, 10, 10, 10, 100);
+                
+            THEN( "The cache holds only the GOPs that fit in the budget" )
+            {
+                uint fillDuration(0);
+                uint64_t fillSize(0);
+                pPadProbeHandler->GetFillLevel(&fillDuration, &fillSize);
+                REQUIRE( fillSize == 20*100 );
+                
+                pPadProbeHandler->Clear();
+                pPadProbeHandler->GetFillLevel(&fillDuration, &fillSize);
+                REQUIRE( fillDuration == 0 );
+                REQUIRE( fillSize == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An EncodedCachePadProbeHandler never trims the newest key-frame's GOP", 
+    "[PadProbeHandler]" )
+{
+    GIVEN( "A new EncodedCachePadProbeHandler with a 2 second duration and 500 byte budget" ) 
+    {
+        std::string handlerName("encoded-cache-handler");
+
+        DSL_PPH_ENCODED_CACHE_PTR pPadProbeHandler = 
+            DSL_PPH_ENCODED_CACHE_NEW(handlerName.c_str(), 2, 500);
+
+        WHEN( "5 seconds of 10 fps buffers with a single GOP are added" )
+        {
+            add_encoded_cache_buffers(pPadProbeHandler, 5, 50, 10, 100);
+                
+            THEN( "The GOP is kept even though over both duration and budget" )
+            {
+                uint fillDuration(0);
+                uint64_t fillSize(0);
+                pPadProbeHandler->GetFillLevel(&fillDuration, &fillSize);
+                REQUIRE( fillDuration == 4900 );
+                REQUIRE( fillSize == 50*100 );
+                
+                std::vector<GstBuffer*> buffers;
+                REQUIRE( pPadProbeHandler->GetBuffers(1, buffers) == true );
+                REQUIRE( buffers.size() == 50 );
+                for (auto& ibuffer: buffers)
+                {
+                    gst_buffer_unref(ibuffer);
+                }
+            }
+        }
+        WHEN( "5 seconds of 10 fps buffers with a 3 second GOP are added" )
+        {
+            add_encoded_cache_buffers(pPadProbeHandler, 5, 30, 10, 100);
+                
+            THEN( "Only the newest key-frame's GOP is kept" )
+            {
+                uint fillDuration(0);
+                uint64_t fillSize(0);
+                pPadProbeHandler->GetFillLevel(&fillDuration, &fillSize);
+                REQUIRE( fillDuration == 1900 );
+                REQUIRE( fillSize == 20*100 );
+            }
+        }
+    }
+}
@@ -273,6 +273,39 @@ SCENARIO( "A PrimaryGieBintr in a Linked state fails to Set its Interval",  "[Pr
     }
 }
 
+SCENARIO( "A PrimaryGieBintr in a Linked state can Set its Throttle Factor",  "[PrimaryGieBintr]" )
+{
+    GIVEN( "A new PrimaryGieBintr in memory" ) 
+    {
+        DSL_PRIMARY_GIE_PTR pPrimaryGieBintr= 
+            DSL_PRIMARY_GIE_NEW(primaryGieName.c_str(), 
+            inferConfigFile.c_str(), 
+            modelEngineFile.c_str(), interval);
+
+        REQUIRE( pPrimaryGieBintr->GetThrottleFactor() == 1 );
+        
+        WHEN( "The PrimaryGieBintr is Linked and throttled" )
+        {
+            pPrimaryGieBintr->SetBatchSize(1);
+            REQUIRE( pPrimaryGieBintr->LinkAll() == true );
+
+            pPrimaryGieBintr->SetThrottleFactor(4);
+
+            THEN( "The throttle factor is updated and the interval is unchanged" )
+            {
+                REQUIRE( pPrimaryGieBintr->GetThrottleFactor() == 4 );
+                REQUIRE( pPrimaryGieBintr->GetInterval() == interval );
+
+                pPrimaryGieBintr->SetThrottleFactor(0);
+                REQUIRE( pPrimaryGieBintr->GetThrottleFactor() == 1 );
+
+                pPrimaryGieBintr->UnlinkAll();
+                REQUIRE( pPrimaryGieBintr->IsLinked() == false );
+            }
+        }
+    }
+}
+
 SCENARIO( "A PrimaryGieBintr in a Linked state fails to Set its tensor-meta settings correctly",  
     "[PrimaryGieBintr]" )
 {
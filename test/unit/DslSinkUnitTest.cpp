@@ -26,6 +26,7 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslSinkBintr.h"
 #include "DslOdeAction.h"
+#include "DslXWindowEventMgr.h"
 
 using namespace DSL;
 
@@ -126,6 +127,72 @@ SCENARIO( "A new FrameCaptureSinkBintr is created correctly",  "[SinkBintr]" )
     }
 }
 
+static void frame_capture_complete_cb(dsl_frame_capture_result* result, 
+    void* client_data)
+{
+    *(uint*)client_data = result->status;
+}
+
+SCENARIO( "A FrameCaptureSinkBintr completes pending requests without new frames",  
+    "[SinkBintr]" )
+{
+    GIVEN( "A new FrameCaptureSinkBintr in a linked state" ) 
+    {
+        std::string actionName("ode-action");
+        std::string outdir("./");
+
+        DSL_ODE_ACTION_CAPTURE_FRAME_PTR pAction = 
+            DSL_ODE_ACTION_CAPTURE_FRAME_NEW(actionName.c_str(), 
+                outdir.c_str());
+
+        std::string sinkName("frame-capture-sink");
+
+        DSL_FRAME_CAPTURE_SINK_PTR pSinkBintr =
+            DSL_FRAME_CAPTURE_SINK_NEW(sinkName.c_str(), pAction);
+            
+        REQUIRE( pSinkBintr->LinkAll() == true );
+        
+        uint status(UINT_MAX);
+        uint64_t requestId(0);
+
+        WHEN( "A request with a timeout passes its deadline" )
+        {
+            REQUIRE( pSinkBintr->Request(DSL_FRAME_CAPTURE_NEXT_FRAME, 
+                DSL_FRAME_CAPTURE_OUTPUT_BUFFER, 1, frame_capture_complete_cb, 
+                &status, &requestId) == true );
+            
+            // No frames arrive, only the expiry timer can complete the request
+            for (uint i=0; i<DSL_FRAME_CAPTURE_EXPIRY_PERIOD_MS*2; i+=10)
+            {
+                g_main_context_iteration(NULL, FALSE);
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            
+            THEN( "The expiry timer completes the request as expired" )
+            {
+                // Wait for the worker pool to complete the request
+                pSinkBintr = nullptr;
+                REQUIRE( status == DSL_FRAME_CAPTURE_STATUS_EXPIRED );
+            }
+        }
+        WHEN( "A request without a timeout is pending when the Sink is unlinked" )
+        {
+            REQUIRE( pSinkBintr->Request(DSL_FRAME_CAPTURE_NEXT_FRAME, 
+                DSL_FRAME_CAPTURE_OUTPUT_BUFFER, 0, frame_capture_complete_cb, 
+                &status, &requestId) == true );
+            
+            pSinkBintr->UnlinkAll();
+            
+            THEN( "The request is completed as canceled" )
+            {
+                // Wait for the worker pool to complete the request
+                pSinkBintr = nullptr;
+                REQUIRE( status == DSL_FRAME_CAPTURE_STATUS_CANCELED );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new CustomSinkBintr is created correctly",  "[SinkBintr]" )
 {
     GIVEN( "Attributes for a new Custom Sink" ) 
@@ -725,6 +792,46 @@ SCENARIO( "Multiple EGL SInks can create their XWindow correctly",
     }
 }
 
+SCENARIO( "Multiple EGL Sinks share a single XWindowEventMgr XDisplay", 
+    "[SinkBintr]" )
+{
+    GIVEN( "Two EglSinkBintr's with valid XWindow dimensions" ) 
+    {
+        std::string sinkName1("egl-sink-1");
+        std::string sinkName2("egl-sink-2");
+        uint offsetX(0);
+        uint offsetY(0);
+        uint initSinkW(300);
+        uint initSinkH(200);
+        std::shared_ptr<DslMutex> pSharedClientMutex = 
+            std::shared_ptr<DslMutex>(new DslMutex());
+
+        DSL_EGL_SINK_PTR pSinkBintr1 = DSL_EGL_SINK_NEW(
+            sinkName1.c_str(), offsetX, offsetY, initSinkW, initSinkH);
+        DSL_EGL_SINK_PTR pSinkBintr2 = DSL_EGL_SINK_NEW(
+            sinkName2.c_str(), offsetX, offsetY, initSinkW, initSinkH);
+
+        REQUIRE( XWindowEventMgr::GetMgr()->GetNumWindowSinks() == 0 );
+
+        WHEN( "Both EglSinkBintr's XWindows are created" )
+        {
+            REQUIRE( pSinkBintr1->PrepareWindowHandle(pSharedClientMutex) == true );
+            REQUIRE( pSinkBintr2->PrepareWindowHandle(pSharedClientMutex) == true );
+                
+            THEN( "Both are added to the XWindowEventMgr and removed on delete" )
+            {
+                REQUIRE( XWindowEventMgr::GetMgr()->GetNumWindowSinks() == 2 );
+                REQUIRE( pSinkBintr1->GetHandle() != pSinkBintr2->GetHandle() );
+
+                pSinkBintr1 = nullptr;
+                REQUIRE( XWindowEventMgr::GetMgr()->GetNumWindowSinks() == 1 );
+                pSinkBintr2 = nullptr;
+                REQUIRE( XWindowEventMgr::GetMgr()->GetNumWindowSinks() == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "Multiple EGL SInks can create their XWindow correctly in full screen mode", 
     "[SinkBintr]" )
 {
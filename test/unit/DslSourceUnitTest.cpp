@@ -26,6 +26,7 @@ THE SOFTWARE.
 #include "DslApi.h"
 #include "DslSinkBintr.h"
 #include "DslSourceBintr.h"
+#include "DslSourceRegistry.h"
 #include "DslPipelineSourcesBintr.h"
 
 static std::string sourceName("test-source");
@@ -150,6 +151,162 @@ SCENARIO( "A AppSourceBintr can UnlinkAll all child Elementrs correctly",  "[Sou
     }
 }
 
+/**
+ * @brief Gets the width and height fixed by a VideoSourceBintr's buffer-out
+ * caps filter, which constrain the caps negotiated by the Video Converter.
+ * @param[in] pSourceBintr Source to get the buffer-out caps dimensions for.
+ * @param[out] width fixed width, 0 if not fixed by the caps.
+ * @param[out] height fixed height, 0 if not fixed by the caps.
+ */
+static void get_buffer_out_caps_dimensions(DSL_VIDEO_SOURCE_PTR pSourceBintr,
+    int* width, int* height)
+{
+    std::string capsFilterName(pSourceBintr->GetName() + "-capsfilter-vidconv");
+    
+    GstElement* pCapsFilter = gst_bin_get_by_name(
+        GST_BIN(pSourceBintr->GetGstElement()), capsFilterName.c_str());
+    REQUIRE( pCapsFilter != NULL );
+    
+    GstCaps* pCaps(NULL);
+    g_object_get(pCapsFilter, "caps", &pCaps, NULL);
+    REQUIRE( pCaps != NULL );
+    
+    GstStructure* pStructure = gst_caps_get_structure(pCaps, 0);
+    *width = 0;
+    *height = 0;
+    gst_structure_get_int(pStructure, "width", width);
+    gst_structure_get_int(pStructure, "height", height);
+    
+    gst_caps_unref(pCaps);
+    gst_object_unref(pCapsFilter);
+}
+
+SCENARIO( "A VideoSourceBintr derives its buffer-out caps from its crop and orientation",
+    "[SourceBintr]" )
+{
+    GIVEN( "A new AppSourceBintr in memory" ) 
+    {
+        boolean isLive(true);
+        int capsWidth(0), capsHeight(0);
+        
+        DSL_APP_SOURCE_PTR pSourceBintr = DSL_APP_SOURCE_NEW(
+            sourceName.c_str(), isLive, "I420", width, height, fps_n, fps_d);
+
+        WHEN( "No crop, orientation, or dimensions are set" )
+        {
+            get_buffer_out_caps_dimensions(pSourceBintr, &capsWidth, &capsHeight);
+            
+            THEN( "The buffer-out caps do not fix the dimensions" )
+            {
+                REQUIRE( capsWidth == 0 );
+                REQUIRE( capsHeight == 0 );
+            }
+        }
+        WHEN( "A source crop only is set" )
+        {
+            REQUIRE( pSourceBintr->SetBufferOutCropRectangle(
+                DSL_VIDEO_CROP_AT_SRC, 100, 200, 640, 360) == true );
+            get_buffer_out_caps_dimensions(pSourceBintr, &capsWidth, &capsHeight);
+            
+            THEN( "The buffer-out caps are set to the crop dimensions" )
+            {
+                REQUIRE( capsWidth == 640 );
+                REQUIRE( capsHeight == 360 );
+            }
+        }
+        WHEN( "A destination crop only is set" )
+        {
+            REQUIRE( pSourceBintr->SetBufferOutCropRectangle(
+                DSL_VIDEO_CROP_AT_DEST, 100, 200, 640, 360) == true );
+            get_buffer_out_caps_dimensions(pSourceBintr, &capsWidth, &capsHeight);
+            
+            THEN( "The buffer-out caps do not fix the dimensions" )
+            {
+                REQUIRE( capsWidth == 0 );
+                REQUIRE( capsHeight == 0 );
+            }
+        }
+        WHEN( "A rotate-90 orientation only is set" )
+        {
+            REQUIRE( pSourceBintr->SetBufferOutOrientation(
+                DSL_VIDEO_ORIENTATION_ROTATE_CLOCKWISE_90) == true );
+            get_buffer_out_caps_dimensions(pSourceBintr, &capsWidth, &capsHeight);
+            
+            THEN( "The buffer-out caps do not fix the dimensions" )
+            {
+                // The Video Converter negotiates the transposed input size.
+                REQUIRE( capsWidth == 0 );
+                REQUIRE( capsHeight == 0 );
+            }
+        }
+        WHEN( "A source crop and a rotate-90 orientation are set" )
+        {
+            REQUIRE( pSourceBintr->SetBufferOutCropRectangle(
+                DSL_VIDEO_CROP_AT_SRC, 100, 200, 640, 360) == true );
+            REQUIRE( pSourceBintr->SetBufferOutOrientation(
+                DSL_VIDEO_ORIENTATION_ROTATE_CLOCKWISE_90) == true );
+            get_buffer_out_caps_dimensions(pSourceBintr, &capsWidth, &capsHeight);
+            
+            THEN( "The buffer-out caps are set to the swapped crop dimensions" )
+            {
+                REQUIRE( capsWidth == 360 );
+                REQUIRE( capsHeight == 640 );
+            }
+        }
+        WHEN( "A rotate-270 orientation and then a source crop are set" )
+        {
+            REQUIRE( pSourceBintr->SetBufferOutOrientation(
+                DSL_VIDEO_ORIENTATION_ROTATE_COUNTER_CLOCKWISE_90) == true );
+            REQUIRE( pSourceBintr->SetBufferOutCropRectangle(
+                DSL_VIDEO_CROP_AT_SRC, 100, 200, 640, 360) == true );
+            get_buffer_out_caps_dimensions(pSourceBintr, &capsWidth, &capsHeight);
+            
+            THEN( "The buffer-out caps are set to the swapped crop dimensions" )
+            {
+                REQUIRE( capsWidth == 360 );
+                REQUIRE( capsHeight == 640 );
+            }
+        }
+        WHEN( "A rotate-180 orientation and a source crop are set" )
+        {
+            REQUIRE( pSourceBintr->SetBufferOutOrientation(
+                DSL_VIDEO_ORIENTATION_ROTATE_180) == true );
+            REQUIRE( pSourceBintr->SetBufferOutCropRectangle(
+                DSL_VIDEO_CROP_AT_SRC, 100, 200, 640, 360) == true );
+            get_buffer_out_caps_dimensions(pSourceBintr, &capsWidth, &capsHeight);
+            
+            THEN( "The buffer-out caps are set to the unswapped crop dimensions" )
+            {
+                REQUIRE( capsWidth == 640 );
+                REQUIRE( capsHeight == 360 );
+            }
+        }
+        WHEN( "Explicit dimensions are set with a source crop and rotate-90" )
+        {
+            REQUIRE( pSourceBintr->SetBufferOutCropRectangle(
+                DSL_VIDEO_CROP_AT_SRC, 100, 200, 640, 360) == true );
+            REQUIRE( pSourceBintr->SetBufferOutOrientation(
+                DSL_VIDEO_ORIENTATION_ROTATE_CLOCKWISE_90) == true );
+            REQUIRE( pSourceBintr->SetBufferOutDimensions(1280, 720) == true );
+            get_buffer_out_caps_dimensions(pSourceBintr, &capsWidth, &capsHeight);
+            
+            THEN( "The explicit dimensions are used, unswapped" )
+            {
+                REQUIRE( capsWidth == 1280 );
+                REQUIRE( capsHeight == 720 );
+                
+                // And remain in use when the crop is updated.
+                REQUIRE( pSourceBintr->SetBufferOutCropRectangle(
+                    DSL_VIDEO_CROP_AT_SRC, 0, 0, 320, 240) == true );
+                get_buffer_out_caps_dimensions(pSourceBintr, 
+                    &capsWidth, &capsHeight);
+                REQUIRE( capsWidth == 1280 );
+                REQUIRE( capsHeight == 720 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new CustomSourceBintr is created correctly",  "[SourceBintr]" )
 {
     GIVEN( "A attributes for a new CustomSourceBintr" ) 
@@ -1592,3 +1749,42 @@ SCENARIO( "Multiple DuplicateSourceBintrs can be added and linked with a VideoSo
         }
     }
 }
+
+SCENARIO( "Two SharedSourceBintrs for the same URI share a single decoder",  
+    "[SourceBintr]" )
+{
+    GIVEN( "Two new SharedSourceBintrs for the same URI" ) 
+    {
+        std::string sharedUri("file://" + uri);
+        
+        DSL_SHARED_SOURCE_PTR pSourceBintr1 = DSL_SHARED_SOURCE_NEW(
+            "shared-source-1", sharedUri.c_str(), false);
+        DSL_SHARED_SOURCE_PTR pSourceBintr2 = DSL_SHARED_SOURCE_NEW(
+            "shared-source-2", sharedUri.c_str(), false);
+
+        uint queueSize(0), maxRate(99);
+        pSourceBintr1->GetSharedSettings(&queueSize, &maxRate);
+        REQUIRE( queueSize == DSL_SHARED_SOURCE_DEFAULT_QUEUE_SIZE );
+        REQUIRE( maxRate == 0 );
+        REQUIRE( pSourceBintr1->SetSharedSettings(0, 5) == false );
+        
+        REQUIRE( SourceRegistry::GetRegistry()->GetNumDecoders() == 0 );
+
+        WHEN( "Both SharedSourceBintrs are linked" )
+        {
+            REQUIRE( pSourceBintr1->LinkAll() == true );
+            REQUIRE( pSourceBintr2->LinkAll() == true );
+
+            THEN( "A single decoder is in use until both are unlinked" )
+            {
+                REQUIRE( SourceRegistry::GetRegistry()->GetNumDecoders() == 1 );
+                
+                pSourceBintr1->UnlinkAll();
+                REQUIRE( SourceRegistry::GetRegistry()->GetNumDecoders() == 1 );
+
+                pSourceBintr2->UnlinkAll();
+                REQUIRE( SourceRegistry::GetRegistry()->GetNumDecoders() == 0 );
+            }
+        }
+    }
+}
@@ -0,0 +1,142 @@
+/*
+The MIT License
+
+Copyright (c) 2021, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "Dsl.h"
+#include "DslApi.h"
+
+static std::wstring meta_stream_pph_name(L"meta-stream-pph");
+static std::wstring meta_stream_path(L"/ws/meta");
+
+SCENARIO( "A new Meta-Stream PPH is created correctly", "[meta-stream-pph-api]" )
+{
+    GIVEN( "Attributes for a new Meta-Stream PPH" )
+    {
+        REQUIRE( dsl_pph_list_size() == 0 );
+
+        WHEN( "A new Meta-Stream PPH is created" )
+        {
+            REQUIRE( dsl_pph_meta_stream_new(meta_stream_pph_name.c_str(),
+                meta_stream_path.c_str(), 30, 10) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct attribute values are returned" )
+            {
+                uint key_frame_interval(0), max_rate(0), clients(99);
+                uint64_t sent(99), dropped(99);
+                REQUIRE( dsl_pph_meta_stream_key_frame_interval_get(
+                    meta_stream_pph_name.c_str(), &key_frame_interval) 
+                        == DSL_RESULT_SUCCESS );
+                REQUIRE( key_frame_interval == 30 );
+                REQUIRE( dsl_pph_meta_stream_max_rate_get(
+                    meta_stream_pph_name.c_str(), &max_rate) == DSL_RESULT_SUCCESS );
+                REQUIRE( max_rate == 10 );
+                REQUIRE( dsl_pph_meta_stream_stats_get(meta_stream_pph_name.c_str(),
+                    &clients, &sent, &dropped) == DSL_RESULT_SUCCESS );
+                REQUIRE( clients == 0 );
+                REQUIRE( sent == 0 );
+                REQUIRE( dropped == 0 );
+
+                // A second Handler on the same path must fail
+                REQUIRE( dsl_pph_meta_stream_new(L"second-pph",
+                    meta_stream_path.c_str(), 30, 10) 
+                        == DSL_RESULT_PPH_THREW_EXCEPTION );
+
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Meta-Stream PPH's settings can be updated", "[meta-stream-pph-api]" )
+{
+    GIVEN( "A new Meta-Stream PPH" )
+    {
+        REQUIRE( dsl_pph_meta_stream_new(meta_stream_pph_name.c_str(),
+            meta_stream_path.c_str(), 30, 10) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Meta-Stream PPH's settings are updated" )
+        {
+            REQUIRE( dsl_pph_meta_stream_key_frame_interval_set(
+                meta_stream_pph_name.c_str(), 15) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pph_meta_stream_max_rate_set(
+                meta_stream_pph_name.c_str(), 0) == DSL_RESULT_SUCCESS );
+
+            // A key-frame interval of 0 is invalid
+            REQUIRE( dsl_pph_meta_stream_key_frame_interval_set(
+                meta_stream_pph_name.c_str(), 0) == DSL_RESULT_PPH_SET_FAILED );
+
+            THEN( "The correct values are returned on get" )
+            {
+                uint key_frame_interval(0), max_rate(99);
+                REQUIRE( dsl_pph_meta_stream_key_frame_interval_get(
+                    meta_stream_pph_name.c_str(), &key_frame_interval) 
+                        == DSL_RESULT_SUCCESS );
+                REQUIRE( key_frame_interval == 15 );
+                REQUIRE( dsl_pph_meta_stream_max_rate_get(
+                    meta_stream_pph_name.c_str(), &max_rate) == DSL_RESULT_SUCCESS );
+                REQUIRE( max_rate == 0 );
+
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Meta-Stream PPH API checks for NULL input parameters", "[meta-stream-pph-api]" )
+{
+    GIVEN( "An empty list of Pad Probe Handlers" )
+    {
+        uint uint_arg(0);
+        uint64_t uint64_arg(0);
+
+        WHEN( "When NULL pointers are used as input" )
+        {
+            THEN( "The API returns DSL_RESULT_INVALID_INPUT_PARAM in all cases" )
+            {
+                REQUIRE( dsl_pph_meta_stream_new(NULL, meta_stream_path.c_str(),
+                    30, 10) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meta_stream_new(meta_stream_pph_name.c_str(), 
+                    NULL, 30, 10) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meta_stream_key_frame_interval_get(NULL,
+                    &uint_arg) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meta_stream_key_frame_interval_get(
+                    meta_stream_pph_name.c_str(), NULL) 
+                        == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meta_stream_key_frame_interval_set(NULL,
+                    1) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meta_stream_max_rate_get(NULL,
+                    &uint_arg) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meta_stream_max_rate_set(NULL,
+                    1) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meta_stream_stats_get(NULL,
+                    &uint_arg, &uint64_arg, &uint64_arg) 
+                        == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meta_stream_stats_get(meta_stream_pph_name.c_str(),
+                    NULL, &uint64_arg, &uint64_arg) 
+                        == DSL_RESULT_INVALID_INPUT_PARAM );
+            }
+        }
+    }
+}
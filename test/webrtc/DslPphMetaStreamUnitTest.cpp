@@ -0,0 +1,140 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslMetaStreamPadProbeHandler.h"
+
+using namespace DSL;
+
+static std::string metaStreamPphName("meta-stream-pph");
+static std::string metaStreamPath("/ws/meta");
+
+static void send_subscription(DSL_PPH_META_STREAM_PTR pHandler, 
+    MetaStreamClient* pClient, const std::string& subscription)
+{
+    GBytes* pMessage = g_bytes_new(subscription.c_str(), subscription.size());
+    pHandler->OnMessage(pClient, SOUP_WEBSOCKET_DATA_TEXT, pMessage);
+    g_bytes_unref(pMessage);
+}
+
+SCENARIO( "A MetaStreamPadProbeHandler handles a valid subscription message",
+    "[MetaStreamPadProbeHandler]" )
+{
+    GIVEN( "A new MetaStreamPadProbeHandler and client" )
+    {
+        DSL_PPH_META_STREAM_PTR pHandler = DSL_PPH_META_STREAM_NEW(
+            metaStreamPphName.c_str(), metaStreamPath.c_str(), 30, 10);
+
+        MetaStreamClient client{};
+        client.pHandler = pHandler.get();
+        client.maxRate = 10;
+
+        WHEN( "A valid subscription message is received" )
+        {
+            send_subscription(pHandler, &client, 
+                "{\"sources\":[0,2], \"topics\":[\"objects\",\"occurrences\"], "
+                "\"maxRate\":5}");
+
+            THEN( "The client's subscription is updated correctly" )
+            {
+                REQUIRE( client.sources.size() == 2 );
+                REQUIRE( client.sources.count(0) == 1 );
+                REQUIRE( client.sources.count(2) == 1 );
+                REQUIRE( client.topics == 
+                    ((1 << (DSL_META_STREAM_MSG_TYPE_OBJECTS-1)) |
+                    (1 << (DSL_META_STREAM_MSG_TYPE_OCCURRENCES-1))) );
+                REQUIRE( client.maxRate == 5 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A MetaStreamPadProbeHandler skips invalid subscription values",
+    "[MetaStreamPadProbeHandler]" )
+{
+    GIVEN( "A new MetaStreamPadProbeHandler and client" )
+    {
+        DSL_PPH_META_STREAM_PTR pHandler = DSL_PPH_META_STREAM_NEW(
+            metaStreamPphName.c_str(), metaStreamPath.c_str(), 30, 10);
+
+        MetaStreamClient client{};
+        client.pHandler = pHandler.get();
+        client.maxRate = 10;
+
+        WHEN( "The topics contain non-string elements" )
+        {
+            send_subscription(pHandler, &client, 
+                "{\"topics\":[1, null, {}, [], \"objects\"]}");
+
+            THEN( "Only the valid topic is subscribed to" )
+            {
+                REQUIRE( client.topics == 
+                    (1 << (DSL_META_STREAM_MSG_TYPE_OBJECTS-1)) );
+            }
+        }
+        WHEN( "The sources contain non-integer and negative elements" )
+        {
+            send_subscription(pHandler, &client, 
+                "{\"sources\":[\"0\", null, 1.5, -1, {}, 3]}");
+
+            THEN( "Only the valid source-id is subscribed to" )
+            {
+                REQUIRE( client.sources.size() == 1 );
+                REQUIRE( client.sources.count(3) == 1 );
+            }
+        }
+        WHEN( "The topics and sources are not arrays" )
+        {
+            send_subscription(pHandler, &client, 
+                "{\"sources\":\"0\", \"topics\":\"objects\"}");
+
+            THEN( "No sources or topics are subscribed to" )
+            {
+                REQUIRE( client.sources.size() == 0 );
+                REQUIRE( client.topics == 0 );
+            }
+        }
+        WHEN( "The max-rate is not a non-negative integer" )
+        {
+            send_subscription(pHandler, &client, "{\"maxRate\":\"5\"}");
+            send_subscription(pHandler, &client, "{\"maxRate\":null}");
+            send_subscription(pHandler, &client, "{\"maxRate\":-5}");
+
+            THEN( "The max-rate is unchanged" )
+            {
+                REQUIRE( client.maxRate == 10 );
+            }
+        }
+        WHEN( "The message is not a JSON object" )
+        {
+            send_subscription(pHandler, &client, "[1,2,3]");
+            send_subscription(pHandler, &client, "not-json");
+
+            THEN( "The client's subscription is unchanged" )
+            {
+                REQUIRE( client.maxRate == 10 );
+            }
+        }
+    }
+}